@@ -0,0 +1,402 @@
+#pragma once
+
+#include "PerfCounters.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Calibrated benchmarks with machine readable results. FAST_BER_BENCHMARK(name) { body } runs the body in samples of a
+// calibrated number of iterations, each lasting at least BenchmarkRunner::sample_seconds, and records the median and
+// the median absolute deviation of the time per iteration. The benchmark executables write the results as JSON with
+// --json FILE, and compare them with the results of an earlier run with --compare FILE. With --perf, hardware counters
+// are read around the samples. FAST_BER_BENCHMARK_PDUS(name, pdus, bytes) gives the PDUs and bytes processed by each
+// run of the body, so counts are also reported per PDU and per byte.
+#define FAST_BER_BENCHMARK(name) for (BenchmarkRunner benchmark_runner(name); benchmark_runner.next();)
+#define FAST_BER_BENCHMARK_PDUS(name, pdus, bytes)                                                                     \
+    for (BenchmarkRunner benchmark_runner(name, pdus, bytes); benchmark_runner.next();)
+
+struct BenchmarkResult
+{
+    std::string    name;
+    uint64_t       iterations; // Iterations of each sample
+    uint64_t       samples;
+    double         median_ns; // Times are per iteration
+    double         mad_ns;    // Median absolute deviation
+    double         mean_ns;
+    double         min_ns;
+    uint64_t       pdus;   // Per iteration, zero if not given
+    uint64_t       bytes;  // Per iteration, zero if not given
+    HardwareCounts counts; // Per iteration, none are available unless counters are enabled
+};
+
+// Results of every benchmark run by the program, in order
+inline std::vector<BenchmarkResult>& benchmark_results()
+{
+    static std::vector<BenchmarkResult> results;
+    return results;
+}
+
+inline double median(std::vector<double> values)
+{
+    if (values.empty())
+    {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    const size_t middle = values.size() / 2;
+    return values.size() % 2 == 1 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+}
+
+inline BenchmarkResult summarise_benchmark(const std::string& name, uint64_t iterations,
+                                           const std::vector<double>& sample_ns)
+{
+    BenchmarkResult result = {name, iterations, sample_ns.size(), median(sample_ns), 0.0, 0.0, 0.0, 0, 0, {}};
+
+    std::vector<double> deviations;
+    for (double ns : sample_ns)
+    {
+        deviations.push_back(std::abs(ns - result.median_ns));
+        result.mean_ns += ns / sample_ns.size();
+    }
+    result.mad_ns = median(deviations);
+    result.min_ns = sample_ns.empty() ? 0.0 : *std::min_element(sample_ns.begin(), sample_ns.end());
+    return result;
+}
+
+// Runs the body of FAST_BER_BENCHMARK. The number of iterations doubles until a batch lasts a sample, the last batch of
+// calibration is the first sample. Sampling stops after min_samples once sampling_seconds have passed.
+class BenchmarkRunner
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    constexpr static double   sample_seconds   = 0.01;
+    constexpr static double   sampling_seconds = 0.5;
+    constexpr static size_t   min_samples      = 5;
+    constexpr static size_t   max_samples      = 50;
+    constexpr static uint64_t max_iterations   = uint64_t(1) << 40;
+
+    explicit BenchmarkRunner(std::string name, uint64_t pdus = 0, uint64_t bytes = 0)
+        : m_name(std::move(name)),
+          m_pdus(pdus),
+          m_bytes(bytes),
+          m_counters(hardware_counters_enabled() ? new PerfCounters() : nullptr)
+    {
+    }
+
+    // True while the body should be run again
+    bool next()
+    {
+        if (m_remaining > 0)
+        {
+            m_remaining--;
+            return true;
+        }
+
+        const Clock::time_point end = Clock::now();
+        if (m_counters)
+        {
+            m_batch_counts = m_counters->stop();
+        }
+        if (m_started && !end_batch(std::chrono::duration<double>(end - m_batch_start).count()))
+        {
+            report();
+            return false;
+        }
+        m_started   = true;
+        m_remaining = m_iterations - 1;
+        if (m_counters)
+        {
+            m_counters->start();
+        }
+        m_batch_start = Clock::now();
+        return true;
+    }
+
+  private:
+    // Returns false once enough samples are taken
+    bool end_batch(double seconds)
+    {
+        if (m_calibrating)
+        {
+            if (seconds < sample_seconds && m_iterations < max_iterations)
+            {
+                m_iterations *= 2;
+                return true;
+            }
+            m_calibrating = false;
+        }
+
+        m_sample_ns.push_back(seconds * 1e9 / m_iterations);
+        m_sampled_seconds += seconds;
+        // Counters are available if counted in every sample
+        for (size_t i = 0; i < hardware_counter_count; i++)
+        {
+            m_counts.available[i] = m_batch_counts.available[i] && (m_sample_ns.size() == 1 || m_counts.available[i]);
+            m_counts.values[i] += m_batch_counts.values[i];
+        }
+        return m_sample_ns.size() < min_samples ||
+               (m_sample_ns.size() < max_samples && m_sampled_seconds < sampling_seconds);
+    }
+
+    void report()
+    {
+        BenchmarkResult result = summarise_benchmark(m_name, m_iterations, m_sample_ns);
+        result.pdus            = m_pdus;
+        result.bytes           = m_bytes;
+        result.counts          = m_counts;
+        for (double& value : result.counts.values)
+        {
+            value /= static_cast<double>(m_iterations * m_sample_ns.size());
+        }
+
+        std::printf("%-72s %12llu iters %14.1f ns median %12.1f ns MAD\n", result.name.c_str(),
+                    static_cast<unsigned long long>(result.iterations), result.median_ns, result.mad_ns);
+        if (m_counters)
+        {
+            print_counts(result.counts, m_pdus > 0 ? "PDU" : "iteration", m_pdus);
+            if (m_bytes > 0)
+            {
+                print_counts(result.counts, "byte", m_bytes);
+            }
+        }
+        benchmark_results().push_back(result);
+    }
+
+    // Counts of an iteration divided by the PDUs or bytes it processes
+    static void print_counts(const HardwareCounts& counts, const char* unit, uint64_t per_iteration)
+    {
+        std::printf("    per %-9s", unit);
+        for (size_t i = 0; i < hardware_counter_count; i++)
+        {
+            const char* name = to_string(static_cast<HardwareCounter>(i));
+            if (counts.available[i])
+            {
+                std::printf(" %12.3f %s", counts.values[i] / std::max<uint64_t>(per_iteration, 1), name);
+            }
+            else
+            {
+                std::printf(" %12s %s", "n/a", name);
+            }
+        }
+        std::printf("\n");
+    }
+
+    std::string                   m_name;
+    uint64_t                      m_pdus;
+    uint64_t                      m_bytes;
+    std::unique_ptr<PerfCounters> m_counters;
+    HardwareCounts                m_batch_counts    = {};
+    HardwareCounts                m_counts          = {}; // Summed over the samples
+    uint64_t                      m_iterations      = 1;
+    uint64_t                      m_remaining       = 0;
+    bool                          m_started         = false;
+    bool                          m_calibrating     = true;
+    Clock::time_point             m_batch_start     = {};
+    double                        m_sampled_seconds = 0.0;
+    std::vector<double>           m_sample_ns;
+};
+
+inline std::string json_escape(const std::string& value)
+{
+    std::string escaped;
+    for (char c : value)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+// One benchmark per line, so results can be compared with diff as well as with read_benchmark_json
+inline bool write_benchmark_json(const std::string& path, const std::vector<BenchmarkResult>& results)
+{
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    std::fprintf(file, "{\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const BenchmarkResult& result = results[i];
+        std::fprintf(file,
+                     "    {\"name\": \"%s\", \"iterations\": %llu, \"samples\": %llu, \"median_ns\": %.3f, "
+                     "\"mad_ns\": %.3f, \"mean_ns\": %.3f, \"min_ns\": %.3f, \"pdus\": %llu, \"bytes\": %llu",
+                     json_escape(result.name).c_str(), static_cast<unsigned long long>(result.iterations),
+                     static_cast<unsigned long long>(result.samples), result.median_ns, result.mad_ns, result.mean_ns,
+                     result.min_ns, static_cast<unsigned long long>(result.pdus),
+                     static_cast<unsigned long long>(result.bytes));
+        // Hardware counts per iteration, only those counted
+        for (size_t j = 0; j < hardware_counter_count; j++)
+        {
+            if (result.counts.available[j])
+            {
+                std::fprintf(file, ", \"%s\": %.3f", to_string(static_cast<HardwareCounter>(j)),
+                             result.counts.values[j]);
+            }
+        }
+        std::fprintf(file, "}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(file, "  ]\n}\n");
+    return std::fclose(file) == 0;
+}
+
+namespace detail
+{
+inline bool json_string_field(const std::string& line, const std::string& key, std::string& value)
+{
+    size_t position = line.find("\"" + key + "\": \"");
+    if (position == std::string::npos)
+    {
+        return false;
+    }
+    value.clear();
+    for (position += key.size() + 5; position < line.size() && line[position] != '"'; position++)
+    {
+        if (line[position] == '\\' && position + 1 < line.size())
+        {
+            position++;
+        }
+        value += line[position];
+    }
+    return position < line.size();
+}
+
+inline bool json_number_field(const std::string& line, const std::string& key, double& value)
+{
+    const size_t position = line.find("\"" + key + "\": ");
+    if (position == std::string::npos)
+    {
+        return false;
+    }
+    const char* start = line.c_str() + position + key.size() + 4;
+    char*       end   = nullptr;
+    value             = std::strtod(start, &end);
+    return end != start;
+}
+} // namespace detail
+
+// Reads results written by write_benchmark_json
+inline bool read_benchmark_json(const std::string& path, std::vector<BenchmarkResult>& results)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line))
+    {
+        BenchmarkResult result = {};
+        double          iterations;
+        double          samples;
+        if (!detail::json_string_field(line, "name", result.name))
+        {
+            continue;
+        }
+        if (!detail::json_number_field(line, "iterations", iterations) ||
+            !detail::json_number_field(line, "samples", samples) ||
+            !detail::json_number_field(line, "median_ns", result.median_ns) ||
+            !detail::json_number_field(line, "mad_ns", result.mad_ns) ||
+            !detail::json_number_field(line, "mean_ns", result.mean_ns) ||
+            !detail::json_number_field(line, "min_ns", result.min_ns))
+        {
+            return false;
+        }
+        result.iterations = static_cast<uint64_t>(iterations);
+        result.samples    = static_cast<uint64_t>(samples);
+        results.push_back(result);
+    }
+    return true;
+}
+
+enum class ComparisonStatus
+{
+    unchanged,  // Within the threshold, or within the deviations of both runs
+    regression, // Slower by more than the threshold
+    missing,    // In the baseline only
+    unmatched,  // In the current run only
+};
+
+struct BenchmarkComparison
+{
+    std::string      name;
+    double           baseline_ns; // Zero if missing from the baseline
+    double           current_ns;  // Zero if missing from the current run
+    double           change;      // Relative change of the median, positive when slower
+    ComparisonStatus status;
+};
+
+// Every benchmark of either run. A benchmark regresses when its median is slower by more than the threshold, and by
+// more than three times the deviations of both runs, so noisy benchmarks are not reported. Benchmarks run in only one
+// of the two are reported as missing or unmatched, so a renamed or dropped benchmark is listed.
+inline std::vector<BenchmarkComparison> compare_benchmarks(const std::vector<BenchmarkResult>& baseline,
+                                                           const std::vector<BenchmarkResult>& current,
+                                                           double                              threshold)
+{
+    const auto find = [](const std::vector<BenchmarkResult>& results, const std::string& name) {
+        return std::find_if(results.begin(), results.end(),
+                            [&](const BenchmarkResult& result) { return result.name == name; });
+    };
+
+    std::vector<BenchmarkComparison> comparisons;
+    for (const BenchmarkResult& result : current)
+    {
+        const auto previous = find(baseline, result.name);
+        if (previous == baseline.end())
+        {
+            comparisons.push_back(
+                BenchmarkComparison{result.name, 0.0, result.median_ns, 0.0, ComparisonStatus::unmatched});
+            continue;
+        }
+        const double slower     = result.median_ns - previous->median_ns;
+        const double change     = previous->median_ns > 0.0 ? slower / previous->median_ns : 0.0;
+        const bool   regression = change > threshold && slower > 3 * (previous->mad_ns + result.mad_ns);
+        comparisons.push_back(BenchmarkComparison{result.name, previous->median_ns, result.median_ns, change,
+                                                  regression ? ComparisonStatus::regression
+                                                             : ComparisonStatus::unchanged});
+    }
+    for (const BenchmarkResult& result : baseline)
+    {
+        if (find(current, result.name) == current.end())
+        {
+            comparisons.push_back(
+                BenchmarkComparison{result.name, result.median_ns, 0.0, 0.0, ComparisonStatus::missing});
+        }
+    }
+    return comparisons;
+}
+
+inline void print_comparisons(const std::vector<BenchmarkComparison>& comparisons)
+{
+    for (const BenchmarkComparison& comparison : comparisons)
+    {
+        switch (comparison.status)
+        {
+        case ComparisonStatus::missing:
+            std::printf("%-72s %14.1f ns -> %17s MISSING\n", comparison.name.c_str(), comparison.baseline_ns, "");
+            break;
+        case ComparisonStatus::unmatched:
+            std::printf("%-72s %17s -> %14.1f ns NOT IN BASELINE\n", comparison.name.c_str(), "",
+                        comparison.current_ns);
+            break;
+        default:
+            std::printf("%-72s %14.1f ns -> %14.1f ns %+7.1f%%%s\n", comparison.name.c_str(), comparison.baseline_ns,
+                        comparison.current_ns, comparison.change * 100,
+                        comparison.status == ComparisonStatus::regression ? " REGRESSION" : "");
+        }
+    }
+}
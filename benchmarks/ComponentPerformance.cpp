@@ -1,5 +1,7 @@
 #include "autogen/all.hpp"
 
+#include "Benchmark.hpp"
+
 #include "catch2/catch.hpp"
 
 #include <vector>
@@ -14,6 +16,9 @@ struct StringDefault
     constexpr static const char* get_value() noexcept { return "Test string!"; }
 };
 
+using CompactOctetString = fast_ber::OctetString<fast_ber::ExplicitId<fast_ber::UniversalTag::octet_string>,
+                                                 fast_ber::CompactStorage<>>;
+
 const int iterations = 1000000;
 
 template <typename T>
@@ -21,7 +26,7 @@ void component_benchmark_encode(const T& type, const std::string& type_name)
 {
     std::array<uint8_t, 1000> buffer{};
     fast_ber::EncodeResult    res = {};
-    BENCHMARK("fast_ber        - encode " + type_name)
+    FAST_BER_BENCHMARK("fast_ber        - encode " + type_name)
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -40,7 +45,7 @@ void component_benchmark_decode(const T& type, const std::string& type_name)
     T decoded_copy;
 
     fast_ber::DecodeResult res = {false};
-    BENCHMARK("fast_ber        - decode " + type_name)
+    FAST_BER_BENCHMARK("fast_ber        - decode " + type_name)
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -53,7 +58,7 @@ void component_benchmark_decode(const T& type, const std::string& type_name)
 template <typename T1, typename T2>
 void component_benchmark_construct(const T2& initial_value, const std::string& type_name)
 {
-    BENCHMARK("fast_ber        - construct " + type_name)
+    FAST_BER_BENCHMARK("fast_ber        - construct " + type_name)
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -62,10 +67,29 @@ void component_benchmark_construct(const T2& initial_value, const std::string& t
     }
 }
 
+template <typename T>
+void component_benchmark_read(int64_t value, const std::string& type_name)
+{
+    // Objects are read from memory, as fields of decoded records would be
+    const std::vector<T> objects(1000, T(value));
+    int64_t              total = 0;
+    FAST_BER_BENCHMARK("fast_ber        - read " + type_name)
+    {
+        for (int i = 0; i < iterations / 1000; i++)
+        {
+            for (const T& object : objects)
+            {
+                total += object.value();
+            }
+        }
+    }
+    REQUIRE(total != 0);
+}
+
 template <typename T1>
 void component_benchmark_default_construct(const std::string& type_name)
 {
-    BENCHMARK("fast_ber        - dflt construct " + type_name)
+    FAST_BER_BENCHMARK("fast_ber        - dflt construct " + type_name)
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -77,9 +101,11 @@ void component_benchmark_default_construct(const std::string& type_name)
 TEST_CASE("Component Performance: Encode")
 {
     component_benchmark_encode(fast_ber::Integer<>(-99999999), "Integer");
+    component_benchmark_encode(fast_ber::NativeInteger<>(-99999999), "Native Integer");
     component_benchmark_encode(fast_ber::Default<fast_ber::Integer<>, IntegerDefault>(-99999999), "Default Integer");
     component_benchmark_encode(fast_ber::Boolean<>(true), "Boolean");
     component_benchmark_encode(fast_ber::OctetString<>("Test string!"), "OctetString");
+    component_benchmark_encode(CompactOctetString("Test string!"), "Compact OctetString");
     component_benchmark_encode(fast_ber::Default<fast_ber::OctetString<>, StringDefault>("Test string!"),
                                "Default OctetString");
     component_benchmark_encode(fast_ber::Null<>(), "Null");
@@ -97,9 +123,11 @@ TEST_CASE("Component Performance: Encode")
 TEST_CASE("Component Performance: Decode")
 {
     component_benchmark_decode(fast_ber::Integer<>(-99999999), "Integer");
+    component_benchmark_decode(fast_ber::NativeInteger<>(-99999999), "Native Integer");
     component_benchmark_decode(fast_ber::Default<fast_ber::Integer<>, IntegerDefault>(-99999999), "Default Integer");
     component_benchmark_decode(fast_ber::Boolean<>(true), "Boolean");
     component_benchmark_decode(fast_ber::OctetString<>("Test string!"), "OctetString");
+    component_benchmark_decode(CompactOctetString("Test string!"), "Compact OctetString");
     component_benchmark_decode(fast_ber::Default<fast_ber::OctetString<>, StringDefault>("Test string!"),
                                "Default OctetString");
     component_benchmark_decode(fast_ber::Null<>(), "Null");
@@ -117,9 +145,11 @@ TEST_CASE("Component Performance: Decode")
 TEST_CASE("Component Performance: Object Construction")
 {
     component_benchmark_construct<fast_ber::Integer<>>(-99999999, "Integer");
+    component_benchmark_construct<fast_ber::NativeInteger<>>(-99999999, "Native Integer");
     component_benchmark_construct<fast_ber::Default<fast_ber::Integer<>, IntegerDefault>>(-99999999, "Default Integer");
     component_benchmark_construct<fast_ber::Boolean<>>(true, "Boolean");
     component_benchmark_construct<fast_ber::OctetString<>>("Test string!", "OctetString");
+    component_benchmark_construct<CompactOctetString>("Test string!", "Compact OctetString");
     component_benchmark_construct<fast_ber::Default<fast_ber::OctetString<>, StringDefault>>("Test string!",
                                                                                              "Default String");
     component_benchmark_construct<fast_ber::Null<>>(fast_ber::Null<>{}, "Null");
@@ -139,12 +169,20 @@ TEST_CASE("Component Performance: Object Construction")
         fast_ber::Integer<>(5), "Choice (Integer)");
 }
 
+TEST_CASE("Component Performance: Read Value")
+{
+    component_benchmark_read<fast_ber::Integer<>>(-99999999, "Integer");
+    component_benchmark_read<fast_ber::NativeInteger<>>(-99999999, "Native Integer");
+}
+
 TEST_CASE("Component Performance: Default Construction")
 {
     component_benchmark_default_construct<fast_ber::Integer<>>("Integer");
+    component_benchmark_default_construct<fast_ber::NativeInteger<>>("Native Integer");
     component_benchmark_default_construct<fast_ber::Default<fast_ber::Integer<>, IntegerDefault>>("Default Int");
     component_benchmark_default_construct<fast_ber::Boolean<>>("Boolean");
     component_benchmark_default_construct<fast_ber::OctetString<>>("OctetString");
+    component_benchmark_default_construct<CompactOctetString>("Compact OctetString");
     component_benchmark_default_construct<fast_ber::Default<fast_ber::OctetString<>, StringDefault>>("Default Str");
     component_benchmark_default_construct<fast_ber::Null<>>("Null");
     component_benchmark_default_construct<fast_ber::Real<>>("Real");
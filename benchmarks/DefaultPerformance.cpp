@@ -0,0 +1,74 @@
+#include "autogen/defaults.hpp"
+
+#include "Benchmark.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <array>
+
+// Construction and decoding of a record made up of DEFAULT members, both when every member takes its default value and
+// when every member is set
+
+const int default_iterations = 1000000;
+
+fast_ber::Defaults::SequenceWithDefault sequence_with_values()
+{
+    fast_ber::Defaults::SequenceWithDefault sequence;
+    sequence.integer = 5;
+    sequence.flag    = true;
+    sequence.string  = "cat";
+    sequence.defined = 42;
+    sequence.colour  = fast_ber::Defaults::ColourValues::red;
+    sequence.real    = 1.5;
+    return sequence;
+}
+
+void default_benchmark_decode(const fast_ber::Defaults::SequenceWithDefault& sequence, const std::string& name)
+{
+    std::array<uint8_t, 1000>    buffer        = {};
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), sequence);
+    REQUIRE(encode_result.success);
+
+    fast_ber::Defaults::SequenceWithDefault decoded;
+    fast_ber::DecodeResult                  res = {false};
+    FAST_BER_BENCHMARK("fast_ber        - decode " + name)
+    {
+        for (int i = 0; i < default_iterations; i++)
+        {
+            res = fast_ber::decode(absl::MakeSpan(buffer.data(), encode_result.length), decoded);
+        }
+    }
+    REQUIRE(res.success);
+    REQUIRE(decoded == sequence);
+}
+
+TEST_CASE("Default Performance: Construction")
+{
+    size_t total = 0;
+    FAST_BER_BENCHMARK("fast_ber        - construct SequenceWithDefault (defaults)")
+    {
+        total = 0;
+        for (int i = 0; i < default_iterations; i++)
+        {
+            fast_ber::Defaults::SequenceWithDefault sequence;
+            total += sequence.integer.is_default();
+        }
+    }
+
+    const fast_ber::Defaults::SequenceWithDefault values = sequence_with_values();
+    FAST_BER_BENCHMARK("fast_ber        - copy SequenceWithDefault (values)")
+    {
+        for (int i = 0; i < default_iterations; i++)
+        {
+            fast_ber::Defaults::SequenceWithDefault sequence(values);
+            total += sequence.integer.is_default();
+        }
+    }
+    REQUIRE(total == default_iterations);
+}
+
+TEST_CASE("Default Performance: Decode")
+{
+    default_benchmark_decode(fast_ber::Defaults::SequenceWithDefault{}, "SequenceWithDefault (defaults)");
+    default_benchmark_decode(sequence_with_values(), "SequenceWithDefault (values)");
+}
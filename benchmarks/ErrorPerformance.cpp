@@ -0,0 +1,81 @@
+#include "autogen/sequence.hpp"
+
+#include "Benchmark.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+// Rejection of malformed records. Each failure is recorded in the current ErrorContext, with the path of members
+// leading to it. Building with FAST_BER_DISABLE_ERRORS removes the reports, giving the cost of rejection alone.
+
+const int error_iterations = 1000000;
+
+namespace
+{
+size_t formatted_length = 0;
+
+// Sink formatting each report, as a sink writing to a log would
+void formatting_sink(const fast_ber::ErrorContext& context) noexcept
+{
+    std::array<char, 256> buffer = {};
+    formatted_length += fast_ber::format_error(context, buffer.data(), buffer.size());
+}
+
+std::vector<uint8_t> encoded_contents()
+{
+    fast_ber::Sequence_::Contents contents = {};
+    contents.seq.integer                   = 7;
+    contents.cho                           = fast_ber::Boolean<>(true);
+
+    std::vector<uint8_t>         buffer(100, 0);
+    const fast_ber::EncodeResult result = fast_ber::encode(absl::MakeSpan(buffer), contents);
+    REQUIRE(result.success);
+    buffer.resize(result.length);
+    return buffer;
+}
+
+// Record with the integer nested in its first member retagged as an octet string, rejected two members deep
+std::vector<uint8_t> malformed_contents()
+{
+    std::vector<uint8_t>         buffer  = encoded_contents();
+    const std::array<uint8_t, 3> integer = {0x02, 0x01, 0x07};
+    const auto                   found   = std::search(buffer.begin(), buffer.end(), integer.begin(), integer.end());
+    REQUIRE(found != buffer.end());
+    *found = 0x04;
+    return buffer;
+}
+
+void error_benchmark_decode(const std::vector<uint8_t>& encoded, bool expected, const std::string& name)
+{
+    fast_ber::Sequence_::Contents contents;
+    fast_ber::DecodeResult        res = {!expected};
+    FAST_BER_BENCHMARK("fast_ber        - " + name)
+    {
+        for (int i = 0; i < error_iterations; i++)
+        {
+            res = fast_ber::decode(absl::MakeSpan(encoded), contents);
+        }
+    }
+    REQUIRE(res.success == expected);
+}
+} // namespace
+
+TEST_CASE("Error Performance: Reject malformed records")
+{
+    const std::vector<uint8_t> valid     = encoded_contents();
+    const std::vector<uint8_t> malformed = malformed_contents();
+    const std::vector<uint8_t> truncated(valid.begin(), valid.end() - 1);
+
+    error_benchmark_decode(valid, true, "decode 1,000,000 valid records");
+    error_benchmark_decode(malformed, false, "reject 1,000,000 records with a nested error");
+    error_benchmark_decode(truncated, false, "reject 1,000,000 truncated records");
+
+    fast_ber::ErrorContext context(formatting_sink);
+    fast_ber::ErrorScope   scope(context);
+    error_benchmark_decode(malformed, false, "reject 1,000,000 records with a nested error (formatting sink)");
+    REQUIRE(formatted_length > 0);
+}
@@ -0,0 +1,91 @@
+#include "fast_ber/util/BerFramer.hpp"
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/EncodeIdentifiers.hpp"
+
+#include "Benchmark.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <random>
+#include <vector>
+
+// Framing of a stream of back to back records, sized like call detail records. The stream is framed several times to
+// process 2 GiB per benchmark, read in chunks as it would be from a file or socket.
+
+const size_t framer_stream_size = size_t(128) * 1024 * 1024;
+const int    framer_passes      = 16;
+
+std::vector<uint8_t> record_stream()
+{
+    std::mt19937                          generator(12345);
+    std::uniform_int_distribution<size_t> record_length(100, 2000);
+
+    std::vector<uint8_t> stream(framer_stream_size, 0x78);
+    size_t               offset = 0;
+    while (true)
+    {
+        const size_t content_length = record_length(generator);
+        if (offset + content_length + 10 > stream.size())
+        {
+            break;
+        }
+        offset += fast_ber::encode_header(absl::MakeSpan(stream.data() + offset, stream.size() - offset),
+                                          fast_ber::Construction::constructed, fast_ber::Class::universal, 16,
+                                          content_length);
+        offset += content_length;
+    }
+    stream.resize(offset);
+    return stream;
+}
+
+size_t frame_stream(const std::vector<uint8_t>& stream, size_t chunk_size)
+{
+    fast_ber::BerFramer framer;
+    fast_ber::BerView   pdu;
+    size_t              total = 0;
+    for (size_t offset = 0; offset < stream.size(); offset += chunk_size)
+    {
+        framer.push(absl::MakeSpan(stream.data() + offset, std::min(chunk_size, stream.size() - offset)));
+        while (framer.next(pdu) == fast_ber::FrameStatus::ready)
+        {
+            total += pdu.ber_length();
+        }
+    }
+    return framer.buffered() == 0 ? total : 0;
+}
+
+TEST_CASE("Framer Performance: Record stream")
+{
+    const std::vector<uint8_t> stream = record_stream();
+    const std::string          size   = std::to_string(framer_passes * stream.size() / (1024 * 1024)) + "MiB";
+
+    size_t total = 0;
+    FAST_BER_BENCHMARK("BerViewIterator - visit records of " + size + " in memory")
+    {
+        total = 0;
+        for (int i = 0; i < framer_passes; i++)
+        {
+            const fast_ber::BerViewIterator end(fast_ber::End::end);
+            for (fast_ber::BerViewIterator iterator(stream); iterator != end; ++iterator)
+            {
+                total += iterator->ber_length();
+            }
+        }
+    }
+    REQUIRE(total == framer_passes * stream.size());
+
+    for (size_t chunk_size : {size_t(4096), size_t(65536), size_t(1024 * 1024)})
+    {
+        total = 0;
+        FAST_BER_BENCHMARK("BerFramer       - frame records of " + size + " in " + std::to_string(chunk_size) +
+                           "B chunks")
+        {
+            total = 0;
+            for (int i = 0; i < framer_passes; i++)
+            {
+                total += frame_stream(stream, chunk_size);
+            }
+        }
+        REQUIRE(total == framer_passes * stream.size());
+    }
+}
@@ -0,0 +1,206 @@
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/EncodeIdentifiers.hpp"
+#include "fast_ber/util/Extract.hpp"
+
+#include "Benchmark.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <random>
+#include <vector>
+
+// Header encode / decode with a distribution of tags and lengths similar to real world schemas. Most fields use a
+// context specific tag below 31 and a short form length, a minority use two or three byte tags or lengths and a few
+// are large.
+
+const int header_iterations = 1000;
+const int header_count      = 4096;
+
+struct HeaderSample
+{
+    fast_ber::Tag tag;
+    size_t        length;
+};
+
+std::vector<HeaderSample> realistic_headers()
+{
+    std::mt19937                          generator(12345);
+    std::uniform_int_distribution<int>    percent(0, 99);
+    std::uniform_int_distribution<size_t> short_value(0, 127);
+
+    std::vector<HeaderSample> headers;
+    for (int i = 0; i < header_count; i++)
+    {
+        const int tag_kind    = percent(generator);
+        const int length_kind = percent(generator);
+
+        HeaderSample sample = {};
+        if (tag_kind < 85)
+        {
+            sample.tag = static_cast<fast_ber::Tag>(short_value(generator) % 31);
+        }
+        else if (tag_kind < 97)
+        {
+            sample.tag = static_cast<fast_ber::Tag>(31 + short_value(generator) * 100);
+        }
+        else
+        {
+            sample.tag = fast_ber::Tag(1) << (14 + percent(generator) % 30);
+        }
+
+        if (length_kind < 80)
+        {
+            sample.length = short_value(generator);
+        }
+        else if (length_kind < 95)
+        {
+            sample.length = 128 + short_value(generator) * 300;
+        }
+        else
+        {
+            sample.length = size_t(1) << (16 + percent(generator) % 16);
+        }
+        headers.push_back(sample);
+    }
+    return headers;
+}
+
+std::vector<uint8_t> encode_headers(const std::vector<HeaderSample>& headers, std::vector<size_t>& offsets)
+{
+    std::vector<uint8_t> buffer(headers.size() * 20);
+    size_t               offset = 0;
+    for (const HeaderSample& header : headers)
+    {
+        offsets.push_back(offset);
+        offset += fast_ber::encode_header(absl::MakeSpan(buffer.data() + offset, buffer.size() - offset),
+                                          fast_ber::Construction::primitive, fast_ber::Class::context_specific,
+                                          header.tag, header.length);
+    }
+    buffer.resize(offset);
+    return buffer;
+}
+
+TEST_CASE("Header Codec Performance: Encode")
+{
+    const std::vector<HeaderSample> headers = realistic_headers();
+    std::vector<uint8_t>            buffer(headers.size() * 20);
+
+    size_t total = 0;
+    FAST_BER_BENCHMARK("fast_ber        - encode header")
+    {
+        for (int i = 0; i < header_iterations; i++)
+        {
+            size_t offset = 0;
+            for (const HeaderSample& header : headers)
+            {
+                offset += fast_ber::encode_header(absl::MakeSpan(buffer.data() + offset, buffer.size() - offset),
+                                                  fast_ber::Construction::primitive,
+                                                  fast_ber::Class::context_specific, header.tag, header.length);
+            }
+            total += offset;
+        }
+    }
+    REQUIRE(total > 0);
+
+    total = 0;
+    FAST_BER_BENCHMARK("fast_ber        - encode tag")
+    {
+        for (int i = 0; i < header_iterations; i++)
+        {
+            size_t offset = 0;
+            for (const HeaderSample& header : headers)
+            {
+                offset += fast_ber::encode_tag(absl::MakeSpan(buffer.data() + offset, buffer.size() - offset),
+                                               header.tag);
+            }
+            total += offset;
+        }
+    }
+    REQUIRE(total > 0);
+
+    total = 0;
+    FAST_BER_BENCHMARK("fast_ber        - encode length")
+    {
+        for (int i = 0; i < header_iterations; i++)
+        {
+            size_t offset = 0;
+            for (const HeaderSample& header : headers)
+            {
+                offset += fast_ber::encode_length(absl::MakeSpan(buffer.data() + offset, buffer.size() - offset),
+                                                  header.length);
+            }
+            total += offset;
+        }
+    }
+    REQUIRE(total > 0);
+
+    total = 0;
+    FAST_BER_BENCHMARK("fast_ber        - encoded header length")
+    {
+        for (int i = 0; i < header_iterations; i++)
+        {
+            for (const HeaderSample& header : headers)
+            {
+                total += fast_ber::encoded_header_length(fast_ber::Construction::primitive,
+                                                         fast_ber::Class::context_specific, header.tag,
+                                                         header.length);
+            }
+        }
+    }
+    REQUIRE(total > 0);
+}
+
+TEST_CASE("Header Codec Performance: Decode")
+{
+    const std::vector<HeaderSample> headers = realistic_headers();
+    std::vector<size_t>             offsets;
+    const std::vector<uint8_t>      buffer = encode_headers(headers, offsets);
+
+    size_t total = 0;
+    FAST_BER_BENCHMARK("fast_ber        - extract tag")
+    {
+        for (int i = 0; i < header_iterations; i++)
+        {
+            for (size_t offset : offsets)
+            {
+                fast_ber::Tag tag = 0;
+                total += fast_ber::extract_tag(absl::MakeSpan(buffer.data() + offset, buffer.size() - offset), tag);
+                total += static_cast<size_t>(tag);
+            }
+        }
+    }
+    REQUIRE(total > 0);
+
+    total = 0;
+    FAST_BER_BENCHMARK("fast_ber        - extract tag and length")
+    {
+        for (int i = 0; i < header_iterations; i++)
+        {
+            for (size_t offset : offsets)
+            {
+                absl::Span<const uint8_t> input(buffer.data() + offset, buffer.size() - offset);
+
+                fast_ber::Tag tag        = 0;
+                size_t        length     = 0;
+                size_t        tag_length = fast_ber::extract_tag(input, tag);
+                total += tag_length + fast_ber::extract_length(input, length, tag_length) + length;
+            }
+        }
+    }
+    REQUIRE(total > 0);
+
+    total = 0;
+    FAST_BER_BENCHMARK("fast_ber        - BerView assign")
+    {
+        for (int i = 0; i < header_iterations; i++)
+        {
+            for (size_t offset : offsets)
+            {
+                // Views of the larger lengths are invalid as the content is not present, the header is still parsed
+                fast_ber::BerView view(absl::MakeSpan(buffer.data() + offset, buffer.size() - offset));
+                total += view.is_valid();
+            }
+        }
+    }
+    REQUIRE(total > 0);
+}
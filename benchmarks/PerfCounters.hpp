@@ -0,0 +1,188 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Hardware counters of the calling thread, read with perf_event_open. Threads started by the calling thread after the
+// counters are opened are counted as well once they exit, so the workers of a ParallelDecoder constructed and destroyed
+// within a benchmark are included. Threads started earlier are not. Counters the kernel or the machine does not
+// provide, such as in a virtual machine without a PMU, with perf_event_paranoid above 2 or on other platforms, are
+// reported as unavailable rather than failing the benchmark. Counters multiplexed by the kernel are scaled by the
+// fraction of the time they were counting.
+
+enum class HardwareCounter
+{
+    cycles,
+    instructions,
+    branch_misses,
+    l1d_misses,
+    llc_misses,
+};
+
+constexpr size_t hardware_counter_count = 5;
+
+inline const char* to_string(HardwareCounter counter) noexcept
+{
+    switch (counter)
+    {
+    case HardwareCounter::cycles:
+        return "cycles";
+    case HardwareCounter::instructions:
+        return "instructions";
+    case HardwareCounter::branch_misses:
+        return "branch_misses";
+    case HardwareCounter::l1d_misses:
+        return "l1d_misses";
+    case HardwareCounter::llc_misses:
+        return "llc_misses";
+    }
+    return "unknown";
+}
+
+struct HardwareCounts
+{
+    std::array<bool, hardware_counter_count>   available;
+    std::array<double, hardware_counter_count> values;
+};
+
+class PerfCounters
+{
+  public:
+    PerfCounters() noexcept
+    {
+        for (size_t i = 0; i < hardware_counter_count; i++)
+        {
+            m_fds[i] = open_counter(static_cast<HardwareCounter>(i));
+        }
+    }
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+    ~PerfCounters() noexcept
+    {
+#ifdef __linux__
+        for (int fd : m_fds)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    bool available(HardwareCounter counter) const noexcept { return m_fds[static_cast<size_t>(counter)] >= 0; }
+    bool any_available() const noexcept
+    {
+        for (int fd : m_fds)
+        {
+            if (fd >= 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void start() noexcept
+    {
+#ifdef __linux__
+        for (int fd : m_fds)
+        {
+            if (fd >= 0)
+            {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    // Counts since start
+    HardwareCounts stop() noexcept
+    {
+        HardwareCounts counts = {};
+#ifdef __linux__
+        for (size_t i = 0; i < hardware_counter_count; i++)
+        {
+            const int fd = m_fds[i];
+            if (fd < 0)
+            {
+                continue;
+            }
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+
+            // Value, time enabled and time running
+            uint64_t values[3] = {};
+            if (read(fd, values, sizeof(values)) == static_cast<ssize_t>(sizeof(values)) && values[2] > 0)
+            {
+                counts.available[i] = true;
+                counts.values[i]    = static_cast<double>(values[0]) * values[1] / values[2];
+            }
+        }
+#endif
+        return counts;
+    }
+
+  private:
+    static int open_counter(HardwareCounter counter) noexcept
+    {
+#ifdef __linux__
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size           = sizeof(attr);
+        attr.disabled       = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.inherit        = 1;
+        attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        const uint64_t read_miss = (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        switch (counter)
+        {
+        case HardwareCounter::cycles:
+            attr.type   = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case HardwareCounter::instructions:
+            attr.type   = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case HardwareCounter::branch_misses:
+            attr.type   = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case HardwareCounter::l1d_misses:
+            attr.type   = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_L1D | read_miss;
+            break;
+        case HardwareCounter::llc_misses:
+            attr.type   = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_LL | read_miss;
+            break;
+        }
+        // The calling thread and its future children, on any CPU
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+        (void)counter;
+        return -1;
+#endif
+    }
+
+    std::array<int, hardware_counter_count> m_fds;
+};
+
+// Set by the --perf option of the benchmark executables
+inline bool& hardware_counters_enabled() noexcept
+{
+    static bool enabled = false;
+    return enabled;
+}
@@ -3,9 +3,16 @@
 #endif
 
 #include "autogen/simple.hpp"
+#include "fast_ber/util/BerIndex.hpp"
+#include "fast_ber/util/DecodeBatch.hpp"
+#include "fast_ber/util/ParallelDecoder.hpp"
+
+#include "Benchmark.hpp"
 
 #include "catch2/catch.hpp"
 
+#include <algorithm>
+#include <random>
 #include <vector>
 
 const std::initializer_list<uint8_t> large_test_collection_packet = {
@@ -129,11 +136,41 @@ const std::initializer_list<uint8_t> small_test_collection_packet = {
 
 const int iterations = 1000000;
 
+// Reads every member of a collection through its lazy view, without copying
+size_t read_collection_view(absl::Span<const uint8_t> input)
+{
+    const fast_ber::Simple::Collection::View view(input);
+    if (!view.is_valid())
+    {
+        return 0;
+    }
+
+    size_t total = view.hello().size() + view.goodbye().size() + static_cast<size_t>(view.integer()) + view.boolean();
+    total += static_cast<size_t>(view.child().meaning_of_life().value_or(0));
+    for (absl::string_view element : view.child().list())
+    {
+        total += element.size();
+    }
+
+    const absl::optional<fast_ber::Simple::Child::View> optional_child = view.optional_child();
+    if (optional_child)
+    {
+        total += static_cast<size_t>(optional_child->meaning_of_life().value_or(0));
+        for (absl::string_view element : optional_child->list())
+        {
+            total += element.size();
+        }
+    }
+    return total + view.the_choice().index();
+}
+
 TEST_CASE("Benchmark: Decode Performance")
 {
     bool success = false;
 
-    BENCHMARK("fast_ber        - 1,000,000 x decode " + std::to_string(large_test_collection_packet.size()) + "B pdu")
+    FAST_BER_BENCHMARK_PDUS("fast_ber        - 1,000,000 x decode " +
+                            std::to_string(large_test_collection_packet.size()) + "B pdu", iterations,
+                            iterations * large_test_collection_packet.size())
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -146,9 +183,42 @@ TEST_CASE("Benchmark: Decode Performance")
     }
     REQUIRE(success);
 
+    size_t total = 0;
+    FAST_BER_BENCHMARK_PDUS("fast_ber (view) - 1,000,000 x view and read " +
+                            std::to_string(large_test_collection_packet.size()) + "B pdu", iterations,
+                            iterations * large_test_collection_packet.size())
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            total += read_collection_view(
+                absl::MakeSpan(large_test_collection_packet.begin(), large_test_collection_packet.size()));
+        }
+    }
+    REQUIRE(total > 0);
+
+    // Only the selected members are decoded, the other members are skipped
+    const fast_ber::Simple::Collection::FieldMask fields = {fast_ber::Simple::Collection::Field::hello,
+                                                            fast_ber::Simple::Collection::Field::integer};
+    FAST_BER_BENCHMARK_PDUS("fast_ber (proj) - 1,000,000 x decode 2 members of " +
+                            std::to_string(large_test_collection_packet.size()) + "B pdu", iterations,
+                            iterations * large_test_collection_packet.size())
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            fast_ber::Simple::Collection collection;
+            success = fast_ber::decode(
+                          absl::MakeSpan(large_test_collection_packet.begin(), large_test_collection_packet.size()),
+                          collection, fields)
+                          .success;
+        }
+    }
+    REQUIRE(success);
+
 #ifdef INCLUDE_ASN1C
     asn_dec_rval_t rval = {};
-    BENCHMARK("asn1c           - 1,000,000 x decode " + std::to_string(large_test_collection_packet.size()) + "B pdu")
+    FAST_BER_BENCHMARK_PDUS("asn1c           - 1,000,000 x decode " +
+                            std::to_string(large_test_collection_packet.size()) + "B pdu", iterations,
+                            iterations * large_test_collection_packet.size())
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -162,7 +232,9 @@ TEST_CASE("Benchmark: Decode Performance")
     REQUIRE(rval.code == RC_OK);
 #endif
 
-    BENCHMARK("fast_ber        - 1,000,000 x decode " + std::to_string(small_test_collection_packet.size()) + "B pdu")
+    FAST_BER_BENCHMARK_PDUS("fast_ber        - 1,000,000 x decode " +
+                            std::to_string(small_test_collection_packet.size()) + "B pdu", iterations,
+                            iterations * small_test_collection_packet.size())
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -175,8 +247,23 @@ TEST_CASE("Benchmark: Decode Performance")
     }
     REQUIRE(success);
 
+    total = 0;
+    FAST_BER_BENCHMARK_PDUS("fast_ber (view) - 1,000,000 x view and read " +
+                            std::to_string(small_test_collection_packet.size()) + "B pdu", iterations,
+                            iterations * small_test_collection_packet.size())
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            total += read_collection_view(
+                absl::MakeSpan(small_test_collection_packet.begin(), small_test_collection_packet.size()));
+        }
+    }
+    REQUIRE(total > 0);
+
 #ifdef INCLUDE_ASN1C
-    BENCHMARK("asn1c           - 1,000,000 x decode " + std::to_string(small_test_collection_packet.size()) + "B pdu")
+    FAST_BER_BENCHMARK_PDUS("asn1c           - 1,000,000 x decode " +
+                            std::to_string(small_test_collection_packet.size()) + "B pdu", iterations,
+                            iterations * small_test_collection_packet.size())
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -191,6 +278,184 @@ TEST_CASE("Benchmark: Decode Performance")
 #endif
 }
 
+TEST_CASE("Benchmark: Batch Decode Performance")
+{
+    // Small PDUs received as separate messages, spread through memory in an unpredictable order
+    const size_t         pdu_size = small_test_collection_packet.size();
+    std::vector<uint8_t> messages(iterations * pdu_size);
+    std::vector<absl::Span<const uint8_t>> pdus;
+    for (int i = 0; i < iterations; i++)
+    {
+        std::copy(small_test_collection_packet.begin(), small_test_collection_packet.end(),
+                  messages.begin() + i * pdu_size);
+        pdus.push_back(absl::MakeSpan(messages.data() + i * pdu_size, pdu_size));
+    }
+    std::shuffle(pdus.begin(), pdus.end(), std::mt19937(12345));
+
+    size_t total = 0;
+    FAST_BER_BENCHMARK_PDUS("fast_ber        - 1,000,000 x decode " + std::to_string(pdu_size) + "B pdu, new object",
+                            pdus.size(), pdus.size() * pdu_size)
+    {
+        total = 0;
+        for (const absl::Span<const uint8_t> pdu : pdus)
+        {
+            fast_ber::Simple::Collection collection;
+            total += fast_ber::decode(pdu, collection).success;
+        }
+    }
+    REQUIRE(total == size_t(iterations));
+
+    total = 0;
+    FAST_BER_BENCHMARK_PDUS("fast_ber        - 1,000,000 x decode " + std::to_string(pdu_size) + "B pdu, reused object",
+                            pdus.size(), pdus.size() * pdu_size)
+    {
+        total = 0;
+        fast_ber::Simple::Collection collection;
+        for (const absl::Span<const uint8_t> pdu : pdus)
+        {
+            total += fast_ber::decode(pdu, collection).success;
+        }
+    }
+    REQUIRE(total == size_t(iterations));
+
+    // Batches of 256 PDUs, as if received with a single recvmmsg
+    total = 0;
+    std::vector<fast_ber::Simple::Collection> collections;
+    FAST_BER_BENCHMARK_PDUS("fast_ber (batch) - 1,000,000 x decode " + std::to_string(pdu_size) +
+                            "B pdu, 256 per batch", pdus.size(), pdus.size() * pdu_size)
+    {
+        total = 0;
+        for (size_t first = 0; first < pdus.size(); first += 256)
+        {
+            const size_t count = std::min(size_t(256), pdus.size() - first);
+            total += fast_ber::decode_batch(absl::MakeSpan(pdus.data() + first, count), collections).decoded;
+        }
+    }
+    REQUIRE(total == size_t(iterations));
+}
+
+TEST_CASE("Benchmark: Parallel Decode Performance")
+{
+    // A file of alternating large and small records, decoded in order with a single thread and with a thread pool
+    std::vector<uint8_t> file;
+    for (int i = 0; i < iterations / 2; i++)
+    {
+        file.insert(file.end(), large_test_collection_packet.begin(), large_test_collection_packet.end());
+        file.insert(file.end(), small_test_collection_packet.begin(), small_test_collection_packet.end());
+    }
+
+    size_t total = 0;
+    FAST_BER_BENCHMARK_PDUS("fast_ber        - 1,000,000 x decode records of " + std::to_string(file.size()) + "B file",
+                            iterations, file.size())
+    {
+        total = 0;
+        fast_ber::Simple::Collection collection;
+        const fast_ber::BerViewIterator end(fast_ber::End::end);
+        for (fast_ber::BerViewIterator iterator(file); iterator != end; ++iterator)
+        {
+            total += fast_ber::decode(*iterator, collection).success;
+        }
+    }
+    REQUIRE(total == size_t(iterations));
+
+    // Names must be unique, on a single CPU the default is one thread
+    std::vector<size_t> thread_counts = {1};
+    if (fast_ber::ParallelDecoder<fast_ber::Simple::Collection>::default_threads() > 1)
+    {
+        thread_counts.push_back(fast_ber::ParallelDecoder<fast_ber::Simple::Collection>::default_threads());
+    }
+    for (size_t threads : thread_counts)
+    {
+        total = 0;
+        FAST_BER_BENCHMARK_PDUS("fast_ber (" + std::to_string(threads) + "t)   - 1,000,000 x decode records of " +
+                                std::to_string(file.size()) + "B file", iterations, file.size())
+        {
+            // The workers are started and joined within the samples, so hardware counters include them
+            fast_ber::ParallelDecoder<fast_ber::Simple::Collection> decoder(threads);
+
+            total = 0;
+            total += decoder.decode(file, [](const fast_ber::Simple::Collection&) {}).records;
+        }
+        REQUIRE(total == size_t(iterations));
+    }
+}
+
+size_t count_elements(fast_ber::BerView view)
+{
+    size_t count = 1;
+    if (view.construction() == fast_ber::Construction::constructed)
+    {
+        for (const fast_ber::BerView& child : view)
+        {
+            count += count_elements(child);
+        }
+    }
+    return count;
+}
+
+TEST_CASE("Benchmark: Structural Scan Performance")
+{
+    const auto small_packet = absl::MakeSpan(small_test_collection_packet.begin(), small_test_collection_packet.size());
+    const auto large_packet = absl::MakeSpan(large_test_collection_packet.begin(), large_test_collection_packet.size());
+
+    size_t element_count = 0;
+    FAST_BER_BENCHMARK_PDUS("BerView         - 1,000,000 x visit all elements " + std::to_string(small_packet.size()) +
+                            "B pdu", iterations, iterations * small_packet.size())
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            element_count = count_elements(fast_ber::BerView(small_packet));
+        }
+    }
+    REQUIRE(element_count == 9);
+
+    fast_ber::BerIndex index;
+    FAST_BER_BENCHMARK_PDUS("BerIndex        - 1,000,000 x index all elements " + std::to_string(small_packet.size()) +
+                            "B pdu", iterations, iterations * small_packet.size())
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            index.build(small_packet);
+        }
+    }
+    REQUIRE(index.size() == 9);
+
+    FAST_BER_BENCHMARK_PDUS("BerView         - 1,000,000 x visit all elements " + std::to_string(large_packet.size()) +
+                            "B pdu", iterations, iterations * large_packet.size())
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            element_count = count_elements(fast_ber::BerView(large_packet));
+        }
+    }
+    REQUIRE(element_count == 17);
+
+    FAST_BER_BENCHMARK_PDUS("BerIndex        - 1,000,000 x index all elements " + std::to_string(large_packet.size()) +
+                            "B pdu", iterations, iterations * large_packet.size())
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            index.build(large_packet);
+        }
+    }
+    REQUIRE(index.size() == 17);
+
+    // Once built, elements are found without parsing any headers
+    size_t content_length = 0;
+    FAST_BER_BENCHMARK_PDUS("BerIndex        - 1,000,000 x visit indexed elements " +
+                            std::to_string(large_packet.size()) + "B pdu", iterations, iterations * large_packet.size())
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            for (size_t node = 0; node < index.size(); node++)
+            {
+                content_length += index.view(node).content_length();
+            }
+        }
+    }
+    REQUIRE(content_length != 0);
+}
+
 TEST_CASE("Benchmark: Encode Performance")
 {
     const std::string         long_string     = std::string(2000, 'x');
@@ -213,7 +478,9 @@ TEST_CASE("Benchmark: Encode Performance")
                                 fast_ber::SequenceOf<fast_ber::OctetString<>>{the, second, child, long_string}},
         decltype(collection.the_choice){fast_ber::in_place_index_t<1>(), "I chose a string!"}};
 
-    BENCHMARK("fast_ber        - 1,000,000 x encode " + std::to_string(fast_ber::encoded_length(collection)) + "B pdu")
+    FAST_BER_BENCHMARK_PDUS("fast_ber        - 1,000,000 x encode " +
+                            std::to_string(fast_ber::encoded_length(collection)) + "B pdu", iterations,
+                            iterations * fast_ber::encoded_length(collection))
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -223,6 +490,54 @@ TEST_CASE("Benchmark: Encode Performance")
     }
     REQUIRE(encode_result.success);
 
+    std::array<uint8_t, 5000> reverse_buffer        = {};
+    fast_ber::EncodeResult    reverse_encode_result = {};
+    FAST_BER_BENCHMARK_PDUS("fast_ber (rev)  - 1,000,000 x encode " +
+                            std::to_string(fast_ber::encoded_length(collection)) + "B pdu", iterations,
+                            iterations * fast_ber::encoded_length(collection))
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            reverse_encode_result =
+                fast_ber::encode_reverse(absl::MakeSpan(reverse_buffer.data(), reverse_buffer.size()), collection);
+        }
+    }
+    REQUIRE(reverse_encode_result.success);
+    REQUIRE(absl::MakeSpan(reverse_buffer.data() + reverse_buffer.size() - reverse_encode_result.length,
+                           reverse_encode_result.length) ==
+            absl::MakeSpan(fast_ber_buffer.data(), encode_result.length));
+
+    size_t encoded_length = 0;
+    FAST_BER_BENCHMARK_PDUS("fast_ber        - 1,000,000 x length + encode " +
+                            std::to_string(fast_ber::encoded_length(collection)) + "B pdu", iterations,
+                            iterations * fast_ber::encoded_length(collection))
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            encoded_length = fast_ber::encoded_length(collection);
+            encode_result  = fast_ber::encode(absl::MakeSpan(fast_ber_buffer.data(), encoded_length), collection);
+        }
+    }
+    REQUIRE(encode_result.success);
+
+    fast_ber::EncodePlan      plan;
+    fast_ber::EncodeResult    planned_encode_result = {};
+    std::array<uint8_t, 5000> planned_buffer        = {};
+    FAST_BER_BENCHMARK_PDUS("fast_ber (plan) - 1,000,000 x length + encode " +
+                            std::to_string(fast_ber::encoded_length(collection)) + "B pdu", iterations,
+                            iterations * fast_ber::encoded_length(collection))
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            encoded_length        = fast_ber::encoded_length(collection, plan);
+            planned_encode_result =
+                fast_ber::encode(absl::MakeSpan(planned_buffer.data(), encoded_length), collection, plan);
+        }
+    }
+    REQUIRE(planned_encode_result.success);
+    REQUIRE(absl::MakeSpan(planned_buffer.data(), planned_encode_result.length) ==
+            absl::MakeSpan(fast_ber_buffer.data(), encode_result.length));
+
 #ifdef INCLUDE_ASN1C
     asn_enc_rval_t rval;
     Collection_t   asn1c_collection = {};
@@ -248,7 +563,9 @@ TEST_CASE("Benchmark: Encode Performance")
     asn1c_collection.the_choice.present = the_choice_PR_goodbye;
     OCTET_STRING_fromString(&asn1c_collection.the_choice.choice.goodbye, "I chose a string!");
 
-    BENCHMARK("asn1c           - 1,000,000 x encode " + std::to_string(fast_ber::encoded_length(collection)) + "B pdu")
+    FAST_BER_BENCHMARK_PDUS("asn1c           - 1,000,000 x encode " +
+                            std::to_string(fast_ber::encoded_length(collection)) + "B pdu", iterations,
+                            iterations * fast_ber::encoded_length(collection))
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -285,7 +602,7 @@ TEST_CASE("Benchmark: Object Construction Performance")
     const std::string second      = "second";
     const std::string child       = "child";
 
-    BENCHMARK("fast_ber        - 1,000,000 x construct data")
+    FAST_BER_BENCHMARK("fast_ber        - 1,000,000 x construct data")
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -302,7 +619,7 @@ TEST_CASE("Benchmark: Object Construction Performance")
     }
 
 #ifdef INCLUDE_ASN1C
-    BENCHMARK("asn1c           - 1,000,000 x construct data")
+    FAST_BER_BENCHMARK("asn1c           - 1,000,000 x construct data")
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -369,7 +686,7 @@ TEST_CASE("Benchmark: Calculate Encoded Length Performance")
         decltype(collection.the_choice){fast_ber::in_place_index_t<1>(), "I chose a string!"}};
 
     size_t encoded_length = 0;
-    BENCHMARK("fast_ber        - 1,000,000 x encoded length")
+    FAST_BER_BENCHMARK("fast_ber        - 1,000,000 x encoded length")
     {
         for (int i = 0; i < iterations; i++)
         {
@@ -0,0 +1,111 @@
+#include "autogen/real_schema_sparse.hpp"
+
+#include "Benchmark.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <string>
+#include <vector>
+
+// Decoding batches of SGSN call detail records generated with --sparse-optionals. Most OPTIONAL members of a record are
+// absent, each costs a pointer rather than the full size of the member. With default storage a SGSNPDPRecord is over
+// 6 KB.
+
+const size_t sparse_batch_size = 10000;
+
+// Lists of traffic volumes holding as many elements in place as fit the inline budget, and holding five in place
+using TrafficVolumes   = fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::ListOfTrafficVolumes;
+using TrafficVolumesX5 = fast_ber::SequenceOf<fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition,
+                                              fast_ber::Id<fast_ber::Class::context_specific, 15>,
+                                              fast_ber::StorageMode::small_buffer_optimised, 5>;
+
+static_assert(sizeof(fast_ber::SGSN_2009A_CDR::SGSNPDPRecord) < 1024, "Sparse record");
+static_assert(sizeof(TrafficVolumes) * 2 < sizeof(TrafficVolumesX5), "Inline elements limited by size");
+
+std::vector<uint8_t> sparse_test_record()
+{
+    fast_ber::SGSN_2009A_CDR::SGSNPDPRecord record;
+    record.recordType        = 18;
+    record.servedIMSI        = "12345";
+    record.chargingID        = 77;
+    record.recordOpeningTime = "24:00:00T";
+    record.duration          = 3600;
+    record.nodeID            = "node";
+    record.listOfTrafficVolumes = fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::ListOfTrafficVolumes{
+        fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition{{}, {}, 1, 2, {}, "first"}};
+
+    std::vector<uint8_t>         buffer(5000, 0);
+    const fast_ber::EncodeResult result =
+        fast_ber::encode(absl::MakeSpan(buffer), fast_ber::SGSN_2009A_CDR::CallEventRecord(record));
+    REQUIRE(result.success);
+    buffer.resize(result.length);
+    return buffer;
+}
+
+TEST_CASE("Real Schema Performance: Decode sparse batch")
+{
+    const std::vector<uint8_t> encoded = sparse_test_record();
+    fast_ber::DecodeResult     res     = {true};
+
+    FAST_BER_BENCHMARK_PDUS("fast_ber        - decode sparse batch of 10000 SGSN records", sparse_batch_size,
+                            sparse_batch_size * encoded.size())
+    {
+        std::vector<fast_ber::SGSN_2009A_CDR::CallEventRecord> records(sparse_batch_size);
+        for (fast_ber::SGSN_2009A_CDR::CallEventRecord& record : records)
+        {
+            res.success &= fast_ber::decode(absl::MakeSpan(encoded), record).success;
+        }
+    }
+    REQUIRE(res.success);
+
+    fast_ber::Arena arena;
+    FAST_BER_BENCHMARK_PDUS("fast_ber        - decode sparse batch of 10000 SGSN records (arena)", sparse_batch_size,
+                            sparse_batch_size * encoded.size())
+    {
+        {
+            fast_ber::ArenaScope                                   scope(arena);
+            std::vector<fast_ber::SGSN_2009A_CDR::CallEventRecord> records(sparse_batch_size);
+            for (fast_ber::SGSN_2009A_CDR::CallEventRecord& record : records)
+            {
+                res.success &= fast_ber::decode(absl::MakeSpan(encoded), record).success;
+            }
+        }
+        arena.reset();
+    }
+    REQUIRE(res.success);
+}
+
+template <typename List>
+void traffic_volumes_benchmark_decode(size_t volumes, const std::string& name)
+{
+    List list;
+    for (size_t i = 0; i < volumes; i++)
+    {
+        list.push_back(fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition{{}, {}, 1000, 2000, {}, "24:00:00T"});
+    }
+
+    std::vector<uint8_t>         buffer(5000, 0);
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), list);
+    REQUIRE(encode_result.success);
+
+    fast_ber::DecodeResult res = {true};
+    FAST_BER_BENCHMARK("fast_ber        - decode 10000 traffic volume lists " + name + " (" +
+                       std::to_string(sizeof(List)) + " bytes)")
+    {
+        std::vector<List> lists(sparse_batch_size);
+        for (List& decoded : lists)
+        {
+            res.success &= fast_ber::decode(absl::MakeSpan(buffer.data(), encode_result.length), decoded).success;
+        }
+    }
+    REQUIRE(res.success);
+}
+
+TEST_CASE("Real Schema Performance: Traffic volume lists")
+{
+    for (size_t volumes : {1, 3})
+    {
+        traffic_volumes_benchmark_decode<TrafficVolumes>(volumes, std::to_string(volumes) + " volumes, automatic");
+        traffic_volumes_benchmark_decode<TrafficVolumesX5>(volumes, std::to_string(volumes) + " volumes, 5 inline");
+    }
+}
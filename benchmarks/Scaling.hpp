@@ -0,0 +1,175 @@
+#pragma once
+
+#include "Throughput.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Throughput of the same workload on one thread and on several threads pinned to distinct CPUs. Threads share nothing
+// but the library, so throughput per thread falling short of a single thread comes from contention on state hidden in
+// the library or the allocator.
+
+// Below this fraction of the single thread throughput per thread, parallel throughput is flagged as poor scaling. The
+// flag is advisory, timings on a shared or oversubscribed machine are too noisy to fail a test on.
+const double min_scaling_efficiency = 0.5;
+
+struct ScalingPoint
+{
+    size_t     threads;
+    Throughput throughput; // Summed over all threads
+    double     efficiency; // Throughput per thread relative to a single thread
+};
+
+// CPUs the process may run on, in order
+inline std::vector<int> available_cpus()
+{
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &set))
+            {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    if (cpus.empty())
+    {
+        const int count = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        for (int cpu = 0; cpu < count; cpu++)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+// Pins the calling thread to a CPU, returning false where affinity is not supported
+inline bool pin_thread(int cpu)
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+// Doubling from one thread to one per CPU, which is always included
+inline std::vector<size_t> scaling_thread_counts(size_t cpus)
+{
+    std::vector<size_t> counts;
+    for (size_t threads = 1; threads < cpus; threads *= 2)
+    {
+        counts.push_back(threads);
+    }
+    counts.push_back(std::max<size_t>(cpus, 1));
+    return counts;
+}
+
+// Runs passes on each thread for the given duration. make_worker(thread) is called on the thread before timing begins,
+// so the state of each thread is allocated by the thread itself, and returns the pass to run. Each pass processes
+// bytes and records.
+template <typename MakeWorker>
+Throughput measure_parallel_throughput(size_t threads, const std::vector<int>& cpus, size_t bytes, size_t records,
+                                       MakeWorker make_worker, double seconds = 0.2)
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::atomic<size_t>      ready{0};
+    std::atomic<bool>        start{false};
+    std::atomic<bool>        stop{false};
+    std::vector<uint64_t>    passes(threads);
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < threads; i++)
+    {
+        workers.emplace_back([&, i] {
+            pin_thread(cpus[i % cpus.size()]);
+            auto pass = make_worker(i);
+            pass(); // Warm up
+            ready++;
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+
+            uint64_t count = 0;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                pass();
+                count++;
+            }
+            passes[i] = count;
+        });
+    }
+    while (ready.load() < threads)
+    {
+        std::this_thread::yield();
+    }
+
+    const auto begin = Clock::now();
+    start            = true;
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    stop = true;
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    const double elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    uint64_t total = 0;
+    for (uint64_t count : passes)
+    {
+        total += count;
+    }
+    const double pass_seconds = total > 0 ? elapsed * threads / total : elapsed;
+    return Throughput{pass_seconds, static_cast<double>(bytes * total) / elapsed / 1e6,
+                      static_cast<double>(records * total) / elapsed};
+}
+
+template <typename MakeWorker>
+std::vector<ScalingPoint> measure_scaling(size_t bytes, size_t records, MakeWorker make_worker)
+{
+    const std::vector<int>    cpus = available_cpus();
+    std::vector<ScalingPoint> points;
+    for (size_t threads : scaling_thread_counts(cpus.size()))
+    {
+        const Throughput throughput = measure_parallel_throughput(threads, cpus, bytes, records, make_worker);
+        const double     single     = points.empty() ? throughput.records_per_second
+                                                     : points.front().throughput.records_per_second;
+        points.push_back(ScalingPoint{threads, throughput, throughput.records_per_second / (single * threads)});
+    }
+    return points;
+}
+
+inline bool is_poor_scaling(const ScalingPoint& point) { return point.efficiency < min_scaling_efficiency; }
+
+inline void print_scaling(const std::string& name, const std::vector<ScalingPoint>& points)
+{
+    for (const ScalingPoint& point : points)
+    {
+        std::printf("%-72s %3zu threads %10.1f MB/s %12.0f records/s %6.1f%% efficiency%s\n", name.c_str(),
+                    point.threads, point.throughput.megabytes_per_second, point.throughput.records_per_second,
+                    point.efficiency * 100, is_poor_scaling(point) ? " POOR SCALING" : "");
+    }
+}
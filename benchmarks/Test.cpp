@@ -1,3 +1,103 @@
-#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_RUNNER
+
+#include "Benchmark.hpp"
 
 #include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Catch options are accepted as usual, along with
+//   --json FILE        Write the results of the benchmarks to FILE
+//   --compare FILE     Compare the results with those in FILE, failing if a benchmark regressed. Benchmarks run in
+//                      only one of the two are listed, as a run filtered to some benchmarks never runs the rest
+//   --require-all      Also fail the comparison if a benchmark was run in only one of the two
+//   --threshold PCT    Slowdown of the median beyond which a benchmark has regressed (default 10)
+//   --perf             Report hardware counters of each benchmark, where perf_event_open provides them
+int main(int argc, char* argv[])
+{
+    std::string        json_path;
+    std::string        baseline_path;
+    double             threshold   = 0.1;
+    bool               require_all = false;
+    std::vector<char*> catch_args;
+    for (int i = 0; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        if (i > 0 && arg == "--perf")
+        {
+            hardware_counters_enabled() = true;
+            continue;
+        }
+        if (i > 0 && arg == "--require-all")
+        {
+            require_all = true;
+            continue;
+        }
+        if (i > 0 && i + 1 < argc && (arg == "--json" || arg == "--compare" || arg == "--threshold"))
+        {
+            const std::string value = argv[++i];
+            if (arg == "--json")
+            {
+                json_path = value;
+            }
+            else if (arg == "--compare")
+            {
+                baseline_path = value;
+            }
+            else
+            {
+                threshold = std::atof(value.c_str()) / 100;
+            }
+            continue;
+        }
+        catch_args.push_back(argv[i]);
+    }
+
+    if (hardware_counters_enabled() && !PerfCounters().any_available())
+    {
+        std::fprintf(stderr, "Hardware counters are not available, only times are reported\n");
+        hardware_counters_enabled() = false;
+    }
+
+    const int result = Catch::Session().run(static_cast<int>(catch_args.size()), catch_args.data());
+
+    if (!json_path.empty() && !write_benchmark_json(json_path, benchmark_results()))
+    {
+        std::fprintf(stderr, "Failed to write benchmark results to %s\n", json_path.c_str());
+        return EXIT_FAILURE;
+    }
+    if (!baseline_path.empty())
+    {
+        std::vector<BenchmarkResult> baseline;
+        if (!read_benchmark_json(baseline_path, baseline))
+        {
+            std::fprintf(stderr, "Failed to read benchmark results from %s\n", baseline_path.c_str());
+            return EXIT_FAILURE;
+        }
+
+        const std::vector<BenchmarkComparison> comparisons =
+            compare_benchmarks(baseline, benchmark_results(), threshold);
+        print_comparisons(comparisons);
+        const auto count = [&](ComparisonStatus status) {
+            return std::count_if(comparisons.begin(), comparisons.end(),
+                                 [status](const BenchmarkComparison& c) { return c.status == status; });
+        };
+        const long regressions = count(ComparisonStatus::regression);
+        const long missing     = count(ComparisonStatus::missing);
+        const long unmatched   = count(ComparisonStatus::unmatched);
+        if (regressions + missing + unmatched > 0)
+        {
+            std::printf("%ld of %zu benchmarks regressed by more than %.1f%%, %ld missing, %ld not in the baseline\n",
+                        regressions, comparisons.size(), threshold * 100, missing, unmatched);
+        }
+        if (regressions > 0 || (require_all && missing + unmatched > 0))
+        {
+            return result != 0 ? result : EXIT_FAILURE;
+        }
+    }
+    return result;
+}
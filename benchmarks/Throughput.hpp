@@ -0,0 +1,42 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+// Throughput of a pass over a corpus, from the fastest of several timed passes
+struct Throughput
+{
+    double seconds; // Duration of the fastest pass
+    double megabytes_per_second;
+    double records_per_second;
+};
+
+// Times passes until min_seconds have elapsed, and at least min_passes have run
+template <typename Pass>
+Throughput measure_throughput(size_t bytes, size_t records, Pass pass, double min_seconds = 0.2, int min_passes = 5)
+{
+    using Clock = std::chrono::steady_clock;
+
+    double     best   = 0.0;
+    int        passes = 0;
+    const auto end    = Clock::now() + std::chrono::duration<double>(min_seconds);
+    while (passes < min_passes || Clock::now() < end)
+    {
+        const auto start = Clock::now();
+        pass();
+        const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        best                 = (passes == 0 || elapsed < best) ? elapsed : best;
+        passes++;
+    }
+
+    const double seconds = best > 0.0 ? best : 1e-9;
+    return Throughput{best, static_cast<double>(bytes) / seconds / 1e6, static_cast<double>(records) / seconds};
+}
+
+inline void print_throughput(const std::string& name, const Throughput& throughput)
+{
+    std::printf("%-72s %10.1f MB/s %12.0f records/s\n", name.c_str(), throughput.megabytes_per_second,
+                throughput.records_per_second);
+}
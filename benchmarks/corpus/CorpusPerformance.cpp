@@ -0,0 +1,357 @@
+#include "autogen/real_schema.hpp"
+
+#include "Benchmark.hpp"
+#include "Scaling.hpp"
+#include "Throughput.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// Throughput over a corpus of varied SGSN call detail records, closer to production traffic than a single repeated
+// record. Most records are PDP context records, with a varying set of optional members, traffic volume lists of up to
+// eight changes and values of varying length. The rest are mobile originated and terminated SMS records. The same
+// workloads are run on several threads, to show contention on state shared between threads.
+
+namespace
+{
+const size_t corpus_size = 1000;
+
+namespace cdr = fast_ber::SGSN_2009A_CDR;
+
+// Field values of a record before construction, as held by the network element producing it
+struct RecordSource
+{
+    enum class Kind
+    {
+        pdp,
+        sms_originated,
+        sms_terminated,
+    };
+
+    Kind                                     kind;
+    uint32_t                                 optional_members; // Bit mask of the optional members present
+    std::string                              imsi;
+    std::string                              imei;
+    std::string                              msisdn;
+    std::string                              node_id;
+    std::string                              access_point_name;
+    std::string                              time_stamp;
+    std::array<uint8_t, 4>                   address;
+    int64_t                                  charging_id;
+    int64_t                                  duration;
+    int64_t                                  sequence_number;
+    std::vector<std::pair<int64_t, int64_t>> traffic_volumes; // Uplink and downlink bytes
+};
+
+std::string digits(std::mt19937& random, size_t length)
+{
+    std::string result(length, '0');
+    for (char& c : result)
+    {
+        c = static_cast<char>('0' + random() % 10);
+    }
+    return result;
+}
+
+// Values spanning one to eight encoded bytes
+int64_t varied_integer(std::mt19937& random)
+{
+    const unsigned bits = 4 + random() % 58;
+    return static_cast<int64_t>((uint64_t(random()) << 32 | random()) & ((uint64_t(1) << bits) - 1));
+}
+
+// Deterministic for a given size, the raw output of mt19937 is fully specified by the standard
+std::vector<RecordSource> make_corpus(size_t size)
+{
+    std::mt19937              random(2020);
+    std::vector<RecordSource> corpus;
+    corpus.reserve(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        const uint32_t kind = random() % 10;
+        RecordSource   source;
+        source.kind              = kind < 8 ? RecordSource::Kind::pdp
+                                            : kind == 8 ? RecordSource::Kind::sms_originated
+                                                        : RecordSource::Kind::sms_terminated;
+        source.optional_members  = static_cast<uint32_t>(random());
+        source.imsi              = digits(random, 15);
+        source.imei              = digits(random, 16);
+        source.msisdn            = digits(random, 8 + random() % 8);
+        source.node_id           = "sgsn-" + digits(random, 1 + random() % 12);
+        source.access_point_name = "apn" + digits(random, random() % 30) + ".mnc022.mcc111.gprs";
+        source.time_stamp        = "2001" + digits(random, 5);
+        source.address           = {10, static_cast<uint8_t>(random()), static_cast<uint8_t>(random()), 1};
+        source.charging_id       = static_cast<int64_t>(random());
+        source.duration          = random() % 100000;
+        source.sequence_number   = varied_integer(random);
+
+        const size_t volumes = source.kind == RecordSource::Kind::pdp ? random() % 9 : 0;
+        for (size_t j = 0; j < volumes; j++)
+        {
+            source.traffic_volumes.emplace_back(varied_integer(random), varied_integer(random));
+        }
+        corpus.push_back(source);
+    }
+    return corpus;
+}
+
+bool has(const RecordSource& source, int member) { return (source.optional_members >> member) & 1; }
+
+cdr::CallEventRecord make_pdp_record(const RecordSource& source)
+{
+    cdr::SGSNPDPRecord record;
+    record.recordType              = 18;
+    record.servedIMSI              = source.imsi;
+    record.chargingID              = source.charging_id;
+    record.ggsnAddressUsed         = cdr::GSNAddress{cdr::IPBinaryAddress{
+        cdr::IPBinaryAddress::IPBinV4Address{absl::MakeSpan(source.address.data(), source.address.size())}}};
+    record.recordOpeningTime       = source.time_stamp;
+    record.duration                = source.duration;
+    record.causeForRecClosing      = 0;
+    record.chargingCharacteristics = "\x08\x00";
+    if (has(source, 0))
+    {
+        record.servedIMEI = source.imei;
+    }
+    if (has(source, 1))
+    {
+        record.servedMSISDN = source.msisdn;
+    }
+    if (has(source, 2))
+    {
+        record.nodeID = source.node_id;
+    }
+    if (has(source, 3))
+    {
+        record.accessPointNameNI = source.access_point_name;
+    }
+    if (has(source, 4))
+    {
+        record.recordSequenceNumber = source.sequence_number;
+    }
+    if (has(source, 5))
+    {
+        record.localSequenceNumber = source.sequence_number & 0xFFFFFFFF;
+    }
+    if (has(source, 6))
+    {
+        record.rATType = 1;
+    }
+    if (has(source, 7))
+    {
+        record.diagnostics = cdr::Diagnostics(fast_ber::Integer<fast_ber::Id<fast_ber::Class::context_specific, 0>>(
+            static_cast<int64_t>(source.optional_members % 128)));
+    }
+    if (!source.traffic_volumes.empty())
+    {
+        cdr::SGSNPDPRecord::ListOfTrafficVolumes volumes;
+        for (const std::pair<int64_t, int64_t>& volume : source.traffic_volumes)
+        {
+            volumes.push_back(cdr::ChangeOfCharCondition{
+                {}, {}, volume.first, volume.second, cdr::ChangeCondition::Values::tariffTime, source.time_stamp});
+        }
+        record.listOfTrafficVolumes = volumes;
+    }
+    return cdr::CallEventRecord(record);
+}
+
+template <typename SmsRecord>
+SmsRecord make_sms_record(const RecordSource& source, int64_t record_type)
+{
+    SmsRecord record;
+    record.recordType              = record_type;
+    record.servedIMSI              = source.imsi;
+    record.eventTimeStamp          = source.time_stamp;
+    record.chargingCharacteristics = "\x08\x00";
+    if (has(source, 0))
+    {
+        record.servedIMEI = source.imei;
+    }
+    if (has(source, 1))
+    {
+        record.servedMSISDN = source.msisdn;
+    }
+    if (has(source, 2))
+    {
+        record.nodeID = source.node_id;
+    }
+    if (has(source, 5))
+    {
+        record.localSequenceNumber = source.sequence_number & 0xFFFFFFFF;
+    }
+    return record;
+}
+
+cdr::CallEventRecord make_record(const RecordSource& source)
+{
+    switch (source.kind)
+    {
+    case RecordSource::Kind::sms_originated:
+    {
+        cdr::SGSNSMORecord record = make_sms_record<cdr::SGSNSMORecord>(source, 21);
+        record.messageReference   = source.msisdn;
+        return cdr::CallEventRecord(record);
+    }
+    case RecordSource::Kind::sms_terminated:
+        return cdr::CallEventRecord(make_sms_record<cdr::SGSNSMTRecord>(source, 22));
+    default:
+        return make_pdp_record(source);
+    }
+}
+
+// Records encoded back to back, with the offset of each
+struct EncodedCorpus
+{
+    std::vector<uint8_t> data;
+    std::vector<size_t>  offsets;
+
+    absl::Span<const uint8_t> record(size_t i) const
+    {
+        const size_t end = i + 1 < offsets.size() ? offsets[i + 1] : data.size();
+        return absl::MakeSpan(data.data() + offsets[i], end - offsets[i]);
+    }
+};
+
+// Encodes the records into output, returning the total length, or zero on failure
+size_t encode_corpus(const std::vector<cdr::CallEventRecord>& records, std::vector<uint8_t>& output,
+                     std::vector<size_t>* offsets = nullptr)
+{
+    size_t length = 0;
+    for (const cdr::CallEventRecord& record : records)
+    {
+        if (offsets)
+        {
+            offsets->push_back(length);
+        }
+        const fast_ber::EncodeResult res =
+            fast_ber::encode(absl::MakeSpan(output.data() + length, output.size() - length), record);
+        if (!res.success)
+        {
+            return 0;
+        }
+        length += res.length;
+    }
+    return length;
+}
+
+// A copy of the corpus with the buffers to process it, owned by a single thread
+struct CorpusWorker
+{
+    const std::vector<RecordSource>*  sources;
+    std::vector<cdr::CallEventRecord> records;
+    EncodedCorpus                     corpus;
+    std::vector<uint8_t>              output;
+    std::vector<cdr::CallEventRecord> decoded;
+    bool                              success;
+
+    explicit CorpusWorker(const std::vector<RecordSource>& record_sources)
+        : sources(&record_sources), output(record_sources.size() * 2000), decoded(record_sources.size()), success(true)
+    {
+        for (const RecordSource& source : record_sources)
+        {
+            records.push_back(make_record(source));
+        }
+        corpus.data.resize(encode_corpus(records, output, &corpus.offsets));
+        std::copy(output.begin(), output.begin() + corpus.data.size(), corpus.data.begin());
+        output.resize(corpus.data.size());
+    }
+
+    void construct()
+    {
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            records[i] = make_record((*sources)[i]);
+        }
+    }
+    void encode() { success &= encode_corpus(records, output) == corpus.data.size(); }
+    void decode()
+    {
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            success &= fast_ber::decode(corpus.record(i), decoded[i]).success;
+        }
+    }
+    void round_trip()
+    {
+        decode();
+        success &= encode_corpus(decoded, output) == corpus.data.size();
+    }
+    // Every record truncated by a byte, so every decode fails and reports an error
+    void decode_truncated()
+    {
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            const absl::Span<const uint8_t> record = corpus.record(i);
+            success &= !fast_ber::decode(record.subspan(0, record.size() - 1), decoded[i]).success;
+        }
+    }
+};
+
+std::string corpus_name(const std::string& operation, const EncodedCorpus& corpus)
+{
+    return "fast_ber        - " + operation + " SGSN corpus (" + std::to_string(corpus.offsets.size()) + " records, " +
+           std::to_string(corpus.data.size()) + " bytes)";
+}
+
+// Each thread runs the operation on its own copy of the corpus
+template <typename Operation>
+void benchmark_scaling(const std::string& name, const std::vector<RecordSource>& sources, const CorpusWorker& reference,
+                       Operation operation)
+{
+    std::vector<std::unique_ptr<CorpusWorker>> workers(available_cpus().size());
+    const std::vector<ScalingPoint>            points =
+        measure_scaling(reference.corpus.data.size(), sources.size(), [&](size_t thread) {
+            workers[thread].reset(new CorpusWorker(sources));
+            CorpusWorker* worker = workers[thread].get();
+            return [worker, operation] { (worker->*operation)(); };
+        });
+    print_scaling(corpus_name(name, reference.corpus), points);
+
+    for (const std::unique_ptr<CorpusWorker>& worker : workers)
+    {
+        REQUIRE((!worker || worker->success));
+    }
+}
+} // namespace
+
+TEST_CASE("Corpus Performance: SGSN call detail records")
+{
+    const std::vector<RecordSource> sources = make_corpus(corpus_size);
+    CorpusWorker                    worker(sources);
+    REQUIRE(worker.corpus.data.size() > 0);
+
+    const EncodedCorpus& corpus = worker.corpus;
+    const size_t         bytes  = corpus.data.size();
+    FAST_BER_BENCHMARK_PDUS(corpus_name("construct", corpus), corpus_size, bytes) { worker.construct(); };
+    FAST_BER_BENCHMARK_PDUS(corpus_name("encode", corpus), corpus_size, bytes) { worker.encode(); };
+    FAST_BER_BENCHMARK_PDUS(corpus_name("decode", corpus), corpus_size, bytes) { worker.decode(); };
+    FAST_BER_BENCHMARK_PDUS(corpus_name("round trip", corpus), corpus_size, bytes) { worker.round_trip(); };
+    REQUIRE(worker.success);
+    REQUIRE(worker.decoded == worker.records);
+    REQUIRE(worker.output == corpus.data);
+
+    print_throughput(corpus_name("construct", corpus),
+                     measure_throughput(bytes, corpus_size, [&] { worker.construct(); }));
+    print_throughput(corpus_name("encode", corpus), measure_throughput(bytes, corpus_size, [&] { worker.encode(); }));
+    print_throughput(corpus_name("decode", corpus), measure_throughput(bytes, corpus_size, [&] { worker.decode(); }));
+    print_throughput(corpus_name("round trip", corpus),
+                     measure_throughput(bytes, corpus_size, [&] { worker.round_trip(); }));
+    REQUIRE(worker.success);
+}
+
+TEST_CASE("Corpus Performance: SGSN call detail records on several threads")
+{
+    const std::vector<RecordSource> sources = make_corpus(corpus_size);
+    const CorpusWorker              reference(sources);
+
+    benchmark_scaling("encode", sources, reference, &CorpusWorker::encode);
+    benchmark_scaling("decode", sources, reference, &CorpusWorker::decode);
+    benchmark_scaling("round trip", sources, reference, &CorpusWorker::round_trip);
+    benchmark_scaling("decode failure", sources, reference, &CorpusWorker::decode_truncated);
+}
@@ -4,11 +4,12 @@ if (DEFINED fast_ber_LIB_DIRS_RELEASE) # Hack to set compiler location on conan
     set(FAST_BER_COMPILER ${fast_ber_LIB_DIRS_RELEASE}/../bin/fast_ber_compiler)
 endif()
 
+# Additional arguments are passed to the compiler as options, such as --arena
 function(fast_ber_generate input_file output_name)
     file (MAKE_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}/autogen)
     add_custom_command(
         OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/autogen/${output_name}.hpp
-        COMMAND ${FAST_BER_COMPILER} ${input_file} ${CMAKE_CURRENT_BINARY_DIR}/autogen/${output_name}
+        COMMAND ${FAST_BER_COMPILER} ${ARGN} ${input_file} ${CMAKE_CURRENT_BINARY_DIR}/autogen/${output_name}
         DEPENDS ${FAST_BER_COMPILER} ${input_file}
     )
 endfunction(fast_ber_generate)
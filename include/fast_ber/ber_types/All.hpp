@@ -21,6 +21,7 @@
 #include "IRI.hpp"
 #include "ISO646String.hpp"
 #include "Integer.hpp"
+#include "NativeInteger.hpp"
 #include "Null.hpp"
 #include "NumericString.hpp"
 #include "ObjectIdentifier.hpp"
@@ -44,3 +45,4 @@
 #include "VisibleString.hpp"
 
 #include "Any.hpp"
+#include "View.hpp"
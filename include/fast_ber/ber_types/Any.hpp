@@ -19,6 +19,9 @@ struct Any : AnyTypes
 
     std::size_t  encoded_length() const noexcept { return this->encoded_length_old(); }
     EncodeResult encode(absl::Span<uint8_t> output) const noexcept { return this->encode_old(output); }
+    EncodeResult encode_reverse(absl::Span<uint8_t> output) const noexcept { return this->encode_reverse_old(output); }
+    std::size_t  encoded_length(EncodePlan&) const noexcept { return encoded_length(); }
+    EncodeResult encode(absl::Span<uint8_t> output, EncodePlan&) const noexcept { return encode(output); }
     DecodeResult decode(BerView input) noexcept { return this->decode_old(input); }
 };
 
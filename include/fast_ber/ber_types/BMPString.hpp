@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::bmp_string>>
-using BMPString = fast_ber::StringImpl<UniversalTag::bmp_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::bmp_string>, typename Storage = BerStorage>
+using BMPString = fast_ber::StringImpl<UniversalTag::bmp_string, Identifier, Storage>;
 }
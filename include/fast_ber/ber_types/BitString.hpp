@@ -4,6 +4,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::bit_string>>
-using BitString = fast_ber::StringImpl<UniversalTag::bit_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::bit_string>, typename Storage = BerStorage>
+using BitString = fast_ber::StringImpl<UniversalTag::bit_string, Identifier, Storage>;
 }
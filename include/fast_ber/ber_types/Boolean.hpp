@@ -43,6 +43,9 @@ class Boolean
 
     constexpr static size_t encoded_length() noexcept;
     EncodeResult            encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult            encode_reverse(absl::Span<uint8_t> buffer) const noexcept;
+    size_t                  encoded_length(EncodePlan&) const noexcept { return encoded_length(); }
+    EncodeResult            encode(absl::Span<uint8_t> output, EncodePlan&) const noexcept { return encode(output); }
     DecodeResult            decode(BerView input) noexcept;
 
     using AsnId = Identifier;
@@ -98,33 +101,50 @@ constexpr size_t Boolean<Identifier>::encoded_length() noexcept
 template <typename Identifier>
 EncodeResult Boolean<Identifier>::encode(absl::Span<uint8_t> output) const noexcept
 {
+    FAST_BER_COUNTER(counter, encode, "Boolean", nullptr);
     if (output.size() < this->ber().size())
     {
+        FAST_BER_COUNT(counter, 0, false);
         return EncodeResult{false, 0};
     }
 
     std::memcpy(output.data(), this->ber().data(), this->ber().size());
+    FAST_BER_COUNT(counter, this->ber().size(), true);
     return EncodeResult{true, this->ber().size()};
 }
 
+template <typename Identifier>
+EncodeResult Boolean<Identifier>::encode_reverse(absl::Span<uint8_t> output) const noexcept
+{
+    FAST_BER_COUNTER(counter, encode, "Boolean", nullptr);
+    return FAST_BER_COUNT_ENCODED(counter, prepend_ber(output, this->ber()));
+}
+
 template <typename Identifier>
 DecodeResult Boolean<Identifier>::decode(BerView input) noexcept
 {
+    FAST_BER_COUNTER(counter, decode, "Boolean", nullptr);
     if (!has_correct_header(input, Identifier{}, Construction::primitive))
     {
+        FAST_BER_ERROR(input, "Boolean");
+        FAST_BER_COUNT(counter, input.ber_length(), false);
         return DecodeResult{false};
     }
 
     if (Identifier::depth() == 1 && input.content_length() == 1)
     {
         m_data.back() = *input.content_data();
+        FAST_BER_COUNT(counter, input.ber_length(), true);
         return DecodeResult{true};
     }
     if (Identifier::depth() == 2 && input.begin()->content_length() == 1)
     {
         m_data.back() = *input.begin()->content_data();
+        FAST_BER_COUNT(counter, input.ber_length(), true);
         return DecodeResult{true};
     }
+    FAST_BER_ERROR(ErrorCode::invalid_contents, "Boolean", input.identifier());
+    FAST_BER_COUNT(counter, input.ber_length(), false);
     return DecodeResult{false};
 }
 
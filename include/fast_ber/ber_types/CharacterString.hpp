@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::character_string>>
-using CharacterString = fast_ber::StringImpl<UniversalTag::character_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::character_string>, typename Storage = BerStorage>
+using CharacterString = fast_ber::StringImpl<UniversalTag::character_string, Identifier, Storage>;
 }
@@ -46,6 +46,20 @@ EncodeResult wrap_with_ber_header(absl::Span<uint8_t>, size_t, ChoiceId<Identifi
     return {};
 }
 
+template <typename... Identifiers>
+EncodeResult prepend_ber_header(absl::Span<uint8_t>, size_t, ChoiceId<Identifiers...>)
+{
+    assert(0);
+    return {};
+}
+
+template <typename... Identifiers>
+size_t encode_planned_header(absl::Span<uint8_t>, size_t, ChoiceId<Identifiers...>)
+{
+    assert(0);
+    return {};
+}
+
 template <typename... Identifiers>
 bool has_correct_header(BerView, ChoiceId<Identifiers...>, Construction)
 {
@@ -108,6 +122,18 @@ struct ChoiceImplementation<Choices<Types...>, StorageMode::dynamic>
     using InPlaceType = dynamic::in_place_type_t<T>;
 };
 
+template <typename... Types>
+struct ChoiceImplementation<Choices<Types...>, StorageMode::arena>
+{
+    using Type = dynamic::ArenaVariant<Types...>;
+
+    template <size_t i>
+    using InPlaceIndex = dynamic::in_place_index_t<i>;
+
+    template <typename T>
+    using InPlaceType = dynamic::in_place_type_t<T>;
+};
+
 inline void print(std::ostream&) noexcept {}
 
 template <typename Identifier, typename... Identifiers>
@@ -228,48 +254,49 @@ get(const Choice<Choices<Types...>, Identifier, StorageMode::static_>&& v)
     return absl::get<I>(v.base());
 }
 
-template <class T, typename... Types, typename Identifier>
-T&& get(Choice<Choices<Types...>, Identifier, StorageMode::dynamic>&& v)
+// Overloads for choices with dynamic or arena storage, the static_ overloads above are more specialised
+template <class T, typename... Types, typename Identifier, StorageMode storage>
+T&& get(Choice<Choices<Types...>, Identifier, storage>&& v)
 {
     return fast_ber::dynamic::get<T>(v.base());
 }
 
-template <class T, typename... Types, typename Identifier>
-const T& get(const Choice<Choices<Types...>, Identifier, StorageMode::dynamic>& v)
+template <class T, typename... Types, typename Identifier, StorageMode storage>
+const T& get(const Choice<Choices<Types...>, Identifier, storage>& v)
 {
     return fast_ber::dynamic::get<T>(v.base());
 }
 
-template <class T, typename... Types, typename Identifier>
-const T&& get(const Choice<Choices<Types...>, Identifier, StorageMode::dynamic>&& v)
+template <class T, typename... Types, typename Identifier, StorageMode storage>
+const T&& get(const Choice<Choices<Types...>, Identifier, storage>&& v)
 {
     return fast_ber::dynamic::get<T>(v.base());
 }
 
-template <std::size_t I, typename... Types, typename Identifier>
-variant_alternative_t<I, Choice<Choices<Types...>, Identifier, StorageMode::dynamic>>&
-get(Choice<Choices<Types...>, Identifier, StorageMode::dynamic>& v)
+template <std::size_t I, typename... Types, typename Identifier, StorageMode storage>
+variant_alternative_t<I, Choice<Choices<Types...>, Identifier, storage>>&
+get(Choice<Choices<Types...>, Identifier, storage>& v)
 {
     return fast_ber::dynamic::get<I>(v.base());
 }
 
-template <std::size_t I, typename... Types, typename Identifier>
-variant_alternative_t<I, Choice<Choices<Types...>, Identifier, StorageMode::dynamic>>&&
-get(Choice<Choices<Types...>, Identifier, StorageMode::dynamic>&& v)
+template <std::size_t I, typename... Types, typename Identifier, StorageMode storage>
+variant_alternative_t<I, Choice<Choices<Types...>, Identifier, storage>>&&
+get(Choice<Choices<Types...>, Identifier, storage>&& v)
 {
     return fast_ber::dynamic::get<I>(v.base());
 }
 
-template <std::size_t I, typename... Types, typename Identifier>
-const variant_alternative_t<I, Choice<Choices<Types...>, Identifier, StorageMode::dynamic>>&
-get(const Choice<Choices<Types...>, Identifier, StorageMode::dynamic>& v)
+template <std::size_t I, typename... Types, typename Identifier, StorageMode storage>
+const variant_alternative_t<I, Choice<Choices<Types...>, Identifier, storage>>&
+get(const Choice<Choices<Types...>, Identifier, storage>& v)
 {
     return fast_ber::dynamic::get<I>(v.base());
 }
 
-template <std::size_t I, typename... Types, typename Identifier>
-const variant_alternative_t<I, Choice<Choices<Types...>, Identifier, StorageMode::dynamic>>&&
-get(const Choice<Choices<Types...>, Identifier, StorageMode::dynamic>&& v)
+template <std::size_t I, typename... Types, typename Identifier, StorageMode storage>
+const variant_alternative_t<I, Choice<Choices<Types...>, Identifier, storage>>&&
+get(const Choice<Choices<Types...>, Identifier, storage>&& v)
 {
     return fast_ber::dynamic::get<I>(v.base());
 }
@@ -304,32 +331,32 @@ get_if(const Choice<Choices<Types...>, Identifier, StorageMode::static_>* v) noe
     return v ? absl::get_if<T>(&(v->base())) : nullptr;
 }
 
-template <std::size_t I, typename... Types, typename Identifier>
+template <std::size_t I, typename... Types, typename Identifier, StorageMode storage>
 constexpr typename std::add_pointer<
-    variant_alternative_t<I, Choice<Choices<Types...>, Identifier, StorageMode::dynamic>>>::type
-get_if(Choice<Choices<Types...>, Identifier, StorageMode::dynamic>* v) noexcept
+    variant_alternative_t<I, Choice<Choices<Types...>, Identifier, storage>>>::type
+get_if(Choice<Choices<Types...>, Identifier, storage>* v) noexcept
 {
     return v ? fast_ber::dynamic::get_if<I>(&(v->base())) : nullptr;
 }
 
-template <std::size_t I, typename... Types, typename Identifier>
+template <std::size_t I, typename... Types, typename Identifier, StorageMode storage>
 constexpr typename std::add_pointer<
-    const variant_alternative_t<I, Choice<Choices<Types...>, Identifier, StorageMode::dynamic>>>::type
-get_if(const Choice<Choices<Types...>, Identifier, StorageMode::dynamic>* v) noexcept
+    const variant_alternative_t<I, Choice<Choices<Types...>, Identifier, storage>>>::type
+get_if(const Choice<Choices<Types...>, Identifier, storage>* v) noexcept
 {
     return v ? fast_ber::dynamic::get_if<I>(&(v->base())) : nullptr;
 }
 
-template <class T, typename... Types, typename Identifier>
+template <class T, typename... Types, typename Identifier, StorageMode storage>
 constexpr typename std::add_pointer<T>::type
-get_if(Choice<Choices<Types...>, Identifier, StorageMode::dynamic>* v) noexcept
+get_if(Choice<Choices<Types...>, Identifier, storage>* v) noexcept
 {
     return v ? fast_ber::dynamic::get_if<T>(&(v->base())) : nullptr;
 }
 
-template <class T, typename... Types, typename Identifier>
+template <class T, typename... Types, typename Identifier, StorageMode storage>
 constexpr typename std::add_pointer<const T>::type
-get_if(const Choice<Choices<Types...>, Identifier, StorageMode::dynamic>* v) noexcept
+get_if(const Choice<Choices<Types...>, Identifier, storage>* v) noexcept
 {
     return v ? fast_ber::dynamic::get_if<T>(&(v->base())) : nullptr;
 }
@@ -449,6 +476,18 @@ struct Choice<Choices<Types...>, Identifier, storage>
         return m_base.template emplace<i>(il, std::forward<Args>(args)...);
     }
 
+    // Return alternative i to be decoded into. If it is already active it is kept, along with any storage it owns,
+    // rather than being destroyed and constructed again.
+    template <size_t i>
+    variant_alternative_t<i, Choice>& reuse_or_emplace()
+    {
+        if (index() == i)
+        {
+            return fast_ber::get<i>(*this);
+        }
+        return this->template emplace<i>();
+    }
+
     constexpr bool valueless_by_exception() const noexcept { return m_base.valueless_by_exception(); }
 
     constexpr std::size_t index() const noexcept { return m_base.index(); }
@@ -457,6 +496,7 @@ struct Choice<Choices<Types...>, Identifier, storage>
 
     size_t       encoded_length_old() const noexcept;
     EncodeResult encode_old(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse_old(absl::Span<uint8_t> buffer) const noexcept;
     DecodeResult decode_old(BerView input) noexcept;
 
     using AsnId = Identifier;
@@ -507,8 +547,8 @@ bool operator>=(const Choice<Choices<Variants...>, Identifier, storage>& a,
     return a.base() >= b.base();
 }
 
-template <typename Visitor, typename... Variants, typename Identifier>
-auto visit(Visitor&& vis, const Choice<Choices<Variants...>, Identifier, StorageMode::dynamic>& variant)
+template <typename Visitor, typename... Variants, typename Identifier, StorageMode storage>
+auto visit(Visitor&& vis, const Choice<Choices<Variants...>, Identifier, storage>& variant)
     -> decltype(fast_ber::dynamic::visit(vis, variant.base()))
 {
     return fast_ber::dynamic::visit(vis, variant.base());
@@ -622,11 +662,69 @@ EncodeResult Choice<Choices<Variants...>, Identifier, storage>::encode_old(absl:
     return encode_impl(buffer, *this);
 }
 
+template <size_t index, size_t max_depth, typename... Variants, typename Identifier, StorageMode storage,
+          typename std::enable_if<(!(index < max_depth)), int>::type = 0>
+EncodeResult encode_reverse_if(absl::Span<uint8_t>, const Choice<Choices<Variants...>, Identifier, storage>&) noexcept
+{
+    // No substitutions found, fail
+    return EncodeResult{false, 0};
+}
+
+template <size_t index, size_t max_depth, typename... Variants, typename Identifier, StorageMode storage,
+          typename std::enable_if<(index < max_depth), int>::type = 0>
+EncodeResult encode_reverse_if(absl::Span<uint8_t>                                      buffer,
+                               const Choice<Choices<Variants...>, Identifier, storage>& choice) noexcept
+{
+    if (choice.index() == index)
+    {
+        const auto* child = fast_ber::get_if<index>(&choice);
+        assert(child);
+
+        return encode_reverse(buffer, *child);
+    }
+    else
+    {
+        return encode_reverse_if<index + 1, max_depth>(buffer, choice);
+    }
+}
+
+template <typename... Variants, typename Identifier, StorageMode storage,
+          absl::enable_if_t<!IsChoiceId<Identifier>::value, int> = 0>
+EncodeResult encode_reverse_impl(absl::Span<uint8_t>                                      buffer,
+                                 const Choice<Choices<Variants...>, Identifier, storage>& choice) noexcept
+{
+    constexpr size_t   depth               = sizeof...(Variants);
+    const EncodeResult inner_encode_result = encode_reverse_if<0, depth>(buffer, choice);
+    if (!inner_encode_result.success)
+    {
+        return inner_encode_result;
+    }
+
+    return prepend_ber_header(buffer, inner_encode_result.length, Identifier{});
+}
+
+template <typename... Variants, typename Identifier, StorageMode storage,
+          absl::enable_if_t<IsChoiceId<Identifier>::value, int> = 0>
+EncodeResult encode_reverse_impl(absl::Span<uint8_t>                                      buffer,
+                                 const Choice<Choices<Variants...>, Identifier, storage>& choice) noexcept
+{
+    constexpr size_t depth = sizeof...(Variants);
+    return encode_reverse_if<0, depth>(buffer, choice);
+}
+
+template <typename... Variants, typename Identifier, StorageMode storage>
+EncodeResult
+Choice<Choices<Variants...>, Identifier, storage>::encode_reverse_old(absl::Span<uint8_t> buffer) const noexcept
+{
+    return encode_reverse_impl(buffer, *this);
+}
+
 template <int index, int max_depth, typename... Variants, typename Identifier, StorageMode storage,
           absl::enable_if_t<(!(index < max_depth)), int> = 0>
-DecodeResult decode_if(BerView, Choice<Choices<Variants...>, Identifier, storage>&) noexcept
+DecodeResult decode_if(BerView input, Choice<Choices<Variants...>, Identifier, storage>&) noexcept
 {
     // No substitutions found, fail
+    FAST_BER_ERROR(ErrorCode::unknown_choice, "Choice", input.identifier());
     return DecodeResult{false};
 }
 
@@ -638,7 +736,7 @@ DecodeResult decode_if(BerView input, Choice<Choices<Variants...>, ID, storage>&
 
     if (Identifier<T>::check_id_match(input.class_(), input.tag()))
     {
-        T& child = output.template emplace<index>();
+        T& child = output.template reuse_or_emplace<index>();
         return child.decode(input);
     }
     else
@@ -653,6 +751,7 @@ DecodeResult decode_impl(BerView input, Choice<Choices<Variants...>, Identifier,
 {
     if (!input.is_valid())
     {
+        FAST_BER_ERROR(ErrorCode::invalid_packet, "Choice");
         return DecodeResult{false};
     }
 
@@ -666,12 +765,14 @@ DecodeResult decode_impl(BerView input, Choice<Choices<Variants...>, Identifier,
 {
     if (!has_correct_header(input, Identifier{}, Construction::constructed))
     {
+        FAST_BER_ERROR(input, "Choice");
         return DecodeResult{false};
     }
 
     BerViewIterator child = (Identifier::depth() == 1) ? input.begin() : input.begin()->begin();
     if (!child->is_valid())
     {
+        FAST_BER_ERROR(ErrorCode::invalid_packet, "Choice");
         return DecodeResult{false};
     }
 
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::generalized_time>>
-using DateTime = GeneralizedTime<Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::generalized_time>, typename Storage = BerStorage>
+using DateTime = GeneralizedTime<Identifier, Storage>;
 } // namespace fast_ber
@@ -21,7 +21,7 @@ struct Default
     Default(Default&& rhs) noexcept;
     Default(BerView view) { decode(view); }
 
-    Default(const T& val) : m_item((m_default == val) ? absl::optional<T>() : absl::optional<T>(val)) {}
+    Default(const T& val) : m_item((default_value() == val) ? absl::optional<T>() : absl::optional<T>(val)) {}
     template <typename T2>
     Default(const T2& val) : m_item((DefaultValue::get_value() == val) ? absl::optional<T>() : absl::optional<T>(val))
     {
@@ -40,18 +40,22 @@ struct Default
     Default& operator=(const T2& val);
     Default& operator=(const char* val);
 
-    const T&              get() const noexcept { return is_default() ? m_default : *m_item; }
+    const T&              get() const noexcept { return is_default() ? default_value() : *m_item; }
     decltype(T{}.value()) value() const noexcept(T{}.value()) { return get()->value(); }
     bool                  is_default() const noexcept { return !m_item; }
     void                  set_to_default() noexcept { m_item = absl::nullopt; }
 
     size_t       encoded_length() const noexcept;
     EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept;
+    size_t       encoded_length(EncodePlan& plan) const;
+    EncodeResult encode(absl::Span<uint8_t> buffer, EncodePlan& plan) const noexcept;
     DecodeResult decode(BerView input) noexcept;
 
+    static const T& default_value() noexcept;
+
   private:
     absl::optional<T> m_item;
-    const T           m_default = T(DefaultValue::get_value());
 };
 
 template <typename T, typename DefaultValue>
@@ -60,6 +64,14 @@ struct IdentifierType<Default<T, DefaultValue>>
     using type = Identifier<T>;
 };
 
+// The default value is constructed once and shared by every instance, so a Default holds only the optional value
+template <typename T, typename DefaultValue>
+const T& Default<T, DefaultValue>::default_value() noexcept
+{
+    static const T value(DefaultValue::get_value());
+    return value;
+}
+
 template <typename T, typename DefaultValue>
 Default<T, DefaultValue>::Default(const Default<T, DefaultValue>& rhs) : m_item(rhs.m_item)
 {
@@ -102,7 +114,7 @@ Default<T, DefaultValue>& Default<T, DefaultValue>::operator=(const T2& val)
 template <typename T, typename DefaultValue>
 Default<T, DefaultValue>& Default<T, DefaultValue>::operator=(const T& val)
 {
-    if (m_default == val)
+    if (default_value() == val)
     {
         m_item = absl::nullopt;
     }
@@ -147,12 +159,54 @@ EncodeResult Default<T, DefaultValue>::encode(absl::Span<uint8_t> buffer) const
     }
 }
 
+template <typename T, typename DefaultValue>
+EncodeResult Default<T, DefaultValue>::encode_reverse(absl::Span<uint8_t> buffer) const noexcept
+{
+    if (is_default())
+    {
+        return {true, 0};
+    }
+    else
+    {
+        return m_item->encode_reverse(buffer);
+    }
+}
+
+template <typename T, typename DefaultValue>
+size_t Default<T, DefaultValue>::encoded_length(EncodePlan& plan) const
+{
+    if (is_default())
+    {
+        return 0;
+    }
+    else
+    {
+        return m_item->encoded_length(plan);
+    }
+}
+
+template <typename T, typename DefaultValue>
+EncodeResult Default<T, DefaultValue>::encode(absl::Span<uint8_t> buffer, EncodePlan& plan) const noexcept
+{
+    if (is_default())
+    {
+        return {true, 0};
+    }
+    else
+    {
+        return m_item->encode(buffer, plan);
+    }
+}
+
 template <typename T, typename DefaultValue>
 DecodeResult Default<T, DefaultValue>::decode(BerView input) noexcept
 {
     if (input.is_valid() && Identifier<T>::check_id_match(input.class_(), input.tag()))
     {
-        m_item = T();
+        if (!m_item)
+        {
+            m_item.emplace();
+        }
         return m_item->decode(input);
     }
     else if (!input.is_valid())
@@ -162,6 +216,7 @@ DecodeResult Default<T, DefaultValue>::decode(BerView input) noexcept
     }
     else
     {
+        FAST_BER_ERROR(ErrorCode::incorrect_header, "Default", input.identifier());
         return DecodeResult{false};
     }
 }
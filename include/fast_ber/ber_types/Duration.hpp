@@ -4,6 +4,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::generalized_time>>
-using Duration = GeneralizedTime<Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::generalized_time>, typename Storage = BerStorage>
+using Duration = GeneralizedTime<Identifier, Storage>;
 } // namespace fast_ber
@@ -1,13 +1,16 @@
 #pragma once
 
 #include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/ber_types/NativeInteger.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
 
 namespace fast_ber
 {
 
-template <typename EnumeratedType, typename Identifier = ExplicitId<UniversalTag::enumerated>>
+// The value is held by IntegerStorage, either Integer (encoded) or NativeInteger (native value)
+template <typename EnumeratedType, typename Identifier = ExplicitId<UniversalTag::enumerated>,
+          template <typename> class IntegerStorage = Integer>
 class Enumerated
 {
   public:
@@ -16,7 +19,7 @@ class Enumerated
     Enumerated() noexcept : m_val() {}
     Enumerated(EnumeratedType val) noexcept { assign(val); }
     template <typename Identifier2>
-    Enumerated(const Enumerated<EnumeratedType, Identifier2>& rhs) noexcept
+    Enumerated(const Enumerated<EnumeratedType, Identifier2, IntegerStorage>& rhs) noexcept
     {
         assign(rhs);
     }
@@ -27,7 +30,7 @@ class Enumerated
     EnumeratedType value() const noexcept { return static_cast<EnumeratedType>(m_val.value()); }
 
     template <typename Identifier2>
-    Enumerated& operator=(const Enumerated<EnumeratedType, Identifier2>& rhs) noexcept;
+    Enumerated& operator=(const Enumerated<EnumeratedType, Identifier2, IntegerStorage>& rhs) noexcept;
     Enumerated& operator=(EnumeratedType rhs) noexcept
     {
         assign(rhs);
@@ -35,13 +38,13 @@ class Enumerated
     }
 
     template <typename Identifier2>
-    bool operator==(const Enumerated<EnumeratedType, Identifier2>& rhs) const
+    bool operator==(const Enumerated<EnumeratedType, Identifier2, IntegerStorage>& rhs) const
     {
         return this->value() == rhs.value();
     }
 
     template <typename Identifier2>
-    bool operator!=(const Enumerated<EnumeratedType, Identifier2>& rhs) const
+    bool operator!=(const Enumerated<EnumeratedType, Identifier2, IntegerStorage>& rhs) const
     {
         return !(*this == rhs);
     }
@@ -50,7 +53,7 @@ class Enumerated
     bool operator!=(EnumeratedType rhs) const noexcept { return !(*this == rhs); }
 
     template <typename Identifier2>
-    void assign(const Enumerated<EnumeratedType, Identifier2>& rhs) noexcept
+    void assign(const Enumerated<EnumeratedType, Identifier2, IntegerStorage>& rhs) noexcept
     {
         m_val.assign(rhs.m_val);
     }
@@ -58,45 +61,62 @@ class Enumerated
 
     using AsnId = Identifier;
 
-    template <typename EnumeratedType2, typename Identifier2>
+    template <typename EnumeratedType2, typename Identifier2, template <typename> class IntegerStorage2>
     friend class Enumerated;
 
     size_t       encoded_length() const noexcept;
     EncodeResult encode(absl::Span<uint8_t> output) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> output) const noexcept;
+    size_t       encoded_length(EncodePlan&) const noexcept { return encoded_length(); }
+    EncodeResult encode(absl::Span<uint8_t> output, EncodePlan&) const noexcept { return encode(output); }
     DecodeResult decode(BerView input) noexcept;
 
   private:
-    Integer<Identifier> m_val;
+    IntegerStorage<Identifier> m_val;
 };
 
-template <typename EnumeratedType, typename Identifier>
-size_t Enumerated<EnumeratedType, Identifier>::encoded_length() const noexcept
+template <typename EnumeratedType, typename Identifier, template <typename> class IntegerStorage>
+size_t Enumerated<EnumeratedType, Identifier, IntegerStorage>::encoded_length() const noexcept
 {
     return this->m_val.encoded_length();
 }
 
-template <typename EnumeratedType, typename Identifier>
-EncodeResult Enumerated<EnumeratedType, Identifier>::encode(absl::Span<uint8_t> output) const noexcept
+template <typename EnumeratedType, typename Identifier, template <typename> class IntegerStorage>
+EncodeResult Enumerated<EnumeratedType, Identifier, IntegerStorage>::encode(absl::Span<uint8_t> output) const noexcept
 {
     return this->m_val.encode(output);
 }
 
-template <typename EnumeratedType, typename Identifier>
-DecodeResult Enumerated<EnumeratedType, Identifier>::decode(BerView input) noexcept
+template <typename EnumeratedType, typename Identifier, template <typename> class IntegerStorage>
+EncodeResult
+Enumerated<EnumeratedType, Identifier, IntegerStorage>::encode_reverse(absl::Span<uint8_t> output) const noexcept
+{
+    return this->m_val.encode_reverse(output);
+}
+
+template <typename EnumeratedType, typename Identifier, template <typename> class IntegerStorage>
+DecodeResult Enumerated<EnumeratedType, Identifier, IntegerStorage>::decode(BerView input) noexcept
 {
     return this->m_val.decode(input);
 }
 
-template <typename EnumeratedType, typename Identifier>
-const char* to_string(const Enumerated<EnumeratedType, Identifier>& obj)
+template <typename EnumeratedType, typename Identifier, template <typename> class IntegerStorage>
+const char* to_string(const Enumerated<EnumeratedType, Identifier, IntegerStorage>& obj)
 {
     return to_string(obj.value());
 }
 
-template <typename EnumeratedType, typename Identifier>
-std::ostream& operator<<(std::ostream& os, const Enumerated<EnumeratedType, Identifier>& obj) noexcept
+template <typename EnumeratedType, typename Identifier, template <typename> class IntegerStorage>
+std::ostream& operator<<(std::ostream& os, const Enumerated<EnumeratedType, Identifier, IntegerStorage>& obj) noexcept
 {
     return os << '"' << obj.value() << '"';
 }
 
+// Enumerated values are held at the full width of a NativeInteger
+template <typename Identifier>
+using NativeEnumeratedStorage = NativeInteger<Identifier>;
+
+template <typename EnumeratedType, typename Identifier = ExplicitId<UniversalTag::enumerated>>
+using NativeEnumerated = Enumerated<EnumeratedType, Identifier, NativeEnumeratedStorage>;
+
 } // namespace fast_ber
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::general_string>>
-using GeneralString = fast_ber::StringImpl<UniversalTag::general_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::general_string>, typename Storage = BerStorage>
+using GeneralString = fast_ber::StringImpl<UniversalTag::general_string, Identifier, Storage>;
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "fast_ber/util/CompactBerContainer.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
 #include "fast_ber/util/FixedIdBerContainer.hpp"
@@ -16,7 +17,7 @@ const std::string g_local_time_format                    = "%E4Y%m%d%H%M%S";
 const std::string g_universal_time_format                = "%E4Y%m%d%H%M%SZ";
 const std::string g_universal_time_with_time_zone_format = "%E4Y%m%d%H%M%S";
 
-template <typename Identifier = ExplicitId<UniversalTag::generalized_time>>
+template <typename Identifier = ExplicitId<UniversalTag::generalized_time>, typename Storage = BerStorage>
 class GeneralizedTime
 {
   public:
@@ -47,28 +48,31 @@ class GeneralizedTime
 
     size_t       encoded_length() const noexcept;
     EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept;
+    size_t       encoded_length(EncodePlan&) const noexcept { return encoded_length(); }
+    EncodeResult encode(absl::Span<uint8_t> output, EncodePlan&) const noexcept { return encode(output); }
     DecodeResult decode(BerView buffer) noexcept;
 
     using AsnId = Identifier;
 
   private:
-    FixedIdBerContainer<Identifier> m_contents;
+    typename Storage::template Container<Identifier> m_contents;
 };
 
-template <typename Identifier>
-bool operator==(const GeneralizedTime<Identifier>& lhs, const GeneralizedTime<Identifier>& rhs)
+template <typename Identifier, typename Storage>
+bool operator==(const GeneralizedTime<Identifier, Storage>& lhs, const GeneralizedTime<Identifier, Storage>& rhs)
 {
     return lhs.time() == rhs.time();
 }
 
-template <typename Identifier>
-bool operator!=(const GeneralizedTime<Identifier>& lhs, const GeneralizedTime<Identifier>& rhs)
+template <typename Identifier, typename Storage>
+bool operator!=(const GeneralizedTime<Identifier, Storage>& lhs, const GeneralizedTime<Identifier, Storage>& rhs)
 {
     return !(lhs == rhs);
 }
 
-template <typename Identifier>
-void GeneralizedTime<Identifier>::set_time(const absl::Time& time)
+template <typename Identifier, typename Storage>
+void GeneralizedTime<Identifier, Storage>::set_time(const absl::Time& time)
 {
     std::string time_str = absl::FormatTime(g_universal_time_format, time, absl::UTCTimeZone());
 
@@ -76,8 +80,8 @@ void GeneralizedTime<Identifier>::set_time(const absl::Time& time)
         absl::Span<const uint8_t>(reinterpret_cast<const uint8_t*>(time_str.data()), time_str.length()));
 }
 
-template <typename Identifier>
-void GeneralizedTime<Identifier>::set_time(const absl::CivilSecond& cs)
+template <typename Identifier, typename Storage>
+void GeneralizedTime<Identifier, Storage>::set_time(const absl::CivilSecond& cs)
 {
     std::string time_str =
         absl::FormatTime(g_local_time_format, absl::FromCivil(cs, absl::LocalTimeZone()), absl::LocalTimeZone());
@@ -86,8 +90,8 @@ void GeneralizedTime<Identifier>::set_time(const absl::CivilSecond& cs)
         absl::Span<const uint8_t>(reinterpret_cast<const uint8_t*>(time_str.data()), time_str.length()));
 }
 
-template <typename Identifier>
-void GeneralizedTime<Identifier>::set_time(const absl::Time& time, int timezone_offset_minutes)
+template <typename Identifier, typename Storage>
+void GeneralizedTime<Identifier, Storage>::set_time(const absl::Time& time, int timezone_offset_minutes)
 {
     std::string time_str = absl::FormatTime(g_universal_time_with_time_zone_format, time, absl::UTCTimeZone());
 
@@ -102,8 +106,8 @@ void GeneralizedTime<Identifier>::set_time(const absl::Time& time, int timezone_
         absl::Span<const uint8_t>(reinterpret_cast<const uint8_t*>(time_str.data()), time_str.length()));
 }
 
-template <typename Identifier>
-typename GeneralizedTime<Identifier>::TimeFormat GeneralizedTime<Identifier>::format() const
+template <typename Identifier, typename Storage>
+typename GeneralizedTime<Identifier, Storage>::TimeFormat GeneralizedTime<Identifier, Storage>::format() const
 {
     if (m_contents.content().back() == 'Z')
     {
@@ -120,8 +124,8 @@ typename GeneralizedTime<Identifier>::TimeFormat GeneralizedTime<Identifier>::fo
     }
 }
 
-template <typename Identifier>
-absl::Time GeneralizedTime<Identifier>::time() const
+template <typename Identifier, typename Storage>
+absl::Time GeneralizedTime<Identifier, Storage>::time() const
 {
     thread_local std::string s_error_string;
     absl::Time               time;
@@ -153,37 +157,45 @@ absl::Time GeneralizedTime<Identifier>::time() const
     return time;
 }
 
-template <typename Identifier>
-std::string GeneralizedTime<Identifier>::string() const
+template <typename Identifier, typename Storage>
+std::string GeneralizedTime<Identifier, Storage>::string() const
 {
     return std::string(reinterpret_cast<const char*>(m_contents.content_data()), m_contents.content_length());
 }
 
-template <typename Identifier>
-size_t GeneralizedTime<Identifier>::encoded_length() const noexcept
+template <typename Identifier, typename Storage>
+size_t GeneralizedTime<Identifier, Storage>::encoded_length() const noexcept
 {
-    return this->m_contents.ber().length();
+    return this->m_contents.encoded_length();
 }
 
-template <typename Identifier>
-EncodeResult GeneralizedTime<Identifier>::encode(absl::Span<uint8_t> output) const noexcept
+template <typename Identifier, typename Storage>
+EncodeResult GeneralizedTime<Identifier, Storage>::encode(absl::Span<uint8_t> output) const noexcept
 {
     return this->m_contents.encode(output);
 }
 
-template <typename Identifier>
-DecodeResult GeneralizedTime<Identifier>::decode(BerView view) noexcept
+template <typename Identifier, typename Storage>
+EncodeResult GeneralizedTime<Identifier, Storage>::encode_reverse(absl::Span<uint8_t> output) const noexcept
+{
+    return this->m_contents.encode_reverse(output);
+}
+
+template <typename Identifier, typename Storage>
+DecodeResult GeneralizedTime<Identifier, Storage>::decode(BerView view) noexcept
 {
     DecodeResult res = m_contents.decode(view);
-    if (m_contents.content_length() < minimum_timestamp_length || m_contents.content_length() > max_timestamp_length)
+    if (res.success &&
+        (m_contents.content_length() < minimum_timestamp_length || m_contents.content_length() > max_timestamp_length))
     {
+        FAST_BER_ERROR(ErrorCode::invalid_contents, "GeneralizedTime", view.identifier());
         return DecodeResult{false};
     }
     return res;
 }
 
-template <typename Identifier>
-std::ostream& operator<<(std::ostream& os, const GeneralizedTime<Identifier>& time)
+template <typename Identifier, typename Storage>
+std::ostream& operator<<(std::ostream& os, const GeneralizedTime<Identifier, Storage>& time)
 {
     return os << time.time();
 }
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::graphic_string>>
-using GraphicString = fast_ber::StringImpl<UniversalTag::graphic_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::graphic_string>, typename Storage = BerStorage>
+using GraphicString = fast_ber::StringImpl<UniversalTag::graphic_string, Identifier, Storage>;
 }
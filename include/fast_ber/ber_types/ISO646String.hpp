@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::iso646_string>>
-using ISO646String = fast_ber::StringImpl<UniversalTag::iso646_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::iso646_string>, typename Storage = BerStorage>
+using ISO646String = fast_ber::StringImpl<UniversalTag::iso646_string, Identifier, Storage>;
 }
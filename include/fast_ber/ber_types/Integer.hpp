@@ -8,6 +8,7 @@
 #include "fast_ber/util/EncodeHelpers.hpp"
 #include "fast_ber/util/EncodeIdentifiers.hpp"
 #include "fast_ber/util/Extract.hpp"
+#include "fast_ber/util/HeaderCodec.hpp"
 #include "fast_ber/util/SmallFixedIdBerContainer.hpp"
 
 #include <algorithm>
@@ -22,6 +23,7 @@ namespace fast_ber
 
 inline bool   decode_integer(absl::Span<const uint8_t> input, int64_t& output) noexcept;
 inline size_t encode_integer(absl::Span<uint8_t> output, int64_t input) noexcept;
+inline size_t encoded_integer_length(int64_t input) noexcept;
 
 template <typename Identifier = ExplicitId<UniversalTag::integer>>
 class Integer
@@ -62,8 +64,11 @@ class Integer
     void assign(const Integer<Identifier2>& rhs) noexcept;
 
     size_t       encoded_length() const noexcept { return m_contents.ber_length(); }
-    EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept { return m_contents.encode(buffer); }
-    DecodeResult decode(BerView rhs) noexcept { return m_contents.decode(rhs); }
+    EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept;
+    size_t       encoded_length(EncodePlan&) const noexcept { return encoded_length(); }
+    EncodeResult encode(absl::Span<uint8_t> output, EncodePlan&) const noexcept { return encode(output); }
+    DecodeResult decode(BerView rhs) noexcept;
 
     template <typename Identifier2>
     friend class Integer;
@@ -72,72 +77,38 @@ class Integer
     SmallFixedIdBerContainer<Identifier, sizeof(int64_t)> m_contents;
 };
 
+// Content octets are handled as a single big endian word rather than one byte at a time
 inline bool decode_integer(absl::Span<const uint8_t> input, int64_t& output) noexcept
 {
-    if (input.size() == 0 || input.size() > 8)
+    if (input.size() == 0 || input.size() > sizeof(int64_t))
     {
         return false;
     }
 
-    if (input[0] & 0x80)
-    {
-        output = -1;
-    }
-    else
-    {
-        output = 0;
-    }
-
-    std::array<uint8_t, sizeof(int64_t)> buffer{};
-    const auto                           offset = sizeof(int64_t) - input.size();
-    memcpy(buffer.data(), &output, sizeof(int64_t));
-    for (size_t i = 0; i < input.size(); i++)
-    {
-        buffer[7 - (offset + i)] = input[i];
-    }
-    memcpy(&output, buffer.data(), sizeof(int64_t));
+    uint64_t word = 0;
+    std::memcpy(&word, input.data(), input.size());
 
+    // The first octet becomes the most significant, the arithmetic shift then sign extends the value
+    output = static_cast<int64_t>(detail::to_big_endian(word)) >> (8 * (sizeof(int64_t) - input.size()));
     return true;
 }
 
-inline size_t encode_integer(absl::Span<uint8_t> output, int64_t input) noexcept
+// Minimum number of content octets, redundant leading sign octets are not encoded
+inline size_t encoded_integer_length(int64_t input) noexcept
 {
-    std::array<uint8_t, sizeof(int64_t)> buffer{};
-    std::memcpy(buffer.data(), &input, sizeof(int64_t));
-    std::reverse(buffer.begin(), buffer.end());
-
-    size_t to_skip = 0;
-    for (size_t i = 0; i < sizeof(int64_t) - 1; i++)
-    {
-        if (buffer[i] == 0 && !(buffer[i + 1] & 0x80))
-        {
-            to_skip++;
-        }
-        else
-        {
-            break;
-        }
-    }
-
-    for (size_t i = 0; i < sizeof(int64_t) - 1; i++)
-    {
-        if (buffer[i] == 0xFF && (buffer[i + 1] & 0x80))
-        {
-            to_skip++;
-        }
-        else
-        {
-            break;
-        }
-    }
+    const uint64_t magnitude = static_cast<uint64_t>(input ^ (input >> 63));
+    return (64 - detail::count_leading_zeros((magnitude << 1) | 1) + 7) / 8;
+}
 
-    size_t encoded_len = sizeof(int64_t) - to_skip;
+inline size_t encode_integer(absl::Span<uint8_t> output, int64_t input) noexcept
+{
+    const size_t encoded_len = encoded_integer_length(input);
     if (output.size() < encoded_len)
     {
         return 0;
     }
 
-    std::memcpy(output.data(), buffer.data() + to_skip, encoded_len);
+    detail::store_big_endian(output.data(), static_cast<uint64_t>(input), encoded_len);
     return encoded_len;
 }
 
@@ -183,6 +154,27 @@ inline void Integer<Identifier>::assign(const Integer<Identifier2>& rhs) noexcep
     m_contents = rhs.m_contents;
 }
 
+template <typename Identifier>
+inline EncodeResult Integer<Identifier>::encode(absl::Span<uint8_t> buffer) const noexcept
+{
+    FAST_BER_COUNTER(counter, encode, "Integer", nullptr);
+    return FAST_BER_COUNT_ENCODED(counter, m_contents.encode(buffer));
+}
+
+template <typename Identifier>
+inline EncodeResult Integer<Identifier>::encode_reverse(absl::Span<uint8_t> buffer) const noexcept
+{
+    FAST_BER_COUNTER(counter, encode, "Integer", nullptr);
+    return FAST_BER_COUNT_ENCODED(counter, m_contents.encode_reverse(buffer));
+}
+
+template <typename Identifier>
+inline DecodeResult Integer<Identifier>::decode(BerView rhs) noexcept
+{
+    FAST_BER_COUNTER(counter, decode, "Integer", nullptr);
+    return FAST_BER_COUNT_DECODED(counter, rhs.ber_length(), m_contents.decode(rhs));
+}
+
 template <typename Identifier>
 DecodeResult decode(BerViewIterator& input, Integer<Identifier>& output) noexcept
 {
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "absl/types/span.h"
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/HeaderCodec.hpp"
+
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+
+namespace fast_ber
+{
+
+// Integer holding its value as a native integer rather than as encoded ber. Reading the value is free and the object is
+// the size of its Value, the value is converted when encoding and decoding instead. Encodes identically to Integer.
+// A narrower Value may be used for integers with a value range constraint. Values outside its range fail to decode, and
+// fail to be assigned, leaving the integer unchanged.
+template <typename Identifier = ExplicitId<UniversalTag::integer>, typename Value = int64_t>
+class NativeInteger
+{
+  public:
+    NativeInteger() noexcept = default;
+    NativeInteger(int64_t num) noexcept { assign(num); }
+    NativeInteger(BerView view) noexcept { decode(view); }
+    template <typename Identifier2, typename Value2>
+    NativeInteger(const NativeInteger<Identifier2, Value2>& rhs) noexcept
+    {
+        assign(rhs.value());
+    }
+    template <typename Identifier2>
+    NativeInteger(const Integer<Identifier2>& rhs) noexcept
+    {
+        assign(rhs.value());
+    }
+
+    int64_t value() const noexcept { return m_value; }
+
+    NativeInteger& operator=(int64_t rhs) noexcept
+    {
+        assign(rhs);
+        return *this;
+    }
+    template <typename Identifier2, typename Value2>
+    NativeInteger& operator=(const NativeInteger<Identifier2, Value2>& rhs) noexcept
+    {
+        assign(rhs);
+        return *this;
+    }
+    template <typename Identifier2>
+    NativeInteger& operator=(const Integer<Identifier2>& rhs) noexcept
+    {
+        assign(rhs.value());
+        return *this;
+    }
+
+    template <typename Identifier2, typename Value2>
+    bool operator==(const NativeInteger<Identifier2, Value2>& rhs) const noexcept
+    {
+        return this->value() == rhs.value();
+    }
+    template <typename Identifier2, typename Value2>
+    bool operator!=(const NativeInteger<Identifier2, Value2>& rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+    template <typename Identifier2>
+    bool operator==(const Integer<Identifier2>& rhs) const noexcept
+    {
+        return this->value() == rhs.value();
+    }
+    template <typename Identifier2>
+    bool operator!=(const Integer<Identifier2>& rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    bool operator==(int64_t rhs) const noexcept { return this->value() == rhs; }
+    bool operator!=(int64_t rhs) const noexcept { return !(*this == rhs); }
+
+    using AsnId = Identifier;
+
+    bool assign(int64_t val) noexcept;
+    template <typename Identifier2, typename Value2>
+    bool assign(const NativeInteger<Identifier2, Value2>& rhs) noexcept
+    {
+        return assign(rhs.value());
+    }
+
+    size_t       encoded_length() const noexcept { return header_length + encoded_integer_length(m_value); }
+    EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept;
+    size_t       encoded_length(EncodePlan&) const noexcept { return encoded_length(); }
+    EncodeResult encode(absl::Span<uint8_t> output, EncodePlan&) const noexcept { return encode(output); }
+    DecodeResult decode(BerView input) noexcept;
+
+  private:
+    static bool in_range(int64_t val) noexcept
+    {
+        return val >= static_cast<int64_t>(std::numeric_limits<Value>::min()) &&
+               (val <= 0 || static_cast<uint64_t>(val) <= static_cast<uint64_t>(std::numeric_limits<Value>::max()));
+    }
+
+    // Content is at most 8 bytes, the length of the header doesn't depend on the value
+    constexpr static size_t header_length = encoded_header_length(0, Identifier{});
+
+    Value m_value = 0;
+};
+
+template <typename Identifier, typename Value>
+bool NativeInteger<Identifier, Value>::assign(int64_t val) noexcept
+{
+    if (!in_range(val))
+    {
+        FAST_BER_ERROR(ErrorCode::invalid_contents, "Integer");
+        return false;
+    }
+
+    m_value = static_cast<Value>(val);
+    return true;
+}
+
+template <typename Identifier, typename Value>
+EncodeResult NativeInteger<Identifier, Value>::encode(absl::Span<uint8_t> buffer) const noexcept
+{
+    FAST_BER_COUNTER(counter, encode, "Integer", nullptr);
+    const size_t content_length = encoded_integer_length(m_value);
+    if (buffer.size() < header_length + content_length)
+    {
+        FAST_BER_COUNT(counter, 0, false);
+        return EncodeResult{false, 0};
+    }
+
+    encode_header(buffer, content_length, Identifier{}, Construction::primitive);
+    detail::store_big_endian(buffer.data() + header_length, static_cast<uint64_t>(m_value), content_length);
+    FAST_BER_COUNT(counter, header_length + content_length, true);
+    return EncodeResult{true, header_length + content_length};
+}
+
+template <typename Identifier, typename Value>
+EncodeResult NativeInteger<Identifier, Value>::encode_reverse(absl::Span<uint8_t> buffer) const noexcept
+{
+    const size_t length = encoded_length();
+    if (buffer.size() < length)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    buffer.remove_prefix(buffer.size() - length);
+    return encode(buffer);
+}
+
+template <typename Identifier, typename Value>
+DecodeResult NativeInteger<Identifier, Value>::decode(BerView input) noexcept
+{
+    FAST_BER_COUNTER(counter, decode, "Integer", nullptr);
+    if (!has_correct_header(input, Identifier{}, Construction::primitive))
+    {
+        FAST_BER_ERROR(input, "Integer");
+        FAST_BER_COUNT(counter, input.ber_length(), false);
+        return DecodeResult{false};
+    }
+
+    const BerView value   = (Identifier::depth() == 1) ? input : *input.begin();
+    int64_t       decoded = 0;
+    if (!decode_integer(value.content(), decoded) || !in_range(decoded))
+    {
+        FAST_BER_ERROR(ErrorCode::invalid_contents, "Integer", value.identifier());
+        FAST_BER_COUNT(counter, input.ber_length(), false);
+        return DecodeResult{false};
+    }
+
+    m_value = static_cast<Value>(decoded);
+    FAST_BER_COUNT(counter, input.ber_length(), true);
+    return DecodeResult{true};
+}
+
+template <typename Identifier, typename Value>
+DecodeResult decode(BerViewIterator& input, NativeInteger<Identifier, Value>& output) noexcept
+{
+    DecodeResult res = output.decode(*input);
+    ++input;
+    return res;
+}
+
+template <typename Identifier, typename Value>
+std::ostream& operator<<(std::ostream& os, const NativeInteger<Identifier, Value>& object) noexcept
+{
+    return os << object.value();
+}
+
+} // namespace fast_ber
@@ -52,6 +52,9 @@ class Null
 
     constexpr static size_t encoded_length() noexcept;
     EncodeResult            encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult            encode_reverse(absl::Span<uint8_t> buffer) const noexcept;
+    size_t                  encoded_length(EncodePlan&) const noexcept { return encoded_length(); }
+    EncodeResult            encode(absl::Span<uint8_t> output, EncodePlan&) const noexcept { return encode(output); }
     DecodeResult            decode(BerView buffer) noexcept;
 
     using AsnId = Identifier;
@@ -78,11 +81,18 @@ EncodeResult Null<Identifier>::encode(absl::Span<uint8_t> output) const noexcept
     return EncodeResult{true, this->m_data.size()};
 }
 
+template <typename Identifier>
+EncodeResult Null<Identifier>::encode_reverse(absl::Span<uint8_t> output) const noexcept
+{
+    return prepend_ber(output, this->ber());
+}
+
 template <typename Identifier>
 DecodeResult Null<Identifier>::decode(BerView input) noexcept
 {
     if (!has_correct_header(input, Identifier{}, Construction::primitive))
     {
+        FAST_BER_ERROR(input, "Null");
         return DecodeResult{false};
     }
 
@@ -94,6 +104,7 @@ DecodeResult Null<Identifier>::decode(BerView input) noexcept
     {
         return DecodeResult{true};
     }
+    FAST_BER_ERROR(ErrorCode::invalid_contents, "Null", input.identifier());
     return DecodeResult{false};
 }
 
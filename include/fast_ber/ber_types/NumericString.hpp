@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::numeric_string>>
-using NumericString = fast_ber::StringImpl<UniversalTag::numeric_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::numeric_string>, typename Storage = BerStorage>
+using NumericString = fast_ber::StringImpl<UniversalTag::numeric_string, Identifier, Storage>;
 }
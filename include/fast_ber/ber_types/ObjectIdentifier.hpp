@@ -1,5 +1,6 @@
 #pragma once
 
+#include "fast_ber/util/CompactBerContainer.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
 #include "fast_ber/util/FixedIdBerContainer.hpp"
@@ -20,26 +21,26 @@ DecodeResult decode_object_id(absl::Span<const uint8_t> input, ObjectIdentifierC
 int64_t get_component_number(absl::Span<const uint8_t> input, size_t component_number) noexcept;
 size_t  get_number_of_components(absl::Span<const uint8_t> input) noexcept;
 
-template <typename Identifier = ExplicitId<UniversalTag::object_identifier>>
+template <typename Identifier = ExplicitId<UniversalTag::object_identifier>, typename Storage = BerStorage>
 class ObjectIdentifier
 {
   public:
-    ObjectIdentifier() noexcept                                   = default;
-    ObjectIdentifier(const ObjectIdentifier<Identifier>& rhs)     = default;
-    ObjectIdentifier(ObjectIdentifier<Identifier>&& rhs) noexcept = default;
+    ObjectIdentifier() noexcept                            = default;
+    ObjectIdentifier(const ObjectIdentifier& rhs)          = default;
+    ObjectIdentifier(ObjectIdentifier&& rhs) noexcept      = default;
     ObjectIdentifier(const ObjectIdentifierComponents& oid) noexcept { assign(oid); }
     ObjectIdentifier(const std::initializer_list<int64_t>& oid) noexcept { assign(ObjectIdentifierComponents(oid)); }
     explicit ObjectIdentifier(BerView view) { decode(view); }
     ~ObjectIdentifier() noexcept = default;
 
-    ObjectIdentifier<Identifier>& operator=(const ObjectIdentifierComponents& rhs) noexcept;
-    ObjectIdentifier&             operator=(const ObjectIdentifier&) = default;
-    ObjectIdentifier&             operator=(ObjectIdentifier&&) noexcept = default;
+    ObjectIdentifier& operator=(const ObjectIdentifierComponents& rhs) noexcept;
+    ObjectIdentifier& operator=(const ObjectIdentifier&) = default;
+    ObjectIdentifier& operator=(ObjectIdentifier&&) noexcept = default;
 
-    template <typename Identifier2>
-    bool operator==(const ObjectIdentifier<Identifier2>& rhs) const noexcept;
-    template <typename Identifier2>
-    bool operator!=(const ObjectIdentifier<Identifier2>& rhs) const noexcept;
+    template <typename Identifier2, typename Storage2>
+    bool operator==(const ObjectIdentifier<Identifier2, Storage2>& rhs) const noexcept;
+    template <typename Identifier2, typename Storage2>
+    bool operator!=(const ObjectIdentifier<Identifier2, Storage2>& rhs) const noexcept;
     bool operator==(const ObjectIdentifierComponents& rhs) const noexcept { return this->value() == rhs; }
     bool operator!=(const ObjectIdentifierComponents& rhs) const noexcept { return !(*this == rhs); }
 
@@ -52,12 +53,18 @@ class ObjectIdentifier
 
     size_t       encoded_length() const noexcept;
     EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept;
+    size_t       encoded_length(EncodePlan&) const noexcept { return encoded_length(); }
+    EncodeResult encode(absl::Span<uint8_t> output, EncodePlan&) const noexcept { return encode(output); }
     DecodeResult decode(BerView buffer) noexcept;
 
     using AsnId = Identifier;
 
+    template <typename Identifier2, typename Storage2>
+    friend class ObjectIdentifier;
+
   private:
-    FixedIdBerContainer<Identifier> m_contents;
+    typename Storage::template Container<Identifier> m_contents;
 };
 
 inline size_t encoded_object_id_length(const ObjectIdentifierComponents& input) noexcept
@@ -127,10 +134,7 @@ inline EncodeResult encode_object_id(absl::Span<uint8_t> output, const ObjectIde
 
 inline DecodeResult decode_object_id(absl::Span<const uint8_t> input, absl::InlinedVector<int64_t, 10>& output) noexcept
 {
-    if (!output.empty())
-    {
-        output.clear();
-    }
+    output.resize(0); // Unlike clear(), keeps any allocated storage
 
     if (input.empty())
     {
@@ -213,29 +217,32 @@ inline size_t get_number_of_components(absl::Span<const uint8_t> input) noexcept
     return number_of_components;
 }
 
-template <typename Identifier>
-ObjectIdentifier<Identifier>& ObjectIdentifier<Identifier>::operator=(const ObjectIdentifierComponents& rhs) noexcept
+template <typename Identifier, typename Storage>
+ObjectIdentifier<Identifier, Storage>&
+ObjectIdentifier<Identifier, Storage>::operator=(const ObjectIdentifierComponents& rhs) noexcept
 {
     assign(rhs);
     return *this;
 }
 
-template <typename Identifier>
-template <typename Identifier2>
-bool ObjectIdentifier<Identifier>::operator==(const ObjectIdentifier<Identifier2>& rhs) const noexcept
+template <typename Identifier, typename Storage>
+template <typename Identifier2, typename Storage2>
+bool ObjectIdentifier<Identifier, Storage>::operator==(
+    const ObjectIdentifier<Identifier2, Storage2>& rhs) const noexcept
 {
     return this->m_contents.content() == rhs.m_contents.content();
 }
 
-template <typename Identifier>
-template <typename Identifier2>
-bool ObjectIdentifier<Identifier>::operator!=(const ObjectIdentifier<Identifier2>& rhs) const noexcept
+template <typename Identifier, typename Storage>
+template <typename Identifier2, typename Storage2>
+bool ObjectIdentifier<Identifier, Storage>::operator!=(
+    const ObjectIdentifier<Identifier2, Storage2>& rhs) const noexcept
 {
     return !(*this == rhs);
 }
 
-template <typename Identifier>
-std::ostream& operator<<(std::ostream& os, const ObjectIdentifier<Identifier>& oid) noexcept
+template <typename Identifier, typename Storage>
+std::ostream& operator<<(std::ostream& os, const ObjectIdentifier<Identifier, Storage>& oid) noexcept
 {
     os << "[";
     const auto oid_components = oid.value();
@@ -251,28 +258,28 @@ std::ostream& operator<<(std::ostream& os, const ObjectIdentifier<Identifier>& o
     return os;
 }
 
-template <typename Identifier>
-size_t ObjectIdentifier<Identifier>::number_of_components() const noexcept
+template <typename Identifier, typename Storage>
+size_t ObjectIdentifier<Identifier, Storage>::number_of_components() const noexcept
 {
     return fast_ber::get_number_of_components(m_contents.content());
 }
 
-template <typename Identifier>
-int64_t ObjectIdentifier<Identifier>::component_number(size_t component_number) const noexcept
+template <typename Identifier, typename Storage>
+int64_t ObjectIdentifier<Identifier, Storage>::component_number(size_t component_number) const noexcept
 {
     return fast_ber::get_component_number(m_contents.content(), component_number);
 }
 
-template <typename Identifier>
-ObjectIdentifierComponents ObjectIdentifier<Identifier>::value() const noexcept
+template <typename Identifier, typename Storage>
+ObjectIdentifierComponents ObjectIdentifier<Identifier, Storage>::value() const noexcept
 {
     ObjectIdentifierComponents output;
     decode_object_id(m_contents.content(), output);
     return output;
 }
 
-template <typename Identifier>
-bool ObjectIdentifier<Identifier>::assign(const ObjectIdentifierComponents& oid) noexcept
+template <typename Identifier, typename Storage>
+bool ObjectIdentifier<Identifier, Storage>::assign(const ObjectIdentifierComponents& oid) noexcept
 {
     const size_t encoded_length = encoded_object_id_length(oid);
     m_contents.resize_content(encoded_length);
@@ -284,20 +291,26 @@ bool ObjectIdentifier<Identifier>::assign(const ObjectIdentifierComponents& oid)
     return res.success;
 }
 
-template <typename Identifier>
-size_t ObjectIdentifier<Identifier>::encoded_length() const noexcept
+template <typename Identifier, typename Storage>
+size_t ObjectIdentifier<Identifier, Storage>::encoded_length() const noexcept
 {
-    return this->m_contents.ber_length();
+    return this->m_contents.encoded_length();
 }
 
-template <typename Identifier>
-EncodeResult ObjectIdentifier<Identifier>::encode(absl::Span<uint8_t> output) const noexcept
+template <typename Identifier, typename Storage>
+EncodeResult ObjectIdentifier<Identifier, Storage>::encode(absl::Span<uint8_t> output) const noexcept
 {
     return this->m_contents.encode(output);
 }
 
-template <typename Identifier>
-DecodeResult ObjectIdentifier<Identifier>::decode(BerView input) noexcept
+template <typename Identifier, typename Storage>
+EncodeResult ObjectIdentifier<Identifier, Storage>::encode_reverse(absl::Span<uint8_t> output) const noexcept
+{
+    return this->m_contents.encode_reverse(output);
+}
+
+template <typename Identifier, typename Storage>
+DecodeResult ObjectIdentifier<Identifier, Storage>::decode(BerView input) noexcept
 {
     return this->m_contents.decode(input);
 }
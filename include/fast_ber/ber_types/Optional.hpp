@@ -11,6 +11,8 @@
 #include "fast_ber/util/DynamicOptional.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
 
+#include <type_traits>
+
 namespace fast_ber
 {
 
@@ -35,6 +37,24 @@ struct OptionalImplementation<T, StorageMode::dynamic>
     using Type = DynamicOptional<T>;
 };
 
+template <typename T>
+struct OptionalImplementation<T, StorageMode::arena>
+{
+    using Type = DynamicOptional<T, ArenaAllocation>;
+};
+
+// Optional values larger than this are held out of line by StorageMode::sparse
+constexpr size_t sparse_optional_inline_size = 2 * sizeof(void*);
+
+// Absent members of sequences with many rarely present members cost a pointer rather than the size of T. The pointer
+// doubles as the presence bit of the member. Values are created in the current arena, or on the heap if there is none
+template <typename T>
+struct OptionalImplementation<T, StorageMode::sparse>
+{
+    using Type = typename std::conditional<(sizeof(T) > sparse_optional_inline_size),
+                                           DynamicOptional<T, ArenaAllocation>, StaticOptional<T>>::type;
+};
+
 template <typename T, StorageMode storage = StorageMode::static_>
 struct Optional : public OptionalImplementation<T, storage>::Type
 {
@@ -53,6 +73,9 @@ struct Optional : public OptionalImplementation<T, storage>::Type
 
     size_t       encoded_length() const noexcept;
     EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept;
+    size_t       encoded_length(EncodePlan& plan) const;
+    EncodeResult encode(absl::Span<uint8_t> buffer, EncodePlan& plan) const noexcept;
     DecodeResult decode(BerView input) noexcept;
 
     template <typename Identifier>
@@ -60,6 +83,12 @@ struct Optional : public OptionalImplementation<T, storage>::Type
     template <typename Identifier>
     EncodeResult encode_with_id(absl::Span<uint8_t> buffer) const noexcept;
     template <typename Identifier>
+    EncodeResult encode_reverse_with_id(absl::Span<uint8_t> buffer) const noexcept;
+    template <typename Identifier>
+    size_t encoded_length_with_id(EncodePlan& plan) const;
+    template <typename Identifier>
+    EncodeResult encode_with_id(absl::Span<uint8_t> buffer, EncodePlan& plan) const noexcept;
+    template <typename Identifier>
     DecodeResult decode_with_id(BerView input) noexcept;
 };
 
@@ -107,12 +136,54 @@ EncodeResult Optional<T, s1>::encode(absl::Span<uint8_t> buffer) const noexcept
     }
 }
 
+template <typename T, StorageMode s1>
+EncodeResult Optional<T, s1>::encode_reverse(absl::Span<uint8_t> buffer) const noexcept
+{
+    if (this->has_value())
+    {
+        return (*this)->encode_reverse(buffer);
+    }
+    else
+    {
+        return {true, 0};
+    }
+}
+
+template <typename T, StorageMode s1>
+size_t Optional<T, s1>::encoded_length(EncodePlan& plan) const
+{
+    if (this->has_value())
+    {
+        return (*this)->encoded_length(plan);
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+template <typename T, StorageMode s1>
+EncodeResult Optional<T, s1>::encode(absl::Span<uint8_t> buffer, EncodePlan& plan) const noexcept
+{
+    if (this->has_value())
+    {
+        return (*this)->encode(buffer, plan);
+    }
+    else
+    {
+        return {true, 0};
+    }
+}
+
 template <typename T, StorageMode s1>
 DecodeResult decode(BerViewIterator& input, Optional<T, s1>& output) noexcept
 {
     if (input->is_valid() && Identifier<T>::check_id_match(input->class_(), input->tag()))
     {
-        output.emplace();
+        if (!output.has_value())
+        {
+            output.emplace();
+        }
         return decode(input, *output);
     }
     else
@@ -127,7 +198,11 @@ DecodeResult Optional<T, s1>::decode(BerView input) noexcept
 {
     if (input.is_valid() && Identifier<T>::check_id_match(input.class_(), input.tag()))
     {
-        this->emplace();
+        // An existing value is decoded into, keeping its storage
+        if (!this->has_value())
+        {
+            this->emplace();
+        }
         return (*this)->decode(input);
     }
     else if (!input.is_valid())
@@ -137,6 +212,7 @@ DecodeResult Optional<T, s1>::decode(BerView input) noexcept
     }
     else
     {
+        FAST_BER_ERROR(ErrorCode::incorrect_header, "Optional", input.identifier());
         return DecodeResult{false};
     }
 }
@@ -169,13 +245,59 @@ EncodeResult Optional<T, s1>::encode_with_id(absl::Span<uint8_t> buffer) const n
     }
 }
 
+template <typename T, StorageMode s1>
+template <typename Identifier>
+EncodeResult Optional<T, s1>::encode_reverse_with_id(absl::Span<uint8_t> buffer) const noexcept
+{
+    if (this->has_value())
+    {
+        return (*this)->template encode_reverse_with_id<Identifier>(buffer);
+    }
+    else
+    {
+        return {true, 0};
+    }
+}
+
+template <typename T, StorageMode s1>
+template <typename Identifier>
+size_t Optional<T, s1>::encoded_length_with_id(EncodePlan& plan) const
+{
+    if (this->has_value())
+    {
+        return (*this)->template encoded_length_with_id<Identifier>(plan);
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+template <typename T, StorageMode s1>
+template <typename Identifier>
+EncodeResult Optional<T, s1>::encode_with_id(absl::Span<uint8_t> buffer, EncodePlan& plan) const noexcept
+{
+    if (this->has_value())
+    {
+        return (*this)->template encode_with_id<Identifier>(buffer, plan);
+    }
+    else
+    {
+        return {true, 0};
+    }
+}
+
 template <typename T, StorageMode s1>
 template <typename Identifier>
 DecodeResult Optional<T, s1>::decode_with_id(BerView input) noexcept
 {
     if (input.is_valid() && Identifier::check_id_match(input.class_(), input.tag()))
     {
-        this->emplace();
+        // An existing value is decoded into, keeping its storage
+        if (!this->has_value())
+        {
+            this->emplace();
+        }
         return (*this)->template decode_with_id<Identifier>(input);
     }
     else if (!input.is_valid())
@@ -185,6 +307,7 @@ DecodeResult Optional<T, s1>::decode_with_id(BerView input) noexcept
     }
     else
     {
+        FAST_BER_ERROR(ErrorCode::incorrect_header, "Optional", input.identifier());
         return DecodeResult{false};
     }
 }
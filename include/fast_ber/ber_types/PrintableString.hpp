@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::printable_string>>
-using PrintableString = fast_ber::StringImpl<UniversalTag::printable_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::printable_string>, typename Storage = BerStorage>
+using PrintableString = fast_ber::StringImpl<UniversalTag::printable_string, Identifier, Storage>;
 }
@@ -55,6 +55,9 @@ class Real
 
     size_t       encoded_length() const noexcept;
     EncodeResult encode(absl::Span<uint8_t> output) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> output) const noexcept;
+    size_t       encoded_length(EncodePlan&) const noexcept { return encoded_length(); }
+    EncodeResult encode(absl::Span<uint8_t> output, EncodePlan&) const noexcept { return encode(output); }
     DecodeResult decode(BerView input) noexcept;
 
     using AsnId = Identifier;
@@ -634,6 +637,12 @@ EncodeResult Real<Identifier>::encode(absl::Span<uint8_t> output) const noexcept
     return m_contents.encode(output);
 }
 
+template <typename Identifier>
+EncodeResult Real<Identifier>::encode_reverse(absl::Span<uint8_t> output) const noexcept
+{
+    return m_contents.encode_reverse(output);
+}
+
 template <typename Identifier>
 DecodeResult Real<Identifier>::decode(BerView input) noexcept
 {
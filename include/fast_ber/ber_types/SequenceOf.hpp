@@ -1,5 +1,6 @@
 #pragma once
 
+#include "fast_ber/util/Arena.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/Definitions.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
@@ -8,36 +9,62 @@
 
 #include <iosfwd>
 #include <numeric>
+#include <type_traits>
 #include <vector>
 
 namespace fast_ber
 {
 
-constexpr const size_t default_inlined_size = 5;
+// Small buffer optimised lists hold up to default_inlined_size elements in place, limited to inlined_size_budget bytes
+// of elements. Lists of larger elements hold fewer elements in place, lists of elements over the budget allocate from
+// the first element, so a list of large records does not embed several records in its parent.
+constexpr const size_t default_inlined_size   = 5;
+constexpr const size_t inlined_size_budget    = 256;
+constexpr const size_t automatic_inlined_size = static_cast<size_t>(-1);
 
-template <typename T, StorageMode storage>
+template <typename T>
+constexpr size_t inlined_size_for() noexcept
+{
+    return (inlined_size_budget / sizeof(T) < default_inlined_size) ? inlined_size_budget / sizeof(T)
+                                                                     : default_inlined_size;
+}
+
+// Vector holding inlined_size elements in place, a std::vector if inlined_size is 0
+template <typename T, size_t inlined_size>
+using SmallBufferVector = typename std::conditional<inlined_size == 0, std::vector<T>,
+                                                    absl::InlinedVector<T, inlined_size == 0 ? 1 : inlined_size>>::type;
+
+// The number of elements held in place by the small buffer optimised storage is chosen from the size of T, unless
+// given explicitly, such as the upper bound of a SIZE constraint
+template <typename T, StorageMode storage, size_t inlined_size>
 struct SequenceOfImplementation
 {
-    using Type = absl::InlinedVector<T, default_inlined_size>;
+    using Type = SmallBufferVector<T, inlined_size == automatic_inlined_size ? inlined_size_for<T>() : inlined_size>;
 };
 
-template <typename T>
-struct SequenceOfImplementation<T, StorageMode::small_buffer_optimised>
+template <typename T, size_t inlined_size>
+struct SequenceOfImplementation<T, StorageMode::small_buffer_optimised, inlined_size>
 {
-    using Type = absl::InlinedVector<T, default_inlined_size>;
+    using Type = SmallBufferVector<T, inlined_size == automatic_inlined_size ? inlined_size_for<T>() : inlined_size>;
 };
 
-template <typename T>
-struct SequenceOfImplementation<T, StorageMode::dynamic>
+template <typename T, size_t inlined_size>
+struct SequenceOfImplementation<T, StorageMode::dynamic, inlined_size>
 {
     using Type = std::vector<T>;
 };
 
+template <typename T, size_t inlined_size>
+struct SequenceOfImplementation<T, StorageMode::arena, inlined_size>
+{
+    using Type = std::vector<T, ArenaAllocator<T>>;
+};
+
 template <typename T, typename I = ExplicitId<UniversalTag::sequence>,
-          StorageMode s = StorageMode::small_buffer_optimised>
-struct SequenceOf : public SequenceOfImplementation<T, s>::Type
+          StorageMode s = StorageMode::small_buffer_optimised, size_t n = automatic_inlined_size>
+struct SequenceOf : public SequenceOfImplementation<T, s, n>::Type
 {
-    using Implementation = typename SequenceOfImplementation<T, s>::Type;
+    using Implementation = typename SequenceOfImplementation<T, s, n>::Type;
 
     using Implementation::Implementation;
     SequenceOf()                  = default;
@@ -45,8 +72,8 @@ struct SequenceOf : public SequenceOfImplementation<T, s>::Type
     SequenceOf(SequenceOf&&) noexcept;
     SequenceOf(const Implementation& t) : Implementation(t) {}
     SequenceOf(Implementation&& t) noexcept : Implementation(std::move(t)) {}
-    template <typename I2, StorageMode s2>
-    SequenceOf(const SequenceOf<T, I2, s2>& t) : Implementation(t.begin(), t.end())
+    template <typename I2, StorageMode s2, size_t n2>
+    SequenceOf(const SequenceOf<T, I2, s2, n2>& t) : Implementation(t.begin(), t.end())
     {
     }
     ~SequenceOf() noexcept = default;
@@ -56,45 +83,48 @@ struct SequenceOf : public SequenceOfImplementation<T, s>::Type
 
     size_t       encoded_length() const noexcept;
     EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept;
+    size_t       encoded_length(EncodePlan& plan) const;
+    EncodeResult encode(absl::Span<uint8_t> buffer, EncodePlan& plan) const noexcept;
     DecodeResult decode(BerView input) noexcept;
 
     using AsnId = I;
 };
 
-template <typename T, typename I, StorageMode s>
-SequenceOf<T, I, s>::SequenceOf(SequenceOf<T, I, s>&& rhs) noexcept : Implementation(std::move(rhs))
+template <typename T, typename I, StorageMode s, size_t n>
+SequenceOf<T, I, s, n>::SequenceOf(SequenceOf<T, I, s, n>&& rhs) noexcept : Implementation(std::move(rhs))
 {
 }
 
-template <typename T, typename I, StorageMode s>
-SequenceOf<T, I, s>& SequenceOf<T, I, s>::operator=(SequenceOf<T, I, s>&& rhs) noexcept
+template <typename T, typename I, StorageMode s, size_t n>
+SequenceOf<T, I, s, n>& SequenceOf<T, I, s, n>::operator=(SequenceOf<T, I, s, n>&& rhs) noexcept
 {
     Implementation::operator=(rhs);
     return *this;
 }
 
-template <typename T, typename I1, StorageMode s1, typename I2, StorageMode s2>
-bool operator==(const SequenceOf<T, I1, s1>& lhs, const SequenceOf<T, I2, s2>& rhs) noexcept
+template <typename T, typename I1, StorageMode s1, size_t n1, typename I2, StorageMode s2, size_t n2>
+bool operator==(const SequenceOf<T, I1, s1, n1>& lhs, const SequenceOf<T, I2, s2, n2>& rhs) noexcept
 {
     return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <typename T, typename I1, StorageMode s1, typename I2, StorageMode s2>
-bool operator!=(const SequenceOf<T, I1, s1>& lhs, const SequenceOf<T, I2, s2>& rhs) noexcept
+template <typename T, typename I1, StorageMode s1, size_t n1, typename I2, StorageMode s2, size_t n2>
+bool operator!=(const SequenceOf<T, I1, s1, n1>& lhs, const SequenceOf<T, I2, s2, n2>& rhs) noexcept
 {
     return !(lhs == rhs);
 }
 
-template <typename T, typename I, StorageMode s>
-size_t SequenceOf<T, I, s>::encoded_length() const noexcept
+template <typename T, typename I, StorageMode s, size_t n>
+size_t SequenceOf<T, I, s, n>::encoded_length() const noexcept
 {
     const size_t content_length = std::accumulate(this->begin(), this->end(), size_t(0),
                                                   [](size_t count, const T& t) { return count + t.encoded_length(); });
     return fast_ber::encoded_length(content_length, I{});
 }
 
-template <typename T, typename I, StorageMode s>
-EncodeResult SequenceOf<T, I, s>::encode(const absl::Span<uint8_t> buffer) const noexcept
+template <typename T, typename I, StorageMode s, size_t n>
+EncodeResult SequenceOf<T, I, s, n>::encode(const absl::Span<uint8_t> buffer) const noexcept
 {
     constexpr size_t header_length_guess = fast_ber::encoded_length(0, I{});
     auto             content_buffer      = buffer;
@@ -119,30 +149,98 @@ EncodeResult SequenceOf<T, I, s>::encode(const absl::Span<uint8_t> buffer) const
     return wrap_with_ber_header(buffer, combined_length, I{}, header_length_guess);
 }
 
-template <typename T, typename I, StorageMode s>
-DecodeResult SequenceOf<T, I, s>::decode(BerView input) noexcept
+template <typename T, typename I, StorageMode s, size_t n>
+EncodeResult SequenceOf<T, I, s, n>::encode_reverse(const absl::Span<uint8_t> buffer) const noexcept
+{
+    auto   content_buffer  = buffer;
+    size_t combined_length = 0;
+
+    for (auto element = this->rbegin(); element != this->rend(); ++element)
+    {
+        const auto element_encode_result = element->encode_reverse(content_buffer);
+        if (!element_encode_result.success)
+        {
+            return {false, 0};
+        }
+        combined_length += element_encode_result.length;
+        content_buffer.remove_suffix(element_encode_result.length);
+    }
+
+    return prepend_ber_header(buffer, combined_length, I{});
+}
+
+template <typename T, typename I, StorageMode s, size_t n>
+size_t SequenceOf<T, I, s, n>::encoded_length(EncodePlan& plan) const
+{
+    const size_t entry          = plan.add_entry();
+    size_t       content_length = 0;
+    for (const T& element : *this)
+    {
+        content_length += element.encoded_length(plan);
+    }
+    plan.set_entry(entry, content_length);
+    return fast_ber::encoded_length(content_length, I{});
+}
+
+template <typename T, typename I, StorageMode s, size_t n>
+EncodeResult SequenceOf<T, I, s, n>::encode(const absl::Span<uint8_t> buffer, EncodePlan& plan) const noexcept
+{
+    size_t       content_length = 0;
+    const size_t header_length  = plan.next_entry(content_length) ? encode_planned_header(buffer, content_length, I{})
+                                                                  : 0;
+    if (header_length == 0)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    auto content_buffer = buffer;
+    content_buffer.remove_prefix(header_length);
+    for (const T& element : *this)
+    {
+        const auto element_encode_result = element.encode(content_buffer, plan);
+        if (!element_encode_result.success)
+        {
+            return {false, 0};
+        }
+        content_buffer.remove_prefix(element_encode_result.length);
+    }
+
+    return EncodeResult{true, header_length + content_length};
+}
+
+// Existing elements are decoded into in place, keeping any storage they own. The sequence is only shrunk once all
+// elements have been decoded, so decoding sequences of a similar size repeatedly does not allocate.
+template <typename T, typename I, StorageMode s, size_t n>
+DecodeResult SequenceOf<T, I, s, n>::decode(BerView input) noexcept
 {
-    this->clear();
     if (!has_correct_header(input, I{}, Construction::constructed))
     {
+        FAST_BER_ERROR(input, "SequenceOf");
+        this->erase(this->begin(), this->end());
         return DecodeResult{false};
     }
 
+    size_t  count       = 0;
     BerView child_range = (I::depth() == 1) ? input : *input.begin();
     for (const BerView child : child_range)
     {
-        this->emplace_back();
-        bool success = this->back().decode(child).success;
+        if (count == this->size())
+        {
+            this->emplace_back();
+        }
+        bool success = (*this)[count++].decode(child).success;
         if (!success)
         {
+            this->erase(this->begin() + static_cast<std::ptrdiff_t>(count), this->end());
             return DecodeResult{false};
         }
     }
+    this->erase(this->begin() + static_cast<std::ptrdiff_t>(count), this->end());
     return DecodeResult{true};
 }
 
-template <typename T, typename I, StorageMode s1>
-std::ostream& operator<<(std::ostream& os, const SequenceOf<T, I, s1>& sequence)
+template <typename T, typename I, StorageMode s, size_t n>
+std::ostream& operator<<(std::ostream& os, const SequenceOf<T, I, s, n>& sequence)
 {
     bool first = true;
 
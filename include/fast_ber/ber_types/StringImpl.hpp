@@ -1,5 +1,7 @@
 #pragma once
 
+#include "fast_ber/util/BoundedBerContainer.hpp"
+#include "fast_ber/util/CompactBerContainer.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
 #include "fast_ber/util/FixedIdBerContainer.hpp"
@@ -14,19 +16,17 @@
 namespace fast_ber
 {
 
-// A string with data stored with ber encoding. Interface mimics std::string
-template <UniversalTag tag, typename Identifier>
+// A string with data stored with ber encoding. Interface mimics std::string. Storage is BerStorage to hold the encoded
+// packet, CompactStorage to hold only the contents or BoundedStorage to hold contents of a known maximum size in place
+template <UniversalTag tag, typename Identifier, typename Storage = BerStorage>
 class StringImpl
 {
   public:
     StringImpl() noexcept = default;
-    template <UniversalTag tag2, typename Identifier2>
-    StringImpl(const StringImpl<tag2, Identifier2>& rhs) noexcept : m_contents(rhs.m_contents)
-    {
-    }
-    template <UniversalTag tag2, typename Identifier2>
-    StringImpl(StringImpl<tag2, Identifier2>&& rhs) noexcept : m_contents(std::move(rhs.m_contents))
+    template <UniversalTag tag2, typename Identifier2, typename Storage2>
+    StringImpl(const StringImpl<tag2, Identifier2, Storage2>& rhs) noexcept
     {
+        assign(rhs);
     }
 
     StringImpl(const char* input_data) noexcept { assign(absl::string_view(input_data)); }
@@ -37,8 +37,8 @@ class StringImpl
     explicit StringImpl(absl::Span<const uint8_t> input_data) noexcept { assign(input_data); }
     explicit StringImpl(BerView view) noexcept { decode(view); }
 
-    template <UniversalTag tag2, typename Identifier2>
-    StringImpl& operator=(const StringImpl<tag2, Identifier2>& rhs) noexcept;
+    template <UniversalTag tag2, typename Identifier2, typename Storage2>
+    StringImpl& operator=(const StringImpl<tag2, Identifier2, Storage2>& rhs) noexcept;
     StringImpl& operator=(const char* rhs) noexcept;
     StringImpl& operator=(const std::string& rhs) noexcept;
     StringImpl& operator=(absl::string_view rhs) noexcept;
@@ -73,87 +73,89 @@ class StringImpl
     std::string               value() const noexcept { return std::string(c_str(), length()); }
     bool                      empty() const noexcept { return length() == 0; }
 
-    template <UniversalTag tag2, typename Identifier2>
-    void assign(const StringImpl<tag2, Identifier2>& rhs) noexcept;
+    template <UniversalTag tag2, typename Identifier2, typename Storage2>
+    void assign(const StringImpl<tag2, Identifier2, Storage2>& rhs) noexcept;
     void assign(absl::string_view buffer) noexcept;
     void assign(absl::Span<const uint8_t> buffer) noexcept;
     void resize(size_t i) noexcept { m_contents.resize_content(i); }
 
-    template <UniversalTag tag2, typename Identifier2>
-    friend class StringImpl;
-
     using AsnId = Identifier;
 
-    size_t       encoded_length() const noexcept { return m_contents.ber().length(); }
-    EncodeResult encode(absl::Span<uint8_t> output) const noexcept { return m_contents.encode(output); }
-    DecodeResult decode(BerView input) noexcept { return m_contents.decode(input); }
+    size_t       encoded_length() const noexcept { return m_contents.encoded_length(); }
+    EncodeResult encode(absl::Span<uint8_t> output) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> output) const noexcept;
+    size_t       encoded_length(EncodePlan&) const noexcept { return encoded_length(); }
+    EncodeResult encode(absl::Span<uint8_t> output, EncodePlan&) const noexcept { return encode(output); }
+    DecodeResult decode(BerView input) noexcept;
 
   private:
-    FixedIdBerContainer<Identifier> m_contents;
-}; // namespace fast_ber
+    typename Storage::template Container<Identifier> m_contents;
+};
 
-template <UniversalTag tag, typename Identifier>
-struct IdentifierType<StringImpl<tag, Identifier>>
+template <UniversalTag tag, typename Identifier, typename Storage>
+struct IdentifierType<StringImpl<tag, Identifier, Storage>>
 {
     using type = Identifier;
 };
 
-template <UniversalTag tag, typename Identifier>
-StringImpl<tag, Identifier>& StringImpl<tag, Identifier>::operator=(absl::Span<const uint8_t> rhs) noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+StringImpl<tag, Identifier, Storage>&
+StringImpl<tag, Identifier, Storage>::operator=(absl::Span<const uint8_t> rhs) noexcept
 {
     assign(rhs);
     return *this;
 }
 
-template <UniversalTag tag, typename Identifier>
-StringImpl<tag, Identifier>& StringImpl<tag, Identifier>::operator=(const char* rhs) noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+StringImpl<tag, Identifier, Storage>& StringImpl<tag, Identifier, Storage>::operator=(const char* rhs) noexcept
 {
     assign(absl::string_view(rhs));
     return *this;
 }
 
-template <UniversalTag tag, typename Identifier>
-StringImpl<tag, Identifier>& StringImpl<tag, Identifier>::operator=(const std::string& rhs) noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+StringImpl<tag, Identifier, Storage>& StringImpl<tag, Identifier, Storage>::operator=(const std::string& rhs) noexcept
 {
     assign(absl::string_view(rhs));
     return *this;
 }
 
-template <UniversalTag tag, typename Identifier>
-StringImpl<tag, Identifier>& StringImpl<tag, Identifier>::operator=(absl::string_view rhs) noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+StringImpl<tag, Identifier, Storage>& StringImpl<tag, Identifier, Storage>::operator=(absl::string_view rhs) noexcept
 {
     assign(rhs);
     return *this;
 }
 
-template <UniversalTag tag, typename Identifier>
-template <UniversalTag tag2, typename Identifier2>
-StringImpl<tag, Identifier>& StringImpl<tag, Identifier>::operator=(const StringImpl<tag2, Identifier2>& rhs) noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+template <UniversalTag tag2, typename Identifier2, typename Storage2>
+StringImpl<tag, Identifier, Storage>&
+StringImpl<tag, Identifier, Storage>::operator=(const StringImpl<tag2, Identifier2, Storage2>& rhs) noexcept
 {
     assign(rhs);
     return *this;
 }
 
-template <UniversalTag tag, typename Identifier>
-bool StringImpl<tag, Identifier>::operator==(const StringImpl<tag, Identifier>& rhs) const noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+bool StringImpl<tag, Identifier, Storage>::operator==(const StringImpl& rhs) const noexcept
 {
     return absl::string_view(*this) == absl::string_view(rhs);
 }
 
-template <UniversalTag tag, typename Identifier>
-bool StringImpl<tag, Identifier>::operator==(const std::string& rhs) const noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+bool StringImpl<tag, Identifier, Storage>::operator==(const std::string& rhs) const noexcept
 {
     return absl::string_view(*this) == absl::string_view(rhs);
 }
 
-template <UniversalTag tag, typename Identifier>
-bool StringImpl<tag, Identifier>::operator==(const char* rhs) const noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+bool StringImpl<tag, Identifier, Storage>::operator==(const char* rhs) const noexcept
 {
     return absl::string_view(*this) == absl::string_view(rhs);
 }
 
-template <UniversalTag tag, typename Identifier>
-std::ostream& operator<<(std::ostream& os, const StringImpl<tag, Identifier>& str) noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+std::ostream& operator<<(std::ostream& os, const StringImpl<tag, Identifier, Storage>& str) noexcept
 {
     if (std::all_of(str.begin(), str.end(), [](char c) { return std::isprint(c); }))
     {
@@ -165,23 +167,45 @@ std::ostream& operator<<(std::ostream& os, const StringImpl<tag, Identifier>& st
     }
 }
 
-template <UniversalTag tag, typename Identifier>
-void StringImpl<tag, Identifier>::assign(absl::string_view buffer) noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+void StringImpl<tag, Identifier, Storage>::assign(absl::string_view buffer) noexcept
 {
     m_contents.assign_content(absl::MakeSpan(reinterpret_cast<const uint8_t*>(buffer.data()), buffer.length()));
 }
 
-template <UniversalTag tag, typename Identifier>
-void StringImpl<tag, Identifier>::assign(absl::Span<const uint8_t> buffer) noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+void StringImpl<tag, Identifier, Storage>::assign(absl::Span<const uint8_t> buffer) noexcept
 {
     m_contents.assign_content(buffer);
 }
 
-template <UniversalTag tag, typename Identifier>
-template <UniversalTag tag2, typename Identifier2>
-void StringImpl<tag, Identifier>::assign(const StringImpl<tag2, Identifier2>& rhs) noexcept
+template <UniversalTag tag, typename Identifier, typename Storage>
+template <UniversalTag tag2, typename Identifier2, typename Storage2>
+void StringImpl<tag, Identifier, Storage>::assign(const StringImpl<tag2, Identifier2, Storage2>& rhs) noexcept
 {
     assign(rhs.span());
 }
 
+// All string types are counted together as "String"
+template <UniversalTag tag, typename Identifier, typename Storage>
+inline EncodeResult StringImpl<tag, Identifier, Storage>::encode(absl::Span<uint8_t> output) const noexcept
+{
+    FAST_BER_COUNTER(counter, encode, "String", nullptr);
+    return FAST_BER_COUNT_ENCODED(counter, m_contents.encode(output));
+}
+
+template <UniversalTag tag, typename Identifier, typename Storage>
+inline EncodeResult StringImpl<tag, Identifier, Storage>::encode_reverse(absl::Span<uint8_t> output) const noexcept
+{
+    FAST_BER_COUNTER(counter, encode, "String", nullptr);
+    return FAST_BER_COUNT_ENCODED(counter, m_contents.encode_reverse(output));
+}
+
+template <UniversalTag tag, typename Identifier, typename Storage>
+inline DecodeResult StringImpl<tag, Identifier, Storage>::decode(BerView input) noexcept
+{
+    FAST_BER_COUNTER(counter, decode, "String", nullptr);
+    return FAST_BER_COUNT_DECODED(counter, input.ber_length(), m_contents.decode(input));
+}
+
 } // namespace fast_ber
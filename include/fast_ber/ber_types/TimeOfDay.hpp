@@ -4,6 +4,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::utc_time>>
-using TimeOfDay = GeneralizedTime<Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::utc_time>, typename Storage = BerStorage>
+using TimeOfDay = GeneralizedTime<Identifier, Storage>;
 } // namespace fast_ber
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::utc_time>>
-using UTCTime = GeneralizedTime<Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::utc_time>, typename Storage = BerStorage>
+using UTCTime = GeneralizedTime<Identifier, Storage>;
 } // namespace fast_ber
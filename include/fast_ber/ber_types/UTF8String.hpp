@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::utf8_string>>
-using UTF8String = fast_ber::StringImpl<UniversalTag::utf8_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::utf8_string>, typename Storage = BerStorage>
+using UTF8String = fast_ber::StringImpl<UniversalTag::utf8_string, Identifier, Storage>;
 }
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::videotex_string>>
-using VideotexString = fast_ber::StringImpl<UniversalTag::videotex_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::videotex_string>, typename Storage = BerStorage>
+using VideotexString = fast_ber::StringImpl<UniversalTag::videotex_string, Identifier, Storage>;
 }
@@ -0,0 +1,311 @@
+﻿#pragma once
+
+#include "fast_ber/ber_types/Boolean.hpp"
+#include "fast_ber/ber_types/Default.hpp"
+#include "fast_ber/ber_types/Enumerated.hpp"
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/ber_types/NativeInteger.hpp"
+#include "fast_ber/ber_types/SequenceOf.hpp"
+#include "fast_ber/ber_types/StringImpl.hpp"
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+
+#include "absl/meta/type_traits.h"
+#include "absl/strings/string_view.h"
+
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace fast_ber
+{
+
+// Zero copy access to encoded values. ViewTraits<T>::type is the value produced when a member of type T is read
+// through the View of a generated type. Values are read directly from the encoded input, which must outlive them.
+//
+// validate<Identifier> checks an encoded element can be read, make<Identifier> reads an element which has been
+// validated. Types without a specialisation are exposed as the BerView of their element, which may be decoded.
+template <typename T, typename = void>
+struct ViewTraits
+{
+    using type = BerView;
+
+    template <typename Identifier>
+    static bool validate(BerView input) noexcept
+    {
+        return input.is_valid() && Identifier::check_id_match(input.class_(), input.tag());
+    }
+
+    template <typename Identifier>
+    static type make(BerView input) noexcept
+    {
+        return input;
+    }
+};
+
+template <typename T>
+using ViewType = typename ViewTraits<T>::type;
+
+namespace detail
+{
+
+// The element holding the value of an encoded type, after any explicit tag has been removed
+template <typename Identifier>
+BerView value_element(BerView input) noexcept
+{
+    return (Identifier::depth() == 1) ? input : *input.begin();
+}
+
+template <typename Identifier>
+bool has_primitive_value(BerView input, size_t min_length, size_t max_length) noexcept
+{
+    if (!has_correct_header(input, Identifier{}, Construction::primitive))
+    {
+        return false;
+    }
+
+    const size_t length = value_element<Identifier>(input).content_length();
+    return length >= min_length && length <= max_length;
+}
+
+template <typename Identifier>
+int64_t integer_value(BerView input) noexcept
+{
+    int64_t value = 0;
+    decode_integer(value_element<Identifier>(input).content(), value);
+    return value;
+}
+
+} // namespace detail
+
+template <UniversalTag tag, typename I, typename S>
+struct ViewTraits<StringImpl<tag, I, S>>
+{
+    using type = absl::string_view;
+
+    template <typename Identifier>
+    static bool validate(BerView input) noexcept
+    {
+        return has_correct_header(input, Identifier{}, Construction::primitive);
+    }
+
+    template <typename Identifier>
+    static type make(BerView input) noexcept
+    {
+        const BerView value = detail::value_element<Identifier>(input);
+        return absl::string_view(reinterpret_cast<const char*>(value.content_data()), value.content_length());
+    }
+};
+
+template <typename I>
+struct ViewTraits<Integer<I>>
+{
+    using type = int64_t;
+
+    template <typename Identifier>
+    static bool validate(BerView input) noexcept
+    {
+        return detail::has_primitive_value<Identifier>(input, 1, sizeof(int64_t));
+    }
+
+    template <typename Identifier>
+    static type make(BerView input) noexcept
+    {
+        return detail::integer_value<Identifier>(input);
+    }
+};
+
+template <typename I, typename V>
+struct ViewTraits<NativeInteger<I, V>>
+{
+    using type = int64_t;
+
+    template <typename Identifier>
+    static bool validate(BerView input) noexcept
+    {
+        return detail::has_primitive_value<Identifier>(input, 1, sizeof(int64_t));
+    }
+
+    template <typename Identifier>
+    static type make(BerView input) noexcept
+    {
+        return detail::integer_value<Identifier>(input);
+    }
+};
+
+template <typename EnumeratedType, typename I, template <typename> class S>
+struct ViewTraits<Enumerated<EnumeratedType, I, S>>
+{
+    using type = EnumeratedType;
+
+    template <typename Identifier>
+    static bool validate(BerView input) noexcept
+    {
+        return detail::has_primitive_value<Identifier>(input, 1, sizeof(int64_t));
+    }
+
+    template <typename Identifier>
+    static type make(BerView input) noexcept
+    {
+        return static_cast<EnumeratedType>(detail::integer_value<Identifier>(input));
+    }
+};
+
+template <typename I>
+struct ViewTraits<Boolean<I>>
+{
+    using type = bool;
+
+    template <typename Identifier>
+    static bool validate(BerView input) noexcept
+    {
+        return detail::has_primitive_value<Identifier>(input, 1, 1);
+    }
+
+    template <typename Identifier>
+    static type make(BerView input) noexcept
+    {
+        return *detail::value_element<Identifier>(input).content_data() != 0x00;
+    }
+};
+
+// DEFAULT members are read as their type. default_value() views the default value, read from an encoding of it made on
+// first use, which lives until the program exits. Making the encoding allocates, so default_value() may throw
+template <typename T, typename DefaultValue>
+struct ViewTraits<Default<T, DefaultValue>>
+{
+    using type = ViewType<T>;
+
+    template <typename Identifier>
+    static bool validate(BerView input) noexcept
+    {
+        return ViewTraits<T>::template validate<Identifier>(input);
+    }
+
+    template <typename Identifier>
+    static type make(BerView input) noexcept
+    {
+        return ViewTraits<T>::template make<Identifier>(input);
+    }
+
+    static type default_value()
+    {
+        static const std::vector<uint8_t> encoded = encode_default_value();
+        return ViewTraits<T>::template make<fast_ber::Identifier<T>>(BerView(absl::MakeConstSpan(encoded)));
+    }
+
+  private:
+    static std::vector<uint8_t> encode_default_value()
+    {
+        const T&             value = Default<T, DefaultValue>::default_value();
+        std::vector<uint8_t> encoded(fast_ber::encoded_length(value));
+        fast_ber::encode(absl::MakeSpan(encoded), value);
+        return encoded;
+    }
+};
+
+// Generated types provide a View class, which validates its own members when it is created
+template <typename T>
+struct ViewTraits<T, absl::void_t<typename T::View>>
+{
+    using type = typename T::View;
+
+    template <typename Identifier>
+    static bool validate(BerView input) noexcept
+    {
+        return input.is_valid() && Identifier::check_id_match(input.class_(), input.tag());
+    }
+
+    template <typename Identifier>
+    static type make(BerView input) noexcept
+    {
+        type view;
+        view.template assign_with_id<Identifier>(input);
+        return view;
+    }
+};
+
+// Lazy range over the elements of an encoded SEQUENCE OF / SET OF, each element is read as it is visited
+template <typename T>
+class SequenceOfView
+{
+  public:
+    class Iterator
+    {
+      public:
+        explicit Iterator(BerViewIterator iterator) noexcept : m_iterator(iterator) {}
+
+        ViewType<T> operator*() const noexcept { return ViewTraits<T>::template make<Identifier<T>>(*m_iterator); }
+        Iterator&   operator++() noexcept
+        {
+            ++m_iterator;
+            return *this;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+        {
+            return lhs.m_iterator == rhs.m_iterator;
+        }
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept { return !(lhs == rhs); }
+
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = ViewType<T>;
+        using pointer           = void;
+        using reference         = ViewType<T>;
+        using iterator_category = std::input_iterator_tag;
+
+      private:
+        BerViewIterator m_iterator;
+    };
+
+    SequenceOfView() noexcept = default;
+    explicit SequenceOfView(BerView elements) noexcept : m_elements(elements) {}
+
+    Iterator begin() const noexcept { return Iterator(m_elements.begin()); }
+    Iterator end() const noexcept { return Iterator(m_elements.end()); }
+    bool     empty() const noexcept { return m_elements.content_length() == 0; }
+    size_t   size() const noexcept { return static_cast<size_t>(std::distance(m_elements.begin(), m_elements.end())); }
+
+    // Element holding the encoded elements as its content
+    BerView elements() const noexcept { return m_elements; }
+
+  private:
+    BerView m_elements;
+};
+
+template <typename T, typename I, StorageMode s, size_t n>
+struct ViewTraits<SequenceOf<T, I, s, n>>
+{
+    using type = SequenceOfView<T>;
+
+    // The header of each element is checked, elements which are generated types validate their members when read
+    template <typename Identifier>
+    static bool validate(BerView input) noexcept
+    {
+        if (!has_correct_header(input, Identifier{}, Construction::constructed))
+        {
+            return false;
+        }
+
+        const BerView elements = detail::value_element<Identifier>(input);
+        size_t        length   = 0;
+        for (const BerView element : elements)
+        {
+            if (!ViewTraits<T>::template validate<fast_ber::Identifier<T>>(element))
+            {
+                return false;
+            }
+            length += element.ber_length();
+        }
+        return length == elements.content_length();
+    }
+
+    template <typename Identifier>
+    static type make(BerView input) noexcept
+    {
+        return type(detail::value_element<Identifier>(input));
+    }
+};
+
+} // namespace fast_ber
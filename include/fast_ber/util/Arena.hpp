@@ -0,0 +1,285 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fast_ber
+{
+
+// Monotonic allocator. Allocations are carved from large blocks and are never freed individually, all allocations are
+// released at once by reset(). Blocks are kept for reuse after a reset, so an arena used to decode a stream of similar
+// PDUs stops requesting memory from the system once it has grown to the size of the largest PDU.
+//
+// Types with StorageMode::arena allocate from the arena made current on the thread by an ArenaScope. Objects using an
+// arena must be destroyed, or no longer accessed, before the arena is reset.
+class Arena
+{
+  public:
+    static constexpr size_t default_block_size = 64 * 1024;
+
+    explicit Arena(size_t block_size = default_block_size) noexcept : m_block_size(std::max(block_size, size_t(64))) {}
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    ~Arena() noexcept;
+
+    void* allocate(size_t size, size_t alignment);
+    void  reset() noexcept;
+
+    size_t bytes_allocated() const noexcept { return m_bytes_allocated; } // Allocated since the last reset
+    size_t capacity() const noexcept;                                       // Total size of all blocks
+
+    // Arena of the innermost ArenaScope on this thread, nullptr if there is none
+    static Arena* current() noexcept { return current_ref(); }
+
+  private:
+    friend class ArenaScope;
+
+    struct Block
+    {
+        uint8_t* data;
+        size_t   size;
+    };
+
+    static Arena*& current_ref() noexcept
+    {
+        static thread_local Arena* current = nullptr;
+        return current;
+    }
+
+    void* allocate_from_block(size_t size, size_t alignment) noexcept;
+
+    std::vector<Block> m_blocks;
+    size_t             m_block           = 0; // Index of the block being allocated from
+    size_t             m_offset          = 0; // Offset of the next allocation in the current block
+    size_t             m_bytes_allocated = 0;
+    size_t             m_block_size;
+};
+
+// Makes an arena current on this thread for the lifetime of the scope. Scopes may be nested.
+class ArenaScope
+{
+  public:
+    explicit ArenaScope(Arena& arena) noexcept : m_previous(Arena::current_ref()) { Arena::current_ref() = &arena; }
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ~ArenaScope() noexcept { Arena::current_ref() = m_previous; }
+
+  private:
+    Arena* m_previous;
+};
+
+inline Arena::~Arena() noexcept
+{
+    for (const Block& block : m_blocks)
+    {
+        ::operator delete(block.data);
+    }
+}
+
+inline void* Arena::allocate(size_t size, size_t alignment)
+{
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    m_bytes_allocated += size;
+    while (m_block < m_blocks.size())
+    {
+        void* const allocation = allocate_from_block(size, alignment);
+        if (allocation != nullptr)
+        {
+            return allocation;
+        }
+
+        // Blocks kept from before a reset are tried in order before a new block is added
+        m_block++;
+        m_offset = 0;
+    }
+
+    // Blocks double in size, limiting the number of system allocations made by a growing arena
+    size_t block_size = m_blocks.empty() ? m_block_size : m_blocks.back().size * 2;
+    block_size        = std::max(block_size, size + alignment);
+    m_blocks.push_back(Block{static_cast<uint8_t*>(::operator new(block_size)), block_size});
+    m_block  = m_blocks.size() - 1;
+    m_offset = 0;
+
+    void* const allocation = allocate_from_block(size, alignment);
+    assert(allocation != nullptr);
+    return allocation;
+}
+
+inline void* Arena::allocate_from_block(size_t size, size_t alignment) noexcept
+{
+    const Block&    block   = m_blocks[m_block];
+    const uintptr_t address = reinterpret_cast<uintptr_t>(block.data) + m_offset;
+    const size_t    padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+    if (m_offset + padding + size > block.size)
+    {
+        return nullptr;
+    }
+
+    void* const allocation = block.data + m_offset + padding;
+    m_offset += padding + size;
+    return allocation;
+}
+
+inline void Arena::reset() noexcept
+{
+    m_block           = 0;
+    m_offset          = 0;
+    m_bytes_allocated = 0;
+}
+
+inline size_t Arena::capacity() const noexcept
+{
+    size_t total = 0;
+    for (const Block& block : m_blocks)
+    {
+        total += block.size;
+    }
+    return total;
+}
+
+// Standard library allocator using the current arena when it is constructed, or the heap if there is none.
+// Memory from an arena is only released when the arena is reset. Allocators of different arenas are unequal, the
+// allocator is propagated on assignment and swap so containers of different arenas can be moved and swapped, each
+// element staying with the arena it was allocated from.
+template <typename T>
+class ArenaAllocator
+{
+  public:
+    using value_type                             = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::false_type;
+
+    ArenaAllocator() noexcept : m_arena(Arena::current()) {}
+    explicit ArenaAllocator(Arena* arena) noexcept : m_arena(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& rhs) noexcept : m_arena(rhs.arena())
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(m_arena ? m_arena->allocate(n * sizeof(T), alignof(T)) : ::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t) noexcept
+    {
+        if (m_arena == nullptr)
+        {
+            ::operator delete(p);
+        }
+    }
+
+    // Copies of containers allocate from the arena current where they are made, not from the arena of the original
+    ArenaAllocator select_on_container_copy_construction() const noexcept { return ArenaAllocator(); }
+
+    Arena* arena() const noexcept { return m_arena; }
+
+  private:
+    Arena* m_arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+{
+    return lhs.arena() == rhs.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+// Allocation policies used by DynamicOptional and DynamicVariant to create and destroy their values
+
+struct HeapAllocation
+{
+    template <typename T, typename... Args>
+    static T* create(Args&&... args)
+    {
+        return new T(std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    static void destroy(T* t) noexcept
+    {
+        delete t;
+    }
+};
+
+// Values are created in the current arena, or on the heap if there is none. The arena used is recorded just before
+// each value, so a value is destroyed correctly regardless of the arena current when it is destroyed.
+struct ArenaAllocation
+{
+    template <typename T>
+    struct Layout
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Over aligned types are not supported");
+
+        // Offset of the value from the start of the allocation, the owning arena is stored immediately before it
+        static constexpr size_t offset    = (sizeof(Arena*) + alignof(T) - 1) / alignof(T) * alignof(T);
+        static constexpr size_t size      = offset + sizeof(T);
+        static constexpr size_t alignment = alignof(T) > alignof(Arena*) ? alignof(T) : alignof(Arena*);
+    };
+
+    template <typename T, typename... Args>
+    static T* create(Args&&... args)
+    {
+        Arena* const   arena = Arena::current();
+        uint8_t* const allocation =
+            static_cast<uint8_t*>(arena ? arena->allocate(Layout<T>::size, Layout<T>::alignment)
+                                        : ::operator new(Layout<T>::size));
+        new (allocation + Layout<T>::offset - sizeof(Arena*)) Arena*(arena);
+
+        try
+        {
+            return new (allocation + Layout<T>::offset) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            if (arena == nullptr)
+            {
+                ::operator delete(allocation);
+            }
+            throw;
+        }
+    }
+
+    template <typename T>
+    static void destroy(T* t) noexcept
+    {
+        if (t == nullptr)
+        {
+            return;
+        }
+
+        uint8_t* const allocation = reinterpret_cast<uint8_t*>(t) - Layout<T>::offset;
+        Arena* const   arena = *reinterpret_cast<Arena**>(allocation + Layout<T>::offset - sizeof(Arena*));
+        t->~T();
+        if (arena == nullptr)
+        {
+            ::operator delete(allocation);
+        }
+    }
+};
+
+template <typename Allocation>
+struct AllocationDeleter
+{
+    template <typename T>
+    void operator()(T* t) const noexcept
+    {
+        Allocation::destroy(t);
+    }
+};
+
+} // namespace fast_ber
@@ -63,6 +63,7 @@ class BerContainer
     const BerView view() const noexcept { return m_view; }
 
     EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept { return m_view.encode_reverse(buffer); }
     DecodeResult decode(const BerView input_data) noexcept;
 
   private:
@@ -169,6 +170,7 @@ inline DecodeResult BerContainer::decode(const BerView input_view) noexcept
         m_data = {};
         m_view.assign(absl::Span<uint8_t>(m_data));
         assert(!m_view.is_valid());
+        FAST_BER_ERROR(ErrorCode::invalid_packet, nullptr);
         return DecodeResult{false};
     }
 
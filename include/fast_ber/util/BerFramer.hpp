@@ -0,0 +1,236 @@
+#pragma once
+
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/Extract.hpp"
+
+#include "absl/types/span.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace fast_ber
+{
+
+enum class FrameStatus
+{
+    ready,     // A complete PDU has been produced
+    need_more, // All pushed data has been consumed, bytes_needed() more bytes are required for the next PDU
+    error,     // The stream is malformed, the framer must be reset before it can be used again
+};
+
+// Splits a stream of back to back ber PDUs, such as a file of records or a TCP feed, into complete PDUs.
+// Data is pushed in chunks with any boundaries, PDUs are then pulled with next() until it returns need_more.
+//
+// PDUs contained in a single chunk are produced as views of the chunk, without copying. A PDU split between chunks is
+// stitched together in an internal buffer, copying only the bytes of that PDU. A produced PDU is valid until the next
+// call to push() or next(). A chunk must remain valid until next() returns need_more, after which the framer holds
+// no references to it and the chunk's storage may be reused for the next read.
+class BerFramer
+{
+  public:
+    static constexpr size_t default_max_pdu_length = size_t(64) * 1024 * 1024;
+
+    // PDUs longer than max_pdu_length are treated as malformed, limiting the memory used when stitching
+    explicit BerFramer(size_t max_pdu_length = default_max_pdu_length) noexcept : m_max_pdu_length(max_pdu_length) {}
+
+    void        push(absl::Span<const uint8_t> chunk);
+    FrameStatus next(BerView& pdu);
+
+    // Minimum number of bytes which must be pushed before the next PDU can be produced, useful for sizing reads.
+    // The exact remaining length is known once the header of the next PDU has been received.
+    size_t bytes_needed() const noexcept { return m_bytes_needed; }
+
+    // Bytes received which do not yet form a complete PDU, zero at a clean end of stream
+    size_t buffered() const noexcept { return m_pending.size() - m_produced_length + m_chunk.size(); }
+    bool   has_error() const noexcept { return m_error; }
+    void   reset() noexcept;
+
+  private:
+    FrameStatus frame_length(absl::Span<const uint8_t> data, size_t& header_length, size_t& ber_length) noexcept;
+    FrameStatus next_stitched(BerView& pdu);
+    FrameStatus fail() noexcept;
+    void        release_produced() noexcept;
+
+    absl::Span<const uint8_t> m_chunk;
+    std::vector<uint8_t>      m_pending;
+    size_t                    m_produced_length = 0; // Length of the PDU produced from the start of m_pending
+    bool                      m_error           = false;
+    size_t                    m_bytes_needed    = 2;
+    size_t                    m_max_pdu_length;
+};
+
+inline void BerFramer::push(absl::Span<const uint8_t> chunk)
+{
+    release_produced();
+
+    // Data from the previous chunk which has not been framed must be kept before the chunk is replaced
+    if (!m_chunk.empty())
+    {
+        m_pending.insert(m_pending.end(), m_chunk.begin(), m_chunk.end());
+    }
+    m_chunk = chunk;
+}
+
+inline FrameStatus BerFramer::next(BerView& pdu)
+{
+    if (m_error)
+    {
+        return FrameStatus::error;
+    }
+
+    release_produced();
+    if (!m_pending.empty())
+    {
+        return next_stitched(pdu);
+    }
+
+    size_t            header_length = 0;
+    size_t            ber_length    = 0;
+    const FrameStatus status        = frame_length(m_chunk, header_length, ber_length);
+    if (status == FrameStatus::ready)
+    {
+        pdu.assign(m_chunk.subspan(0, ber_length), header_length, ber_length - header_length);
+        m_chunk.remove_prefix(ber_length);
+        return FrameStatus::ready;
+    }
+    if (status == FrameStatus::error)
+    {
+        return fail();
+    }
+
+    // The PDU continues in the next chunk
+    if (ber_length > 0)
+    {
+        m_pending.reserve(ber_length);
+    }
+    m_pending.assign(m_chunk.begin(), m_chunk.end());
+    m_chunk = absl::Span<const uint8_t>();
+    return FrameStatus::need_more;
+}
+
+// Complete the PDU started in a previous chunk. Only the bytes required to complete the header, then the PDU, are
+// copied. The remainder of the chunk is framed without copying.
+inline FrameStatus BerFramer::next_stitched(BerView& pdu)
+{
+    size_t header_length = 0;
+    size_t ber_length    = 0;
+    while (true)
+    {
+        const FrameStatus status = frame_length(m_pending, header_length, ber_length);
+        if (status == FrameStatus::error)
+        {
+            return fail();
+        }
+        if (status == FrameStatus::ready)
+        {
+            break;
+        }
+        if (m_chunk.empty())
+        {
+            return FrameStatus::need_more;
+        }
+
+        const size_t copy_length = std::min(m_bytes_needed, m_chunk.size());
+        m_pending.insert(m_pending.end(), m_chunk.begin(), m_chunk.begin() + copy_length);
+        m_chunk.remove_prefix(copy_length);
+    }
+
+    pdu.assign(m_pending, header_length, ber_length - header_length);
+    m_produced_length = ber_length;
+    return FrameStatus::ready;
+}
+
+// The stitched buffer only holds data following the produced PDU if a chunk was pushed before the previous one was
+// drained, usually the whole buffer is released
+inline void BerFramer::release_produced() noexcept
+{
+    m_pending.erase(m_pending.begin(), m_pending.begin() + static_cast<std::ptrdiff_t>(m_produced_length));
+    m_produced_length = 0;
+}
+
+inline void BerFramer::reset() noexcept
+{
+    m_chunk = absl::Span<const uint8_t>();
+    m_pending.clear();
+    m_produced_length = 0;
+    m_error           = false;
+    m_bytes_needed    = 2;
+}
+
+inline FrameStatus BerFramer::fail() noexcept
+{
+    m_error        = true;
+    m_bytes_needed = 0;
+    return FrameStatus::error;
+}
+
+// Determine the length of the PDU at the start of data, from as much of the header as is available.
+// ber_length is set once the header is complete. If the PDU is incomplete m_bytes_needed is set to the minimum number
+// of bytes required to make progress, which is the remainder of the PDU once its length is known.
+inline FrameStatus BerFramer::frame_length(absl::Span<const uint8_t> data, size_t& header_length,
+                                           size_t& ber_length) noexcept
+{
+    constexpr size_t max_tag_length = 10; // Tags are limited to 64 bits
+    constexpr size_t max_len_length = 8;
+
+    ber_length = 0;
+
+    // Identifier octets
+    size_t tag_length = 1;
+    if (!data.empty() && (data[0] & 0x1F) == 0x1F)
+    {
+        while (tag_length < data.size() && (data[tag_length] & 0x80) != 0)
+        {
+            tag_length++;
+        }
+        tag_length++;
+        if (tag_length > max_tag_length)
+        {
+            return FrameStatus::error;
+        }
+    }
+    if (data.size() <= tag_length)
+    {
+        m_bytes_needed = tag_length + 1 - data.size();
+        return FrameStatus::need_more;
+    }
+
+    // Length octets, indefinite lengths are not supported
+    const uint8_t length_0   = data[tag_length];
+    size_t        len_length = 1;
+    if ((length_0 & 0x80) != 0)
+    {
+        len_length += length_0 & 0x7F;
+        if (len_length == 1 || len_length > max_len_length + 1)
+        {
+            return FrameStatus::error;
+        }
+    }
+    header_length = tag_length + len_length;
+    if (data.size() < header_length)
+    {
+        m_bytes_needed = header_length - data.size();
+        return FrameStatus::need_more;
+    }
+
+    size_t content_length = 0;
+    if (extract_length(data, content_length, tag_length) != len_length || content_length > m_max_pdu_length ||
+        header_length + content_length > m_max_pdu_length)
+    {
+        return FrameStatus::error;
+    }
+
+    ber_length = header_length + content_length;
+    if (data.size() < ber_length)
+    {
+        m_bytes_needed = ber_length - data.size();
+        return FrameStatus::need_more;
+    }
+
+    m_bytes_needed = 2;
+    return FrameStatus::ready;
+}
+
+} // namespace fast_ber
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "fast_ber/ber_types/Class.hpp"
+#include "fast_ber/ber_types/Construction.hpp"
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/Extract.hpp"
+
+#include "absl/types/span.h"
+
+#include <cassert>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <vector>
+
+namespace fast_ber
+{
+
+static constexpr uint32_t ber_index_npos = std::numeric_limits<uint32_t>::max();
+
+// A single ber element of an indexed PDU. Offsets are relative to the start of the indexed input.
+struct BerIndexNode
+{
+    uint32_t offset;
+    uint32_t content_length;
+    uint32_t tag;
+    uint32_t first_child;  // ber_index_npos if the element has no children
+    uint32_t next_sibling; // ber_index_npos if the element is the last child of its parent
+    uint32_t child_count;
+    uint32_t header_length;
+    uint32_t identifier; // First identifier octet, holding class and construction
+
+    Construction construction() const noexcept { return get_construction(static_cast<uint8_t>(identifier)); }
+    Class        class_() const noexcept { return get_class(static_cast<uint8_t>(identifier)); }
+    size_t       content_offset() const noexcept { return size_t(offset) + header_length; }
+    size_t       ber_length() const noexcept { return size_t(header_length) + content_length; }
+};
+
+// Flat index of every element of a ber PDU, built with a single iterative scan of the input. Nodes are stored in
+// breadth first order, so the children of a node are contiguous and the n-th child is found in constant time.
+// Headers are parsed once, BerViews can be created from the index without parsing the input again.
+// The index refers to the input, which must outlive it. It can be rebuilt for each PDU to reuse its storage.
+class BerIndex
+{
+  public:
+    BerIndex() noexcept = default;
+    explicit BerIndex(absl::Span<const uint8_t> input) { build(input); }
+
+    // Index the ber PDU at the start of input, any trailing data is ignored
+    // Return false if the PDU or any of its constructed elements are malformed, in which case the index is empty
+    bool build(absl::Span<const uint8_t> input);
+    void clear() noexcept;
+
+    bool                           is_valid() const noexcept { return !m_nodes.empty(); }
+    size_t                         size() const noexcept { return m_nodes.size(); }
+    absl::Span<const BerIndexNode> nodes() const noexcept { return m_nodes; }
+    const BerIndexNode&            node(size_t index) const noexcept;
+    const BerIndexNode&            root() const noexcept { return node(0); }
+    absl::Span<const uint8_t>      input() const noexcept { return m_input; }
+
+    // Index of the n-th child of a node, ber_index_npos if the node has no such child
+    size_t child(size_t index, size_t n) const noexcept;
+
+    BerView                   view(size_t index) const noexcept;
+    absl::Span<const uint8_t> content(size_t index) const noexcept;
+
+  private:
+    bool add_node(size_t offset, size_t available);
+    bool add_children(size_t parent);
+
+    absl::Span<const uint8_t> m_input;
+    std::vector<BerIndexNode> m_nodes;
+};
+
+inline bool BerIndex::build(absl::Span<const uint8_t> input)
+{
+    clear();
+
+    // Offsets and lengths are stored in 32 bits
+    if (input.size() >= ber_index_npos)
+    {
+        return false;
+    }
+
+    m_input = input;
+    if (!add_node(0, input.size()))
+    {
+        clear();
+        return false;
+    }
+    m_nodes.front().next_sibling = ber_index_npos;
+
+    // Nodes are appended as their parents are scanned, so the node list also acts as the work queue
+    for (size_t i = 0; i < m_nodes.size(); i++)
+    {
+        if (m_nodes[i].construction() == Construction::constructed && !add_children(i))
+        {
+            clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+inline void BerIndex::clear() noexcept
+{
+    m_input = absl::Span<const uint8_t>();
+    m_nodes.clear();
+}
+
+inline const BerIndexNode& BerIndex::node(size_t index) const noexcept
+{
+    assert(index < m_nodes.size());
+    return m_nodes[index];
+}
+
+inline size_t BerIndex::child(size_t index, size_t n) const noexcept
+{
+    const BerIndexNode& parent = node(index);
+    return (n < parent.child_count) ? size_t(parent.first_child) + n : size_t(ber_index_npos);
+}
+
+inline BerView BerIndex::view(size_t index) const noexcept
+{
+    const BerIndexNode& element = node(index);
+    return BerView(m_input.subspan(element.offset, element.ber_length()), static_cast<Tag>(element.tag),
+                   element.header_length, element.content_length);
+}
+
+inline absl::Span<const uint8_t> BerIndex::content(size_t index) const noexcept
+{
+    const BerIndexNode& element = node(index);
+    return m_input.subspan(element.content_offset(), element.content_length);
+}
+
+inline bool BerIndex::add_node(size_t offset, size_t available)
+{
+    const absl::Span<const uint8_t> data(m_input.data() + offset, available);
+
+    Tag    tag            = 0;
+    size_t content_length = 0;
+    size_t header_length  = extract_short_header(data, tag, content_length);
+    if (header_length == 0)
+    {
+        const size_t tag_length = extract_tag(data, tag);
+        if (tag_length == 0)
+        {
+            return false;
+        }
+
+        const size_t length_length = extract_length(data, content_length, tag_length);
+        if (length_length == 0)
+        {
+            return false;
+        }
+        header_length = tag_length + length_length;
+    }
+
+    if (content_length > available - header_length || tag > Tag(std::numeric_limits<uint32_t>::max()))
+    {
+        return false;
+    }
+
+    m_nodes.emplace_back();
+    BerIndexNode& node  = m_nodes.back();
+    node.offset         = static_cast<uint32_t>(offset);
+    node.content_length = static_cast<uint32_t>(content_length);
+    node.tag            = static_cast<uint32_t>(tag);
+    node.first_child    = ber_index_npos;
+    node.next_sibling   = static_cast<uint32_t>(m_nodes.size()); // Corrected by add_children for the last child
+    node.child_count    = 0;
+    node.header_length  = static_cast<uint32_t>(header_length);
+    node.identifier     = data[0];
+    return true;
+}
+
+inline bool BerIndex::add_children(size_t parent)
+{
+    const size_t first_child = m_nodes.size();
+    const size_t end         = m_nodes[parent].content_offset() + m_nodes[parent].content_length;
+
+    size_t offset = m_nodes[parent].content_offset();
+    while (offset < end)
+    {
+        if (!add_node(offset, end - offset))
+        {
+            return false;
+        }
+
+        offset += m_nodes.back().ber_length();
+    }
+
+    if (m_nodes.size() > first_child)
+    {
+        m_nodes.back().next_sibling = ber_index_npos;
+        m_nodes[parent].first_child = static_cast<uint32_t>(first_child);
+        m_nodes[parent].child_count = static_cast<uint32_t>(m_nodes.size() - first_child);
+    }
+    return true;
+}
+
+// Prints the same representation as streaming a BerView of the indexed PDU
+std::ostream& operator<<(std::ostream& os, const BerIndex& index) noexcept;
+
+} // namespace fast_ber
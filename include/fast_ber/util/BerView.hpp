@@ -54,6 +54,7 @@ class BerView
     BerViewIterator end() const noexcept;
 
     EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept { return prepend_ber(buffer, ber()); }
 
   private:
     const uint8_t* m_data           = nullptr;
@@ -195,6 +196,16 @@ inline void BerView::assign(absl::Span<const uint8_t> input_ber_data) noexcept
 {
     size_t input_content_length = 0;
 
+    // Fast path for single byte identifier and short form length
+    if (extract_short_header(input_ber_data, m_tag, input_content_length) != 0 &&
+        input_content_length + 2 <= input_ber_data.length())
+    {
+        m_data           = input_ber_data.data();
+        m_header_length  = 2;
+        m_content_length = input_content_length;
+        return;
+    }
+
     size_t input_tag_length      = extract_tag(input_ber_data, m_tag);
     size_t input_len_length      = extract_length(input_ber_data, input_content_length, input_tag_length);
     size_t input_header_length   = input_tag_length + input_len_length;
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/Error.hpp"
+
+#include "absl/types/span.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace fast_ber
+{
+
+namespace detail
+{
+// Smallest unsigned type able to count up to capacity
+template <size_t capacity>
+struct BoundedLength
+{
+    using Wide = typename std::conditional<capacity <= UINT16_MAX, uint16_t, size_t>::type;
+    using type = typename std::conditional<capacity <= UINT8_MAX, uint8_t, Wide>::type;
+};
+} // namespace detail
+
+// Owning container of the contents of a ber packet with a fixed identifier and a maximum size, such as a string with a
+// SIZE constraint. The contents are held in a fixed array, so the container never allocates. Contents longer than the
+// capacity fail to decode or to be assigned, reported as capacity_exceeded, and the contents are left unchanged.
+template <typename Identifier, size_t capacity>
+class BoundedBerContainer
+{
+  public:
+    BoundedBerContainer() noexcept = default;
+    BoundedBerContainer(BerView input_view) noexcept { decode(input_view); }
+    template <typename Identifier2, size_t capacity_2>
+    BoundedBerContainer(const BoundedBerContainer<Identifier2, capacity_2>& rhs) noexcept
+    {
+        assign_content(rhs.content());
+    }
+
+    BoundedBerContainer& operator=(BerView input_view) noexcept;
+    template <typename Identifier2, size_t capacity_2>
+    BoundedBerContainer& operator=(const BoundedBerContainer<Identifier2, capacity_2>& rhs) noexcept;
+
+    bool assign_content(const absl::Span<const uint8_t> input_content) noexcept;
+    bool resize_content(size_t size) noexcept;
+
+    constexpr static Class class_() noexcept { return Identifier::class_(); }
+    constexpr static Tag   tag() noexcept { return Identifier::tag(); }
+
+    absl::Span<uint8_t>       content() noexcept { return absl::MakeSpan(m_content.data(), m_length); }
+    absl::Span<const uint8_t> content() const noexcept { return absl::MakeConstSpan(m_content.data(), m_length); }
+    uint8_t*                  content_data() noexcept { return m_content.data(); }
+    const uint8_t*            content_data() const noexcept { return m_content.data(); }
+    size_t                    content_length() const noexcept { return m_length; }
+
+    bool operator==(const BoundedBerContainer& rhs) const noexcept { return content() == rhs.content(); }
+    bool operator!=(const BoundedBerContainer& rhs) const noexcept { return !(*this == rhs); }
+
+    size_t       encoded_length() const noexcept { return fast_ber::encoded_length(m_length, Identifier{}); }
+    EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept;
+    DecodeResult decode(BerView view) noexcept;
+
+  private:
+    using Length = typename detail::BoundedLength<capacity>::type;
+
+    std::array<uint8_t, capacity> m_content = {};
+    Length                        m_length  = 0;
+};
+
+// Storage policy holding the contents of a packet in place, see BoundedBerContainer. Used for strings with an upper
+// bound on their size
+template <size_t capacity>
+struct BoundedStorage
+{
+    template <typename Identifier>
+    using Container = BoundedBerContainer<Identifier, capacity>;
+};
+
+template <typename Identifier, size_t capacity>
+BoundedBerContainer<Identifier, capacity>&
+BoundedBerContainer<Identifier, capacity>::operator=(BerView input_view) noexcept
+{
+    decode(input_view);
+    return *this;
+}
+
+template <typename Identifier, size_t capacity>
+template <typename Identifier2, size_t capacity_2>
+BoundedBerContainer<Identifier, capacity>&
+BoundedBerContainer<Identifier, capacity>::operator=(const BoundedBerContainer<Identifier2, capacity_2>& rhs) noexcept
+{
+    assign_content(rhs.content());
+    return *this;
+}
+
+template <typename Identifier, size_t capacity>
+bool BoundedBerContainer<Identifier, capacity>::assign_content(const absl::Span<const uint8_t> input_content) noexcept
+{
+    if (!resize_content(input_content.size()))
+    {
+        return false;
+    }
+
+    std::memmove(m_content.data(), input_content.data(), m_length);
+    return true;
+}
+
+template <typename Identifier, size_t capacity>
+bool BoundedBerContainer<Identifier, capacity>::resize_content(size_t size) noexcept
+{
+    if (size > capacity)
+    {
+        FAST_BER_ERROR(ErrorCode::capacity_exceeded, nullptr);
+        return false;
+    }
+
+    m_length = static_cast<Length>(size);
+    return true;
+}
+
+template <typename Identifier, size_t capacity>
+EncodeResult BoundedBerContainer<Identifier, capacity>::encode(absl::Span<uint8_t> buffer) const noexcept
+{
+    const EncodeResult result = encode_header(buffer, m_length, Identifier{}, Construction::primitive);
+    if (!result.success || buffer.size() < result.length)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    std::memcpy(buffer.data() + result.length - m_length, m_content.data(), m_length);
+    return result;
+}
+
+template <typename Identifier, size_t capacity>
+EncodeResult BoundedBerContainer<Identifier, capacity>::encode_reverse(absl::Span<uint8_t> buffer) const noexcept
+{
+    const size_t length = encoded_length();
+    if (buffer.size() < length)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    buffer.remove_prefix(buffer.size() - length);
+    return encode(buffer);
+}
+
+template <typename Identifier, size_t capacity>
+DecodeResult BoundedBerContainer<Identifier, capacity>::decode(BerView input_view) noexcept
+{
+    if (!has_correct_header(input_view, Identifier{}, Construction::primitive))
+    {
+        FAST_BER_ERROR(input_view, nullptr);
+        return DecodeResult{false};
+    }
+
+    const BerView value = (Identifier::depth() == 1) ? input_view : *input_view.begin();
+    if (value.content_length() > capacity)
+    {
+        FAST_BER_ERROR(ErrorCode::capacity_exceeded, nullptr, value.identifier());
+        return DecodeResult{false};
+    }
+
+    assign_content(value.content());
+    return DecodeResult{true};
+}
+
+} // namespace fast_ber
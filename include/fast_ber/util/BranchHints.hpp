@@ -0,0 +1,18 @@
+#pragma once
+
+// Branch hints for the generated code and the library. FAST_BER_UNLIKELY marks the failure branches of encode and
+// decode, letting the compiler lay out the successful path as straight line code. FAST_BER_COLD marks functions only
+// called on failure, such as the error reports, which are kept out of line and placed away from the hot code.
+#if defined(__GNUC__) || defined(__clang__)
+#define FAST_BER_LIKELY(...) __builtin_expect(static_cast<bool>(__VA_ARGS__), 1)
+#define FAST_BER_UNLIKELY(...) __builtin_expect(static_cast<bool>(__VA_ARGS__), 0)
+#define FAST_BER_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define FAST_BER_LIKELY(...) (__VA_ARGS__)
+#define FAST_BER_UNLIKELY(...) (__VA_ARGS__)
+#define FAST_BER_COLD __declspec(noinline)
+#else
+#define FAST_BER_LIKELY(...) (__VA_ARGS__)
+#define FAST_BER_UNLIKELY(...) (__VA_ARGS__)
+#define FAST_BER_COLD
+#endif
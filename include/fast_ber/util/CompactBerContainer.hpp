@@ -0,0 +1,133 @@
+#pragma once
+
+#include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/Error.hpp"
+
+#include "absl/container/inlined_vector.h"
+#include "absl/types/span.h"
+
+#include <cstring>
+
+namespace fast_ber
+{
+
+// Owning container of the contents of a ber packet with a fixed identifier. As the identifier is known at compile time
+// the header is not stored, it is regenerated when encoding. Contents of up to inline_capacity bytes are held without
+// allocating.
+template <typename Identifier, size_t inline_capacity>
+class CompactBerContainer
+{
+  public:
+    CompactBerContainer() noexcept = default;
+    CompactBerContainer(BerView input_view) noexcept { decode(input_view); }
+    template <typename Identifier2, size_t inline_capacity_2>
+    CompactBerContainer(const CompactBerContainer<Identifier2, inline_capacity_2>& rhs) noexcept
+    {
+        assign_content(rhs.content());
+    }
+
+    CompactBerContainer& operator=(BerView input_view) noexcept;
+    template <typename Identifier2, size_t inline_capacity_2>
+    CompactBerContainer& operator=(const CompactBerContainer<Identifier2, inline_capacity_2>& rhs) noexcept;
+
+    void assign_content(const absl::Span<const uint8_t> input_content) noexcept;
+    void resize_content(size_t size) { m_content.resize(size); }
+
+    constexpr static Class class_() noexcept { return Identifier::class_(); }
+    constexpr static Tag   tag() noexcept { return Identifier::tag(); }
+
+    absl::Span<uint8_t>       content() noexcept { return absl::MakeSpan(m_content); }
+    absl::Span<const uint8_t> content() const noexcept { return absl::MakeConstSpan(m_content); }
+    uint8_t*                  content_data() noexcept { return m_content.data(); }
+    const uint8_t*            content_data() const noexcept { return m_content.data(); }
+    size_t                    content_length() const noexcept { return m_content.size(); }
+
+    bool operator==(const CompactBerContainer& rhs) const noexcept { return content() == rhs.content(); }
+    bool operator!=(const CompactBerContainer& rhs) const noexcept { return !(*this == rhs); }
+
+    size_t       encoded_length() const noexcept { return fast_ber::encoded_length(m_content.size(), Identifier{}); }
+    EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept;
+    DecodeResult decode(BerView view) noexcept;
+
+  private:
+    absl::InlinedVector<uint8_t, inline_capacity> m_content;
+};
+
+// Storage policy holding only the contents of a packet, see CompactBerContainer. The default inline capacity fills the
+// space absl::InlinedVector needs for a heap allocation, so short strings cost no more than long ones
+template <size_t inline_capacity = 16>
+struct CompactStorage
+{
+    template <typename Identifier>
+    using Container = CompactBerContainer<Identifier, inline_capacity>;
+};
+
+template <typename Identifier, size_t inline_capacity>
+CompactBerContainer<Identifier, inline_capacity>&
+CompactBerContainer<Identifier, inline_capacity>::operator=(BerView input_view) noexcept
+{
+    decode(input_view);
+    return *this;
+}
+
+template <typename Identifier, size_t inline_capacity>
+template <typename Identifier2, size_t inline_capacity_2>
+CompactBerContainer<Identifier, inline_capacity>& CompactBerContainer<Identifier, inline_capacity>::operator=(
+    const CompactBerContainer<Identifier2, inline_capacity_2>& rhs) noexcept
+{
+    assign_content(rhs.content());
+    return *this;
+}
+
+template <typename Identifier, size_t inline_capacity>
+void CompactBerContainer<Identifier, inline_capacity>::assign_content(
+    const absl::Span<const uint8_t> input_content) noexcept
+{
+    m_content.assign(input_content.begin(), input_content.end());
+}
+
+template <typename Identifier, size_t inline_capacity>
+EncodeResult CompactBerContainer<Identifier, inline_capacity>::encode(absl::Span<uint8_t> buffer) const noexcept
+{
+    const EncodeResult result = encode_header(buffer, m_content.size(), Identifier{}, Construction::primitive);
+    if (!result.success || buffer.size() < result.length)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    std::memcpy(buffer.data() + result.length - m_content.size(), m_content.data(), m_content.size());
+    return result;
+}
+
+template <typename Identifier, size_t inline_capacity>
+EncodeResult CompactBerContainer<Identifier, inline_capacity>::encode_reverse(absl::Span<uint8_t> buffer) const noexcept
+{
+    const size_t length = encoded_length();
+    if (buffer.size() < length)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    buffer.remove_prefix(buffer.size() - length);
+    return encode(buffer);
+}
+
+template <typename Identifier, size_t inline_capacity>
+DecodeResult CompactBerContainer<Identifier, inline_capacity>::decode(BerView input_view) noexcept
+{
+    if (!has_correct_header(input_view, Identifier{}, Construction::primitive))
+    {
+        FAST_BER_ERROR(input_view, nullptr);
+        return DecodeResult{false};
+    }
+
+    const BerView value = (Identifier::depth() == 1) ? input_view : *input_view.begin();
+    m_content.assign(value.content().begin(), value.content().end());
+    return DecodeResult{true};
+}
+
+} // namespace fast_ber
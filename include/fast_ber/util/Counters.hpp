@@ -0,0 +1,234 @@
+#pragma once
+
+#include "fast_ber/util/BranchHints.hpp"
+#include "fast_ber/util/SiteRegistry.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+// Counters of decode and encode calls, bytes and failures, per type and per member of a collection. Hooks in the
+// library and the generated code declare a site with FAST_BER_COUNTER(site, operation, type, member) and count with
+// FAST_BER_COUNT(site, bytes, success). FAST_BER_COUNT_ENCODED(site, result) and
+// FAST_BER_COUNT_DECODED(site, bytes, result) count a result and evaluate to it, so a hook can wrap a returned
+// expression. Unless FAST_BER_ENABLE_COUNTERS is defined the hooks expand to nothing, or to the result alone, leaving
+// the code exactly as it was without them. The definition must be the same in every translation unit of a program.
+#ifdef FAST_BER_ENABLE_COUNTERS
+#define FAST_BER_COUNTER(site, operation, type, member)                                                                \
+    static const ::fast_ber::CounterSite site(::fast_ber::CounterOperation::operation, type, member)
+#define FAST_BER_COUNT(site, bytes, success) ::fast_ber::count(site, bytes, success)
+#define FAST_BER_COUNT_ENCODED(site, ...) ::fast_ber::count_encoded(site, __VA_ARGS__)
+#define FAST_BER_COUNT_DECODED(site, bytes, ...) ::fast_ber::count_decoded(site, bytes, __VA_ARGS__)
+#else
+#define FAST_BER_COUNTER(site, operation, type, member) static_cast<void>(0)
+#define FAST_BER_COUNT(site, bytes, success) static_cast<void>(0)
+#define FAST_BER_COUNT_ENCODED(site, ...) (__VA_ARGS__)
+#define FAST_BER_COUNT_DECODED(site, bytes, ...) (__VA_ARGS__)
+#endif
+
+namespace fast_ber
+{
+
+enum class CounterOperation
+{
+    decode,
+    encode,
+};
+
+inline const char* to_string(CounterOperation operation) noexcept
+{
+    return operation == CounterOperation::decode ? "decode" : "encode";
+}
+
+struct CounterValues
+{
+    uint64_t calls;
+    uint64_t bytes; // Length of the encodings decoded or encoded, including their headers
+    uint64_t failures;
+};
+
+// Totals of a type, or of a member of a collection, summed over all threads
+struct CounterEntry
+{
+    CounterOperation operation;
+    const char*      type;
+    const char*      member; // nullptr for the counts of the type itself
+    CounterValues    values;
+};
+
+// A place counting decodes or encodes, usually a function local static. Sites register on construction, sites with the
+// same operation and names are reported as one entry. Sites beyond max_sites are not counted.
+class CounterSite
+{
+  public:
+    constexpr static size_t max_sites = 8192;
+
+    CounterSite(CounterOperation operation, const char* type, const char* member) noexcept;
+    CounterSite(const CounterSite&) = delete;
+    CounterSite& operator=(const CounterSite&) = delete;
+
+    CounterOperation operation() const noexcept { return m_operation; }
+    const char*      type() const noexcept { return m_type; }
+    const char*      member() const noexcept { return m_member; }
+    size_t           id() const noexcept { return m_id; }
+
+  private:
+    CounterOperation m_operation;
+    const char*      m_type;
+    const char*      m_member;
+    size_t           m_id;
+};
+
+void count(const CounterSite& site, size_t bytes, bool success) noexcept;
+
+template <typename EncodeResult>
+EncodeResult count_encoded(const CounterSite& site, EncodeResult result) noexcept
+{
+    count(site, result.length, result.success);
+    return result;
+}
+
+template <typename DecodeResult>
+DecodeResult count_decoded(const CounterSite& site, size_t bytes, DecodeResult result) noexcept
+{
+    count(site, bytes, result.success);
+    return result;
+}
+
+// Totals of every type and member counted so far, ordered by operation, type and member. Takes a lock shared with
+// thread start and exit, but not with counting.
+std::vector<CounterEntry> counter_snapshot();
+
+namespace detail
+{
+
+// Counts of a single thread. Only the owning thread increments them, so increments are plain loads and stores rather
+// than locked instructions. Snapshots read them from other threads, hence the relaxed atomics. Counts are held in
+// chunks allocated when a site in the chunk is first counted.
+class ThreadCounters
+{
+  public:
+    using Value = CounterValues;
+
+    constexpr static size_t chunk_size = 64;
+    constexpr static size_t max_chunks = CounterSite::max_sites / chunk_size;
+
+    ThreadCounters() noexcept
+    {
+        for (std::atomic<Chunk*>& chunk : m_chunks)
+        {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ThreadCounters(const ThreadCounters&) = delete;
+    ThreadCounters& operator=(const ThreadCounters&) = delete;
+    ~ThreadCounters() noexcept
+    {
+        for (std::atomic<Chunk*>& chunk : m_chunks)
+        {
+            delete chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    void add(size_t id, const CounterValues& values) noexcept
+    {
+        Chunk* chunk = m_chunks[id / chunk_size].load(std::memory_order_relaxed);
+        if (FAST_BER_UNLIKELY(chunk == nullptr))
+        {
+            chunk = allocate_chunk(id / chunk_size);
+            if (chunk == nullptr)
+            {
+                return;
+            }
+        }
+        Counts& counts = (*chunk)[id % chunk_size];
+        increment(counts.calls, values.calls);
+        increment(counts.bytes, values.bytes);
+        increment(counts.failures, values.failures);
+    }
+
+    // Adds the counts of a site to output, returning false if the site was not counted
+    bool add_to(size_t id, CounterValues& output) const noexcept
+    {
+        const Chunk* chunk = m_chunks[id / chunk_size].load(std::memory_order_acquire);
+        if (chunk == nullptr)
+        {
+            return false;
+        }
+        const Counts&  counts = (*chunk)[id % chunk_size];
+        const uint64_t calls  = counts.calls.load(std::memory_order_relaxed);
+        output.calls += calls;
+        output.bytes += counts.bytes.load(std::memory_order_relaxed);
+        output.failures += counts.failures.load(std::memory_order_relaxed);
+        return calls > 0;
+    }
+
+  private:
+    struct Counts
+    {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> failures{0};
+    };
+    using Chunk = std::array<Counts, chunk_size>;
+
+    static void increment(std::atomic<uint64_t>& counter, uint64_t amount) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    FAST_BER_COLD Chunk* allocate_chunk(size_t index) noexcept
+    {
+        Chunk* chunk = new (std::nothrow) Chunk();
+        m_chunks[index].store(chunk, std::memory_order_release);
+        return chunk;
+    }
+
+    std::array<std::atomic<Chunk*>, max_chunks> m_chunks;
+};
+
+using CounterRegistry = SiteRegistry<CounterSite, ThreadCounters>;
+
+inline int compare_entries(const CounterEntry& lhs, const CounterEntry& rhs) noexcept
+{
+    if (lhs.operation != rhs.operation)
+    {
+        return lhs.operation < rhs.operation ? -1 : 1;
+    }
+    const int type = compare_names(lhs.type, rhs.type);
+    return type != 0 ? type : compare_names(lhs.member, rhs.member);
+}
+
+} // namespace detail
+
+inline CounterSite::CounterSite(CounterOperation operation, const char* type, const char* member) noexcept
+    : m_operation(operation), m_type(type), m_member(member), m_id(detail::CounterRegistry::instance().add_site(*this))
+{
+}
+
+inline void count(const CounterSite& site, size_t bytes, bool success) noexcept
+{
+    if (site.id() < CounterSite::max_sites)
+    {
+        detail::CounterRegistry::thread_payload().add(site.id(), CounterValues{1, bytes, success ? 0u : 1u});
+    }
+}
+
+inline std::vector<CounterEntry> counter_snapshot()
+{
+    return detail::CounterRegistry::instance().snapshot<CounterEntry>(
+        [](const CounterSite& site, const CounterValues& values) {
+            return CounterEntry{site.operation(), site.type(), site.member(), values};
+        },
+        detail::compare_entries,
+        [](CounterEntry& merged, const CounterEntry& entry) {
+            merged.values.calls += entry.values.calls;
+            merged.values.bytes += entry.values.bytes;
+            merged.values.failures += entry.values.failures;
+        });
+}
+
+} // namespace fast_ber
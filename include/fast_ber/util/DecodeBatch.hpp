@@ -0,0 +1,160 @@
+#pragma once
+
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+
+#include "absl/types/span.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
+namespace fast_ber
+{
+
+struct BatchDecodeResult
+{
+    bool   success;
+    size_t decoded; // Number of PDUs decoded, the index of the PDU which failed to decode on failure
+};
+
+// Decode many independent PDUs, such as a burst of messages from a socket. Each PDU is decoded into the output object
+// of the same index, output objects are reused rather than constructed for each PDU, allowing their storage to be
+// kept between batches. Decoding stops at the first PDU which fails to decode. Only as many PDUs as there are output
+// objects are decoded, with fewer outputs than inputs the batch fails at the first PDU without an output.
+//
+// PDUs are processed in groups. The headers of a group are parsed together, as their loads are independent, and the
+// memory of the next group is prefetched while the current group is decoded.
+template <typename T>
+BatchDecodeResult decode_batch(absl::Span<const absl::Span<const uint8_t>> inputs, absl::Span<T> outputs) noexcept;
+
+// PDUs which have already been framed, their headers are not parsed again
+template <typename T>
+BatchDecodeResult decode_batch(absl::Span<const BerView> inputs, absl::Span<T> outputs) noexcept;
+
+// Output vector is grown to the number of inputs if required, it is never shrunk so objects are kept for later batches
+template <typename T>
+BatchDecodeResult decode_batch(absl::Span<const absl::Span<const uint8_t>> inputs, std::vector<T>& outputs);
+template <typename T>
+BatchDecodeResult decode_batch(absl::Span<const BerView> inputs, std::vector<T>& outputs);
+
+namespace detail
+{
+
+constexpr size_t batch_group_size      = 4;
+constexpr size_t batch_prefetch_length = 256; // Bytes prefetched from the start of each PDU
+constexpr size_t cache_line_size       = 64;
+
+inline void prefetch_read(const void* address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER)
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
+
+inline void prefetch_write(const void* address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 1, 3);
+#elif defined(_MSC_VER)
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
+
+inline void prefetch_pdu(const uint8_t* data, size_t length) noexcept
+{
+    const size_t prefetch_length = std::min(length, batch_prefetch_length);
+    for (size_t offset = 0; offset < prefetch_length; offset += cache_line_size)
+    {
+        prefetch_read(data + offset);
+    }
+}
+
+inline void prefetch_pdu(absl::Span<const uint8_t> input) noexcept { prefetch_pdu(input.data(), input.size()); }
+inline void prefetch_pdu(const BerView& input) noexcept { prefetch_pdu(input.ber_data(), input.ber_length()); }
+
+inline BerView batch_view(absl::Span<const uint8_t> input) noexcept { return BerView(input); }
+inline BerView batch_view(const BerView& input) noexcept { return input; }
+
+template <typename Input, typename T>
+BatchDecodeResult decode_batch(absl::Span<const Input> inputs, absl::Span<T> outputs) noexcept
+{
+    const size_t size = std::min(inputs.size(), outputs.size());
+    for (size_t i = 0; i < std::min(size, batch_group_size); i++)
+    {
+        prefetch_pdu(inputs[i]);
+    }
+
+    for (size_t first = 0; first < size; first += batch_group_size)
+    {
+        const size_t count = std::min(batch_group_size, size - first);
+
+        BerView views[batch_group_size];
+        for (size_t i = 0; i < count; i++)
+        {
+            views[i] = batch_view(inputs[first + i]);
+        }
+
+        const size_t next_end = std::min(first + count + batch_group_size, size);
+        for (size_t i = first + count; i < next_end; i++)
+        {
+            prefetch_pdu(inputs[i]);
+            prefetch_write(&outputs[i]);
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!fast_ber::decode(views[i], outputs[first + i]).success)
+            {
+                return BatchDecodeResult{false, first + i};
+            }
+        }
+    }
+    return BatchDecodeResult{size == inputs.size(), size};
+}
+
+} // namespace detail
+
+template <typename T>
+BatchDecodeResult decode_batch(absl::Span<const absl::Span<const uint8_t>> inputs, absl::Span<T> outputs) noexcept
+{
+    return detail::decode_batch(inputs, outputs);
+}
+
+template <typename T>
+BatchDecodeResult decode_batch(absl::Span<const BerView> inputs, absl::Span<T> outputs) noexcept
+{
+    return detail::decode_batch(inputs, outputs);
+}
+
+template <typename T>
+BatchDecodeResult decode_batch(absl::Span<const absl::Span<const uint8_t>> inputs, std::vector<T>& outputs)
+{
+    if (outputs.size() < inputs.size())
+    {
+        outputs.resize(inputs.size());
+    }
+    return detail::decode_batch(inputs, absl::MakeSpan(outputs));
+}
+
+template <typename T>
+BatchDecodeResult decode_batch(absl::Span<const BerView> inputs, std::vector<T>& outputs)
+{
+    if (outputs.size() < inputs.size())
+    {
+        outputs.resize(inputs.size());
+    }
+    return detail::decode_batch(inputs, absl::MakeSpan(outputs));
+}
+
+} // namespace fast_ber
@@ -2,7 +2,12 @@
 
 #include "absl/types/span.h"
 #include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/util/BerIndex.hpp"
 #include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/Counters.hpp"
+#include "fast_ber/util/Error.hpp"
+#include "fast_ber/util/FieldMask.hpp"
+#include "fast_ber/util/Latency.hpp"
 
 namespace fast_ber
 {
@@ -24,6 +29,35 @@ DecodeResult decode(BerView input, T& output) noexcept
     return output.decode(input);
 }
 
+// Decode only the selected members of a generated collection. Other members are skipped without being decoded and
+// are left empty, or set to their default value.
+template <typename T>
+DecodeResult decode(absl::Span<const uint8_t> input, T& output, const typename T::FieldMask& fields) noexcept
+{
+    return output.decode(BerView(input), fields);
+}
+
+template <typename T>
+DecodeResult decode(BerView input, T& output, const typename T::FieldMask& fields) noexcept
+{
+    return output.decode(input, fields);
+}
+
+// Returns a member skipped by a projected decode to its default constructed state. The member is assigned rather than
+// destroyed and reconstructed, so it is never left destroyed
+template <typename T>
+void reset_member(T& member) noexcept
+{
+    member = T{};
+}
+
+// Decode an element of an indexed PDU, the element's header is not parsed again
+template <typename T>
+DecodeResult decode(const BerIndex& index, size_t node, T& output) noexcept
+{
+    return output.decode(index.view(node));
+}
+
 template <typename T>
 DecodeResult decode(BerViewIterator& input, T& output) noexcept
 {
@@ -41,9 +75,26 @@ bool has_correct_header(BerView input, Id<class_, tag>, Construction constructio
 template <typename Identifier1, typename Identifier2>
 bool has_correct_header(BerView input, DoubleId<Identifier1, Identifier2>, Construction construction)
 {
-    return input.is_valid() && input.identifier() == Identifier1{} &&
-           input.construction() == Construction::constructed && input.begin()->is_valid() &&
-           input.begin()->identifier() == Identifier2{} && input.begin()->construction() == construction;
+    if (!(input.is_valid() && input.identifier() == Identifier1{} && input.construction() == Construction::constructed))
+    {
+        return false;
+    }
+
+    const BerView inner = *input.begin();
+    return inner.is_valid() && inner.identifier() == Identifier2{} && inner.construction() == construction;
+}
+
+// Reports a packet rejected by has_correct_header, recording its identifier if the packet can be read
+FAST_BER_COLD inline void report_error(BerView input, const char* type) noexcept
+{
+    if (input.is_valid())
+    {
+        report_error(ErrorCode::incorrect_header, type, input.identifier());
+    }
+    else
+    {
+        report_error(ErrorCode::invalid_packet, type);
+    }
 }
 
 } // namespace fast_ber
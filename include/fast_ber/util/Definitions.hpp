@@ -14,6 +14,8 @@ enum class StorageMode
     static_,
     small_buffer_optimised,
     dynamic,
+    arena,  // Allocated from the current fast_ber::Arena, see util/Arena.hpp
+    sparse, // Optional values larger than a few words are held out of line, see ber_types/Optional.hpp
 };
 
 } // namespace fast_ber
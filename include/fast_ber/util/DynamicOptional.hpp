@@ -1,15 +1,21 @@
 ﻿#pragma once
 
-#include "absl/memory/memory.h"
+#include "fast_ber/util/Arena.hpp"
+
 #include "absl/types/optional.h"
 
+#include <memory>
+#include <type_traits>
+
 namespace fast_ber
 {
 
 using Empty                 = absl::nullopt_t;
 constexpr static auto empty = absl::nullopt;
 
-template <typename T>
+// Optional value held in separately allocated storage, allowing T to be an incomplete type.
+// Storage is created and destroyed by the Allocation policy, either HeapAllocation or ArenaAllocation.
+template <typename T, typename Allocation = HeapAllocation>
 class DynamicOptional
 {
   public:
@@ -17,31 +23,32 @@ class DynamicOptional
     DynamicOptional(const DynamicOptional& rhs) : m_val(nullptr) { *this = rhs; }
     DynamicOptional(DynamicOptional&&) noexcept = default;
     DynamicOptional(Empty) noexcept {}
-    DynamicOptional(const T& t) : m_val(new T(t)) {}
-    DynamicOptional(T&& t) : m_val(new T(std::move(t))) {}
+    DynamicOptional(const T& t) : m_val(create(t)) {}
+    DynamicOptional(T&& t) : m_val(create(std::move(t))) {}
     ~DynamicOptional() noexcept = default;
 
     template <typename U = T,
               typename std::enable_if<
                   absl::conjunction<absl::negation<std::is_same<absl::in_place_t, typename std::decay<U>::type>>,
-                                    absl::negation<std::is_same<DynamicOptional<T>, typename std::decay<U>::type>>,
+                                    absl::negation<std::is_same<DynamicOptional, typename std::decay<U>::type>>,
                                     std::is_convertible<U&&, T>, std::is_constructible<T, U&&>>::value,
                   bool>::type = false>
-    DynamicOptional(const U& t) : m_val(absl::make_unique<T>(t))
+    DynamicOptional(const U& t) : m_val(create(t))
     {
     }
 
-    template <typename T2>
+    // Excludes types derived from DynamicOptional, such as fast_ber::Optional, which are copied as optionals
+    template <typename T2, typename std::enable_if<!std::is_base_of<DynamicOptional, T2>::value, bool>::type = false>
     DynamicOptional& operator=(const T2& t2)
     {
-        m_val = absl::make_unique<T>(t2);
+        m_val = create(t2);
         return *this;
     }
     DynamicOptional& operator=(const DynamicOptional& rhs)
     {
         if (rhs.m_val)
         {
-            m_val = absl::make_unique<T>(*rhs.m_val);
+            m_val = create(*rhs.m_val);
         }
         else
         {
@@ -56,7 +63,7 @@ class DynamicOptional
     }
     DynamicOptional& operator=(const T& t)
     {
-        m_val.reset(new T(t));
+        m_val = create(t);
         return *this;
     }
     DynamicOptional& operator=(DynamicOptional&&) noexcept = default;
@@ -70,7 +77,7 @@ class DynamicOptional
     template <typename... Args>
     T& emplace(Args&&... args)
     {
-        m_val = absl::make_unique<T>(args...);
+        m_val = create(std::forward<Args>(args)...);
         return *m_val;
     }
     bool has_value() const noexcept { return bool(m_val); }
@@ -89,20 +96,33 @@ class DynamicOptional
 
         return *m_val == *rhs.m_val;
     }
-    bool operator==(const T& rhs) const noexcept
+    template <typename T2, typename std::enable_if<!std::is_base_of<DynamicOptional, T2>::value, bool>::type = false>
+    bool operator==(const T2& rhs) const noexcept
     {
         if (!this->has_value())
         {
             return false;
         }
 
-        return *m_val == *rhs;
+        return *m_val == rhs;
     }
     bool operator!=(const DynamicOptional& rhs) const noexcept { return !(*this == rhs); }
-    bool operator!=(const T& rhs) const noexcept { return !(*this == rhs); }
+    template <typename T2, typename std::enable_if<!std::is_base_of<DynamicOptional, T2>::value, bool>::type = false>
+    bool operator!=(const T2& rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
 
   private:
-    std::unique_ptr<T> m_val;
+    using Pointer = std::unique_ptr<T, AllocationDeleter<Allocation>>;
+
+    template <typename... Args>
+    static Pointer create(Args&&... args)
+    {
+        return Pointer(Allocation::template create<T>(std::forward<Args>(args)...));
+    }
+
+    Pointer m_val;
 };
 
 } // namespace fast_ber
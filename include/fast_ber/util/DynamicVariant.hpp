@@ -39,8 +39,10 @@ struct BadVariantAccess : public std::exception
     const char* what() const noexcept override { return "Bad variant access;"; }
 };
 
-template <typename... Ts, absl::enable_if_t<absl::conjunction<std::is_move_constructible<Ts>...>::value, int> = 0>
-void swap(DynamicVariant<Ts...>& v, DynamicVariant<Ts...>& w) noexcept(noexcept(v.swap(w)))
+template <typename Allocation, typename... Ts,
+          absl::enable_if_t<absl::conjunction<std::is_move_constructible<Ts>...>::value, int> = 0>
+void swap(BasicDynamicVariant<Allocation, Ts...>& v,
+          BasicDynamicVariant<Allocation, Ts...>& w) noexcept(noexcept(v.swap(w)))
 {
     v.swap(w);
 }
@@ -48,8 +50,8 @@ void swap(DynamicVariant<Ts...>& v, DynamicVariant<Ts...>& w) noexcept(noexcept(
 template <class T>
 struct variant_size;
 
-template <class... Ts>
-struct variant_size<DynamicVariant<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)>
+template <typename Allocation, class... Ts>
+struct variant_size<BasicDynamicVariant<Allocation, Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)>
 {
 };
 
@@ -71,8 +73,8 @@ struct variant_size<const volatile T> : variant_size<T>
 template <std::size_t I, class T>
 struct variant_alternative;
 
-template <std::size_t I, class... Types>
-struct variant_alternative<I, DynamicVariant<Types...>>
+template <std::size_t I, typename Allocation, class... Types>
+struct variant_alternative<I, BasicDynamicVariant<Allocation, Types...>>
 {
     using type = detail::TypeAtIndex<I, Types...>;
 };
@@ -98,14 +100,14 @@ struct variant_alternative<I, const volatile T>
 template <std::size_t I, class T>
 using variant_alternative_t = typename variant_alternative<I, T>::type;
 
-template <class T, class... Types>
-constexpr bool holds_alternative(const DynamicVariant<Types...>& v) noexcept
+template <class T, typename Allocation, class... Types>
+constexpr bool holds_alternative(const BasicDynamicVariant<Allocation, Types...>& v) noexcept
 {
     return v.index() == detail::IndexOf<T, Types...>::value;
 }
 
-template <class T, class... Types>
-T& get(DynamicVariant<Types...>& v)
+template <class T, typename Allocation, class... Types>
+T& get(BasicDynamicVariant<Allocation, Types...>& v)
 {
     if (v.index() != detail::IndexOf<T, Types...>::value)
     {
@@ -114,8 +116,8 @@ T& get(DynamicVariant<Types...>& v)
     return v.template value<T>();
 }
 
-template <class T, class... Types>
-T&& get(DynamicVariant<Types...>&& v)
+template <class T, typename Allocation, class... Types>
+T&& get(BasicDynamicVariant<Allocation, Types...>&& v)
 {
     if (v.index() != detail::IndexOf<T, Types...>::value)
     {
@@ -124,8 +126,8 @@ T&& get(DynamicVariant<Types...>&& v)
     return v.template value<T>();
 }
 
-template <class T, class... Types>
-const T& get(const DynamicVariant<Types...>& v)
+template <class T, typename Allocation, class... Types>
+const T& get(const BasicDynamicVariant<Allocation, Types...>& v)
 {
     if (v.index() != detail::IndexOf<T, Types...>::value)
     {
@@ -134,8 +136,8 @@ const T& get(const DynamicVariant<Types...>& v)
     return v.template value<T>();
 }
 
-template <class T, class... Types>
-const T&& get(const DynamicVariant<Types...>&& v)
+template <class T, typename Allocation, class... Types>
+const T&& get(const BasicDynamicVariant<Allocation, Types...>&& v)
 {
     if (v.index() != detail::IndexOf<T, Types...>::value)
     {
@@ -144,84 +146,87 @@ const T&& get(const DynamicVariant<Types...>&& v)
     return v.template value<T>();
 }
 
-template <std::size_t I, class... Types>
-variant_alternative_t<I, DynamicVariant<Types...>>& get(DynamicVariant<Types...>& v)
+template <std::size_t I, typename Allocation, class... Types>
+variant_alternative_t<I, BasicDynamicVariant<Allocation, Types...>>& get(BasicDynamicVariant<Allocation, Types...>& v)
 {
     if (v.index() != I)
     {
         throw BadVariantAccess();
     }
-    return v.template value<variant_alternative_t<I, DynamicVariant<Types...>>>();
+    return v.template value<variant_alternative_t<I, BasicDynamicVariant<Allocation, Types...>>>();
 }
 
-template <std::size_t I, class... Types>
-variant_alternative_t<I, DynamicVariant<Types...>>&& get(DynamicVariant<Types...>&& v)
+template <std::size_t I, typename Allocation, class... Types>
+variant_alternative_t<I, BasicDynamicVariant<Allocation, Types...>>&& get(BasicDynamicVariant<Allocation, Types...>&& v)
 {
     if (v.index() != I)
     {
         throw BadVariantAccess();
     }
-    return v.template value<variant_alternative_t<I, DynamicVariant<Types...>>>();
+    return v.template value<variant_alternative_t<I, BasicDynamicVariant<Allocation, Types...>>>();
 }
 
-template <std::size_t I, class... Types>
-const variant_alternative_t<I, DynamicVariant<Types...>>& get(const DynamicVariant<Types...>& v)
+template <std::size_t I, typename Allocation, class... Types>
+const variant_alternative_t<I, BasicDynamicVariant<Allocation, Types...>>&
+get(const BasicDynamicVariant<Allocation, Types...>& v)
 {
     if (v.index() != I)
     {
         throw BadVariantAccess();
     }
-    return v.template value<variant_alternative_t<I, DynamicVariant<Types...>>>();
+    return v.template value<variant_alternative_t<I, BasicDynamicVariant<Allocation, Types...>>>();
 }
 
-template <std::size_t I, class... Types>
-const variant_alternative_t<I, DynamicVariant<Types...>>&& get(const DynamicVariant<Types...>&& v)
+template <std::size_t I, typename Allocation, class... Types>
+const variant_alternative_t<I, BasicDynamicVariant<Allocation, Types...>>&&
+get(const BasicDynamicVariant<Allocation, Types...>&& v)
 {
     if (v.index() != I)
     {
         throw BadVariantAccess();
     }
-    return v.template value<variant_alternative_t<I, DynamicVariant<Types...>>>();
+    return v.template value<variant_alternative_t<I, BasicDynamicVariant<Allocation, Types...>>>();
 }
 
-template <std::size_t I, class... Types>
-constexpr typename std::add_pointer<variant_alternative_t<I, DynamicVariant<Types...>>>::type
-get_if(DynamicVariant<Types...>* v) noexcept
+template <std::size_t I, typename Allocation, class... Types>
+constexpr typename std::add_pointer<variant_alternative_t<I, BasicDynamicVariant<Allocation, Types...>>>::type
+get_if(BasicDynamicVariant<Allocation, Types...>* v) noexcept
 {
     return (v != nullptr && v->index() == I) ? std::addressof(fast_ber::dynamic::get<I>(*v)) : nullptr;
 }
 
-template <std::size_t I, class... Types>
-constexpr typename std::add_pointer<const variant_alternative_t<I, DynamicVariant<Types...>>>::type
-get_if(const DynamicVariant<Types...>* v) noexcept
+template <std::size_t I, typename Allocation, class... Types>
+constexpr typename std::add_pointer<const variant_alternative_t<I, BasicDynamicVariant<Allocation, Types...>>>::type
+get_if(const BasicDynamicVariant<Allocation, Types...>* v) noexcept
 {
     return (v != nullptr && v->index() == I) ? std::addressof(fast_ber::dynamic::get<I>(*v)) : nullptr;
 }
 
-template <class T, class... Types>
-constexpr typename std::add_pointer<T>::type get_if(DynamicVariant<Types...>* v) noexcept
+template <class T, typename Allocation, class... Types>
+constexpr typename std::add_pointer<T>::type get_if(BasicDynamicVariant<Allocation, Types...>* v) noexcept
 {
     return fast_ber::dynamic::get_if<detail::IndexOf<T, Types...>::value>(v);
 }
 
-template <class T, class... Types>
-constexpr typename std::add_pointer<const T>::type get_if(const DynamicVariant<Types...>* v) noexcept
+template <class T, typename Allocation, class... Types>
+constexpr typename std::add_pointer<const T>::type get_if(const BasicDynamicVariant<Allocation, Types...>* v) noexcept
 {
     return fast_ber::dynamic::get_if<detail::IndexOf<T, Types...>::value>(v);
 }
 
-template <size_t index, typename Visitor, typename... VariantOptions,
+template <size_t index, typename Visitor, typename Allocation, typename... VariantOptions,
           typename std::enable_if<(index == sizeof...(VariantOptions)), int>::type = 0>
-[[noreturn]] auto visit_impl(Visitor&& vis, const DynamicVariant<VariantOptions...>& variant)
+[[noreturn]] auto visit_impl(Visitor&& vis, const BasicDynamicVariant<Allocation, VariantOptions...>& variant)
     -> decltype(vis(get<0>(variant)))
 {
     assert("Not reachable");
     throw 0;
 }
 
-template <size_t index, typename Visitor, typename... VariantOptions,
+template <size_t index, typename Visitor, typename Allocation, typename... VariantOptions,
           typename std::enable_if<(index < sizeof...(VariantOptions)), int>::type = 0>
-auto visit_impl(Visitor&& vis, DynamicVariant<VariantOptions...>& variant) -> decltype(vis(get<0>(variant)))
+auto visit_impl(Visitor&& vis, BasicDynamicVariant<Allocation, VariantOptions...>& variant)
+    -> decltype(vis(get<0>(variant)))
 {
     if (index == variant.index())
     {
@@ -230,9 +235,10 @@ auto visit_impl(Visitor&& vis, DynamicVariant<VariantOptions...>& variant) -> de
     return visit_impl<index + 1>(vis, variant);
 }
 
-template <size_t index, typename Visitor, typename... VariantOptions,
+template <size_t index, typename Visitor, typename Allocation, typename... VariantOptions,
           typename std::enable_if<(index < sizeof...(VariantOptions)), int>::type = 0>
-auto visit_impl(Visitor&& vis, const DynamicVariant<VariantOptions...>& variant) -> decltype(vis(get<0>(variant)))
+auto visit_impl(Visitor&& vis, const BasicDynamicVariant<Allocation, VariantOptions...>& variant)
+    -> decltype(vis(get<0>(variant)))
 {
     if (index == variant.index())
     {
@@ -247,19 +253,21 @@ auto visit(Visitor&& vis, Variants&&... vars) -> decltype(visit_impl<0>(vis, var
     return visit_impl<0>(vis, vars...);
 }
 
-template <size_t index, typename Visitor, typename... VariantOptions,
+template <size_t index, typename Visitor, typename Allocation, typename... VariantOptions,
           typename std::enable_if<(index == sizeof...(VariantOptions)), int>::type = 0>
-[[noreturn]] auto visit_binary_impl(Visitor&& vis, const DynamicVariant<VariantOptions...>& a,
-                                    const DynamicVariant<VariantOptions...>& b) -> decltype(vis(get<0>(a), get<0>(b)))
+[[noreturn]] auto visit_binary_impl(Visitor&& vis, const BasicDynamicVariant<Allocation, VariantOptions...>& a,
+                                    const BasicDynamicVariant<Allocation, VariantOptions...>& b)
+    -> decltype(vis(get<0>(a), get<0>(b)))
 {
     assert("Not reachable");
     throw 0;
 }
 
-template <size_t index, typename Visitor, typename... VariantOptions,
+template <size_t index, typename Visitor, typename Allocation, typename... VariantOptions,
           typename std::enable_if<(index < sizeof...(VariantOptions)), int>::type = 0>
-auto visit_binary_impl(Visitor&& vis, const DynamicVariant<VariantOptions...>& a,
-                       const DynamicVariant<VariantOptions...>& b) -> decltype(vis(get<0>(a), get<0>(b)))
+auto visit_binary_impl(Visitor&& vis, const BasicDynamicVariant<Allocation, VariantOptions...>& a,
+                       const BasicDynamicVariant<Allocation, VariantOptions...>& b)
+    -> decltype(vis(get<0>(a), get<0>(b)))
 {
     if (index == a.index())
     {
@@ -268,34 +276,37 @@ auto visit_binary_impl(Visitor&& vis, const DynamicVariant<VariantOptions...>& a
     return visit_binary_impl<index + 1>(vis, a, b);
 }
 
-template <typename Visitor, typename... Types>
-auto visit_binary(Visitor&& vis, const DynamicVariant<Types...>& a, const DynamicVariant<Types...>& b)
+template <typename Visitor, typename Allocation, typename... Types>
+auto visit_binary(Visitor&& vis, const BasicDynamicVariant<Allocation, Types...>& a,
+                  const BasicDynamicVariant<Allocation, Types...>& b)
     -> decltype(visit_binary_impl<0>(vis, a, b))
 {
     assert(a.index() == b.index());
     return visit_binary_impl<0>(vis, a, b);
 }
 
+template <typename Allocation>
 struct CopyVisitor
 {
     template <typename T>
     void* operator()(const T& t) const
     {
-        return new T(t);
+        return Allocation::template create<T>(t);
     }
 };
 
+template <typename Allocation>
 struct DeleteVisitor
 {
     template <typename T>
     void operator()(T& t) const
     {
-        delete &t;
+        Allocation::destroy(&t);
     }
 };
 
-template <typename... Types>
-class DynamicVariant
+template <typename Allocation, typename... Types>
+class BasicDynamicVariant
 {
     static_assert(absl::conjunction<std::is_object<Types>...>::value,
                   "Attempted to instantiate a variant containing a non-object "
@@ -316,7 +327,7 @@ class DynamicVariant
     template <size_t i>
     struct ToTypeImpl<i, true>
     {
-        using type = variant_alternative_t<i, DynamicVariant>;
+        using type = variant_alternative_t<i, BasicDynamicVariant>;
     };
 
   public:
@@ -325,33 +336,36 @@ class DynamicVariant
     template <typename T>
     using ExactlyOnce = detail::ExactlyOnce<T, Types...>;
     template <typename T>
-    using AcceptedIndex = detail::AcceptedIndex<T&&, DynamicVariant>;
+    using AcceptedIndex = detail::AcceptedIndex<T&&, BasicDynamicVariant>;
     template <typename T>
     using AcceptedType = ToType<AcceptedIndex<T>::value>;
 
-    DynamicVariant() noexcept : m_data(new ToType<0>()) {}
-    DynamicVariant(const DynamicVariant& other)
-        : m_index(other.m_index), m_data(fast_ber::dynamic::visit(CopyVisitor{}, other))
+    BasicDynamicVariant() noexcept : m_data(Allocation::template create<ToType<0>>()) {}
+    BasicDynamicVariant(const BasicDynamicVariant& other)
+        : m_index(other.m_index), m_data(fast_ber::dynamic::visit(CopyVisitor<Allocation>{}, other))
     {
     }
-    DynamicVariant(DynamicVariant&& other) noexcept : m_index(std::move(other.m_index)), m_data(std::move(other.m_data))
+    BasicDynamicVariant(BasicDynamicVariant&& other) noexcept
+        : m_index(std::move(other.m_index)), m_data(std::move(other.m_data))
     {
         other.m_data = nullptr;
     }
 
-    template <typename T, typename = absl::enable_if_t<!std::is_same<absl::decay_t<T>, DynamicVariant>::value>,
+    template <typename T, typename = absl::enable_if_t<!std::is_same<absl::decay_t<T>, BasicDynamicVariant>::value>,
               typename = absl::enable_if_t<ExactlyOnce<AcceptedType<T&&>>::value &&
                                            std::is_constructible<AcceptedType<T&&>, T&&>::value>>
-    DynamicVariant(T&& t) noexcept(std::is_nothrow_constructible<AcceptedType<T&&>, T&&>::value)
-        : m_index(detail::IndexOf<AcceptedType<T&&>, Types...>::value), m_data(new AcceptedType<T&&>(t))
+    BasicDynamicVariant(T&& t) noexcept(std::is_nothrow_constructible<AcceptedType<T&&>, T&&>::value)
+        : m_index(detail::IndexOf<AcceptedType<T&&>, Types...>::value),
+          m_data(Allocation::template create<AcceptedType<T&&>>(t))
     {
         assert(holds_alternative<AcceptedType<T&&>>(*this));
     }
 
     template <typename T, typename... Args,
               typename = absl::enable_if_t<ExactlyOnce<T>::value && std::is_constructible<T, Args&&...>::value>>
-    explicit DynamicVariant(in_place_type_t<T>, Args&&... args)
-        : m_index(detail::IndexOf<T, Types...>::value), m_data(new T(std::forward<Args>(args)...))
+    explicit BasicDynamicVariant(in_place_type_t<T>, Args&&... args)
+        : m_index(detail::IndexOf<T, Types...>::value),
+          m_data(Allocation::template create<T>(std::forward<Args>(args)...))
 
     {
         assert(holds_alternative<T>(*this));
@@ -360,16 +374,16 @@ class DynamicVariant
     template <typename T, typename U, typename... Args,
               typename = absl::enable_if_t<ExactlyOnce<T>::value &&
                                            std::is_constructible<T, std::initializer_list<U>&, Args&&...>::value>>
-    explicit DynamicVariant(in_place_type_t<T>, std::initializer_list<U> il, Args&&... args)
-        : m_index(detail::IndexOf<T, Types...>::value), m_data(new T(il, args...))
+    explicit BasicDynamicVariant(in_place_type_t<T>, std::initializer_list<U> il, Args&&... args)
+        : m_index(detail::IndexOf<T, Types...>::value), m_data(Allocation::template create<T>(il, args...))
     {
         assert(holds_alternative<T>(*this));
     }
 
     template <size_t i, typename... Args,
               typename = absl::enable_if_t<std::is_constructible<ToType<i>, Args&&...>::value>>
-    explicit DynamicVariant(in_place_index_t<i>, Args&&... args)
-        : m_index(i), m_data(new ToType<i>(std::forward<Args>(args)...))
+    explicit BasicDynamicVariant(in_place_index_t<i>, Args&&... args)
+        : m_index(i), m_data(Allocation::template create<ToType<i>>(std::forward<Args>(args)...))
     {
         assert(index() == i);
     }
@@ -377,38 +391,38 @@ class DynamicVariant
     template <
         size_t i, typename U, typename... Args,
         typename = absl::enable_if_t<std::is_constructible<ToType<i>, std::initializer_list<U>&, Args&&...>::value>>
-    explicit DynamicVariant(in_place_index_t<i>, std::initializer_list<U> il, Args&&... args)
-        : m_index(i), m_data(new ToType<i>(il, std::forward<Args>(args)...))
+    explicit BasicDynamicVariant(in_place_index_t<i>, std::initializer_list<U> il, Args&&... args)
+        : m_index(i), m_data(Allocation::template create<ToType<i>>(il, std::forward<Args>(args)...))
 
     {
         assert(index() == i);
     }
 
-    ~DynamicVariant()
+    ~BasicDynamicVariant()
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor<Allocation>(), *this);
         }
     }
 
-    DynamicVariant& operator=(const DynamicVariant& other)
+    BasicDynamicVariant& operator=(const BasicDynamicVariant& other)
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor<Allocation>(), *this);
         }
         m_index = other.m_index;
-        m_data  = fast_ber::dynamic::visit(CopyVisitor(), other);
+        m_data  = fast_ber::dynamic::visit(CopyVisitor<Allocation>(), other);
 
         return *this;
     }
 
-    DynamicVariant& operator=(DynamicVariant&& other) noexcept
+    BasicDynamicVariant& operator=(BasicDynamicVariant&& other) noexcept
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor<Allocation>(), *this);
         }
         m_index = other.m_index;
         m_data  = other.m_data;
@@ -417,19 +431,19 @@ class DynamicVariant
         return *this;
     }
 
-    template <typename T, typename = absl::enable_if_t<!std::is_same<absl::decay_t<T>, DynamicVariant>::value &&
+    template <typename T, typename = absl::enable_if_t<!std::is_same<absl::decay_t<T>, BasicDynamicVariant>::value &&
                                                        ExactlyOnce<AcceptedType<T&&>>::value &&
                                                        std::is_constructible<AcceptedType<T&&>, T&&>::value &&
                                                        std::is_assignable<AcceptedType<T&&>&, T&&>::value>>
-    DynamicVariant& operator=(T&& t) noexcept(std::is_nothrow_assignable<AcceptedType<T&&>&, T&&>::value&&
+    BasicDynamicVariant& operator=(T&& t) noexcept(std::is_nothrow_assignable<AcceptedType<T&&>&, T&&>::value&&
                                                   std::is_nothrow_constructible<AcceptedType<T&&>, T&&>::value)
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor<Allocation>(), *this);
         }
         m_index = AcceptedIndex<T>::value;
-        m_data  = new AcceptedType<T>(std::move(t));
+        m_data  = Allocation::template create<AcceptedType<T>>(std::move(t));
         return *this;
     }
 
@@ -439,10 +453,10 @@ class DynamicVariant
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor<Allocation>(), *this);
         }
         m_index = AcceptedIndex<T>::value;
-        m_data  = new AcceptedType<T>(std::forward<Args>(args)...);
+        m_data  = Allocation::template create<AcceptedType<T>>(std::forward<Args>(args)...);
 
         assert(holds_alternative<T>(*this));
         return *static_cast<T*>(m_data);
@@ -455,31 +469,31 @@ class DynamicVariant
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor<Allocation>(), *this);
         }
         m_index = AcceptedIndex<T>::value;
-        m_data  = new T(std::forward<Args>(il, args)...);
+        m_data  = Allocation::template create<T>(std::forward<Args>(il, args)...);
 
         assert(holds_alternative<T>(*this));
         return *static_cast<T*>(m_data);
     }
 
     template <size_t i, typename... Args>
-    absl::enable_if_t<std::is_constructible<variant_alternative_t<i, DynamicVariant>, Args...>::value,
-                      variant_alternative_t<i, DynamicVariant>&>
+    absl::enable_if_t<std::is_constructible<variant_alternative_t<i, BasicDynamicVariant>, Args...>::value,
+                      variant_alternative_t<i, BasicDynamicVariant>&>
     emplace(Args&&... args)
     {
         static_assert(i < sizeof...(Types), "The index should be in [0, number of alternatives)");
 
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor<Allocation>(), *this);
         }
 
         try
         {
             m_index = i;
-            m_data  = new ToType<i>(std::forward<Args>(args)...);
+            m_data  = Allocation::template create<ToType<i>>(std::forward<Args>(args)...);
         }
         catch (...)
         {
@@ -492,21 +506,21 @@ class DynamicVariant
 
     template <size_t i, typename U, typename... Args>
     absl::enable_if_t<
-        std::is_constructible<variant_alternative_t<i, DynamicVariant>, std::initializer_list<U>&, Args...>::value,
-        variant_alternative_t<i, DynamicVariant>&>
+        std::is_constructible<variant_alternative_t<i, BasicDynamicVariant>, std::initializer_list<U>&, Args...>::value,
+        variant_alternative_t<i, BasicDynamicVariant>&>
     emplace(std::initializer_list<U> il, Args&&... args)
     {
         static_assert(i < sizeof...(Types), "The index should be in [0, number of alternatives)");
 
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor<Allocation>(), *this);
         }
 
         try
         {
             m_index = i;
-            m_data  = new ToType<i>(std::forward<Args>(il, args)...);
+            m_data  = Allocation::template create<ToType<i>>(std::forward<Args>(il, args)...);
         }
         catch (...)
         {
@@ -521,7 +535,7 @@ class DynamicVariant
 
     constexpr std::size_t index() const noexcept { return m_index; }
 
-    void swap(DynamicVariant& rhs) noexcept
+    void swap(BasicDynamicVariant& rhs) noexcept
     {
         std::swap(m_index, rhs.m_index);
         std::swap(m_data, rhs.m_data);
@@ -542,7 +556,7 @@ class DynamicVariant
   private:
     size_t m_index{0};
     void*  m_data;
-}; // namespace fast_ber
+};
 
 static_assert(std::is_copy_constructible<DynamicVariant<int, char>>::value, "");
 static_assert(std::is_move_constructible<DynamicVariant<int, char>>::value, "");
@@ -594,38 +608,38 @@ struct GreaterThanOrEquals
     }
 };
 
-template <typename... Types>
-bool operator==(const DynamicVariant<Types...>& a, const DynamicVariant<Types...>& b)
+template <typename Allocation, typename... Types>
+bool operator==(const BasicDynamicVariant<Allocation, Types...>& a, const BasicDynamicVariant<Allocation, Types...>& b)
 {
     return (a.index() == b.index()) && visit_binary(Equals(), a, b);
 }
 
-template <typename... Types>
-bool operator!=(const DynamicVariant<Types...>& a, const DynamicVariant<Types...>& b)
+template <typename Allocation, typename... Types>
+bool operator!=(const BasicDynamicVariant<Allocation, Types...>& a, const BasicDynamicVariant<Allocation, Types...>& b)
 {
     return (a.index() != b.index()) || !visit_binary(Equals(), a, b);
 }
 
-template <typename... Types>
-bool operator<(const DynamicVariant<Types...>& a, const DynamicVariant<Types...>& b)
+template <typename Allocation, typename... Types>
+bool operator<(const BasicDynamicVariant<Allocation, Types...>& a, const BasicDynamicVariant<Allocation, Types...>& b)
 {
     return (a.index() != b.index()) ? (a.index() + 1) < (b.index() + 1) : visit_binary(LessThan(), a, b);
 }
 
-template <typename... Types>
-bool operator>(const DynamicVariant<Types...>& a, const DynamicVariant<Types...>& b)
+template <typename Allocation, typename... Types>
+bool operator>(const BasicDynamicVariant<Allocation, Types...>& a, const BasicDynamicVariant<Allocation, Types...>& b)
 {
     return (a.index() != b.index()) ? (a.index() + 1) > (b.index() + 1) : visit_binary(GreaterThan(), a, b);
 }
 
-template <typename... Types>
-bool operator<=(const DynamicVariant<Types...>& a, const DynamicVariant<Types...>& b)
+template <typename Allocation, typename... Types>
+bool operator<=(const BasicDynamicVariant<Allocation, Types...>& a, const BasicDynamicVariant<Allocation, Types...>& b)
 {
     return (a.index() != b.index()) ? (a.index() + 1) < (b.index() + 1) : visit_binary(LessThanOrEquals(), a, b);
 }
 
-template <typename... Types>
-bool operator>=(const DynamicVariant<Types...>& a, const DynamicVariant<Types...>& b)
+template <typename Allocation, typename... Types>
+bool operator>=(const BasicDynamicVariant<Allocation, Types...>& a, const BasicDynamicVariant<Allocation, Types...>& b)
 {
     return (a.index() != b.index()) ? (a.index() + 1) > (b.index() + 1) : visit_binary(GreaterThanOrEquals(), a, b);
 }
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "fast_ber/util/Arena.hpp"
+
 #include <cstddef>
 #include <tuple>
 #include <type_traits>
@@ -12,8 +14,16 @@ namespace fast_ber
 namespace dynamic
 {
 
+template <typename Allocation, typename... Ts>
+class BasicDynamicVariant;
+
+// Variant holding its value in separately allocated storage, allowing alternatives to be incomplete types
+template <typename... Ts>
+using DynamicVariant = BasicDynamicVariant<HeapAllocation, Ts...>;
+
+// Variant allocating its value from the current arena
 template <typename... Ts>
-class DynamicVariant;
+using ArenaVariant = BasicDynamicVariant<ArenaAllocation, Ts...>;
 
 static constexpr size_t variant_npos = size_t(-1);
 
@@ -23,16 +33,17 @@ namespace detail
 template <class Variant, std::size_t i = 0>
 struct ImaginaryFun;
 
-template <std::size_t i>
-struct ImaginaryFun<DynamicVariant<>, i>
+template <typename Allocation, std::size_t i>
+struct ImaginaryFun<BasicDynamicVariant<Allocation>, i>
 {
     static void Run() = delete;
 };
 
-template <class H, class... T, std::size_t i>
-struct ImaginaryFun<DynamicVariant<H, T...>, i> : ImaginaryFun<DynamicVariant<T...>, i + 1>
+template <typename Allocation, class H, class... T, std::size_t i>
+struct ImaginaryFun<BasicDynamicVariant<Allocation, H, T...>, i>
+    : ImaginaryFun<BasicDynamicVariant<Allocation, T...>, i + 1>
 {
-    using ImaginaryFun<DynamicVariant<T...>, i + 1>::Run;
+    using ImaginaryFun<BasicDynamicVariant<Allocation, T...>, i + 1>::Run;
 
     static std::integral_constant<std::size_t, i> Run(const H&, std::integral_constant<std::size_t, i>);
     static std::integral_constant<std::size_t, i> Run(H&&, std::integral_constant<std::size_t, i>);
@@ -3,6 +3,7 @@
 #include "fast_ber/ber_types/Identifier.hpp"
 #include "fast_ber/util/Definitions.hpp"
 #include "fast_ber/util/EncodeIdentifiers.hpp"
+#include "fast_ber/util/EncodePlan.hpp"
 
 #include "absl/types/span.h"
 
@@ -82,6 +83,53 @@ EncodeResult wrap_with_ber_header(absl::Span<uint8_t> buffer, size_t content_len
     return encode_header(buffer, content_length, id, construction);
 }
 
+// Encodes a header for content of a known length, as recorded in an EncodePlan
+// Returns the length of the header, or zero if the buffer cannot hold both the header and content
+template <typename Identifier>
+size_t encode_planned_header(absl::Span<uint8_t> buffer, size_t content_length, Identifier id,
+                             Construction construction = Construction::constructed)
+{
+    size_t header_length = encoded_header_length(content_length, id);
+    if (header_length + content_length > buffer.length())
+    {
+        return 0;
+    }
+
+    encode_header(buffer, content_length, id, construction);
+    return header_length;
+}
+
+// Reverse (back to front) encoding writes each packet to the end of the provided buffer. Content is encoded first,
+// the header is then written directly in front of it once the content length is known. No memory is moved.
+
+// Creates a BER header with provided ID in front of the data at the end of the buffer
+// The data of interest should be the final "content_length" bytes of the buffer
+template <typename Identifier>
+EncodeResult prepend_ber_header(absl::Span<uint8_t> buffer, size_t content_length, Identifier id,
+                                Construction construction = Construction::constructed)
+{
+    size_t header_length = encoded_header_length(content_length, id);
+    if (header_length + content_length > buffer.length())
+    {
+        return EncodeResult{false, 0};
+    }
+
+    buffer.remove_prefix(buffer.length() - header_length - content_length);
+    return encode_header(buffer, content_length, id, construction);
+}
+
+// Copies a fully encoded BER packet to the end of the buffer
+inline EncodeResult prepend_ber(absl::Span<uint8_t> buffer, absl::Span<const uint8_t> ber) noexcept
+{
+    if (buffer.length() < ber.length())
+    {
+        return EncodeResult{false, 0};
+    }
+
+    std::memcpy(buffer.data() + buffer.length() - ber.length(), ber.data(), ber.length());
+    return EncodeResult{true, ber.length()};
+}
+
 template <typename T>
 constexpr size_t encoded_length(const T& object) noexcept
 {
@@ -94,4 +142,28 @@ EncodeResult encode(absl::Span<uint8_t> output, const T& object) noexcept
     return object.encode(output);
 }
 
+// Calculate encoded length, recording the content length of each constructed element in the plan. The plan grows as
+// needed, so this may throw std::bad_alloc, unlike the other encode functions
+template <typename T>
+size_t encoded_length(const T& object, EncodePlan& plan)
+{
+    plan.clear();
+    return object.encoded_length(plan);
+}
+
+// Encode using the lengths recorded by encoded_length(object, plan), object must not be modified in between
+template <typename T>
+EncodeResult encode(absl::Span<uint8_t> output, const T& object, EncodePlan& plan) noexcept
+{
+    plan.rewind();
+    return object.encode(output, plan);
+}
+
+// Encode back to front, the encoded packet is located in the final EncodeResult::length bytes of output
+template <typename T>
+EncodeResult encode_reverse(absl::Span<uint8_t> output, const T& object) noexcept
+{
+    return object.encode_reverse(output);
+}
+
 } // namespace fast_ber
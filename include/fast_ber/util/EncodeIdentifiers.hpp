@@ -4,6 +4,7 @@
 #include "fast_ber/ber_types/Construction.hpp"
 #include "fast_ber/ber_types/Identifier.hpp"
 #include "fast_ber/ber_types/Tag.hpp"
+#include "fast_ber/util/HeaderCodec.hpp"
 
 #include "absl/types/span.h"
 
@@ -76,7 +77,18 @@ inline size_t encode_tag(absl::Span<uint8_t> output, Tag tag) noexcept
     }
     else
     {
+        const size_t tag_length = encoded_tag_length(tag) - 1;
+        if (output.length() < tag_length + 1)
+        {
+            return 0;
+        }
+
         output[0] |= 0x1F;
+        if (tag_length <= sizeof(uint64_t))
+        {
+            detail::encode_long_tag(output.data() + 1, static_cast<uint64_t>(tag), tag_length);
+            return tag_length + 1;
+        }
 
         for (size_t i = 1; i < output.size(); i++)
         {
@@ -103,6 +115,9 @@ inline size_t encode_tag(absl::Span<uint8_t> output, UniversalTag tag) noexcept
 }
 constexpr inline size_t encoded_tag_length(Tag tag) noexcept
 {
+#if FAST_BER_HAS_CONSTEXPR_CLZ
+    return (tag < 0) ? 0 : (tag <= 30) ? 1 : 1 + detail::significant_septets(static_cast<uint64_t>(tag));
+#else
     return (tag < 0ll)                 ? 0
            : (tag <= 30ll)             ? 1
            : (tag < 128ll)             ? 2
@@ -114,6 +129,7 @@ constexpr inline size_t encoded_tag_length(Tag tag) noexcept
            : (tag < 562949953421312ll) ? 8
            : (tag < 72057594037927936) ? 9
                                        : 10;
+#endif
 }
 
 constexpr inline size_t encoded_tag_length(UniversalTag tag) noexcept { return encoded_tag_length(as_underlying(tag)); }
@@ -156,93 +172,33 @@ constexpr inline size_t encoded_identifier_length(Construction, Class, Universal
 
 inline size_t encode_length(absl::Span<uint8_t> output, uint64_t length) noexcept
 {
-    if (length < 0x80 && output.length() > 0)
+    if (length < 0x80)
     {
-        output[0] = (length >> 0) & 0xFF;
+        if (output.length() == 0)
+        {
+            return 0;
+        }
+
+        output[0] = static_cast<uint8_t>(length);
         return 1;
     }
-    else if (length <= 0xFF && output.length() > 1)
-    {
-        output[0] = 0x81;
-        output[1] = (length >> 0) & 0xFF;
-        return 2;
-    }
-    else if (length <= 0xFFFF && output.length() > 2)
-    {
-        output[0] = 0x82;
-        output[1] = (length >> 8) & 0xFF;
-        output[2] = (length >> 0) & 0xFF;
-        return 3;
-    }
-    else if (length <= 0xFFFFFF && output.length() > 3)
-    {
-        output[0] = 0x83;
-        output[1] = (length >> 16) & 0xFF;
-        output[2] = (length >> 8) & 0xFF;
-        output[3] = (length >> 0) & 0xFF;
-        return 4;
-    }
-    else if (length <= 0xFFFFFFFF && output.length() > 4)
-    {
-        output[0] = 0x84;
-        output[1] = (length >> 24) & 0xFF;
-        output[2] = (length >> 16) & 0xFF;
-        output[3] = (length >> 8) & 0xFF;
-        output[4] = (length >> 0) & 0xFF;
-        return 5;
-    }
-    else if (length <= 0xFFFFFFFFFF && output.length() > 5)
-    {
-        output[0] = 0x85;
-        output[1] = (length >> 32) & 0xFF;
-        output[2] = (length >> 24) & 0xFF;
-        output[3] = (length >> 16) & 0xFF;
-        output[4] = (length >> 8) & 0xFF;
-        output[5] = (length >> 0) & 0xFF;
-        return 6;
-    }
-    else if (length <= 0xFFFFFFFFFFFF && output.length() > 6)
-    {
-        output[0] = 0x86;
-        output[1] = (length >> 40) & 0xFF;
-        output[2] = (length >> 32) & 0xFF;
-        output[3] = (length >> 24) & 0xFF;
-        output[4] = (length >> 16) & 0xFF;
-        output[5] = (length >> 8) & 0xFF;
-        output[6] = (length >> 0) & 0xFF;
-        return 7;
-    }
-    else if (length <= 0xFFFFFFFFFFFFFF && output.length() > 7)
-    {
-        output[0] = 0x87;
-        output[1] = (length >> 48) & 0xFF;
-        output[2] = (length >> 40) & 0xFF;
-        output[3] = (length >> 32) & 0xFF;
-        output[4] = (length >> 24) & 0xFF;
-        output[5] = (length >> 16) & 0xFF;
-        output[6] = (length >> 8) & 0xFF;
-        output[7] = (length >> 0) & 0xFF;
-        return 8;
-    }
-    else if (output.length() > 8)
+
+    const size_t length_length = detail::significant_bytes(length);
+    if (output.length() < length_length + 1)
     {
-        output[0] = 0x88;
-        output[1] = (length >> 56) & 0xFF;
-        output[2] = (length >> 48) & 0xFF;
-        output[3] = (length >> 40) & 0xFF;
-        output[4] = (length >> 32) & 0xFF;
-        output[5] = (length >> 24) & 0xFF;
-        output[6] = (length >> 16) & 0xFF;
-        output[7] = (length >> 8) & 0xFF;
-        output[8] = (length >> 0) & 0xFF;
-        return 9;
+        return 0;
     }
 
-    return 0;
+    output[0] = static_cast<uint8_t>(0x80 | length_length);
+    detail::store_big_endian(output.data() + 1, length, length_length);
+    return length_length + 1;
 }
 
 constexpr inline size_t encoded_length_length(size_t length) noexcept
 {
+#if FAST_BER_HAS_CONSTEXPR_CLZ
+    return (length < 0x80) ? 1 : 1 + detail::significant_bytes(length);
+#else
     return (length < 0x80)                ? 1
            : (length <= 0xFF)             ? 2
            : (length <= 0xFFFF)           ? 3
@@ -252,6 +208,7 @@ constexpr inline size_t encoded_length_length(size_t length) noexcept
            : (length <= 0xFFFFFFFFFFFF)   ? 7
            : (length <= 0xFFFFFFFFFFFFFF) ? 8
                                           : 9;
+#endif
 }
 
 inline size_t encode_header(absl::Span<uint8_t> output, Construction construction, Class class_, Tag tag,
@@ -262,6 +219,14 @@ inline size_t encode_header(absl::Span<uint8_t> output, Construction constructio
         return false;
     }
 
+    // Most headers have a single byte identifier and a short form length
+    if (tag >= 0 && tag <= 30 && length < 0x80)
+    {
+        output[0] = encode_short_identifier(construction, class_, tag);
+        output[1] = static_cast<uint8_t>(length);
+        return 2;
+    }
+
     size_t id_length = encode_identifier(output, construction, class_, tag);
     output.remove_prefix(id_length);
     size_t length_length = encode_length(output, length);
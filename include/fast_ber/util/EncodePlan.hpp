@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace fast_ber
+{
+
+// Flat record of the content length of every constructed element of an object, in the order their headers are
+// encoded. Lengths are filled in a single post-order pass (fast_ber::encoded_length(object, plan)) and consumed by
+// fast_ber::encode(output, object, plan), allowing each header to be written with its final length before its
+// content. The plan can be reused between objects to avoid allocations, or reserved up front. Adding an entry may
+// allocate, so the encoded_length overloads taking a plan are not noexcept. A plan which does not match the object
+// encoded runs out of entries, next_entry then returns false and the encode fails.
+class EncodePlan
+{
+  public:
+    void   clear() noexcept;
+    void   rewind() noexcept { m_position = 0; }
+    size_t size() const noexcept { return m_content_lengths.size(); }
+    void   reserve(size_t entries) { m_content_lengths.reserve(entries); }
+
+    size_t add_entry();
+    void   set_entry(size_t entry, size_t content_length) noexcept;
+    bool   next_entry(size_t& content_length) noexcept;
+
+  private:
+    std::vector<size_t> m_content_lengths;
+    size_t              m_position = 0;
+};
+
+inline void EncodePlan::clear() noexcept
+{
+    m_content_lengths.clear();
+    m_position = 0;
+}
+
+inline size_t EncodePlan::add_entry()
+{
+    m_content_lengths.push_back(0);
+    return m_content_lengths.size() - 1;
+}
+
+inline void EncodePlan::set_entry(size_t entry, size_t content_length) noexcept
+{
+    assert(entry < m_content_lengths.size());
+    m_content_lengths[entry] = content_length;
+}
+
+inline bool EncodePlan::next_entry(size_t& content_length) noexcept
+{
+    if (m_position >= m_content_lengths.size())
+    {
+        return false;
+    }
+    content_length = m_content_lengths[m_position++];
+    return true;
+}
+
+} // namespace fast_ber
@@ -1,25 +1,260 @@
 #pragma once
 
-#include <iostream>
+#include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/util/BranchHints.hpp"
 
-#define FAST_BER_ERROR(...) ::fast_ber::handle_error(__VA_ARGS__)
+#include <array>
+#include <cstddef>
+#include <cstdio>
+
+// Decode failures are reported with FAST_BER_ERROR(code, type, ...), see report_error. Reports are recorded in the
+// current ErrorContext without allocating. Define FAST_BER_DISABLE_ERRORS to remove reporting entirely, the arguments
+// of FAST_BER_ERROR are then only type checked, not evaluated.
+#ifdef FAST_BER_DISABLE_ERRORS
+#define FAST_BER_ERROR(...) static_cast<void>(sizeof(::fast_ber::report_error(__VA_ARGS__), 0))
+#else
+#define FAST_BER_ERROR(...) ::fast_ber::report_error(__VA_ARGS__)
+#endif
 
 namespace fast_ber
 {
 
-inline void handle_error_impl() { std::cerr << std::endl; }
+enum class ErrorCode
+{
+    none,
+    invalid_packet,     // Packet is truncated or its header can not be read
+    incorrect_header,   // Packet has an unexpected identifier or construction
+    invalid_contents,   // Contents are not a valid encoding of the type
+    capacity_exceeded,  // Contents are longer than the storage can hold
+    missing_member,     // Non optional member of a set is absent
+    duplicate_member,   // Member of a set is present more than once
+    unexpected_member,  // Member of a set is not one of its components
+    invalid_member,     // Member is malformed, found when skipping or viewing it
+    unknown_choice,     // Contents of a choice match none of its alternatives
+    member_failed,      // A member failed to decode, extends the path of the error already recorded
+};
+
+inline const char* to_string(ErrorCode code) noexcept
+{
+    switch (code)
+    {
+    case ErrorCode::none:
+        return "none";
+    case ErrorCode::invalid_packet:
+        return "invalid packet";
+    case ErrorCode::incorrect_header:
+        return "incorrect header";
+    case ErrorCode::invalid_contents:
+        return "invalid contents";
+    case ErrorCode::capacity_exceeded:
+        return "capacity exceeded";
+    case ErrorCode::missing_member:
+        return "missing member";
+    case ErrorCode::duplicate_member:
+        return "duplicate member";
+    case ErrorCode::unexpected_member:
+        return "unexpected member";
+    case ErrorCode::invalid_member:
+        return "invalid member";
+    case ErrorCode::unknown_choice:
+        return "unknown choice";
+    case ErrorCode::member_failed:
+        return "member failed";
+    }
+    return "unknown error";
+}
+
+// Member of a collection on the path to a decode failure
+struct ErrorPathEntry
+{
+    const char* type;
+    const char* member;
+};
+
+class ErrorContext;
+
+// Called with the context after each report. Sinks run on the decoding thread and must not throw
+using ErrorSink = void (*)(const ErrorContext&);
+
+// Record of the most recent decode failure. All strings are literals from the library or the generated code, so a
+// report only stores pointers. The path is held innermost first, members beyond max_path_depth are dropped.
+class ErrorContext
+{
+  public:
+    constexpr static size_t max_path_depth = 8;
+
+    explicit ErrorContext(ErrorSink error_sink = nullptr) noexcept : m_sink(error_sink) {}
+    ErrorContext(const ErrorContext&) = delete;
+    ErrorContext& operator=(const ErrorContext&) = delete;
+
+    ErrorCode             code() const noexcept { return m_code; }
+    const char*           type() const noexcept { return m_type; }
+    bool                  has_identifier() const noexcept { return m_has_identifier; }
+    RuntimeId             identifier() const noexcept { return m_identifier; }
+    size_t                path_depth() const noexcept { return m_path_depth; }
+    const ErrorPathEntry& path(size_t depth) const noexcept { return m_path[depth]; }
+    size_t                error_count() const noexcept { return m_error_count; }
+
+    ErrorSink sink() const noexcept { return m_sink; }
+    void      set_sink(ErrorSink error_sink) noexcept { m_sink = error_sink; }
+
+    void clear() noexcept;
+    void report(ErrorCode code, const char* type) noexcept;
+    void report(ErrorCode code, const char* type, RuntimeId identifier) noexcept;
+    void report(ErrorCode code, const char* type, const char* member) noexcept;
+
+    // Context reports on this thread are recorded in. Each thread has its own until an ErrorScope is entered
+    static ErrorContext& current() noexcept { return *current_ref(); }
+
+  private:
+    friend class ErrorScope;
+
+    static ErrorContext*& current_ref() noexcept
+    {
+        static thread_local ErrorContext  thread_context;
+        static thread_local ErrorContext* current = &thread_context;
+        return current;
+    }
+
+    void start(ErrorCode code, const char* type) noexcept;
+    void append(const char* type, const char* member) noexcept;
+    void notify() const noexcept
+    {
+        if (m_sink)
+        {
+            m_sink(*this);
+        }
+    }
+
+    ErrorCode                                  m_code           = ErrorCode::none;
+    const char*                                m_type           = nullptr;
+    RuntimeId                                  m_identifier     = RuntimeId(Class::universal, 0);
+    bool                                       m_has_identifier = false;
+    std::array<ErrorPathEntry, max_path_depth> m_path           = {};
+    size_t                                     m_path_depth     = 0;
+    size_t                                     m_error_count    = 0;
+    ErrorSink                                  m_sink;
+};
+
+// Makes a caller provided context current on this thread for the lifetime of the scope. Scopes may be nested.
+class ErrorScope
+{
+  public:
+    explicit ErrorScope(ErrorContext& context) noexcept : m_previous(ErrorContext::current_ref())
+    {
+        ErrorContext::current_ref() = &context;
+    }
+    ErrorScope(const ErrorScope&) = delete;
+    ErrorScope& operator=(const ErrorScope&) = delete;
+    ~ErrorScope() noexcept { ErrorContext::current_ref() = m_previous; }
+
+  private:
+    ErrorContext* m_previous;
+};
+
+inline void ErrorContext::clear() noexcept
+{
+    m_code           = ErrorCode::none;
+    m_type           = nullptr;
+    m_has_identifier = false;
+    m_path_depth     = 0;
+}
+
+inline void ErrorContext::start(ErrorCode code, const char* type) noexcept
+{
+    clear();
+    m_code = code;
+    m_type = type;
+    m_error_count++;
+}
+
+inline void ErrorContext::append(const char* type, const char* member) noexcept
+{
+    if (m_path_depth < max_path_depth)
+    {
+        m_path[m_path_depth++] = ErrorPathEntry{type, member};
+    }
+}
+
+inline void ErrorContext::report(ErrorCode code, const char* type) noexcept
+{
+    start(code, type);
+    notify();
+}
+
+inline void ErrorContext::report(ErrorCode code, const char* type, RuntimeId identifier) noexcept
+{
+    start(code, type);
+    m_identifier     = identifier;
+    m_has_identifier = true;
+    notify();
+}
 
-template <typename T, typename... Args>
-void handle_error_impl(const T& t, Args&&... args)
+// A member_failed report extends the path of the error reported by the member itself. Other codes start a new error,
+// with the member as the innermost entry of its path
+inline void ErrorContext::report(ErrorCode code, const char* type, const char* member) noexcept
 {
-    std::cerr << t;
-    handle_error_impl(args...);
+    if (code != ErrorCode::member_failed || m_code == ErrorCode::none)
+    {
+        start(code, type);
+    }
+    append(type, member);
+    notify();
 }
 
+// Out of line and cold, so a failure branch costs only a call placed away from the successful path
 template <typename... Args>
-void handle_error(Args&&... args)
+FAST_BER_COLD void report_error(ErrorCode code, const char* type, Args... args) noexcept
+{
+    ErrorContext::current().report(code, type, args...);
+}
+
+namespace detail
+{
+template <typename... Args>
+void append_format(char* buffer, size_t size, size_t& length, const char* format, Args... args) noexcept
+{
+    const size_t offset  = length < size ? length : size;
+    const int    written = std::snprintf(buffer + offset, size - offset, format, args...);
+    length += written > 0 ? static_cast<size_t>(written) : 0;
+}
+} // namespace detail
+
+// Writes a one line description of the recorded error, such as
+// "incorrect header [Universal 4] in Boolean at Record.inner > Inner.flag", truncated to the size of the buffer.
+// Returns the length of the full description, as snprintf does
+inline size_t format_error(const ErrorContext& context, char* buffer, size_t size) noexcept
+{
+    static const char* const class_names[] = {"Universal", "Application", "Context Specific", "Private"};
+
+    size_t length = 0;
+    detail::append_format(buffer, size, length, "%s", to_string(context.code()));
+    if (context.has_identifier())
+    {
+        detail::append_format(buffer, size, length, " [%s %lld]",
+                              class_names[static_cast<size_t>(context.identifier().class_()) & 3],
+                              static_cast<long long>(context.identifier().tag()));
+    }
+    if (context.type())
+    {
+        detail::append_format(buffer, size, length, " in %s", context.type());
+    }
+    for (size_t i = context.path_depth(); i > 0; i--)
+    {
+        const ErrorPathEntry& entry = context.path(i - 1);
+        detail::append_format(buffer, size, length, i == context.path_depth() ? " at %s.%s" : " > %s.%s",
+                              entry.type ? entry.type : "?", entry.member ? entry.member : "?");
+    }
+    return length;
+}
+
+// Sink writing each report to stderr. A failure nested inside collections is written once per level, with the path
+// growing as the failure propagates outwards
+inline void stderr_error_sink(const ErrorContext& context) noexcept
 {
-    handle_error_impl(args...);
+    char buffer[256];
+    format_error(context, buffer, sizeof(buffer));
+    std::fprintf(stderr, "fast_ber: %s\n", buffer);
 }
 
 } // namespace fast_ber
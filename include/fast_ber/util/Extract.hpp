@@ -3,6 +3,7 @@
 #include "fast_ber/ber_types/Class.hpp"
 #include "fast_ber/ber_types/Construction.hpp"
 #include "fast_ber/ber_types/Tag.hpp"
+#include "fast_ber/util/HeaderCodec.hpp"
 
 #include "absl/types/span.h"
 
@@ -29,6 +30,10 @@ inline size_t extract_tag(absl::Span<const uint8_t> input, Tag& tag) noexcept;
 // Return the length of the length octets on success, false on fail
 inline size_t extract_length(absl::Span<const uint8_t> input, size_t& length, size_t length_offset) noexcept;
 
+// Extract the tag and length of a ber packet with a single byte identifier and a short form length
+// Return the length of the header (2) on success, zero if the header is not of this form
+inline size_t extract_short_header(absl::Span<const uint8_t> input, Tag& tag, size_t& length) noexcept;
+
 inline bool extract_construction(absl::Span<const uint8_t> input, Construction& construction) noexcept
 {
     if (input.size() == 0)
@@ -89,6 +94,17 @@ inline size_t extract_tag(absl::Span<const uint8_t> input, Tag& tag) noexcept
     }
     else
     {
+        if (input.length() > sizeof(uint64_t))
+        {
+            uint64_t     long_tag   = 0;
+            const size_t tag_length = detail::decode_long_tag(input.data() + 1, long_tag);
+            if (tag_length != 0)
+            {
+                tag = static_cast<Tag>(long_tag);
+                return tag_length + 1;
+            }
+        }
+
         tag = 0;
         for (size_t i = 1; i < input.length(); i++)
         {
@@ -125,6 +141,12 @@ inline size_t extract_length(absl::Span<const uint8_t> input, size_t& length, si
         return false;
     }
 
+    if (input.length() > sizeof(uint64_t))
+    {
+        length = detail::decode_long_length(input.data() + 1, tag_length);
+        return tag_length + 1;
+    }
+
     length = 0;
     for (size_t i = 1; i < tag_length + 1; i++)
     {
@@ -134,4 +156,23 @@ inline size_t extract_length(absl::Span<const uint8_t> input, size_t& length, si
     return tag_length + 1;
 }
 
+inline size_t extract_short_header(absl::Span<const uint8_t> input, Tag& tag, size_t& length) noexcept
+{
+    if (input.size() < 2)
+    {
+        return 0;
+    }
+
+    const uint8_t identifier = input[0];
+    const uint8_t length_0   = input[1];
+    if ((identifier & 0x1F) == 0x1F || (length_0 & 0x80) != 0)
+    {
+        return 0;
+    }
+
+    tag    = static_cast<Tag>(identifier & 0x1F);
+    length = length_0;
+    return 2;
+}
+
 } // namespace fast_ber
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <initializer_list>
+
+namespace fast_ber
+{
+
+// Selection of the members of a generated collection, used for projected decoding. Field is the collection's
+// generated Field enumeration, which has one enumerator per member in declaration order.
+template <typename Field, std::size_t size>
+class FieldMask
+{
+  public:
+    FieldMask() noexcept = default;
+    FieldMask(std::initializer_list<Field> fields) noexcept;
+
+    static FieldMask all() noexcept { return FieldMask().set_all(); }
+
+    FieldMask& set(Field field) noexcept;
+    FieldMask& reset(Field field) noexcept;
+    FieldMask& set_all() noexcept;
+
+    bool        test(Field field) const noexcept { return m_fields[index(field)]; }
+    std::size_t count() const noexcept { return m_fields.count(); }
+
+    friend bool operator==(const FieldMask& lhs, const FieldMask& rhs) noexcept { return lhs.m_fields == rhs.m_fields; }
+    friend bool operator!=(const FieldMask& lhs, const FieldMask& rhs) noexcept { return !(lhs == rhs); }
+
+  private:
+    static std::size_t index(Field field) noexcept { return static_cast<std::size_t>(field); }
+
+    std::bitset<size> m_fields;
+};
+
+// Selects every member, a projected decode with AllFields is a full decode
+struct AllFields
+{
+    template <typename Field>
+    constexpr bool test(Field) const noexcept
+    {
+        return true;
+    }
+};
+
+template <typename Field, std::size_t size>
+FieldMask<Field, size>::FieldMask(std::initializer_list<Field> fields) noexcept
+{
+    for (Field field : fields)
+    {
+        set(field);
+    }
+}
+
+template <typename Field, std::size_t size>
+FieldMask<Field, size>& FieldMask<Field, size>::set(Field field) noexcept
+{
+    m_fields[index(field)] = true;
+    return *this;
+}
+
+template <typename Field, std::size_t size>
+FieldMask<Field, size>& FieldMask<Field, size>::reset(Field field) noexcept
+{
+    m_fields[index(field)] = false;
+    return *this;
+}
+
+template <typename Field, std::size_t size>
+FieldMask<Field, size>& FieldMask<Field, size>::set_all() noexcept
+{
+    m_fields.set();
+    return *this;
+}
+
+} // namespace fast_ber
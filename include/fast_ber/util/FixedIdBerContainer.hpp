@@ -63,6 +63,7 @@ class FixedIdBerContainer
 
     size_t       encoded_length() const noexcept { return m_data.size(); }
     EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept { return prepend_ber(buffer, ber()); }
     DecodeResult decode(BerView view) noexcept;
 
   private:
@@ -75,6 +76,13 @@ class FixedIdBerContainer
     size_t                             m_content_length{0};
 };
 
+// Storage policy holding a packet in a FixedIdBerContainer, header included, so encoding is a single copy
+struct BerStorage
+{
+    template <typename Identifier>
+    using Container = FixedIdBerContainer<Identifier>;
+};
+
 template <typename Identifier>
 FixedIdBerContainer<Identifier>::FixedIdBerContainer() noexcept : m_data()
 {
@@ -167,14 +175,7 @@ DecodeResult FixedIdBerContainer<Identifier>::decode_impl(BerView input_view, Id
 {
     if (!has_correct_header(input_view, id, Construction::primitive))
     {
-        if (!input_view.is_valid())
-        {
-            FAST_BER_ERROR("Invalid packet when decoding packet with tag [", id, "]");
-        }
-        else
-        {
-            FAST_BER_ERROR("Incorrect header [", input_view.identifier(), "] when decoding packet with tag [", id, "]");
-        }
+        FAST_BER_ERROR(input_view, nullptr);
         return DecodeResult{false};
     }
 
@@ -190,15 +191,7 @@ DecodeResult FixedIdBerContainer<Identifier>::decode_impl(BerView
 {
     if (!has_correct_header(input_view, id, Construction::primitive))
     {
-        if (!input_view.is_valid() || !input_view.begin()->is_valid())
-        {
-            FAST_BER_ERROR("Invalid packet when decoding packet with tag [", id, "]");
-        }
-        else
-        {
-            FAST_BER_ERROR("Incorrect header [", input_view.identifier(), ", ", input_view.begin()->identifier(),
-                           "] when decoding packet with tag [", id, "]");
-        }
+        FAST_BER_ERROR(input_view, nullptr);
         return DecodeResult{false};
     }
 
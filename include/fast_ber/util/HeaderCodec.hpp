@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Low level kernels used when encoding and decoding ber identifier and length octets. Multi byte fields are
+// handled as a single 64 bit word rather than one byte at a time.
+
+// count_leading_zeros can only be evaluated at compile time when a compiler builtin is available
+#if defined(__GNUC__) || defined(__clang__)
+#define FAST_BER_HAS_CONSTEXPR_CLZ 1
+#define FAST_BER_CLZ_CONSTEXPR constexpr
+#else
+#define FAST_BER_HAS_CONSTEXPR_CLZ 0
+#define FAST_BER_CLZ_CONSTEXPR
+#endif
+
+namespace fast_ber
+{
+namespace detail
+{
+
+// Number of leading zero bits, value must be non zero
+#if FAST_BER_HAS_CONSTEXPR_CLZ
+constexpr inline size_t count_leading_zeros(uint64_t value) noexcept
+{
+    return static_cast<size_t>(__builtin_clzll(value));
+}
+#else
+inline size_t count_leading_zeros(uint64_t value) noexcept
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    return 63 - static_cast<size_t>(index);
+#else
+    size_t count = 0;
+    while ((value & 0x8000000000000000ull) == 0)
+    {
+        value <<= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+#endif
+
+// Number of bytes required to represent value, value must be non zero
+FAST_BER_CLZ_CONSTEXPR inline size_t significant_bytes(uint64_t value) noexcept
+{
+    return (64 - count_leading_zeros(value) + 7) / 8;
+}
+
+// Number of 7 bit groups required to represent value, value must be non zero
+FAST_BER_CLZ_CONSTEXPR inline size_t significant_septets(uint64_t value) noexcept
+{
+    return (64 - count_leading_zeros(value) + 6) / 7;
+}
+
+inline uint64_t byte_swap(uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#elif defined(_MSC_VER)
+    return _byteswap_uint64(value);
+#else
+    value = ((value & 0x00FF00FF00FF00FFull) << 8) | ((value >> 8) & 0x00FF00FF00FF00FFull);
+    value = ((value & 0x0000FFFF0000FFFFull) << 16) | ((value >> 16) & 0x0000FFFF0000FFFFull);
+    return (value << 32) | (value >> 32);
+#endif
+}
+
+inline uint64_t to_big_endian(uint64_t value) noexcept
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return value;
+#else
+    return byte_swap(value);
+#endif
+}
+
+// Load 8 bytes, the first byte becoming the most significant
+inline uint64_t load_big_endian(const uint8_t* input) noexcept
+{
+    uint64_t value = 0;
+    std::memcpy(&value, input, sizeof(value));
+    return to_big_endian(value);
+}
+
+// Store the least significant "bytes" bytes of value, most significant first. bytes must be in the range [1, 8]
+inline void store_big_endian(uint8_t* output, uint64_t value, size_t bytes) noexcept
+{
+    const uint64_t big_endian = to_big_endian(value << (8 * (8 - bytes)));
+    std::memcpy(output, &big_endian, bytes);
+}
+
+// Spread the low 56 bits of value into 8 bytes of 7 bits each
+inline uint64_t spread_septets(uint64_t value) noexcept
+{
+    value = (value & 0x000000000FFFFFFFull) | ((value & 0x00FFFFFFF0000000ull) << 4);
+    value = (value & 0x00003FFF00003FFFull) | ((value & 0x0FFFC0000FFFC000ull) << 2);
+    value = (value & 0x007F007F007F007Full) | ((value & 0x3F803F803F803F80ull) << 1);
+    return value;
+}
+
+// Gather the low 7 bits of each byte of value into a 56 bit value, reverse of spread_septets
+inline uint64_t gather_septets(uint64_t value) noexcept
+{
+    value &= 0x7F7F7F7F7F7F7F7Full;
+    value = (value & 0x007F007F007F007Full) | ((value & 0x7F007F007F007F00ull) >> 1);
+    value = (value & 0x00003FFF00003FFFull) | ((value & 0x3FFF00003FFF0000ull) >> 2);
+    value = (value & 0x000000000FFFFFFFull) | ((value & 0x0FFFFFFF00000000ull) >> 4);
+    return value;
+}
+
+// Decode a long form tag from the 8 bytes following the identifier's first byte
+// Return the number of tag bytes (at most 8), or zero if the tag continues beyond the loaded bytes
+inline size_t decode_long_tag(const uint8_t* input, uint64_t& tag) noexcept
+{
+    const uint64_t word = load_big_endian(input);
+    const uint64_t ends = ~word & 0x8080808080808080ull; // Final byte of the tag has the top bit cleared
+    if (ends == 0)
+    {
+        return 0;
+    }
+
+    const size_t length = count_leading_zeros(ends) / 8 + 1;
+    tag                 = gather_septets(word >> (64 - 8 * length));
+    return length;
+}
+
+// Encode a long form tag of "length" (at most 8) bytes
+inline void encode_long_tag(uint8_t* output, uint64_t tag, size_t length) noexcept
+{
+    // All bytes but the last have the top bit set
+    store_big_endian(output, spread_septets(tag) | 0x8080808080808000ull, length);
+}
+
+// Decode a long form length of "length" (at most 8) bytes. At least 8 bytes must be readable from input
+inline uint64_t decode_long_length(const uint8_t* input, size_t length) noexcept
+{
+    return load_big_endian(input) >> (64 - 8 * length);
+}
+
+} // namespace detail
+} // namespace fast_ber
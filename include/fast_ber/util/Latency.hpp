@@ -0,0 +1,347 @@
+#pragma once
+
+#include "fast_ber/util/BranchHints.hpp"
+#include "fast_ber/util/Counters.hpp"
+#include "fast_ber/util/SiteRegistry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+// Sampled latency of decodes and encodes, per type. FAST_BER_LATENCY(site, operation, type) at the top of a function
+// times one in every latency_sample_period() calls of the site on the thread, until the function returns. Durations are
+// recorded in per thread histograms, merged by latency_snapshot(). Unless FAST_BER_ENABLE_LATENCY is defined the hook
+// expands to nothing. The definition must be the same in every translation unit of a program.
+#ifdef FAST_BER_ENABLE_LATENCY
+#define FAST_BER_LATENCY(site, operation, type)                                                                        \
+    static const ::fast_ber::LatencySite site(::fast_ber::CounterOperation::operation, type);                          \
+    const ::fast_ber::LatencyTimer       site##_timer(site)
+#else
+#define FAST_BER_LATENCY(site, operation, type) static_cast<void>(0)
+#endif
+
+namespace fast_ber
+{
+
+// Histogram of durations in nanoseconds. Buckets are log-linear, as in HDR histograms: values below 16 have a bucket
+// each, above that each power of two is split into 16 buckets, so a bucket is within 6.25% of any value it holds.
+class LatencyHistogram
+{
+  public:
+    constexpr static size_t sub_bucket_bits = 4;
+    constexpr static size_t sub_buckets     = size_t(1) << sub_bucket_bits;
+    constexpr static size_t bucket_count    = (64 - sub_bucket_bits + 1) * sub_buckets;
+
+    static size_t   bucket(uint64_t nanoseconds) noexcept;
+    static uint64_t lower_bound(size_t bucket) noexcept;
+    static uint64_t upper_bound(size_t bucket) noexcept;
+
+    void     record(uint64_t nanoseconds) noexcept { add(bucket(nanoseconds), 1, nanoseconds); }
+    void     add(size_t bucket, uint64_t count, uint64_t total_nanoseconds) noexcept;
+    void     merge(const LatencyHistogram& rhs) noexcept;
+    uint64_t count() const noexcept { return m_count; }
+    uint64_t count(size_t bucket) const noexcept { return m_buckets[bucket]; }
+    uint64_t total_nanoseconds() const noexcept { return m_total; }
+    uint64_t mean() const noexcept { return m_count ? m_total / m_count : 0; }
+
+    // Upper bound of the bucket holding the given quantile, from 0.0 to 1.0. Zero if nothing has been recorded
+    uint64_t percentile(double quantile) const noexcept;
+
+  private:
+    std::array<uint64_t, bucket_count> m_buckets = {};
+    uint64_t                           m_count   = 0;
+    uint64_t                           m_total   = 0;
+};
+
+// Sampled durations of a type, summed over all threads
+struct LatencyEntry
+{
+    CounterOperation operation;
+    const char*      type;
+    LatencyHistogram histogram;
+};
+
+// A function timed by FAST_BER_LATENCY, usually a function local static. Sites with the same operation and type are
+// reported as one entry. Sites beyond max_sites are not recorded.
+class LatencySite
+{
+  public:
+    constexpr static size_t max_sites = 2048;
+
+    LatencySite(CounterOperation operation, const char* type) noexcept;
+    LatencySite(const LatencySite&) = delete;
+    LatencySite& operator=(const LatencySite&) = delete;
+
+    CounterOperation operation() const noexcept { return m_operation; }
+    const char*      type() const noexcept { return m_type; }
+    size_t           id() const noexcept { return m_id; }
+
+  private:
+    CounterOperation m_operation;
+    const char*      m_type;
+    size_t           m_id;
+};
+
+void record_latency(const LatencySite& site, uint64_t nanoseconds) noexcept;
+
+// One in every period calls of each site timed on each thread, 1024 by default. A period of 1 times every call
+void     set_latency_sample_period(uint32_t period) noexcept;
+uint32_t latency_sample_period() noexcept;
+
+// Histograms of every type sampled so far, ordered by operation and type
+std::vector<LatencyEntry> latency_snapshot();
+
+namespace detail
+{
+
+inline std::atomic<uint32_t>& latency_period() noexcept
+{
+    static std::atomic<uint32_t> period(1024);
+    return period;
+}
+
+// Histograms of a single thread, allocated when a site is first sampled. As with ThreadCounters only the owning thread
+// writes, snapshots read from other threads. Calls are counted per site, as nested types run in a fixed order a count
+// shared by every site would sample some sites on every period and others never.
+class ThreadLatency
+{
+  public:
+    using Value = LatencyHistogram;
+
+    ThreadLatency() noexcept
+    {
+        for (std::atomic<Histogram*>& histogram : m_histograms)
+        {
+            histogram.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ThreadLatency(const ThreadLatency&) = delete;
+    ThreadLatency& operator=(const ThreadLatency&) = delete;
+    ~ThreadLatency() noexcept
+    {
+        for (std::atomic<Histogram*>& histogram : m_histograms)
+        {
+            delete histogram.load(std::memory_order_relaxed);
+        }
+    }
+
+    void add(size_t id, size_t bucket, uint64_t count, uint64_t total_nanoseconds) noexcept
+    {
+        Histogram* histogram = m_histograms[id].load(std::memory_order_relaxed);
+        if (FAST_BER_UNLIKELY(histogram == nullptr))
+        {
+            histogram = allocate_histogram(id);
+            if (histogram == nullptr)
+            {
+                return;
+            }
+        }
+        increment(histogram->buckets[bucket], count);
+        increment(histogram->total, total_nanoseconds);
+    }
+
+    void add(size_t id, const LatencyHistogram& histogram) noexcept
+    {
+        for (size_t i = 0; i < LatencyHistogram::bucket_count; i++)
+        {
+            if (histogram.count(i) > 0)
+            {
+                add(id, i, histogram.count(i), 0);
+            }
+        }
+        add(id, 0, 0, histogram.total_nanoseconds());
+    }
+
+    // Calls of a site on this thread since it was last sampled
+    uint32_t& calls(size_t id) noexcept { return m_calls[id]; }
+
+    // Adds the histogram of a site to output, returning false if nothing was recorded
+    bool add_to(size_t id, LatencyHistogram& output) const noexcept
+    {
+        const Histogram* histogram = m_histograms[id].load(std::memory_order_acquire);
+        if (histogram == nullptr)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < LatencyHistogram::bucket_count; i++)
+        {
+            const uint64_t count = histogram->buckets[i].load(std::memory_order_relaxed);
+            if (count > 0)
+            {
+                output.add(i, count, 0);
+            }
+        }
+        output.add(0, 0, histogram->total.load(std::memory_order_relaxed));
+        return true;
+    }
+
+  private:
+    struct Histogram
+    {
+        std::array<std::atomic<uint64_t>, LatencyHistogram::bucket_count> buckets = {};
+        std::atomic<uint64_t>                                              total{0};
+    };
+
+    static void increment(std::atomic<uint64_t>& counter, uint64_t amount) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    FAST_BER_COLD Histogram* allocate_histogram(size_t id) noexcept
+    {
+        Histogram* histogram = new (std::nothrow) Histogram();
+        m_histograms[id].store(histogram, std::memory_order_release);
+        return histogram;
+    }
+
+    std::array<std::atomic<Histogram*>, LatencySite::max_sites> m_histograms;
+    std::array<uint32_t, LatencySite::max_sites>                m_calls = {};
+};
+
+using LatencyRegistry = SiteRegistry<LatencySite, ThreadLatency>;
+
+} // namespace detail
+
+// Times the enclosing scope if the call is sampled. Unsampled calls cost a thread local increment and a comparison
+// with the period, so a new period applies from the next call. Sites beyond max_sites are never sampled
+class LatencyTimer
+{
+  public:
+    explicit LatencyTimer(const LatencySite& site) noexcept : m_site(site)
+    {
+        if (FAST_BER_UNLIKELY(site.id() >= LatencySite::max_sites))
+        {
+            return;
+        }
+        uint32_t& calls = detail::LatencyRegistry::thread_payload().calls(site.id());
+        if (FAST_BER_UNLIKELY(++calls >= latency_sample_period()))
+        {
+            calls     = 0;
+            m_sampled = true;
+            m_start   = std::chrono::steady_clock::now();
+        }
+    }
+    LatencyTimer(const LatencyTimer&) = delete;
+    LatencyTimer& operator=(const LatencyTimer&) = delete;
+    ~LatencyTimer() noexcept
+    {
+        if (FAST_BER_UNLIKELY(m_sampled))
+        {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                                      m_start);
+            record_latency(m_site, static_cast<uint64_t>(elapsed.count()));
+        }
+    }
+
+  private:
+    const LatencySite&                    m_site;
+    bool                                  m_sampled = false;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+inline size_t LatencyHistogram::bucket(uint64_t nanoseconds) noexcept
+{
+    if (nanoseconds < sub_buckets)
+    {
+        return static_cast<size_t>(nanoseconds);
+    }
+    size_t exponent = sub_bucket_bits;
+    while (exponent < 63 && (nanoseconds >> (exponent + 1)) != 0)
+    {
+        exponent++;
+    }
+    const size_t sub_bucket = static_cast<size_t>(nanoseconds >> (exponent - sub_bucket_bits)) - sub_buckets;
+    return (exponent - sub_bucket_bits + 1) * sub_buckets + sub_bucket;
+}
+
+inline uint64_t LatencyHistogram::lower_bound(size_t bucket) noexcept
+{
+    if (bucket < sub_buckets)
+    {
+        return bucket;
+    }
+    const size_t exponent = bucket / sub_buckets + sub_bucket_bits - 1;
+    return static_cast<uint64_t>(sub_buckets + bucket % sub_buckets) << (exponent - sub_bucket_bits);
+}
+
+inline uint64_t LatencyHistogram::upper_bound(size_t bucket) noexcept
+{
+    return bucket + 1 < bucket_count ? lower_bound(bucket + 1) - 1 : UINT64_MAX;
+}
+
+inline void LatencyHistogram::add(size_t bucket, uint64_t count, uint64_t total_nanoseconds) noexcept
+{
+    m_buckets[bucket] += count;
+    m_count += count;
+    m_total += total_nanoseconds;
+}
+
+inline void LatencyHistogram::merge(const LatencyHistogram& rhs) noexcept
+{
+    for (size_t i = 0; i < bucket_count; i++)
+    {
+        m_buckets[i] += rhs.m_buckets[i];
+    }
+    m_count += rhs.m_count;
+    m_total += rhs.m_total;
+}
+
+inline uint64_t LatencyHistogram::percentile(double quantile) const noexcept
+{
+    if (m_count == 0)
+    {
+        return 0;
+    }
+    const double   clamped = std::min(std::max(quantile, 0.0), 1.0);
+    const uint64_t rank    = std::max<uint64_t>(1, static_cast<uint64_t>(clamped * static_cast<double>(m_count) + 0.5));
+    uint64_t       seen    = 0;
+    for (size_t i = 0; i < bucket_count; i++)
+    {
+        seen += m_buckets[i];
+        if (seen >= rank)
+        {
+            return upper_bound(i);
+        }
+    }
+    return upper_bound(bucket_count - 1);
+}
+
+inline LatencySite::LatencySite(CounterOperation operation, const char* type) noexcept
+    : m_operation(operation), m_type(type), m_id(detail::LatencyRegistry::instance().add_site(*this))
+{
+}
+
+inline void record_latency(const LatencySite& site, uint64_t nanoseconds) noexcept
+{
+    if (site.id() < LatencySite::max_sites)
+    {
+        detail::LatencyRegistry::thread_payload().add(site.id(), LatencyHistogram::bucket(nanoseconds), 1, nanoseconds);
+    }
+}
+
+inline void set_latency_sample_period(uint32_t period) noexcept
+{
+    detail::latency_period().store(period > 0 ? period : 1, std::memory_order_relaxed);
+}
+
+inline uint32_t latency_sample_period() noexcept { return detail::latency_period().load(std::memory_order_relaxed); }
+
+inline std::vector<LatencyEntry> latency_snapshot()
+{
+    return detail::LatencyRegistry::instance().snapshot<LatencyEntry>(
+        [](const LatencySite& site, const LatencyHistogram& histogram) {
+            return LatencyEntry{site.operation(), site.type(), histogram};
+        },
+        [](const LatencyEntry& lhs, const LatencyEntry& rhs) {
+            return lhs.operation != rhs.operation ? (lhs.operation < rhs.operation ? -1 : 1)
+                                                  : detail::compare_names(lhs.type, rhs.type);
+        },
+        [](LatencyEntry& merged, const LatencyEntry& entry) { merged.histogram.merge(entry.histogram); });
+}
+
+} // namespace fast_ber
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "absl/types/span.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace fast_ber
+{
+
+// Read only view of the contents of a file. On POSIX systems the file is memory mapped, so the contents are read from
+// the page cache as they are accessed without being copied. On other systems the file is read into memory.
+class MappedFile
+{
+  public:
+    MappedFile() noexcept = default;
+    explicit MappedFile(const std::string& path) { open(path); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&& rhs) noexcept;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&& rhs) noexcept;
+    ~MappedFile() noexcept { close(); }
+
+    // Return false if the file could not be opened or mapped
+    bool open(const std::string& path);
+    void close() noexcept;
+
+    bool                      is_open() const noexcept { return m_is_open; }
+    absl::Span<const uint8_t> data() const noexcept { return m_data; }
+    size_t                    size() const noexcept { return m_data.size(); }
+
+  private:
+    absl::Span<const uint8_t> m_data;
+    bool                      m_is_open = false;
+    bool                      m_mapped  = false;
+    std::vector<uint8_t>      m_buffer; // Contents when the file is not mapped
+};
+
+} // namespace fast_ber
@@ -0,0 +1,259 @@
+#pragma once
+
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/DecodeBatch.hpp"
+
+#include "absl/types/span.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fast_ber
+{
+
+struct ParallelDecodeResult
+{
+    bool   success;
+    size_t records;      // Number of records decoded and output
+    size_t error_offset; // Offset in the input of the first record which could not be framed or decoded
+};
+
+// Decodes a buffer of back to back records, such as a memory mapped file of call detail records, using a pool of
+// threads. Record boundaries are found by the calling thread by hopping from header to header, contiguous batches of
+// records are then decoded by the worker threads. Records are referred to in place, input bytes are never copied.
+//
+// Decoded records are passed to the output on the calling thread, in the order of the input. A bounded window of
+// batches is in flight at any time, limiting memory use regardless of the size of the input. The decoded objects of
+// each batch are reused for later batches, reducing allocations.
+//
+// The worker threads are started by the constructor and kept until the decoder is destroyed, so repeated decodes do
+// not start threads. One decode may run at a time.
+template <typename T>
+class ParallelDecoder
+{
+  public:
+    explicit ParallelDecoder(size_t threads = default_threads(), size_t batch_size = 256);
+    ParallelDecoder(const ParallelDecoder&) = delete;
+    ParallelDecoder& operator=(const ParallelDecoder&) = delete;
+    ~ParallelDecoder() noexcept { stop_workers(); }
+
+    // Decode each record of the input, calling output(const T&) for each record in order.
+    // Decoding stops at the first record which can't be framed or decoded, records before it are output. If the output
+    // throws, batches still being decoded are finished before the exception leaves decode.
+    template <typename Output>
+    ParallelDecodeResult decode(absl::Span<const uint8_t> input, Output&& output);
+
+    size_t threads() const noexcept { return m_threads; }
+
+    static size_t default_threads() noexcept
+    {
+        const unsigned int threads = std::thread::hardware_concurrency();
+        return threads > 0 ? threads : 1;
+    }
+
+  private:
+    enum class BatchState
+    {
+        framed,
+        decoded,
+    };
+
+    struct Batch
+    {
+        std::vector<BerView> records;
+        std::vector<T>       objects;
+        size_t               decoded = 0; // Records successfully decoded, fewer than records.size() on failure
+        BatchState           state   = BatchState::decoded;
+    };
+
+    // Ends a decode, including when the output throws. Batches not yet taken by a worker are dropped, and batches being
+    // decoded are waited for, so none are in use by a worker when the next decode starts
+    class FinishDecode
+    {
+      public:
+        explicit FinishDecode(ParallelDecoder& decoder) noexcept : m_decoder(decoder) {}
+        FinishDecode(const FinishDecode&) = delete;
+        FinishDecode& operator=(const FinishDecode&) = delete;
+        ~FinishDecode() noexcept { m_decoder.finish_decode(); }
+
+      private:
+        ParallelDecoder& m_decoder;
+    };
+
+    void   work();
+    void   decode_batch(Batch& batch);
+    void   finish_decode() noexcept;
+    void   stop_workers() noexcept;
+    Batch& batch_at(size_t sequence) noexcept { return m_batches[sequence % m_batches.size()]; }
+
+    size_t                   m_threads;
+    size_t                   m_batch_size;
+    std::vector<Batch>       m_batches;
+    std::vector<std::thread> m_workers;
+
+    // Batches are numbered in the order of the input. Guarded by m_mutex.
+    std::mutex              m_mutex;
+    std::condition_variable m_work_ready;
+    std::condition_variable m_batch_decoded;
+    size_t                  m_framed   = 0; // Batches made available to the workers
+    size_t                  m_claimed  = 0; // Batches taken by a worker
+    size_t                  m_decoding = 0; // Batches taken by a worker and not yet decoded
+    bool                    m_stop     = false;
+};
+
+template <typename T>
+ParallelDecoder<T>::ParallelDecoder(size_t threads, size_t batch_size)
+    : m_threads(threads > 0 ? threads : 1), m_batch_size(batch_size > 0 ? batch_size : 1), m_batches(m_threads * 4)
+{
+    m_workers.reserve(m_threads);
+    try
+    {
+        for (size_t i = 0; i < m_threads; i++)
+        {
+            m_workers.emplace_back([this] { work(); });
+        }
+    }
+    catch (...)
+    {
+        // The destructor is not run when the constructor throws, so workers already started are joined here
+        stop_workers();
+        throw;
+    }
+}
+
+template <typename T>
+template <typename Output>
+ParallelDecodeResult ParallelDecoder<T>::decode(absl::Span<const uint8_t> input, Output&& output)
+{
+    ParallelDecodeResult result = {true, 0, 0};
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_framed  = 0;
+        m_claimed = 0;
+    }
+    const FinishDecode finish(*this);
+
+    BerViewIterator       iterator(input);
+    const BerViewIterator end(End::end);
+    size_t                framed_length = 0;
+    bool                  framing       = true;
+    size_t                output_count  = 0; // Batches passed to the output
+    while (true)
+    {
+        // Frame batches ahead of the output, until the window is full
+        while (framing && m_framed - output_count < m_batches.size())
+        {
+            Batch& next = batch_at(m_framed);
+            next.records.clear();
+            for (; next.records.size() < m_batch_size && iterator != end; ++iterator)
+            {
+                next.records.push_back(*iterator);
+                framed_length += iterator->ber_length();
+            }
+            framing = iterator != end;
+            if (next.records.empty())
+            {
+                break;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                next.state = BatchState::framed;
+                m_framed++;
+            }
+            m_work_ready.notify_one();
+        }
+
+        if (output_count == m_framed)
+        {
+            break;
+        }
+
+        Batch& oldest = batch_at(output_count);
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_batch_decoded.wait(lock, [&oldest] { return oldest.state == BatchState::decoded; });
+        }
+
+        for (size_t i = 0; i < oldest.decoded; i++)
+        {
+            output(static_cast<const T&>(oldest.objects[i]));
+        }
+        result.records += oldest.decoded;
+        output_count++;
+
+        if (oldest.decoded != oldest.records.size())
+        {
+            result.success      = false;
+            result.error_offset = static_cast<size_t>(oldest.records[oldest.decoded].ber_data() - input.data());
+            break;
+        }
+    }
+
+    // Trailing data which is not a complete record
+    if (result.success && framed_length != input.size())
+    {
+        result.success      = false;
+        result.error_offset = framed_length;
+    }
+    return result;
+}
+
+template <typename T>
+void ParallelDecoder<T>::work()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_work_ready.wait(lock, [this] { return m_stop || m_claimed < m_framed; });
+        if (m_stop)
+        {
+            return;
+        }
+
+        Batch& claimed = batch_at(m_claimed++);
+        m_decoding++;
+        lock.unlock();
+        decode_batch(claimed);
+        lock.lock();
+
+        claimed.state = BatchState::decoded;
+        m_decoding--;
+        m_batch_decoded.notify_one();
+    }
+}
+
+template <typename T>
+void ParallelDecoder<T>::finish_decode() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_framed = m_claimed;
+    m_batch_decoded.wait(lock, [this] { return m_decoding == 0; });
+}
+
+template <typename T>
+void ParallelDecoder<T>::stop_workers() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_work_ready.notify_all();
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+template <typename T>
+void ParallelDecoder<T>::decode_batch(Batch& batch)
+{
+    // Objects are kept between batches, their storage is reused
+    batch.decoded = fast_ber::decode_batch(absl::MakeConstSpan(batch.records), batch.objects).decoded;
+}
+
+} // namespace fast_ber
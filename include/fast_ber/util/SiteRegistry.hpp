@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace fast_ber
+{
+namespace detail
+{
+
+inline int compare_names(const char* lhs, const char* rhs) noexcept
+{
+    if (lhs == rhs)
+    {
+        return 0;
+    }
+    if (lhs == nullptr || rhs == nullptr)
+    {
+        return lhs == nullptr ? -1 : 1;
+    }
+    return std::strcmp(lhs, rhs);
+}
+
+// Sites of a hook, such as the counters or the latency timers, and the data each thread records for them. Sites
+// register on construction and are given an id, sites beyond Site::max_sites are given max_sites and not recorded.
+// Each thread records into its own Payload, registered on first use. When the thread exits its payload is added to the
+// retired payload, so nothing recorded is lost.
+//
+// Payload is default constructible and provides, for a site id:
+//     void add(size_t id, const Value& value) noexcept;      Adds values recorded by an exited thread
+//     bool add_to(size_t id, Value& output) const noexcept;  Adds the values of the site to output, returning false if
+//                                                            nothing was recorded
+// Only the owning thread writes to a payload, add_to is called from other threads while the registry lock is held.
+template <typename Site, typename Payload>
+class SiteRegistry
+{
+  public:
+    using Value = typename Payload::Value;
+
+    static SiteRegistry& instance() noexcept
+    {
+        static SiteRegistry registry;
+        return registry;
+    }
+
+    size_t add_site(const Site& site) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_site_count == Site::max_sites)
+        {
+            return Site::max_sites;
+        }
+        m_sites[m_site_count] = &site;
+        return m_site_count++;
+    }
+
+    // Payload of the calling thread
+    static Payload& thread_payload() noexcept
+    {
+        static thread_local RegisteredThread registered;
+        return registered.thread.payload;
+    }
+
+    // Totals of each site recorded by any thread, made into entries by make_entry(site, value). Entries are ordered by
+    // compare(lhs, rhs), which returns a negative, zero or positive int as strcmp does, and entries comparing equal,
+    // such as sites of one type instantiated with several identifiers, are combined by merge(into, entry). Takes a lock
+    // shared with thread start and exit, but not with recording.
+    template <typename Entry, typename MakeEntry, typename Compare, typename Merge>
+    std::vector<Entry> snapshot(MakeEntry make_entry, Compare compare, Merge merge) const
+    {
+        std::vector<Entry> entries;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (size_t id = 0; id < m_site_count; id++)
+            {
+                Value total    = {};
+                bool  recorded = m_retired.add_to(id, total);
+                for (const Thread* thread = m_threads; thread != nullptr; thread = thread->next)
+                {
+                    recorded = thread->payload.add_to(id, total) || recorded;
+                }
+                if (recorded)
+                {
+                    entries.push_back(make_entry(*m_sites[id], total));
+                }
+            }
+        }
+
+        std::sort(entries.begin(), entries.end(),
+                  [&](const Entry& lhs, const Entry& rhs) { return compare(lhs, rhs) < 0; });
+        std::vector<Entry> merged;
+        for (const Entry& entry : entries)
+        {
+            if (!merged.empty() && compare(merged.back(), entry) == 0)
+            {
+                merge(merged.back(), entry);
+            }
+            else
+            {
+                merged.push_back(entry);
+            }
+        }
+        return merged;
+    }
+
+  private:
+    // Threads are held in an intrusive list, so registering a thread never allocates
+    struct Thread
+    {
+        Payload payload;
+        Thread* next     = nullptr;
+        Thread* previous = nullptr;
+    };
+
+    class RegisteredThread
+    {
+      public:
+        RegisteredThread() noexcept { instance().add_thread(thread); }
+        RegisteredThread(const RegisteredThread&) = delete;
+        RegisteredThread& operator=(const RegisteredThread&) = delete;
+        ~RegisteredThread() noexcept { instance().remove_thread(thread); }
+
+        Thread thread;
+    };
+
+    SiteRegistry() noexcept = default;
+
+    void add_thread(Thread& thread) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        thread.next = m_threads;
+        if (m_threads)
+        {
+            m_threads->previous = &thread;
+        }
+        m_threads = &thread;
+    }
+
+    void remove_thread(Thread& thread) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t id = 0; id < m_site_count; id++)
+        {
+            Value value = {};
+            if (thread.payload.add_to(id, value))
+            {
+                m_retired.add(id, value);
+            }
+        }
+        if (thread.previous)
+        {
+            thread.previous->next = thread.next;
+        }
+        else
+        {
+            m_threads = thread.next;
+        }
+        if (thread.next)
+        {
+            thread.next->previous = thread.previous;
+        }
+    }
+
+    mutable std::mutex                       m_mutex;
+    std::array<const Site*, Site::max_sites> m_sites      = {};
+    size_t                                   m_site_count = 0;
+    Thread*                                  m_threads    = nullptr;
+    Payload                                  m_retired;
+};
+
+} // namespace detail
+} // namespace fast_ber
@@ -65,6 +65,7 @@ class SmallFixedIdBerContainer
     BerView view() const noexcept { return BerView(m_data); }
 
     EncodeResult encode(absl::Span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(absl::Span<uint8_t> buffer) const noexcept { return prepend_ber(buffer, ber()); }
     DecodeResult decode(BerView view) noexcept;
 
   private:
@@ -130,9 +131,14 @@ template <Class class_1, Tag tag_1>
 DecodeResult SmallFixedIdBerContainer<Identifier, max_content_length>::decode_impl(const BerView      input_view,
                                                                                    Id<class_1, tag_1> id) noexcept
 {
-    if (!(input_view.is_valid() && input_view.identifier() == id &&
-          input_view.construction() == Construction::primitive && input_view.content_length() <= max_content_length))
+    if (!has_correct_header(input_view, id, Construction::primitive))
     {
+        FAST_BER_ERROR(input_view, nullptr);
+        return DecodeResult{false};
+    }
+    if (input_view.content_length() > max_content_length)
+    {
+        FAST_BER_ERROR(ErrorCode::capacity_exceeded, nullptr, input_view.identifier());
         return DecodeResult{false};
     }
 
@@ -149,18 +155,27 @@ SmallFixedIdBerContainer<Identifier, max_content_length>::decode_impl(const BerV
                                                                       DoubleId<Identifier1, Identifier2>) noexcept
 {
     if (!(input_view.is_valid() && input_view.identifier() == Identifier1{} &&
-          input_view.construction() == Construction::constructed && input_view.begin()->is_valid() &&
-          input_view.begin()->identifier() == Identifier2{} &&
-          input_view.begin()->construction() == Construction::primitive &&
-          input_view.begin()->content_length() <= max_content_length))
+          input_view.construction() == Construction::constructed))
     {
+        FAST_BER_ERROR(input_view, nullptr);
+        return DecodeResult{false};
+    }
 
+    const BerView inner_view = *input_view.begin();
+    if (!(inner_view.is_valid() && inner_view.identifier() == Identifier2{} &&
+          inner_view.construction() == Construction::primitive))
+    {
+        FAST_BER_ERROR(inner_view, nullptr);
+        return DecodeResult{false};
+    }
+    if (inner_view.content_length() > max_content_length)
+    {
+        FAST_BER_ERROR(ErrorCode::capacity_exceeded, nullptr, inner_view.identifier());
         return DecodeResult{false};
     }
 
-    std::memcpy(m_data.data() + m_header_length, input_view.begin()->content_data(),
-                input_view.begin()->content_length());
-    set_content_length(input_view.begin()->content_length());
+    std::memcpy(m_data.data() + m_header_length, inner_view.content_data(), inner_view.content_length());
+    set_content_length(inner_view.content_length());
 
     return DecodeResult{true};
 }
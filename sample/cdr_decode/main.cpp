@@ -0,0 +1,77 @@
+#include "autogen/sgsn_cdr.hpp"
+
+#include "fast_ber/util/MappedFile.hpp"
+#include "fast_ber/util/ParallelDecoder.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+void usage()
+{
+    std::cout << "Summarise a file of concatenated SGSN call detail records, decoded using all cores.\n";
+    std::cout << "  usage: ./sample_cdr_decode [records.ber] [threads]\n";
+}
+
+int main(int argc, const char** argv)
+{
+    if (argc != 2 && argc != 3)
+    {
+        usage();
+        return -1;
+    }
+
+    const std::string          input_path = argv[1];
+    const fast_ber::MappedFile input(input_path);
+    if (!input.is_open())
+    {
+        std::cout << "Failed to open input: " << input_path << std::endl;
+        return -1;
+    }
+
+    using Decoder        = fast_ber::ParallelDecoder<fast_ber::SGSN_2009A_CDR::CallEventRecord>;
+    const size_t threads = (argc == 3) ? std::strtoul(argv[2], nullptr, 10) : Decoder::default_threads();
+    Decoder      decoder(threads);
+
+    std::array<size_t, 3> record_counts = {};
+    int64_t               uplink        = 0;
+    int64_t               downlink      = 0;
+
+    const auto                           start  = std::chrono::steady_clock::now();
+    const fast_ber::ParallelDecodeResult result = decoder.decode(
+        input.data(), [&](const fast_ber::SGSN_2009A_CDR::CallEventRecord& record) {
+            record_counts[record.index()]++;
+
+            if (record.index() != 0)
+            {
+                return;
+            }
+
+            const fast_ber::SGSN_2009A_CDR::SGSNPDPRecord& pdp = fast_ber::get<0>(record);
+            if (pdp.listOfTrafficVolumes.has_value())
+            {
+                for (const fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition& change : *pdp.listOfTrafficVolumes)
+                {
+                    uplink += change.dataVolumeGPRSUplink.value();
+                    downlink += change.dataVolumeGPRSDownlink.value();
+                }
+            }
+        });
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Records: " << result.records << " (" << input.size() << " bytes, " << decoder.threads()
+              << " threads, " << elapsed.count() << " s)\n";
+    std::cout << "  sgsnPDPRecord: " << record_counts[0] << '\n';
+    std::cout << "  sgsnSMORecord: " << record_counts[1] << '\n';
+    std::cout << "  sgsnSMTRecord: " << record_counts[2] << '\n';
+    std::cout << "Uplink volume: " << uplink << ", downlink volume: " << downlink << '\n';
+
+    if (!result.success)
+    {
+        std::cout << "Failed to decode record at offset " << result.error_offset << std::endl;
+        return -1;
+    }
+    return 0;
+}
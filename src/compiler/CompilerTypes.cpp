@@ -7,15 +7,18 @@ SequenceOfType::SequenceOfType(bool a, std::unique_ptr<NamedType>&& b, std::uniq
 SequenceOfType::SequenceOfType(const SequenceOfType& rhs)
     : has_name(rhs.has_name),
       named_type(rhs.named_type ? std::unique_ptr<NamedType>(new NamedType(*rhs.named_type)) : nullptr),
-      type(rhs.type ? new Type(*rhs.type) : nullptr), storage(rhs.storage)
+      type(rhs.type ? new Type(*rhs.type) : nullptr), storage(rhs.storage), constraint(rhs.constraint),
+      inlined_size(rhs.inlined_size)
 {
 }
 SequenceOfType& SequenceOfType::operator=(const SequenceOfType& rhs)
 {
-    has_name   = rhs.has_name;
-    named_type = rhs.named_type ? std::unique_ptr<NamedType>(new NamedType(*rhs.named_type)) : nullptr;
-    type       = rhs.type ? std::unique_ptr<Type>(new Type(*rhs.type)) : nullptr;
-    storage    = rhs.storage;
+    has_name     = rhs.has_name;
+    named_type   = rhs.named_type ? std::unique_ptr<NamedType>(new NamedType(*rhs.named_type)) : nullptr;
+    type         = rhs.type ? std::unique_ptr<Type>(new Type(*rhs.type)) : nullptr;
+    storage      = rhs.storage;
+    constraint   = rhs.constraint;
+    inlined_size = rhs.inlined_size;
     return *this;
 }
 
@@ -163,9 +166,11 @@ static const std::unordered_set<std::string> reserved_keywords = {
     "UTF8String",
     "UniversalString",
     "VideotexString",
+    "View",
     "VisibleString",
     "decode",
     "encode",
+    "encode_reverse",
     "encoded_length"};
 
 // Switch asn '-' for C++ '_'
@@ -224,6 +229,10 @@ std::string to_string(StorageMode mode)
         return "StorageMode::small_buffer_optimised";
     case StorageMode::dynamic:
         return "StorageMode::dynamic";
+    case StorageMode::arena:
+        return "StorageMode::arena";
+    case StorageMode::sparse:
+        return "StorageMode::sparse";
     }
 
     return "Unknown StorageMode";
@@ -327,3 +336,135 @@ std::string gen_anon_member_name()
     static std::size_t count = 0;
     return "anonymous_member_" + std::to_string(count++);
 }
+
+static bool is_number(const absl::optional<ConstraintBound>& bound)
+{
+    return bound && absl::holds_alternative<int64_t>(*bound);
+}
+
+static bool is_same_reference(const absl::optional<ConstraintBound>& lhs, const absl::optional<ConstraintBound>& rhs)
+{
+    return lhs && rhs && absl::holds_alternative<DefinedValue>(*lhs) && absl::holds_alternative<DefinedValue>(*rhs) &&
+           absl::get<DefinedValue>(*lhs).reference == absl::get<DefinedValue>(*rhs).reference;
+}
+
+// Looser of two ends of a range, unbounded unless both are bounded and can be compared
+static absl::optional<ConstraintBound> looser_bound(const absl::optional<ConstraintBound>& lhs,
+                                                    const absl::optional<ConstraintBound>& rhs, bool upper)
+{
+    if (is_number(lhs) && is_number(rhs))
+    {
+        const int64_t lhs_number = absl::get<int64_t>(*lhs);
+        const int64_t rhs_number = absl::get<int64_t>(*rhs);
+        return ConstraintBound(upper ? std::max(lhs_number, rhs_number) : std::min(lhs_number, rhs_number));
+    }
+    if (is_same_reference(lhs, rhs))
+    {
+        return lhs;
+    }
+    return absl::nullopt;
+}
+
+// Tighter of two ends of a range. Either end bounds an intersection, so when they can't be compared a number is kept
+static absl::optional<ConstraintBound> tighter_bound(const absl::optional<ConstraintBound>& lhs,
+                                                     const absl::optional<ConstraintBound>& rhs, bool upper)
+{
+    if (is_number(lhs) && is_number(rhs))
+    {
+        const int64_t lhs_number = absl::get<int64_t>(*lhs);
+        const int64_t rhs_number = absl::get<int64_t>(*rhs);
+        return ConstraintBound(upper ? std::min(lhs_number, rhs_number) : std::max(lhs_number, rhs_number));
+    }
+    if (!lhs || is_number(rhs))
+    {
+        return rhs;
+    }
+    return lhs;
+}
+
+Constraint constraint_union(const Constraint& lhs, const Constraint& rhs)
+{
+    Constraint constraint;
+    constraint.value.lower = looser_bound(lhs.value.lower, rhs.value.lower, false);
+    constraint.value.upper = looser_bound(lhs.value.upper, rhs.value.upper, true);
+    constraint.size.lower  = looser_bound(lhs.size.lower, rhs.size.lower, false);
+    constraint.size.upper  = looser_bound(lhs.size.upper, rhs.size.upper, true);
+    return constraint;
+}
+
+Constraint constraint_intersection(const Constraint& lhs, const Constraint& rhs)
+{
+    Constraint constraint;
+    constraint.value.lower = tighter_bound(lhs.value.lower, rhs.value.lower, false);
+    constraint.value.upper = tighter_bound(lhs.value.upper, rhs.value.upper, true);
+    constraint.size.lower  = tighter_bound(lhs.size.lower, rhs.size.lower, false);
+    constraint.size.upper  = tighter_bound(lhs.size.upper, rhs.size.upper, true);
+    return constraint;
+}
+
+absl::optional<ConstraintBound> constraint_bound(const Value& value)
+{
+    if (absl::holds_alternative<int64_t>(value.value_selection))
+    {
+        return ConstraintBound(absl::get<int64_t>(value.value_selection));
+    }
+    if (absl::holds_alternative<DefinedValue>(value.value_selection))
+    {
+        return ConstraintBound(absl::get<DefinedValue>(value.value_selection));
+    }
+    return absl::nullopt;
+}
+
+// Excluded ends given by reference can't be adjusted, so are left unbounded
+absl::optional<ConstraintBound> exclusive_bound(const absl::optional<ConstraintBound>& bound, int64_t step)
+{
+    if (!is_number(bound))
+    {
+        return absl::nullopt;
+    }
+    return ConstraintBound(absl::get<int64_t>(*bound) + step);
+}
+
+void add_constraint(Type& type, const Constraint& constraint)
+{
+    if (!absl::holds_alternative<BuiltinType>(type))
+    {
+        return;
+    }
+
+    BuiltinType& builtin = absl::get<BuiltinType>(type);
+    if (absl::holds_alternative<BitStringType>(builtin))
+    {
+        Constraint& existing = absl::get<BitStringType>(builtin).constraint;
+        existing             = constraint_intersection(existing, constraint);
+    }
+    else if (absl::holds_alternative<CharacterStringType>(builtin))
+    {
+        Constraint& existing = absl::get<CharacterStringType>(builtin).constraint;
+        existing             = constraint_intersection(existing, constraint);
+    }
+    else if (absl::holds_alternative<IntegerType>(builtin))
+    {
+        Constraint& existing = absl::get<IntegerType>(builtin).constraint;
+        existing             = constraint_intersection(existing, constraint);
+    }
+    else if (absl::holds_alternative<OctetStringType>(builtin))
+    {
+        Constraint& existing = absl::get<OctetStringType>(builtin).constraint;
+        existing             = constraint_intersection(existing, constraint);
+    }
+    else if (absl::holds_alternative<SequenceOfType>(builtin))
+    {
+        Constraint& existing = absl::get<SequenceOfType>(builtin).constraint;
+        existing             = constraint_intersection(existing, constraint);
+    }
+    else if (absl::holds_alternative<SetOfType>(builtin))
+    {
+        Constraint& existing = absl::get<SetOfType>(builtin).constraint;
+        existing             = constraint_intersection(existing, constraint);
+    }
+    else if (absl::holds_alternative<PrefixedType>(builtin))
+    {
+        add_constraint(absl::get<PrefixedType>(builtin).tagged_type->type, constraint);
+    }
+}
@@ -2,6 +2,7 @@
 
 #include <cctype>
 #include <sstream>
+#include <unordered_set>
 
 std::string create_include(const std::string& path) { return "#include \"" + path + "\"\n"; }
 
@@ -62,12 +63,16 @@ std::string add_namespace(const std::string& name, const std::string& enclosed)
     return output;
 }
 
+// Names declared in every generated type, which member types may not share
+static const std::unordered_set<std::string> generated_member_names = {"AsnId", "Field", "FieldMask", "View"};
+
 // Creates a C++ type following conventions of project (ie starts with capital letter)
 std::string make_type_name(std::string name, absl::string_view parent_name)
 {
     assert(!name.empty());
     name[0] = std::toupper(name[0]);
-    if (name == parent_name) // C++ types may not share a name with their enclosing class
+    // C++ types may not share a name with their enclosing class, or with the names it declares itself
+    if (name == parent_name || generated_member_names.count(name) > 0)
     {
         return name + '_';
     }
@@ -23,6 +23,31 @@ std::string make_component_function(const std::string& function, const NamedType
     return function;
 }
 
+// Declares the counter of a type, or of one of its members when a member is given. Counters are removed unless
+// FAST_BER_ENABLE_COUNTERS is defined, see util/Counters.hpp
+std::string declare_counter(const std::string& operation, const std::string& name, const std::string& member = "")
+{
+    if (member.empty())
+    {
+        return "FAST_BER_COUNTER(fast_ber_counter, " + operation + R"(, ")" + name + R"(", nullptr);)";
+    }
+    return "FAST_BER_COUNTER(fast_ber_counter_" + member + ", " + operation + R"(, ")" + name + R"(", ")" + member +
+           R"(");)";
+}
+
+// Times a sample of the calls of a type until the function returns. Removed unless FAST_BER_ENABLE_LATENCY is defined,
+// see util/Latency.hpp
+std::string declare_latency(const std::string& operation, const std::string& name)
+{
+    return "FAST_BER_LATENCY(fast_ber_latency, " + operation + R"(, ")" + name + R"(");)";
+}
+
+std::string count(const std::string& member, const std::string& bytes, const std::string& success)
+{
+    const std::string site = member.empty() ? "fast_ber_counter" : "fast_ber_counter_" + member;
+    return "FAST_BER_COUNT(" + site + ", " + bytes + ", " + success + ");";
+}
+
 template <typename CollectionType>
 CodeBlock create_collection_encode_functions(const std::string& name, const CollectionType& collection,
                                              const Module& module, const Asn1Tree& tree)
@@ -33,11 +58,14 @@ CodeBlock create_collection_encode_functions(const std::string& name, const Coll
     block.add_line("inline EncodeResult " + name + "::encode_with_id(absl::Span<uint8_t> output) const noexcept");
     {
         auto scope = CodeScope(block);
+        block.add_line(declare_counter("encode", name));
+        block.add_line(declare_latency("encode", name));
         block.add_line("constexpr std::size_t header_length_guess = fast_ber::encoded_length(0, Identifier_{});");
-        block.add_line("if (output.length() < header_length_guess)");
+        block.add_line("if (FAST_BER_UNLIKELY(output.length() < header_length_guess))");
 
         {
             auto scope2 = CodeScope(block);
+            block.add_line(count("", "0", "false"));
             block.add_line("return EncodeResult{false, 0};");
         }
 
@@ -53,15 +81,55 @@ CodeBlock create_collection_encode_functions(const std::string& name, const Coll
         {
             block.add_line("res = " + component.named_type.name + "." +
                            make_component_function("encode", component.named_type, module, tree) + "(content);");
-            block.add_line("if (!res.success)");
+            block.add_line(declare_counter("encode", name, component.named_type.name));
+            block.add_line(count(component.named_type.name, "res.length", "res.success"));
+            block.add_line("if (FAST_BER_UNLIKELY(!res.success))");
             {
                 auto scope2 = CodeScope(block);
+                block.add_line(count("", "0", "false"));
                 block.add_line("return res;");
             }
             block.add_line("content.remove_prefix(res.length);");
             block.add_line("content_length += res.length;");
         }
-        block.add_line("return wrap_with_ber_header(output, content_length, Identifier_{}, header_length_guess);");
+        block.add_line("return FAST_BER_COUNT_ENCODED(fast_ber_counter, wrap_with_ber_header(output, content_length, "
+                       "Identifier_{}, header_length_guess));");
+    }
+    block.add_line();
+
+    // Components are encoded last to first from the end of the buffer, the header is then prepended
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("inline EncodeResult " + name +
+                   "::encode_reverse_with_id(absl::Span<uint8_t> output) const noexcept");
+    {
+        auto scope = CodeScope(block);
+        block.add_line(declare_counter("encode", name));
+        block.add_line(declare_latency("encode", name));
+        if (collection.components.size() != 0)
+        {
+            block.add_line("EncodeResult res;");
+            block.add_line("auto content = output;");
+        }
+        block.add_line("std::size_t content_length = 0;");
+
+        for (auto component = collection.components.rbegin(); component != collection.components.rend(); ++component)
+        {
+            block.add_line("res = " + component->named_type.name + "." +
+                           make_component_function("encode_reverse", component->named_type, module, tree) +
+                           "(content);");
+            block.add_line(declare_counter("encode", name, component->named_type.name));
+            block.add_line(count(component->named_type.name, "res.length", "res.success"));
+            block.add_line("if (FAST_BER_UNLIKELY(!res.success))");
+            {
+                auto scope2 = CodeScope(block);
+                block.add_line(count("", "0", "false"));
+                block.add_line("return res;");
+            }
+            block.add_line("content.remove_suffix(res.length);");
+            block.add_line("content_length += res.length;");
+        }
+        block.add_line("return FAST_BER_COUNT_ENCODED(fast_ber_counter, prepend_ber_header(output, content_length, "
+                       "Identifier_{}));");
     }
     block.add_line();
 
@@ -80,6 +148,71 @@ CodeBlock create_collection_encode_functions(const std::string& name, const Coll
         block.add_line("return fast_ber::encoded_length(content_length, Identifier_{});");
     }
     block.add_line();
+
+    // Planned encoding, the content length of each constructed element is recorded in a single pass so that
+    // headers can be written with their final length before the content
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("std::size_t " + name + "::encoded_length_with_id(EncodePlan& plan) const");
+    {
+        auto scope = CodeScope(block);
+        block.add_line("const std::size_t entry          = plan.add_entry();");
+        block.add_line("std::size_t       content_length = 0;");
+        block.add_line();
+        for (const ComponentType& component : collection.components)
+        {
+            block.add_line("content_length += this->" + component.named_type.name + "." +
+                           make_component_function("encoded_length", component.named_type, module, tree) +
+                           "(plan);");
+        }
+        block.add_line();
+        block.add_line("plan.set_entry(entry, content_length);");
+        block.add_line("return fast_ber::encoded_length(content_length, Identifier_{});");
+    }
+    block.add_line();
+
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("inline EncodeResult " + name +
+                   "::encode_with_id(absl::Span<uint8_t> output, EncodePlan& plan) const noexcept");
+    {
+        auto scope = CodeScope(block);
+        block.add_line(declare_counter("encode", name));
+        block.add_line(declare_latency("encode", name));
+        block.add_line("std::size_t       content_length = 0;");
+        block.add_line("const std::size_t header_length  = plan.next_entry(content_length)");
+        block.add_line("    ? encode_planned_header(output, content_length, Identifier_{}) : 0;");
+        block.add_line("if (FAST_BER_UNLIKELY(header_length == 0))");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line(count("", "0", "false"));
+            block.add_line("return EncodeResult{false, 0};");
+        }
+
+        if (collection.components.size() != 0)
+        {
+            block.add_line("EncodeResult res;");
+            block.add_line("auto content = output;");
+            block.add_line("content.remove_prefix(header_length);");
+        }
+
+        for (const ComponentType& component : collection.components)
+        {
+            block.add_line("res = " + component.named_type.name + "." +
+                           make_component_function("encode", component.named_type, module, tree) +
+                           "(content, plan);");
+            block.add_line(declare_counter("encode", name, component.named_type.name));
+            block.add_line(count(component.named_type.name, "res.length", "res.success"));
+            block.add_line("if (FAST_BER_UNLIKELY(!res.success))");
+            {
+                auto scope2 = CodeScope(block);
+                block.add_line(count("", "0", "false"));
+                block.add_line("return res;");
+            }
+            block.add_line("content.remove_prefix(res.length);");
+        }
+        block.add_line(count("", "header_length + content_length", "true"));
+        block.add_line("return EncodeResult{true, header_length + content_length};");
+    }
+    block.add_line();
     return block;
 }
 
@@ -92,6 +225,8 @@ CodeBlock create_choice_encode_functions(const std::string& name, const ChoiceTy
     block.add_line("inline EncodeResult " + name + "::encode_with_id(absl::Span<uint8_t> output) const noexcept");
     {
         auto scope1 = CodeScope(block);
+        block.add_line(declare_counter("encode", name));
+        block.add_line(declare_latency("encode", name));
         block.add_line("EncodeResult res;");
         block.add_line("auto content = output;");
         // If an alternative (non ChoiceId) identifier is provided choice type should be wrapped,
@@ -102,9 +237,10 @@ CodeBlock create_choice_encode_functions(const std::string& name, const ChoiceTy
             auto scope2 = CodeScope(block);
             block.add_line(" header_length_guess = fast_ber::encoded_length(0,Identifier_{});");
 
-            block.add_line("if (output.length() < header_length_guess)");
+            block.add_line("if (FAST_BER_UNLIKELY(output.length() < header_length_guess))");
             {
                 auto scope3 = CodeScope(block);
+                block.add_line(count("", "0", "false"));
                 block.add_line("return EncodeResult{false, 0};");
             }
             block.add_line("content.remove_prefix(header_length_guess);");
@@ -118,6 +254,8 @@ CodeBlock create_choice_encode_functions(const std::string& name, const ChoiceTy
                 block.add_line("case " + std::to_string(i) + ":");
                 block.add_line("	res = fast_ber::get<" + std::to_string(i) + ">(*this)." +
                                make_component_function("encode", choice.choices[i], module, tree) + "(content);");
+                block.add_line("	" + declare_counter("encode", name, choice.choices[i].name));
+                block.add_line("	" + count(choice.choices[i].name, "res.length", "res.success"));
                 block.add_line("	break;");
             }
             block.add_line("default: assert(0);");
@@ -126,18 +264,67 @@ CodeBlock create_choice_encode_functions(const std::string& name, const ChoiceTy
         block.add_line("if (!IsChoiceId<Identifier_>::value)");
         {
             auto scope2 = CodeScope(block);
-            block.add_line("if (!res.success)");
+            block.add_line("if (FAST_BER_UNLIKELY(!res.success))");
             {
                 auto scope3 = CodeScope(block);
+                block.add_line(count("", "0", "false"));
                 block.add_line("return res;");
             }
             block.add_line("const std::size_t content_length = res.length;");
             block.add_line("res = wrap_with_ber_header(output, content_length, Identifier_{}, header_length_guess);");
+            block.add_line(count("", "res.length", "res.success"));
             block.add_line("return res;");
         }
         block.add_line("else");
         {
             auto scope2 = CodeScope(block);
+            block.add_line(count("", "res.length", "res.success"));
+            block.add_line("return res;");
+        }
+    }
+
+    block.add_line();
+
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("inline EncodeResult " + name +
+                   "::encode_reverse_with_id(absl::Span<uint8_t> output) const noexcept");
+    {
+        auto scope1 = CodeScope(block);
+        block.add_line(declare_counter("encode", name));
+        block.add_line(declare_latency("encode", name));
+        block.add_line("EncodeResult res;");
+        block.add_line("switch (this->index())");
+        {
+            auto scope2 = CodeScope(block);
+            for (std::size_t i = 0; i < choice.choices.size(); i++)
+            {
+                block.add_line("case " + std::to_string(i) + ":");
+                block.add_line("	res = fast_ber::get<" + std::to_string(i) + ">(*this)." +
+                               make_component_function("encode_reverse", choice.choices[i], module, tree) +
+                               "(output);");
+                block.add_line("	" + declare_counter("encode", name, choice.choices[i].name));
+                block.add_line("	" + count(choice.choices[i].name, "res.length", "res.success"));
+                block.add_line("	break;");
+            }
+            block.add_line("default: assert(0);");
+        }
+
+        block.add_line("if (!IsChoiceId<Identifier_>::value)");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("if (FAST_BER_UNLIKELY(!res.success))");
+            {
+                auto scope3 = CodeScope(block);
+                block.add_line(count("", "0", "false"));
+                block.add_line("return res;");
+            }
+            block.add_line("return FAST_BER_COUNT_ENCODED(fast_ber_counter, prepend_ber_header(output, res.length, "
+                           "Identifier_{}));");
+        }
+        block.add_line("else");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line(count("", "res.length", "res.success"));
             block.add_line("return res;");
         }
     }
@@ -174,10 +361,168 @@ CodeBlock create_choice_encode_functions(const std::string& name, const ChoiceTy
         }
     }
 
+    block.add_line();
+
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("inline std::size_t " + name + "::encoded_length_with_id(EncodePlan& plan) const");
+    {
+        auto scope1 = CodeScope(block);
+        block.add_line("std::size_t entry          = 0;");
+        block.add_line("std::size_t content_length = 0;");
+        block.add_line("if (!IsChoiceId<Identifier_>::value)");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("entry = plan.add_entry();");
+        }
+        block.add_line("switch (this->index())");
+        {
+            auto scope2 = CodeScope(block);
+            for (std::size_t i = 0; i < choice.choices.size(); i++)
+            {
+                block.add_line("case " + std::to_string(i) + ":");
+                block.add_line("	content_length = fast_ber::get<" + std::to_string(i) + ">(*this)." +
+                               make_component_function("encoded_length", choice.choices[i], module, tree) +
+                               "(plan);");
+                block.add_line("	break;");
+            }
+            block.add_line("default: assert(0);");
+        }
+
+        block.add_line("if (!IsChoiceId<Identifier_>::value)");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("plan.set_entry(entry, content_length);");
+            block.add_line("return fast_ber::encoded_length(content_length, Identifier_{});");
+        }
+        block.add_line("else");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("return content_length;");
+        }
+    }
+
+    block.add_line();
+
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("inline EncodeResult " + name +
+                   "::encode_with_id(absl::Span<uint8_t> output, EncodePlan& plan) const noexcept");
+    {
+        auto scope1 = CodeScope(block);
+        block.add_line(declare_counter("encode", name));
+        block.add_line(declare_latency("encode", name));
+        block.add_line("EncodeResult res;");
+        block.add_line("auto content = output;");
+        block.add_line("std::size_t header_length = 0;");
+        block.add_line("if (!IsChoiceId<Identifier_>::value)");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("std::size_t content_length = 0;");
+            block.add_line("header_length = plan.next_entry(content_length)");
+            block.add_line("    ? encode_planned_header(output, content_length, Identifier_{}) : 0;");
+            block.add_line("if (FAST_BER_UNLIKELY(header_length == 0))");
+            {
+                auto scope3 = CodeScope(block);
+                block.add_line(count("", "0", "false"));
+                block.add_line("return EncodeResult{false, 0};");
+            }
+            block.add_line("content.remove_prefix(header_length);");
+        }
+
+        block.add_line("switch (this->index())");
+        {
+            auto scope2 = CodeScope(block);
+            for (std::size_t i = 0; i < choice.choices.size(); i++)
+            {
+                block.add_line("case " + std::to_string(i) + ":");
+                block.add_line("	res = fast_ber::get<" + std::to_string(i) + ">(*this)." +
+                               make_component_function("encode", choice.choices[i], module, tree) +
+                               "(content, plan);");
+                block.add_line("	" + declare_counter("encode", name, choice.choices[i].name));
+                block.add_line("	" + count(choice.choices[i].name, "res.length", "res.success"));
+                block.add_line("	break;");
+            }
+            block.add_line("default: assert(0);");
+        }
+
+        block.add_line("if (FAST_BER_UNLIKELY(!res.success))");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line(count("", "0", "false"));
+            block.add_line("return res;");
+        }
+        block.add_line(count("", "header_length + res.length", "true"));
+        block.add_line("return EncodeResult{true, header_length + res.length};");
+    }
+
     block.add_line();
     return block;
 }
 
+// Statement leaving a member which was not selected by a projected decode empty, or set to its default value
+std::string skipped_member_reset(const ComponentType& component)
+{
+    if (component.is_optional)
+    {
+        return "this->" + component.named_type.name + " = fast_ber::empty;";
+    }
+    if (component.default_value)
+    {
+        return "this->" + component.named_type.name + ".set_to_default();";
+    }
+    return "fast_ber::reset_member(this->" + component.named_type.name + ");";
+}
+
+// Decode the member at the iterator if it is selected, otherwise only its header is checked before it is skipped
+void add_member_decode(CodeBlock& block, const ComponentType& component, const std::string& name,
+                       const Module& module, const Asn1Tree& tree, bool check_present)
+{
+    block.add_line("if (fields.test(Field::" + component.named_type.name + "))");
+    {
+        auto scope = CodeScope(block);
+        block.add_line("res = this->" + component.named_type.name + "." +
+                       make_component_function("decode", component.named_type, module, tree) + "(*iterator);");
+        block.add_line(declare_counter("decode", name, component.named_type.name));
+        block.add_line(count(component.named_type.name, "iterator->ber_length()", "res.success"));
+        block.add_line("if (FAST_BER_UNLIKELY(!res.success))");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::member_failed, ")" + name + R"(", ")" +
+                           component.named_type.name + R"(");)");
+            block.add_line(count("", "input.ber_length()", "false"));
+            block.add_line("return res;");
+        }
+    }
+    block.add_line("else");
+    {
+        auto scope = CodeScope(block);
+        if (check_present)
+        {
+            // The element must be the member, as checked by its decode when the member is selected. Types without
+            // an outer identifier, such as ANY, match any element.
+            const std::vector<Identifier>& ids      = outer_identifiers(component.named_type.type, module, tree);
+            std::string                    id_check = "if (FAST_BER_UNLIKELY(!iterator->is_valid()";
+            if (!ids.empty())
+            {
+                id_check += " || !(false";
+                for (const Identifier& id : ids)
+                {
+                    id_check += " || " + id.name() + "::check_id_match(iterator->class_(), iterator->tag())";
+                }
+                id_check += ")";
+            }
+            block.add_line(id_check + "))");
+            {
+                auto scope2 = CodeScope(block);
+                block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::invalid_member, ")" + name + R"(", ")" +
+                               component.named_type.name + R"(");)");
+                block.add_line(count("", "input.ber_length()", "false"));
+                block.add_line("return DecodeResult{false};");
+            }
+        }
+        block.add_line(skipped_member_reset(component));
+    }
+}
+
 template <typename CollectionType>
 CodeBlock create_collection_decode_functions(const std::string& name, const CollectionType& collection,
                                              const Module& module, const Asn1Tree& tree)
@@ -187,18 +532,33 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
     block.add_line("DecodeResult " + name + "::decode_with_id(BerView input) noexcept");
     {
         auto scope = CodeScope(block);
-        block.add_line("if (!input.is_valid())");
+        block.add_line("return decode_with_id<Identifier_>(input, ::fast_ber::AllFields{});");
+    }
+    block.add_line();
+
+    // Members which are not selected are skipped. A full decode selects AllFields, which removes the checks.
+    block.add_line(create_template_definition({"Identifier_", "Fields_"}));
+    block.add_line("DecodeResult " + name + "::decode_with_id(BerView input, const Fields_& fields) noexcept");
+    {
+        auto scope = CodeScope(block);
+        if (collection.components.empty())
+        {
+            block.add_line("(void)fields;");
+        }
+        block.add_line(declare_counter("decode", name));
+        block.add_line(declare_latency("decode", name));
+        block.add_line("if (FAST_BER_UNLIKELY(!input.is_valid()))");
         {
             auto scope2 = CodeScope(block);
-            block.add_line(R"(FAST_BER_ERROR("Invalid packet when decoding collection [)" + name + R"(]");)");
+            block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::invalid_packet, ")" + name + R"(");)");
+            block.add_line(count("", "0", "false"));
             block.add_line("return DecodeResult{false};");
         }
-        block.add_line("if (!has_correct_header(input, Identifier_{}, Construction::constructed))");
+        block.add_line("if (FAST_BER_UNLIKELY(!has_correct_header(input, Identifier_{}, Construction::constructed)))");
         {
             auto scope2 = CodeScope(block);
-            block.add_line(
-                R"(FAST_BER_ERROR("Invalid identifier [", input.identifier(), "] when decoding collection [)" + name +
-                R"(]");)");
+            block.add_line(R"(FAST_BER_ERROR(input, ")" + name + R"(");)");
+            block.add_line(count("", "input.ber_length()", "false"));
             block.add_line("return DecodeResult{false};");
         }
 
@@ -230,19 +590,7 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
                             for (const ComponentType& component : collection.components)
                             {
                                 block.add_line("case " + std::to_string(i) + ":");
-                                block.add_line("res = this->" + component.named_type.name + "." +
-                                               make_component_function("decode", component.named_type, module, tree) +
-                                               "(*iterator);");
-                                block.add_line("if (!res.success)");
-                                {
-                                    auto scope5 = CodeScope(block);
-                                    {
-                                        block.add_line(R"(FAST_BER_ERROR("failed to decode member [)" +
-                                                       component.named_type.name + R"(] of collection [)" + name +
-                                                       R"(]");)");
-                                        block.add_line("return res;");
-                                    }
-                                }
+                                add_member_decode(block, component, name, module, tree, false);
                                 block.add_line("++decode_counts[" + std::to_string(i) + "];");
                                 block.add_line("++iterator;");
                                 block.add_line("continue;");
@@ -284,21 +632,7 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
                                             if (id.class_ == class_)
                                             {
                                                 block.add_line("case " + std::to_string(id.tag_number) + ":");
-                                                block.add_line("res = this->" + component.named_type.name + "." +
-                                                               make_component_function("decode", component.named_type,
-                                                                                       module, tree) +
-                                                               "(*iterator);");
-
-                                                block.add_line("if (!res.success)");
-                                                {
-                                                    auto scope5 = CodeScope(block);
-                                                    {
-                                                        block.add_line(R"(FAST_BER_ERROR("failed to decode member [)" +
-                                                                       component.named_type.name +
-                                                                       R"(] of collection [)" + name + R"(]");)");
-                                                        block.add_line("return res;");
-                                                    }
-                                                }
+                                                add_member_decode(block, component, name, module, tree, false);
                                                 block.add_line("++decode_counts[" + std::to_string(i) + "];");
                                                 block.add_line("++iterator;");
                                                 block.add_line("continue;");
@@ -312,8 +646,9 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
                     }
                     if (!collection.allow_extensions)
                     {
-                        block.add_line(R"(FAST_BER_ERROR("Invalid ID when decoding set [)" + name +
-                                       R"(] [", iterator->identifier(), "]");)");
+                        block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::unexpected_member, ")" + name +
+                                       R"(", iterator->identifier());)");
+                        block.add_line(count("", "input.ber_length()", "false"));
                         block.add_line("return fast_ber::DecodeResult{false};");
                     }
                     else
@@ -325,7 +660,10 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
                 for (const ComponentType& component : collection.components)
                 {
 
-                    block.add_line("if (decode_counts[" + std::to_string(i) + "] == 0)");
+                    // A missing mandatory member is a failure, missing optional members are expected
+                    const std::string missing  = "decode_counts[" + std::to_string(i) + "] == 0";
+                    const bool        required = !component.is_optional && !component.default_value;
+                    block.add_line("if (" + (required ? "FAST_BER_UNLIKELY(" + missing + ")" : missing) + ")");
                     {
                         auto scope3 = CodeScope(block);
 
@@ -339,16 +677,18 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
                         }
                         else
                         {
-                            block.add_line(R"(FAST_BER_ERROR("Missing non-optional member [)" +
-                                           component.named_type.name + R"(] of set [)" + name + R"(]");)");
+                            block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::missing_member, ")" +
+                                           name + R"(", ")" + component.named_type.name + R"(");)");
+                            block.add_line(count("", "input.ber_length()", "false"));
                             block.add_line("return fast_ber::DecodeResult{false};");
                         }
                     }
-                    block.add_line("if (decode_counts[" + std::to_string(i) + "] > 1)");
+                    block.add_line("if (FAST_BER_UNLIKELY(decode_counts[" + std::to_string(i) + "] > 1))");
                     {
                         auto scope3 = CodeScope(block);
-                        block.add_line(R"(FAST_BER_ERROR("Member [)" + component.named_type.name +
-                                       R"(] present multiple times in set [)" + name + R"(]");)");
+                        block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::duplicate_member, ")" + name + R"(", ")" +
+                                       component.named_type.name + R"(");)");
+                        block.add_line(count("", "input.ber_length()", "false"));
                         block.add_line("return fast_ber::DecodeResult{false};");
                     }
                     i++;
@@ -370,21 +710,7 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
 
                         {
                             auto scope2 = CodeScope(block);
-                            block.add_line("res = this->" + component.named_type.name + "." +
-                                           make_component_function("decode", component.named_type, module, tree) +
-                                           "(*iterator);");
-
-                            block.add_line("if (!res.success)");
-                            {
-                                auto scope3 = CodeScope(block);
-                                {
-                                    block.add_line(R"(FAST_BER_ERROR("failed to decode member [)" +
-                                                   component.named_type.name + R"(] of collection [)" + name +
-                                                   R"(]");)");
-
-                                    block.add_line("return res;");
-                                }
-                            }
+                            add_member_decode(block, component, name, module, tree, false);
                             block.add_line("++iterator;");
                         }
                         block.add_line("else");
@@ -402,28 +728,32 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
                     }
                     else
                     {
-                        block.add_line("res = this->" + component.named_type.name + "." +
-                                       make_component_function("decode", component.named_type, module, tree) +
-                                       "(*iterator);");
-
-                        block.add_line("if (!res.success)");
-                        {
-                            auto scope2 = CodeScope(block);
-                            block.add_line(R"(FAST_BER_ERROR("failed to decode member [)" + component.named_type.name +
-                                           R"(] of collection [)" + name + R"(]");)");
-                            block.add_line("return res;");
-                        }
+                        add_member_decode(block, component, name, module, tree, true);
                         block.add_line("++iterator;");
                     }
                 }
             }
         }
+        block.add_line(count("", "input.ber_length()", "true"));
         block.add_line("return DecodeResult{true};");
     }
 
     return block;
 }
 
+// Decode the alternative of a choice matching the contents, counted both as the alternative and as the choice.
+// Counters of the alternatives are declared at the top of decode_with_id
+void add_alternative_decode(CodeBlock& block, const ChoiceType& choice, std::size_t index, const Module& module,
+                            const Asn1Tree& tree)
+{
+    const NamedType& alternative = choice.choices[index];
+
+    block.add_line("return FAST_BER_COUNT_DECODED(fast_ber_counter, input.ber_length(), "
+                   "FAST_BER_COUNT_DECODED(fast_ber_counter_" + alternative.name + ", content.ber_length(), "
+                   "this->template reuse_or_emplace<" + std::to_string(index) + ">()." +
+                   make_component_function("decode", alternative, module, tree) + "(content)));");
+}
+
 CodeBlock create_choice_decode_functions(const std::string& name, const ChoiceType& choice, const Module& module,
                                          const Asn1Tree& tree)
 {
@@ -433,32 +763,40 @@ CodeBlock create_choice_decode_functions(const std::string& name, const ChoiceTy
     block.add_line("inline DecodeResult " + name + "::decode_with_id(BerView input) noexcept");
     {
         auto scope1 = CodeScope(block);
+        block.add_line(declare_counter("decode", name));
+        block.add_line(declare_latency("decode", name));
+        // Declared once, as an alternative may be matched by several case labels
+        for (const NamedType& alternative : choice.choices)
+        {
+            block.add_line(declare_counter("decode", name, alternative.name));
+        }
         block.add_line("BerView content(input);");
         block.add_line("if (!IsChoiceId<Identifier>::value)");
         {
             auto scope2 = CodeScope(block);
-            block.add_line("if (!input.is_valid())");
+            block.add_line("if (FAST_BER_UNLIKELY(!input.is_valid()))");
             {
                 auto scope3 = CodeScope(block);
-                block.add_line(R"(FAST_BER_ERROR("Invalid packet when decoding choice [)" + name + R"(]");)");
+                block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::invalid_packet, ")" + name + R"(");)");
+                block.add_line(count("", "0", "false"));
                 block.add_line("return DecodeResult{false};");
             }
-            block.add_line("if (!has_correct_header(input, Identifier{}, Construction::constructed))");
+            block.add_line(
+                "if (FAST_BER_UNLIKELY(!has_correct_header(input, Identifier{}, Construction::constructed)))");
             {
                 auto scope3 = CodeScope(block);
-                block.add_line(
-                    R"(FAST_BER_ERROR("Invalid header when decoding choice type [", input.identifier(), "] in choice [)" +
-                    name + R"(]");)");
+                block.add_line(R"(FAST_BER_ERROR(input, ")" + name + R"(");)");
+                block.add_line(count("", "input.ber_length()", "false"));
                 block.add_line("return DecodeResult{false};");
             }
 
             block.add_line(
                 "BerViewIterator child = (Identifier::depth() == 1) ? input.begin() : input.begin()->begin();");
-            block.add_line("if (!child->is_valid())");
+            block.add_line("if (FAST_BER_UNLIKELY(!child->is_valid()))");
             {
                 auto scope3 = CodeScope(block);
-                block.add_line(R"(FAST_BER_ERROR("Invalid child packet when decoding choice [)" + name + R"(]");)");
-
+                block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::invalid_packet, ")" + name + R"(");)");
+                block.add_line(count("", "input.ber_length()", "false"));
                 block.add_line("return DecodeResult{false};");
             }
             block.add_line("content = *child;");
@@ -472,8 +810,7 @@ CodeBlock create_choice_decode_functions(const std::string& name, const ChoiceTy
                 for (std::size_t i = 0; i < choice.choices.size(); i++)
                 {
                     block.add_line("case " + std::to_string(i) + ":");
-                    block.add_line("	return this->template emplace<" + std::to_string(i) + ">()." +
-                                   make_component_function("decode", choice.choices[i], module, tree) + "(content);");
+                    add_alternative_decode(block, choice, i, module, tree);
                 }
             }
         }
@@ -501,9 +838,7 @@ CodeBlock create_choice_decode_functions(const std::string& name, const ChoiceTy
                             if (id.class_ == class_)
                             {
                                 block.add_line("case " + std::to_string(id.tag_number) + ":");
-                                block.add_line("	return this->template emplace<" + std::to_string(i) + ">()." +
-                                               make_component_function("decode", choice.choices[i], module, tree) +
-                                               "(content);");
+                                add_alternative_decode(block, choice, i, module, tree);
                             }
                         }
                         i++;
@@ -511,7 +846,9 @@ CodeBlock create_choice_decode_functions(const std::string& name, const ChoiceTy
                 }
             }
         }
-        block.add_line(R"(FAST_BER_ERROR("Unknown tag [", content.identifier(), "] in choice [)" + name + R"(]");)");
+        block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::unknown_choice, ")" +
+                       name + R"(", content.identifier());)");
+        block.add_line(count("", "input.ber_length()", "false"));
         block.add_line("return DecodeResult{false};");
     }
 
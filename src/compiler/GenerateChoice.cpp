@@ -124,6 +124,14 @@ CodeBlock create_choice_definition(const ChoiceType& choice, const Module& modul
                 block.add_line("return m_storage.emplace<i>(std::forward<Args>(args)...);");
             }
         }
+        block.add_line("template <std::size_t i>");
+        block.add_line("ToType<i>& reuse_or_emplace()");
+        {
+            CodeScope scope2(block);
+            {
+                block.add_line("return m_storage.reuse_or_emplace<i>();");
+            }
+        }
         block.add_line();
 
         // Index
@@ -135,6 +143,12 @@ CodeBlock create_choice_definition(const ChoiceType& choice, const Module& modul
         block.add_line(create_template_definition({"Identifier"}));
         block.add_line("EncodeResult encode_with_id(absl::Span<uint8_t> output) const noexcept;");
         block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("EncodeResult encode_reverse_with_id(absl::Span<uint8_t> output) const noexcept;");
+        block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("std::size_t encoded_length_with_id(EncodePlan& plan) const;");
+        block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("EncodeResult encode_with_id(absl::Span<uint8_t> output, EncodePlan& plan) const noexcept;");
+        block.add_line(create_template_definition({"Identifier"}));
         block.add_line("DecodeResult decode_with_id(BerView output) noexcept;");
         block.add_line();
 
@@ -142,12 +156,19 @@ CodeBlock create_choice_definition(const ChoiceType& choice, const Module& modul
         block.add_line("{ return encoded_length_with_id<" + id + ">(); }");
         block.add_line("EncodeResult encode(absl::Span<uint8_t> output) const noexcept");
         block.add_line("{ return encode_with_id<" + id + ">(output); }");
+        block.add_line("EncodeResult encode_reverse(absl::Span<uint8_t> output) const noexcept");
+        block.add_line("{ return encode_reverse_with_id<" + id + ">(output); }");
+        block.add_line("std::size_t encoded_length(EncodePlan& plan) const");
+        block.add_line("{ return encoded_length_with_id<" + id + ">(plan); }");
+        block.add_line("EncodeResult encode(absl::Span<uint8_t> output, EncodePlan& plan) const noexcept");
+        block.add_line("{ return encode_with_id<" + id + ">(output, plan); }");
         block.add_line("DecodeResult decode(BerView input) noexcept");
         block.add_line("{ return decode_with_id<" + id + ">(input); }");
         block.add_line();
 
         // ID
         block.add_line("using AsnId = " + id + ";");
+        block.add_line("class View;");
         block.add_line();
 
         // Impl Helper
@@ -0,0 +1,462 @@
+#include "fast_ber/compiler/GenerateView.hpp"
+
+#include "fast_ber/compiler/CppGeneration.hpp"
+#include "fast_ber/compiler/Identifier.hpp"
+#include "fast_ber/compiler/ResolveType.hpp"
+#include "fast_ber/compiler/Visit.hpp"
+
+#include <string>
+#include <vector>
+
+struct ViewMember
+{
+    std::string             name;
+    std::string             type;       // Type alias within the generated type
+    std::string             identifier; // Identifier the member is encoded with
+    std::vector<Identifier> outer_ids;
+    bool                    is_optional; // May be absent, OPTIONAL members and alternatives of a choice
+    bool                    has_default; // Read as the default value when absent
+};
+
+// Matches the identifiers used by the generated decode functions
+std::string view_member_identifier(const NamedType& named_type, const std::string& type, const Module& module,
+                                   const Asn1Tree& tree)
+{
+    if (is_generated(resolve_type(tree, module.module_reference, named_type).type))
+    {
+        auto id = identifier(named_type.type, module, tree);
+        if (!id.is_default_tagged)
+            return id.name();
+    }
+    return "fast_ber::Identifier<" + type + ">";
+}
+
+std::string unqualified_name(const std::string& name)
+{
+    const std::size_t found = name.rfind("::");
+    return (found == std::string::npos) ? name : name.substr(found + 2);
+}
+
+template <typename CollectionType>
+std::vector<ViewMember> view_members(const CollectionType& collection, const std::string& name, const Module& module,
+                                     const Asn1Tree& tree)
+{
+    std::vector<ViewMember> members;
+    for (const ComponentType& component : collection.components)
+    {
+        const std::string type = make_type_name(component.named_type.name, unqualified_name(name));
+        members.push_back(ViewMember{component.named_type.name, type,
+                                     view_member_identifier(component.named_type, type, module, tree),
+                                     outer_identifiers(component.named_type.type, module, tree),
+                                     component.is_optional || component.default_value,
+                                     static_cast<bool>(component.default_value)});
+    }
+    return members;
+}
+
+std::vector<ViewMember> view_members(const ChoiceType& choice, const Module& module, const Asn1Tree& tree)
+{
+    std::vector<ViewMember> members;
+    for (const NamedType& named_type : choice.choices)
+    {
+        const std::string type = make_type_name(named_type.name);
+        members.push_back(ViewMember{named_type.name, type, view_member_identifier(named_type, type, module, tree),
+                                     outer_identifiers(named_type.type, module, tree), true, false});
+    }
+    return members;
+}
+
+std::string view_accessor_type(const ViewMember& member, const std::string& scope)
+{
+    const std::string type = "ViewType<" + scope + member.type + ">";
+    return (member.is_optional && !member.has_default) ? "absl::optional<" + type + ">" : type;
+}
+
+// DEFAULT accessors encode the default on first use, which may throw
+std::string view_accessor_specifier(const ViewMember& member)
+{
+    return member.has_default ? "() const" : "() const noexcept";
+}
+
+std::string view_id_check(const ViewMember& member, const std::string& accessor)
+{
+    std::string id_check = "false";
+    for (const Identifier& id : member.outer_ids)
+    {
+        id_check += " || " + id.name() + "::check_id_match(" + accessor + "class_(), " + accessor + "tag())";
+    }
+    return id_check;
+}
+
+void add_view_member_validation(CodeBlock& block, const ViewMember& member, const std::string& element,
+                                const std::string& name)
+{
+    block.add_line("if (FAST_BER_UNLIKELY(!ViewTraits<" + member.type + ">::template validate<" + member.identifier +
+                   ">(" + element + ")))");
+    {
+        auto scope = CodeScope(block);
+        block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::invalid_member, ")" +
+                       name + R"(", ")" + member.name + R"(");)");
+        block.add_line("return false;");
+    }
+}
+
+void add_view_input_validation(CodeBlock& block, const std::string& name)
+{
+    block.add_line("if (FAST_BER_UNLIKELY(!input.is_valid()))");
+    {
+        auto scope = CodeScope(block);
+        block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::invalid_packet, ")" + name + R"(");)");
+        block.add_line("return false;");
+    }
+}
+
+void add_view_header_validation(CodeBlock& block, const std::string& name)
+{
+    block.add_line("if (FAST_BER_UNLIKELY(!has_correct_header(input, Identifier_{}, Construction::constructed)))");
+    {
+        auto scope = CodeScope(block);
+        block.add_line(R"(FAST_BER_ERROR(input, ")" + name + R"(");)");
+        block.add_line("return false;");
+    }
+}
+
+CodeBlock create_view_class(const std::string& name, const std::vector<ViewMember>& members, bool is_choice)
+{
+    CodeBlock block;
+    block.add_line("class " + name + "::View");
+    {
+        CodeScope scope(block, true);
+        block.add_line("public:");
+        block.add_line("View() noexcept = default;");
+        block.add_line("explicit View(BerView input) noexcept { assign(input); }");
+        block.add_line("explicit View(absl::Span<const uint8_t> input) noexcept { assign(BerView(input)); }");
+        block.add_line();
+        block.add_line(create_template_definition({"Identifier_"}));
+        block.add_line("bool assign_with_id(BerView input) noexcept;");
+        block.add_line("bool assign(BerView input) noexcept { return assign_with_id<AsnId>(input); }");
+        block.add_line("bool assign(absl::Span<const uint8_t> input) noexcept { return assign(BerView(input)); }");
+        block.add_line();
+        if (is_choice)
+        {
+            block.add_line("bool is_valid() const noexcept { return m_value.is_valid(); }");
+            block.add_line("std::size_t index() const noexcept { return m_index; }");
+        }
+        else
+        {
+            block.add_line("bool is_valid() const noexcept { return m_ber.is_valid(); }");
+        }
+        block.add_line("BerView ber() const noexcept { return m_ber; }");
+        block.add_line();
+
+        for (const ViewMember& member : members)
+        {
+            block.add_line(view_accessor_type(member, "") + " " + member.name + view_accessor_specifier(member) + ";");
+        }
+        if (!members.empty())
+        {
+            block.add_line();
+        }
+
+        block.add_line("private:");
+        block.add_line("BerView m_ber;");
+        if (is_choice)
+        {
+            block.add_line("BerView m_value;");
+            block.add_line("std::size_t m_index = 0;");
+        }
+        else
+        {
+            block.add_line("std::array<BerView, " + std::to_string(members.size()) + "> m_members;");
+        }
+    }
+    block.add_line();
+    return block;
+}
+
+template <typename CollectionType>
+CodeBlock create_collection_view_functions(const std::string& name, const CollectionType& collection,
+                                           const Module& module, const Asn1Tree& tree)
+{
+    const std::vector<ViewMember> members = view_members(collection, name, module, tree);
+
+    CodeBlock block;
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("bool " + name + "::View::assign_with_id(BerView input) noexcept");
+    {
+        auto scope = CodeScope(block);
+        block.add_line("m_ber     = BerView();");
+        block.add_line("m_members = {};");
+        add_view_input_validation(block, name);
+        add_view_header_validation(block, name);
+
+        if (!members.empty() && std::is_same<CollectionType, SetType>::value)
+        {
+            // Members of a set may be in any order, each is found by its identifier
+            block.add_line("const BerView content = (Identifier_::depth() == 1) ? input : *input.begin();");
+            block.add_line("for (const BerView& child : content)");
+            {
+                auto        scope2 = CodeScope(block);
+                std::size_t i      = 0;
+                for (const ViewMember& member : members)
+                {
+                    if (module.tagging_default == TaggingMode::automatic)
+                    {
+                        block.add_line("if (child.class_() == " + to_string(Class::context_specific) +
+                                       " && child.tag() == " + std::to_string(i) + ")");
+                    }
+                    else
+                    {
+                        block.add_line("if (" + view_id_check(member, "child.") + ")");
+                    }
+                    {
+                        auto scope3 = CodeScope(block);
+                        block.add_line("if (FAST_BER_UNLIKELY(m_members[" + std::to_string(i) + "].is_valid()))");
+                        {
+                            auto scope4 = CodeScope(block);
+                            block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::duplicate_member, ")" +
+                                           name + R"(", ")" + member.name + R"(");)");
+                            block.add_line("return false;");
+                        }
+                        add_view_member_validation(block, member, "child", name);
+                        block.add_line("m_members[" + std::to_string(i) + "] = child;");
+                        block.add_line("continue;");
+                    }
+                    i++;
+                }
+                if (!collection.allow_extensions)
+                {
+                    block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::unexpected_member, ")" + name +
+                                   R"(", child.identifier());)");
+                    block.add_line("return false;");
+                }
+            }
+
+            std::size_t i = 0;
+            for (const ViewMember& member : members)
+            {
+                if (!member.is_optional)
+                {
+                    block.add_line("if (FAST_BER_UNLIKELY(!m_members[" + std::to_string(i) + "].is_valid()))");
+                    {
+                        auto scope2 = CodeScope(block);
+                        block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::missing_member, ")" + name + R"(", ")" +
+                                       member.name + R"(");)");
+                        block.add_line("return false;");
+                    }
+                }
+                i++;
+            }
+        }
+        else if (!members.empty() || !collection.allow_extensions)
+        {
+            block.add_line("auto iterator = (Identifier_::depth() == 1) ? input.begin()");
+            block.add_line("                                            : input.begin()->begin();");
+
+            std::size_t i = 0;
+            for (const ViewMember& member : members)
+            {
+                if (member.is_optional)
+                {
+                    block.add_line("if (iterator->is_valid() && (" + view_id_check(member, "iterator->") + "))");
+                    {
+                        auto scope2 = CodeScope(block);
+                        add_view_member_validation(block, member, "*iterator", name);
+                        block.add_line("m_members[" + std::to_string(i) + "] = *iterator;");
+                        block.add_line("++iterator;");
+                    }
+                }
+                else
+                {
+                    add_view_member_validation(block, member, "*iterator", name);
+                    block.add_line("m_members[" + std::to_string(i) + "] = *iterator;");
+                    block.add_line("++iterator;");
+                }
+                i++;
+            }
+            if (!collection.allow_extensions)
+            {
+                block.add_line("if (FAST_BER_UNLIKELY(iterator->is_valid()))");
+                {
+                    auto scope2 = CodeScope(block);
+                    block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::unexpected_member, ")" + name +
+                                   R"(", iterator->identifier());)");
+                    block.add_line("return false;");
+                }
+            }
+        }
+        block.add_line("m_ber = input;");
+        block.add_line("return true;");
+    }
+    block.add_line();
+
+    std::size_t i = 0;
+    for (const ViewMember& member : members)
+    {
+        const std::string element = "m_members[" + std::to_string(i) + "]";
+        block.add_line("inline " + view_accessor_type(member, name + "::") + " " + name + "::View::" + member.name +
+                       view_accessor_specifier(member));
+        {
+            auto scope = CodeScope(block);
+            if (member.is_optional)
+            {
+                block.add_line("if (!" + element + ".is_valid())");
+                {
+                    auto scope2 = CodeScope(block);
+                    if (member.has_default)
+                    {
+                        block.add_line("return ViewTraits<decltype(" + name + "::" + member.name +
+                                       ")>::default_value();");
+                    }
+                    else
+                    {
+                        block.add_line("return absl::nullopt;");
+                    }
+                }
+            }
+            block.add_line("return ViewTraits<" + member.type + ">::make<" + member.identifier + ">(" + element +
+                           ");");
+        }
+        block.add_line();
+        i++;
+    }
+    return block;
+}
+
+CodeBlock create_choice_view_functions(const std::string& name, const ChoiceType& choice, const Module& module,
+                                       const Asn1Tree& tree)
+{
+    const std::vector<ViewMember> members = view_members(choice, module, tree);
+
+    CodeBlock block;
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("bool " + name + "::View::assign_with_id(BerView input) noexcept");
+    {
+        auto scope = CodeScope(block);
+        block.add_line("m_ber   = BerView();");
+        block.add_line("m_value = BerView();");
+        block.add_line("m_index = 0;");
+        add_view_input_validation(block, name);
+        block.add_line("BerView content = input;");
+        block.add_line("if (!IsChoiceId<Identifier_>::value)");
+        {
+            auto scope2 = CodeScope(block);
+            add_view_header_validation(block, name);
+            block.add_line("content = (Identifier_::depth() == 1) ? *input.begin() : *input.begin()->begin();");
+            block.add_line("if (FAST_BER_UNLIKELY(!content.is_valid()))");
+            {
+                auto scope3 = CodeScope(block);
+                block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::invalid_packet, ")" + name + R"(");)");
+                block.add_line("return false;");
+            }
+        }
+
+        std::size_t i = 0;
+        for (const ViewMember& member : members)
+        {
+            if (module.tagging_default == TaggingMode::automatic)
+            {
+                block.add_line("if (content.class_() == " + to_string(Class::context_specific) +
+                               " && content.tag() == " + std::to_string(i) + ")");
+            }
+            else
+            {
+                block.add_line("if (" + view_id_check(member, "content.") + ")");
+            }
+            {
+                auto scope2 = CodeScope(block);
+                add_view_member_validation(block, member, "content", name);
+                block.add_line("m_ber   = input;");
+                block.add_line("m_value = content;");
+                block.add_line("m_index = " + std::to_string(i) + ";");
+                block.add_line("return true;");
+            }
+            i++;
+        }
+        block.add_line(R"(FAST_BER_ERROR(fast_ber::ErrorCode::unknown_choice, ")" +
+                       name + R"(", content.identifier());)");
+        block.add_line("return false;");
+    }
+    block.add_line();
+
+    std::size_t i = 0;
+    for (const ViewMember& member : members)
+    {
+        block.add_line("inline " + view_accessor_type(member, name + "::") + " " + name + "::View::" + member.name +
+                       "() const noexcept");
+        {
+            auto scope = CodeScope(block);
+            block.add_line("if (!m_value.is_valid() || m_index != " + std::to_string(i) + ")");
+            {
+                auto scope2 = CodeScope(block);
+                block.add_line("return absl::nullopt;");
+            }
+            block.add_line("return ViewTraits<" + member.type + ">::make<" + member.identifier + ">(m_value);");
+        }
+        block.add_line();
+        i++;
+    }
+    return block;
+}
+
+CodeBlock create_view_definitions_impl(const Asn1Tree& tree, const Module& module, const Type& type,
+                                       const std::string& name)
+{
+    if (is_sequence(type))
+    {
+        const SequenceType& sequence = absl::get<SequenceType>(absl::get<BuiltinType>(type));
+        return create_view_class(name, view_members(sequence, name, module, tree), false);
+    }
+    else if (is_set(type))
+    {
+        const SetType& set = absl::get<SetType>(absl::get<BuiltinType>(type));
+        return create_view_class(name, view_members(set, name, module, tree), false);
+    }
+    else if (is_choice(type))
+    {
+        const ChoiceType& choice = absl::get<ChoiceType>(absl::get<BuiltinType>(type));
+        return create_view_class(name, view_members(choice, module, tree), true);
+    }
+    return {};
+}
+
+CodeBlock create_view_functions_impl(const Asn1Tree& tree, const Module& module, const Type& type,
+                                     const std::string& name)
+{
+    if (is_sequence(type))
+    {
+        const SequenceType& sequence = absl::get<SequenceType>(absl::get<BuiltinType>(type));
+        return create_collection_view_functions(name, sequence, module, tree);
+    }
+    else if (is_set(type))
+    {
+        const SetType& set = absl::get<SetType>(absl::get<BuiltinType>(type));
+        return create_collection_view_functions(name, set, module, tree);
+    }
+    else if (is_choice(type))
+    {
+        const ChoiceType& choice = absl::get<ChoiceType>(absl::get<BuiltinType>(type));
+        return create_choice_view_functions(name, choice, module, tree);
+    }
+    return {};
+}
+
+std::string create_view_definitions(const Assignment& assignment, const Module& module, const Asn1Tree& tree)
+{
+    if (absl::holds_alternative<TypeAssignment>(assignment.specific))
+    {
+        return visit_all_types(tree, module, assignment, create_view_definitions_impl).to_string();
+    }
+
+    return "";
+}
+
+std::string create_view_functions(const Assignment& assignment, const Module& module, const Asn1Tree& tree)
+{
+    if (absl::holds_alternative<TypeAssignment>(assignment.specific))
+    {
+        return visit_all_types(tree, module, assignment, create_view_functions_impl).to_string();
+    }
+
+    return "";
+}
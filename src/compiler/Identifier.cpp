@@ -31,7 +31,7 @@ TaggingInfo identifier(const BooleanType&, const Module&, const Asn1Tree&)
 }
 TaggingInfo identifier(const CharacterStringType& type, const Module&, const Asn1Tree&)
 {
-    return TaggingInfo{{}, Identifier(universal_tag(type)), {}, true};
+    return TaggingInfo{{}, Identifier(universal_tag(type.kind)), {}, true};
 }
 TaggingInfo identifier(const ChoiceType& choice, const Module& module, const Asn1Tree& tree)
 {
@@ -266,7 +266,7 @@ std::vector<Identifier> outer_identifiers(const BooleanType&, const Module&, con
 }
 std::vector<Identifier> outer_identifiers(const CharacterStringType& type, const Module&, const Asn1Tree&)
 {
-    return {Identifier(universal_tag(type))};
+    return {Identifier(universal_tag(type.kind))};
 }
 std::vector<Identifier> outer_identifiers(const ChoiceType& choice, const Module& module, const Asn1Tree& tree)
 {
@@ -353,6 +353,195 @@ std::vector<Assignment> reorder_assignments(std::vector<Assignment>& assignments
     return ordered_assignments;
 }
 
+// Calls visitor with a type and each type nested within it, outer types first
+template <typename Visitor>
+void visit_nested_types(Type& type, Visitor& visitor)
+{
+    visitor(type);
+
+    if (is_set(type) || is_sequence(type))
+    {
+        std::vector<ComponentType>& components =
+            is_set(type) ? absl::get<SetType>(absl::get<BuiltinType>(type)).components
+                         : absl::get<SequenceType>(absl::get<BuiltinType>(type)).components;
+        for (ComponentType& component : components)
+        {
+            visit_nested_types(component.named_type.type, visitor);
+        }
+    }
+    else if (is_set_of(type) || is_sequence_of(type))
+    {
+        SequenceOfType& sequence_of = is_set_of(type) ? absl::get<SetOfType>(absl::get<BuiltinType>(type))
+                                                      : absl::get<SequenceOfType>(absl::get<BuiltinType>(type));
+        visit_nested_types(sequence_of.has_name ? sequence_of.named_type->type : *sequence_of.type, visitor);
+    }
+    else if (is_choice(type))
+    {
+        for (NamedType& choice_selection : absl::get<ChoiceType>(absl::get<BuiltinType>(type)).choices)
+        {
+            visit_nested_types(choice_selection.type, visitor);
+        }
+    }
+    else if (is_prefixed(type))
+    {
+        visit_nested_types(absl::get<PrefixedType>(absl::get<BuiltinType>(type)).tagged_type->type, visitor);
+    }
+}
+
+template <typename Visitor>
+void visit_nested_types(Asn1Tree& tree, Visitor& visitor)
+{
+    for (Module& module : tree.modules)
+    {
+        for (Assignment& assignment : module.assignments)
+        {
+            if (is_type(assignment))
+            {
+                visit_nested_types(type(assignment), visitor);
+            }
+        }
+    }
+}
+
+void use_arena_storage(Asn1Tree& tree)
+{
+    auto visitor = [](Type& type) {
+        if (is_set(type) || is_sequence(type))
+        {
+            std::vector<ComponentType>& components =
+                is_set(type) ? absl::get<SetType>(absl::get<BuiltinType>(type)).components
+                             : absl::get<SequenceType>(absl::get<BuiltinType>(type)).components;
+            for (ComponentType& component : components)
+            {
+                // Optional members are only moved from static storage when they must be allocated
+                if (component.is_optional && component.optional_storage == StorageMode::dynamic)
+                {
+                    component.optional_storage = StorageMode::arena;
+                }
+            }
+        }
+        else if (is_set_of(type))
+        {
+            absl::get<SetOfType>(absl::get<BuiltinType>(type)).storage = StorageMode::arena;
+        }
+        else if (is_sequence_of(type))
+        {
+            absl::get<SequenceOfType>(absl::get<BuiltinType>(type)).storage = StorageMode::arena;
+        }
+        else if (is_choice(type))
+        {
+            ChoiceType& choice = absl::get<ChoiceType>(absl::get<BuiltinType>(type));
+            if (choice.storage == StorageMode::dynamic)
+            {
+                choice.storage = StorageMode::arena;
+            }
+        }
+    };
+    visit_nested_types(tree, visitor);
+}
+
+void use_sparse_optional_storage(Asn1Tree& tree)
+{
+    auto visitor = [](Type& type) {
+        if (is_set(type) || is_sequence(type))
+        {
+            std::vector<ComponentType>& components =
+                is_set(type) ? absl::get<SetType>(absl::get<BuiltinType>(type)).components
+                             : absl::get<SequenceType>(absl::get<BuiltinType>(type)).components;
+            for (ComponentType& component : components)
+            {
+                // Recursive members already have dynamic storage, the size of their type is not yet known
+                if (component.is_optional && component.optional_storage == StorageMode::static_)
+                {
+                    component.optional_storage = StorageMode::sparse;
+                }
+            }
+        }
+    };
+    visit_nested_types(tree, visitor);
+}
+
+// Follows any tags applied to a type
+static Type& untagged(Type& type)
+{
+    return is_prefixed(type) ? untagged(absl::get<PrefixedType>(absl::get<BuiltinType>(type)).tagged_type->type)
+                             : type;
+}
+
+bool set_inlined_size(Asn1Tree& tree, const std::string& name, size_t inlined_size)
+{
+    std::vector<std::string> path;
+    for (size_t start = 0, end = 0; end != std::string::npos; start = end + 1)
+    {
+        end = name.find('.', start);
+        path.push_back(name.substr(start, end == std::string::npos ? std::string::npos : end - start));
+    }
+
+    bool found = false;
+    for (Module& module : tree.modules)
+    {
+        for (Assignment& assignment : module.assignments)
+        {
+            if (!is_type(assignment) || assignment.name != path.front())
+            {
+                continue;
+            }
+
+            Type* current = &untagged(type(assignment));
+            for (size_t i = 1; i < path.size() && current; i++)
+            {
+                Type* member = nullptr;
+                if (is_set(*current) || is_sequence(*current))
+                {
+                    std::vector<ComponentType>& components =
+                        is_set(*current) ? absl::get<SetType>(absl::get<BuiltinType>(*current)).components
+                                         : absl::get<SequenceType>(absl::get<BuiltinType>(*current)).components;
+                    for (ComponentType& component : components)
+                    {
+                        if (component.named_type.name == path[i])
+                        {
+                            member = &untagged(component.named_type.type);
+                        }
+                    }
+                }
+                current = member;
+            }
+
+            if (current && (is_set_of(*current) || is_sequence_of(*current)))
+            {
+                SequenceOfType& sequence_of = is_set_of(*current)
+                                                  ? absl::get<SetOfType>(absl::get<BuiltinType>(*current))
+                                                  : absl::get<SequenceOfType>(absl::get<BuiltinType>(*current));
+                // Recursive lists are held dynamically as their elements are incomplete, arena lists by the arena
+                if (sequence_of.storage != StorageMode::small_buffer_optimised)
+                {
+                    throw std::runtime_error("List " + name + " is held with " + to_string(sequence_of.storage) +
+                                             ", elements can only be held in place with " +
+                                             to_string(StorageMode::small_buffer_optimised));
+                }
+                sequence_of.inlined_size = inlined_size;
+                found                    = true;
+            }
+        }
+    }
+    return found;
+}
+
+void use_native_scalar_storage(Asn1Tree& tree)
+{
+    auto visitor = [](Type& type) {
+        if (is_integer(type))
+        {
+            absl::get<IntegerType>(absl::get<BuiltinType>(type)).storage = ScalarStorage::native;
+        }
+        else if (is_enumerated(type))
+        {
+            absl::get<EnumeratedType>(absl::get<BuiltinType>(type)).storage = ScalarStorage::native;
+        }
+    };
+    visit_nested_types(tree, visitor);
+}
+
 int unnamed_definition_num = 0;
 // Finds any sequence or set types nested within a type
 void find_nested_structs(const Module& module, Type& type, std::vector<NamedType>& nested_structs)
@@ -291,3 +291,41 @@ bool is_a_parameter(const std::string& reference, const std::vector<Parameter>&
 
     return std::find_if(parameters.begin(), parameters.end(), parameter_match) != parameters.end();
 }
+
+absl::optional<int64_t> resolve_bound(const Asn1Tree& tree, const Module& module,
+                                      const absl::optional<ConstraintBound>& bound)
+{
+    if (!bound)
+    {
+        return absl::nullopt;
+    }
+    if (absl::holds_alternative<int64_t>(*bound))
+    {
+        return absl::get<int64_t>(*bound);
+    }
+
+    const std::string& reference = absl::get<DefinedValue>(*bound).reference;
+    if (exists(tree, module, reference))
+    {
+        const Assignment& assignment = resolve(tree, module, reference);
+        if (!is_value(assignment))
+        {
+            return absl::nullopt;
+        }
+        return resolve_bound(tree, module, constraint_bound(value(assignment).value));
+    }
+
+    for (const Import& import : module.imports)
+    {
+        const bool is_imported = std::find(import.imported_values.begin(), import.imported_values.end(), reference) !=
+                                 import.imported_values.end();
+        for (const Module& imported_module : tree.modules)
+        {
+            if (is_imported && imported_module.module_reference == import.module_reference)
+            {
+                return resolve_bound(tree, imported_module, bound);
+            }
+        }
+    }
+    return absl::nullopt;
+}
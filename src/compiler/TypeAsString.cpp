@@ -8,6 +8,7 @@
 
 #include "absl/container/flat_hash_set.h"
 
+#include <cstdint>
 #include <iostream>
 
 template <typename Type>
@@ -17,6 +18,121 @@ std::string identifier_template_params(const Type&, const Module&, const Asn1Tre
     return "<" + identifier_override + ">";
 }
 
+// Constrained strings and lists are held in place up to these bounds, larger bounds keep the default storage
+constexpr const size_t max_bounded_string_capacity = 256;
+constexpr const size_t max_bounded_list_size       = 32;
+
+absl::optional<size_t> upper_size(const Constraint& constraint, const Module& module, const Asn1Tree& tree)
+{
+    const absl::optional<int64_t> upper = resolve_bound(tree, module, constraint.size.upper);
+    if (!upper || *upper < 0)
+    {
+        return absl::nullopt;
+    }
+    return static_cast<size_t>(*upper);
+}
+
+// Bytes needed to hold the contents of a string with a SIZE constraint, unset when unbounded
+template <typename Type>
+absl::optional<size_t> bounded_capacity(const Type&, const Module&, const Asn1Tree&)
+{
+    return absl::nullopt;
+}
+absl::optional<size_t> bounded_capacity(const BitStringType& type, const Module& module, const Asn1Tree& tree)
+{
+    // Size is in bits, the contents are preceded by the number of unused bits
+    const absl::optional<size_t> bits = upper_size(type.constraint, module, tree);
+    return bits ? absl::optional<size_t>((*bits + 7) / 8 + 1) : absl::nullopt;
+}
+absl::optional<size_t> bounded_capacity(const CharacterStringType& type, const Module& module, const Asn1Tree& tree)
+{
+    // Size is in characters. Strings which may hold escape sequences have no limit on their encoded length
+    size_t character_length = 0;
+    switch (type.kind)
+    {
+    case CharacterStringKind::ia5_string:
+    case CharacterStringKind::iso646_string:
+    case CharacterStringKind::numeric_string:
+    case CharacterStringKind::printable_string:
+    case CharacterStringKind::visible_string:
+        character_length = 1;
+        break;
+    case CharacterStringKind::bmp_string:
+        character_length = 2;
+        break;
+    case CharacterStringKind::universal_string:
+    case CharacterStringKind::utf8_string:
+        character_length = 4;
+        break;
+    default:
+        return absl::nullopt;
+    }
+
+    const absl::optional<size_t> characters = upper_size(type.constraint, module, tree);
+    return characters ? absl::optional<size_t>(*characters * character_length) : absl::nullopt;
+}
+absl::optional<size_t> bounded_capacity(const OctetStringType& type, const Module& module, const Asn1Tree& tree)
+{
+    return upper_size(type.constraint, module, tree);
+}
+
+// Strings, object identifiers and times are given their storage policy. Bounded storage holds the contents of a string
+// with a SIZE constraint in place, compact storage holds only the contents
+template <typename Type>
+std::string content_template_params(const Type& type, const Module& module, const Asn1Tree& tree,
+                                    const std::string& identifier_override)
+{
+    absl::optional<size_t> capacity;
+    if (tree.bounded_storage)
+    {
+        capacity = bounded_capacity(type, module, tree);
+    }
+
+    const bool is_bounded = capacity && *capacity <= max_bounded_string_capacity;
+    if (!is_bounded && tree.string_storage == StringStorage::ber)
+    {
+        return identifier_template_params(type, module, tree, identifier_override);
+    }
+
+    const std::string& id = identifier_override.empty() ? identifier(type, module, tree).name() : identifier_override;
+    if (is_bounded)
+    {
+        return "<" + id + ", ::fast_ber::BoundedStorage<" + std::to_string(*capacity) + ">>";
+    }
+    return "<" + id + ", ::fast_ber::CompactStorage<" + std::to_string(tree.compact_string_capacity) + ">>";
+}
+
+// Narrowest native type holding every value permitted by a value range constraint
+absl::optional<std::string> bounded_integer_type(const IntegerType& type, const Module& module, const Asn1Tree& tree)
+{
+    const absl::optional<int64_t> lower = resolve_bound(tree, module, type.constraint.value.lower);
+    const absl::optional<int64_t> upper = resolve_bound(tree, module, type.constraint.value.upper);
+    if (!lower || !upper)
+    {
+        return absl::nullopt;
+    }
+
+    if (*lower >= 0)
+    {
+        if (*upper <= UINT8_MAX)
+            return std::string("uint8_t");
+        if (*upper <= UINT16_MAX)
+            return std::string("uint16_t");
+        if (*upper <= UINT32_MAX)
+            return std::string("uint32_t");
+    }
+    else
+    {
+        if (*lower >= INT8_MIN && *upper <= INT8_MAX)
+            return std::string("int8_t");
+        if (*lower >= INT16_MIN && *upper <= INT16_MAX)
+            return std::string("int16_t");
+        if (*lower >= INT32_MIN && *upper <= INT32_MAX)
+            return std::string("int32_t");
+    }
+    return absl::nullopt;
+}
+
 template <typename Collection>
 CodeBlock create_collection_definition(const Collection& collection, const Module& module, const Asn1Tree& tree,
                                        const std::string& type_name, const std::string& identifier_override)
@@ -90,21 +206,51 @@ CodeBlock create_collection_definition(const Collection& collection, const Modul
             block.add_line();
         }
 
+        // Members selected for projected decoding
+        block.add_line("enum class Field : std::size_t");
+        {
+            auto field_scope = CodeScope(block, true);
+            for (const ComponentType& component : collection.components)
+            {
+                block.add_line(component.named_type.name + ",");
+            }
+        }
+        block.add_line("using FieldMask = ::fast_ber::FieldMask<Field, " +
+                       std::to_string(collection.components.size()) + ">;");
+        block.add_line();
+
         auto id = identifier_override.empty() ? identifier(collection, module, tree).name() : identifier_override;
         block.add_line(create_template_definition({"Identifier"}));
         block.add_line("size_t encoded_length_with_id() const noexcept;");
         block.add_line(create_template_definition({"Identifier"}));
         block.add_line("EncodeResult encode_with_id(absl::Span<uint8_t>) const noexcept;");
         block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("EncodeResult encode_reverse_with_id(absl::Span<uint8_t>) const noexcept;");
+        block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("size_t encoded_length_with_id(EncodePlan&) const;");
+        block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("EncodeResult encode_with_id(absl::Span<uint8_t>, EncodePlan&) const noexcept;");
+        block.add_line(create_template_definition({"Identifier"}));
         block.add_line("DecodeResult decode_with_id(BerView) noexcept;");
+        block.add_line(create_template_definition({"Identifier", "Fields"}));
+        block.add_line("DecodeResult decode_with_id(BerView, const Fields&) noexcept;");
 
         block.add_line("size_t encoded_length() const noexcept");
         block.add_line("{ return encoded_length_with_id<" + id + ">(); }");
         block.add_line("EncodeResult encode(absl::Span<uint8_t> output) const noexcept");
         block.add_line("{ return encode_with_id<" + id + ">(output); }");
+        block.add_line("EncodeResult encode_reverse(absl::Span<uint8_t> output) const noexcept");
+        block.add_line("{ return encode_reverse_with_id<" + id + ">(output); }");
+        block.add_line("size_t encoded_length(EncodePlan& plan) const");
+        block.add_line("{ return encoded_length_with_id<" + id + ">(plan); }");
+        block.add_line("EncodeResult encode(absl::Span<uint8_t> output, EncodePlan& plan) const noexcept");
+        block.add_line("{ return encode_with_id<" + id + ">(output, plan); }");
         block.add_line("DecodeResult decode(BerView input) noexcept");
         block.add_line("{ return decode_with_id<" + id + ">(input); }");
+        block.add_line("DecodeResult decode(BerView input, const FieldMask& fields) noexcept");
+        block.add_line("{ return decode_with_id<" + id + ">(input, fields); }");
         block.add_line("using AsnId = " + id + ";");
+        block.add_line("class View;");
     }
     return block;
 }
@@ -117,7 +263,7 @@ std::string type_as_string(const AnyType& type, const Module& module, const Asn1
 std::string type_as_string(const BitStringType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
 {
-    return "::fast_ber::BitString" + identifier_template_params(type, module, tree, identifier_override);
+    return "::fast_ber::BitString" + content_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const BooleanType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
@@ -127,7 +273,7 @@ std::string type_as_string(const BooleanType& type, const Module& module, const
 std::string type_as_string(const CharacterStringType& type, const Module& module, const Asn1Tree& tree,
                            const std::string&, const std::string& identifier_override)
 {
-    return to_string(type) + identifier_template_params(type, module, tree, identifier_override);
+    return to_string(type.kind) + content_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const ChoiceType&, const Module&, const Asn1Tree&, const std::string& name,
                            const std::string&)
@@ -137,31 +283,32 @@ std::string type_as_string(const ChoiceType&, const Module&, const Asn1Tree&, co
 std::string type_as_string(const DateType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
 {
-    return "::fast_ber::Date" + identifier_template_params(type, module, tree, identifier_override);
+    return "::fast_ber::Date" + content_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const DateTimeType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
 {
-    return "::fast_ber::DateTime" + identifier_template_params(type, module, tree, identifier_override);
+    return "::fast_ber::DateTime" + content_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const DurationType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
 {
-    return "::fast_ber::Duration" + identifier_template_params(type, module, tree, identifier_override);
+    return "::fast_ber::Duration" + content_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const EmbeddedPDVType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
 {
     return "::fast_ber::EmbeddedPDV" + identifier_template_params(type, module, tree, identifier_override);
 }
-std::string type_as_string(const EnumeratedType&, const Module&, const Asn1Tree&, const std::string& type_name,
+std::string type_as_string(const EnumeratedType& type, const Module&, const Asn1Tree&, const std::string& type_name,
                            const std::string& identifier_override)
 {
+    const std::string& name = (type.storage == ScalarStorage::native) ? "NativeEnumerated" : "Enumerated";
     if (!identifier_override.empty())
     {
-        return "::fast_ber::Enumerated<" + type_name + "Values," + identifier_override + ">";
+        return "::fast_ber::" + name + "<" + type_name + "Values," + identifier_override + ">";
     }
-    return "::fast_ber::Enumerated<" + type_name + "Values>";
+    return "::fast_ber::" + name + "<" + type_name + "Values>";
 }
 std::string type_as_string(const ExternalType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
@@ -171,7 +318,7 @@ std::string type_as_string(const ExternalType& type, const Module& module, const
 std::string type_as_string(const GeneralizedTimeType& type, const Module& module, const Asn1Tree& tree,
                            const std::string&, const std::string& identifier_override)
 {
-    return "::fast_ber::GeneralizedTime" + identifier_template_params(type, module, tree, identifier_override);
+    return "::fast_ber::GeneralizedTime" + content_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const InstanceOfType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
@@ -181,7 +328,21 @@ std::string type_as_string(const InstanceOfType& type, const Module& module, con
 std::string type_as_string(const IntegerType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
 {
-    return "::fast_ber::Integer" + identifier_template_params(type, module, tree, identifier_override);
+    absl::optional<std::string> value_type;
+    if (tree.bounded_storage)
+    {
+        value_type = bounded_integer_type(type, module, tree);
+    }
+
+    if (value_type)
+    {
+        const std::string& id =
+            identifier_override.empty() ? identifier(type, module, tree).name() : identifier_override;
+        return "::fast_ber::NativeInteger<" + id + ", " + *value_type + ">";
+    }
+
+    const std::string& name = (type.storage == ScalarStorage::native) ? "NativeInteger" : "Integer";
+    return "::fast_ber::" + name + identifier_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const IRIType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
@@ -206,12 +367,12 @@ std::string type_as_string(const ObjectDescriptorType& type, const Module& modul
 std::string type_as_string(const ObjectIdentifierType& type, const Module& module, const Asn1Tree& tree,
                            const std::string&, const std::string& identifier_override)
 {
-    return "::fast_ber::ObjectIdentifier" + identifier_template_params(type, module, tree, identifier_override);
+    return "::fast_ber::ObjectIdentifier" + content_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const OctetStringType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
 {
-    return "::fast_ber::OctetString" + identifier_template_params(type, module, tree, identifier_override);
+    return "::fast_ber::OctetString" + content_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const RealType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
@@ -267,8 +428,8 @@ std::string type_as_string(const SequenceType&, const Module&, const Asn1Tree&,
 {
     return type_name;
 }
-std::string type_as_string(const SequenceOfType& sequence, const Module&, const Asn1Tree&, const std::string& type_name,
-                           const std::string& identifier_override)
+std::string type_as_string(const SequenceOfType& sequence, const Module& module, const Asn1Tree& tree,
+                           const std::string& type_name, const std::string& identifier_override)
 {
     std::string res = "SequenceOf<" + type_name + "Contained";
     if (identifier_override.empty())
@@ -281,6 +442,18 @@ std::string type_as_string(const SequenceOfType& sequence, const Module&, const
     }
 
     res += ", " + to_string(sequence.storage);
+
+    // Lists with a small upper bound on their size hold every element in place
+    const absl::optional<size_t> size = upper_size(sequence.constraint, module, tree);
+    if (sequence.storage == StorageMode::small_buffer_optimised && sequence.inlined_size)
+    {
+        res += ", " + std::to_string(*sequence.inlined_size);
+    }
+    else if (tree.bounded_storage && sequence.storage == StorageMode::small_buffer_optimised && size && *size > 0 &&
+             *size <= max_bounded_list_size)
+    {
+        res += ", " + std::to_string(*size);
+    }
     res += ">";
 
     return res;
@@ -328,17 +501,17 @@ std::string type_as_string(const PrefixedType& prefixed_type, const Module& modu
 std::string type_as_string(const TimeType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
 {
-    return "::fast_ber::Time" + identifier_template_params(type, module, tree, identifier_override);
+    return "::fast_ber::Time" + content_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const TimeOfDayType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
 {
-    return "::fast_ber::TimeOfDay" + identifier_template_params(type, module, tree, identifier_override);
+    return "::fast_ber::TimeOfDay" + content_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const UTCTimeType& type, const Module& module, const Asn1Tree& tree, const std::string&,
                            const std::string& identifier_override)
 {
-    return "::fast_ber::UTCTime" + identifier_template_params(type, module, tree, identifier_override);
+    return "::fast_ber::UTCTime" + content_template_params(type, module, tree, identifier_override);
 }
 std::string type_as_string(const DefinedType& defined_type, const Module& module, const Asn1Tree& tree,
                            const std::string&, const std::string& identifier_override)
@@ -1,10 +1,8 @@
-/* Generated by re2c 2.0.3 */
-#line 1 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re"
-// A Bison parser, made by GNU Bison 3.3.2.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -17,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -32,20 +30,21 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 
 
 
-// //                    "%code requires" blocks.
-#line 10 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:431
+// "%code requires" blocks.
+#line 10 "/root/repo/src/compiler/asn_compiler.yacc"
 
     #include "fast_ber/compiler/CompilerTypes.hpp"
     #include "fast_ber/compiler/Logging.hpp"
 
-#line 47 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:431
+#line 48 "/tmp/regen/asn_compiler.re"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -92,44 +91,48 @@
 #endif
 
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef YY_ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define YY_ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -142,6 +145,27 @@
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -159,18 +183,23 @@
 # define YYDEBUG 1
 #endif
 
-
 namespace yy {
-#line 163 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:431
+#line 188 "/tmp/regen/asn_compiler.re"
+
 
   /// A point in a source file.
   class position
   {
   public:
+    /// Type for file name.
+    typedef const std::string filename_type;
+    /// Type for line and column numbers.
+    typedef int counter_type;
+
     /// Construct a position.
-    explicit position (std::string* f = YY_NULLPTR,
-                       unsigned l = 1u,
-                       unsigned c = 1u)
+    explicit position (filename_type* f = YY_NULLPTR,
+                       counter_type l = 1,
+                       counter_type c = 1)
       : filename (f)
       , line (l)
       , column (c)
@@ -178,9 +207,9 @@ namespace yy {
 
 
     /// Initialization.
-    void initialize (std::string* fn = YY_NULLPTR,
-                     unsigned l = 1u,
-                     unsigned c = 1u)
+    void initialize (filename_type* fn = YY_NULLPTR,
+                     counter_type l = 1,
+                     counter_type c = 1)
     {
       filename = fn;
       line = l;
@@ -190,41 +219,40 @@ namespace yy {
     /** \name Line and Column related manipulators
      ** \{ */
     /// (line related) Advance to the COUNT next lines.
-    void lines (int count = 1)
+    void lines (counter_type count = 1)
     {
       if (count)
         {
-          column = 1u;
+          column = 1;
           line = add_ (line, count, 1);
         }
     }
 
     /// (column related) Advance to the COUNT next columns.
-    void columns (int count = 1)
+    void columns (counter_type count = 1)
     {
       column = add_ (column, count, 1);
     }
     /** \} */
 
     /// File name to which this position refers.
-    std::string* filename;
+    filename_type* filename;
     /// Current line number.
-    unsigned line;
+    counter_type line;
     /// Current column number.
-    unsigned column;
+    counter_type column;
 
   private:
     /// Compute max (min, lhs+rhs).
-    static unsigned add_ (unsigned lhs, int rhs, int min)
+    static counter_type add_ (counter_type lhs, counter_type rhs, counter_type min)
     {
-      return static_cast<unsigned> (std::max (min,
-                                              static_cast<int> (lhs) + rhs));
+      return lhs + rhs < min ? min : lhs + rhs;
     }
   };
 
   /// Add \a width columns, in place.
   inline position&
-  operator+= (position& res, int width)
+  operator+= (position& res, position::counter_type width)
   {
     res.columns (width);
     return res;
@@ -232,43 +260,25 @@ namespace yy {
 
   /// Add \a width columns.
   inline position
-  operator+ (position res, int width)
+  operator+ (position res, position::counter_type width)
   {
     return res += width;
   }
 
   /// Subtract \a width columns, in place.
   inline position&
-  operator-= (position& res, int width)
+  operator-= (position& res, position::counter_type width)
   {
     return res += -width;
   }
 
   /// Subtract \a width columns.
   inline position
-  operator- (position res, int width)
+  operator- (position res, position::counter_type width)
   {
     return res -= width;
   }
 
-  /// Compare two position objects.
-  inline bool
-  operator== (const position& pos1, const position& pos2)
-  {
-    return (pos1.line == pos2.line
-            && pos1.column == pos2.column
-            && (pos1.filename == pos2.filename
-                || (pos1.filename && pos2.filename
-                    && *pos1.filename == *pos2.filename)));
-  }
-
-  /// Compare two position objects.
-  inline bool
-  operator!= (const position& pos1, const position& pos2)
-  {
-    return !(pos1 == pos2);
-  }
-
   /** \brief Intercept output stream redirection.
    ** \param ostr the destination output stream
    ** \param pos a reference to the position to redirect
@@ -286,6 +296,10 @@ namespace yy {
   class location
   {
   public:
+    /// Type for file name.
+    typedef position::filename_type filename_type;
+    /// Type for line and column numbers.
+    typedef position::counter_type counter_type;
 
     /// Construct a location from \a b to \a e.
     location (const position& b, const position& e)
@@ -300,18 +314,18 @@ namespace yy {
     {}
 
     /// Construct a 0-width location in \a f, \a l, \a c.
-    explicit location (std::string* f,
-                       unsigned l = 1u,
-                       unsigned c = 1u)
+    explicit location (filename_type* f,
+                       counter_type l = 1,
+                       counter_type c = 1)
       : begin (f, l, c)
       , end (f, l, c)
     {}
 
 
     /// Initialization.
-    void initialize (std::string* f = YY_NULLPTR,
-                     unsigned l = 1u,
-                     unsigned c = 1u)
+    void initialize (filename_type* f = YY_NULLPTR,
+                     counter_type l = 1,
+                     counter_type c = 1)
     {
       begin.initialize (f, l, c);
       end = begin;
@@ -327,13 +341,13 @@ namespace yy {
     }
 
     /// Extend the current location to the COUNT next columns.
-    void columns (int count = 1)
+    void columns (counter_type count = 1)
     {
       end += count;
     }
 
     /// Extend the current location to the COUNT next lines.
-    void lines (int count = 1)
+    void lines (counter_type count = 1)
     {
       end.lines (count);
     }
@@ -348,57 +362,49 @@ namespace yy {
   };
 
   /// Join two locations, in place.
-  inline location& operator+= (location& res, const location& end)
+  inline location&
+  operator+= (location& res, const location& end)
   {
     res.end = end.end;
     return res;
   }
 
   /// Join two locations.
-  inline location operator+ (location res, const location& end)
+  inline location
+  operator+ (location res, const location& end)
   {
     return res += end;
   }
 
   /// Add \a width columns to the end position, in place.
-  inline location& operator+= (location& res, int width)
+  inline location&
+  operator+= (location& res, location::counter_type width)
   {
     res.columns (width);
     return res;
   }
 
   /// Add \a width columns to the end position.
-  inline location operator+ (location res, int width)
+  inline location
+  operator+ (location res, location::counter_type width)
   {
     return res += width;
   }
 
   /// Subtract \a width columns to the end position, in place.
-  inline location& operator-= (location& res, int width)
+  inline location&
+  operator-= (location& res, location::counter_type width)
   {
     return res += -width;
   }
 
   /// Subtract \a width columns to the end position.
-  inline location operator- (location res, int width)
+  inline location
+  operator- (location res, location::counter_type width)
   {
     return res -= width;
   }
 
-  /// Compare two location objects.
-  inline bool
-  operator== (const location& loc1, const location& loc2)
-  {
-    return loc1.begin == loc2.begin && loc1.end == loc2.end;
-  }
-
-  /// Compare two location objects.
-  inline bool
-  operator!= (const location& loc1, const location& loc2)
-  {
-    return !(loc1 == loc2);
-  }
-
   /** \brief Intercept output stream redirection.
    ** \param ostr the destination output stream
    ** \param loc a reference to the location to redirect
@@ -409,7 +415,8 @@ namespace yy {
   std::basic_ostream<YYChar>&
   operator<< (std::basic_ostream<YYChar>& ostr, const location& loc)
   {
-    unsigned end_col = 0 < loc.end.column ? loc.end.column - 1 : 0;
+    location::counter_type end_col
+      = 0 < loc.end.column ? loc.end.column - 1 : 0;
     ostr << loc.begin;
     if (loc.end.filename
         && (!loc.begin.filename
@@ -427,37 +434,49 @@ namespace yy {
   class asn1_parser
   {
   public:
-#ifndef YYSTYPE
+#ifdef YYSTYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define YYSTYPE in C++, use %define api.value.type"
+# endif
+    typedef YYSTYPE value_type;
+#else
   /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
   /// via the current parser state.
-  class semantic_type
+  class value_type
   {
   public:
     /// Type of *this.
-    typedef semantic_type self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    semantic_type () YY_NOEXCEPT
-      : yybuffer_ ()
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
       , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    semantic_type (YY_RVREF (T) t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= size);
+      YY_ASSERT (sizeof (T) <= size);
       new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~semantic_type () YY_NOEXCEPT
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      YY_ASSERT (!yytypeid_);
     }
 
 # if 201103L <= YY_CPLUSPLUS
@@ -466,8 +485,8 @@ namespace yy {
     T&
     emplace (U&&... u)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      YY_ASSERT (!yytypeid_);
+      YY_ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (std::forward <U>(u)...);
     }
@@ -477,8 +496,8 @@ namespace yy {
     T&
     emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      YY_ASSERT (!yytypeid_);
+      YY_ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T ();
     }
@@ -488,8 +507,8 @@ namespace yy {
     T&
     emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      YY_ASSERT (!yytypeid_);
+      YY_ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
@@ -518,9 +537,9 @@ namespace yy {
     T&
     as () YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= size);
+      YY_ASSERT (yytypeid_);
+      YY_ASSERT (*yytypeid_ == typeid (T));
+      YY_ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
@@ -529,9 +548,9 @@ namespace yy {
     const T&
     as () const YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= size);
+      YY_ASSERT (yytypeid_);
+      YY_ASSERT (*yytypeid_ == typeid (T));
+      YY_ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
@@ -547,8 +566,8 @@ namespace yy {
     void
     swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *that.yytypeid_);
+      YY_ASSERT (yytypeid_);
+      YY_ASSERT (*yytypeid_ == *that.yytypeid_);
       std::swap (as<T> (), that.as<T> ());
     }
 
@@ -597,16 +616,19 @@ namespace yy {
     }
 
   private:
-    /// Prohibit blind copies.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
     self_type& operator= (const self_type&);
-    semantic_type (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
     yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
@@ -615,7 +637,7 @@ namespace yy {
     const T*
     yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
@@ -667,124 +689,141 @@ namespace yy {
       // ComponentTypeList
       char dummy11[sizeof (ComponentTypeList)];
 
+      // Constraint
+      // ConstraintSpec
+      // SubtypeConstraint
+      // ElementSetSpecs
+      // ElementSetSpec
+      // Unions
+      // UElems
+      // Intersections
+      // IElems
+      // IntersectionElements
+      // Elems
+      // Elements
+      // SubtypeElements
+      // ValueRange
+      // SizeConstraint
+      char dummy12[sizeof (Constraint)];
+
       // DateTimeType
-      char dummy12[sizeof (DateTimeType)];
+      char dummy13[sizeof (DateTimeType)];
 
       // DateType
-      char dummy13[sizeof (DateType)];
+      char dummy14[sizeof (DateType)];
 
       // DefinedType
       // ParameterizedType
       // ExternalTypeReference
-      char dummy14[sizeof (DefinedType)];
+      char dummy15[sizeof (DefinedType)];
 
       // DefinedValue
-      char dummy15[sizeof (DefinedValue)];
+      char dummy16[sizeof (DefinedValue)];
 
       // DurationType
-      char dummy16[sizeof (DurationType)];
+      char dummy17[sizeof (DurationType)];
 
       // EmbeddedPDVType
-      char dummy17[sizeof (EmbeddedPDVType)];
+      char dummy18[sizeof (EmbeddedPDVType)];
 
       // EnumeratedType
       // Enumerations
       // Enumeration
-      char dummy18[sizeof (EnumeratedType)];
+      char dummy19[sizeof (EnumeratedType)];
 
       // EnumerationItem
-      char dummy19[sizeof (EnumerationValue)];
+      char dummy20[sizeof (EnumerationValue)];
 
       // ExternalType
-      char dummy20[sizeof (ExternalType)];
+      char dummy21[sizeof (ExternalType)];
 
       // IRIType
-      char dummy21[sizeof (IRIType)];
+      char dummy22[sizeof (IRIType)];
 
       // SymbolsFromModule
-      char dummy22[sizeof (Import)];
+      char dummy23[sizeof (Import)];
 
       // InstanceOfType
-      char dummy23[sizeof (InstanceOfType)];
+      char dummy24[sizeof (InstanceOfType)];
 
       // IntegerType
-      char dummy24[sizeof (IntegerType)];
+      char dummy25[sizeof (IntegerType)];
 
       // ModuleBody
-      char dummy25[sizeof (Module)];
+      char dummy26[sizeof (Module)];
 
       // NamedNumber
-      char dummy26[sizeof (NamedNumber)];
+      char dummy27[sizeof (NamedNumber)];
 
       // NamedType
-      char dummy27[sizeof (NamedType)];
+      char dummy28[sizeof (NamedType)];
 
       // NullType
-      char dummy28[sizeof (NullType)];
+      char dummy29[sizeof (NullType)];
 
       // ObjectClass
       // ObjectClassDefn
-      char dummy29[sizeof (ObjectClassAssignment)];
+      char dummy30[sizeof (ObjectClassAssignment)];
 
       // ObjectClassFieldType
-      char dummy30[sizeof (ObjectClassFieldType)];
+      char dummy31[sizeof (ObjectClassFieldType)];
 
       // ObjIdComponents
       // NameForm
       // NumberForm
       // NameAndNumberForm
-      char dummy31[sizeof (ObjectIdComponentValue)];
+      char dummy32[sizeof (ObjectIdComponentValue)];
 
       // ObjectIdentifierType
-      char dummy32[sizeof (ObjectIdentifierType)];
+      char dummy33[sizeof (ObjectIdentifierType)];
 
       // OctetStringType
-      char dummy33[sizeof (OctetStringType)];
+      char dummy34[sizeof (OctetStringType)];
 
       // Parameter
-      char dummy34[sizeof (Parameter)];
+      char dummy35[sizeof (Parameter)];
 
       // PrefixedType
-      char dummy35[sizeof (PrefixedType)];
+      char dummy36[sizeof (PrefixedType)];
 
       // RealType
-      char dummy36[sizeof (RealType)];
+      char dummy37[sizeof (RealType)];
 
       // RelativeIRIType
-      char dummy37[sizeof (RelativeIRIType)];
+      char dummy38[sizeof (RelativeIRIType)];
 
       // RelativeOIDType
-      char dummy38[sizeof (RelativeOIDType)];
+      char dummy39[sizeof (RelativeOIDType)];
 
       // SequenceOfType
-      char dummy39[sizeof (SequenceOfType)];
+      char dummy40[sizeof (SequenceOfType)];
 
       // SequenceType
-      char dummy40[sizeof (SequenceType)];
+      char dummy41[sizeof (SequenceType)];
 
       // SetOfType
-      char dummy41[sizeof (SetOfType)];
+      char dummy42[sizeof (SetOfType)];
 
       // SetType
-      char dummy42[sizeof (SetType)];
+      char dummy43[sizeof (SetType)];
 
       // Tag
-      char dummy43[sizeof (Tag)];
+      char dummy44[sizeof (Tag)];
 
       // TaggedType
-      char dummy44[sizeof (TaggedType)];
+      char dummy45[sizeof (TaggedType)];
 
       // TagDefault
-      char dummy45[sizeof (TaggingMode)];
+      char dummy46[sizeof (TaggingMode)];
 
       // TimeOfDayType
-      char dummy46[sizeof (TimeOfDayType)];
+      char dummy47[sizeof (TimeOfDayType)];
 
       // TimeType
-      char dummy47[sizeof (TimeType)];
+      char dummy48[sizeof (TimeType)];
 
       // TimeValue
-      char dummy48[sizeof (TimeValue)];
+      char dummy49[sizeof (TimeValue)];
 
       // ParamGovernor
       // Governor
@@ -792,23 +831,29 @@ namespace yy {
       // Type
       // ConstrainedType
       // TypeWithConstraint
-      char dummy49[sizeof (Type)];
+      char dummy50[sizeof (Type)];
 
       // ValueWithoutTypeIdentifier
       // Value
       // SingleValue
-      char dummy50[sizeof (Value)];
+      char dummy51[sizeof (Value)];
+
+      // LowerEndpoint
+      // UpperEndpoint
+      // LowerEndValue
+      // UpperEndValue
+      char dummy52[sizeof (absl::optional<ConstraintBound>)];
 
       // realnumber
-      char dummy51[sizeof (double)];
+      char dummy53[sizeof (double)];
 
       // ClassNumber
-      char dummy52[sizeof (int)];
+      char dummy54[sizeof (int)];
 
       // number
       // negativenumber
       // SignedNumber
-      char dummy53[sizeof (int64_t)];
+      char dummy55[sizeof (int64_t)];
 
       // bstring
       // xmlbstring
@@ -836,51 +881,51 @@ namespace yy {
       // modulereference
       // objectclassreference
       // word
-      char dummy54[sizeof (std::string)];
+      char dummy56[sizeof (std::string)];
 
       // AssignmentList
-      char dummy55[sizeof (std::vector<Assignment>)];
+      char dummy57[sizeof (std::vector<Assignment>)];
 
       // FieldSpecList
       // FieldSpec
       // TypeFieldSpec
       // FixedTypeValueFieldSpec
-      char dummy56[sizeof (std::vector<ClassField>)];
+      char dummy58[sizeof (std::vector<ClassField>)];
 
       // Exports
-      char dummy57[sizeof (std::vector<Export>)];
+      char dummy59[sizeof (std::vector<Export>)];
 
       // Imports
       // SymbolsImported
       // SymbolsFromModuleList
-      char dummy58[sizeof (std::vector<Import>)];
+      char dummy60[sizeof (std::vector<Import>)];
 
       // NamedNumberList
-      char dummy59[sizeof (std::vector<NamedNumber>)];
+      char dummy61[sizeof (std::vector<NamedNumber>)];
 
       // AlternativeTypeLists
       // RootAlternativeTypeList
       // AlternativeTypeList
-      char dummy60[sizeof (std::vector<NamedType>)];
+      char dummy62[sizeof (std::vector<NamedType>)];
 
       // ObjectIdentifierValue
       // ObjIdComponentsList
-      char dummy61[sizeof (std::vector<ObjectIdComponentValue>)];
+      char dummy63[sizeof (std::vector<ObjectIdComponentValue>)];
 
       // ParameterList
       // ParameterSeries
-      char dummy62[sizeof (std::vector<Parameter>)];
+      char dummy64[sizeof (std::vector<Parameter>)];
 
       // ActualParameterList
-      char dummy63[sizeof (std::vector<Type>)];
+      char dummy65[sizeof (std::vector<Type>)];
 
       // SequenceOfValues
-      char dummy64[sizeof (std::vector<Value>)];
+      char dummy66[sizeof (std::vector<Value>)];
 
       // FieldNameList
       // OneOrManyTypeFieldReference
       // SymbolList
-      char dummy65[sizeof (std::vector<std::string>)];
+      char dummy67[sizeof (std::vector<std::string>)];
     };
 
     /// The size of the largest semantic type.
@@ -890,18 +935,19 @@ namespace yy {
     union
     {
       /// Strongest alignment constraints.
-      long double yyalign_me;
+      long double yyalign_me_;
       /// A buffer large enough to store any of the semantic values.
-      char yyraw[size];
-    } yybuffer_;
+      char yyraw_[size];
+    };
 
     /// Whether the content is built: if defined, the name of the stored type.
     const std::type_info *yytypeid_;
   };
 
-#else
-    typedef YYSTYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
@@ -923,178 +969,571 @@ namespace yy {
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        END_OF_FILE = 0,
-        comment = 258,
-        number = 259,
-        negativenumber = 260,
-        realnumber = 261,
-        bstring = 262,
-        xmlbstring = 263,
-        hstring = 264,
-        xmlhstring = 265,
-        cstring = 266,
-        xmlcstring = 267,
-        simplestring = 268,
-        xmltstring = 269,
-        psname = 270,
-        encodingreference = 271,
-        integerUnicodeLabel = 272,
-        tstring = 275,
-        objectreference = 277,
-        objectsetreference = 278,
-        typefieldreference = 279,
-        valuefieldreference = 280,
-        valuesetfieldreference = 281,
-        objectfieldreference = 282,
-        objectsetfieldreference = 283,
-        ABSENT = 284,
-        ABSTRACT_SYNTAX = 285,
-        ALL = 286,
-        ANY = 287,
-        APPLICATION = 288,
-        ASN_NULL = 289,
-        AUTOMATIC = 290,
-        BEGIN = 291,
-        BIT = 292,
-        BMPString = 293,
-        BOOLEAN = 294,
-        BY = 295,
-        CHARACTER = 296,
-        CHOICE = 297,
-        CLASS = 298,
-        COMPONENT = 299,
-        COMPONENTS = 300,
-        CONSTRAINED = 301,
-        CONTAINING = 302,
-        DATE = 303,
-        DATE_TIME = 304,
-        DEFAULT = 305,
-        DEFINITIONS = 306,
-        DURATION = 307,
-        EMBEDDED = 308,
-        ENCODED = 309,
-        ENCODING_CONTROL = 310,
-        END = 311,
-        ENUMERATED = 312,
-        EXCEPT = 313,
-        EXPLICIT = 314,
-        EXPORTS = 315,
-        EXTENSIBILITY = 316,
-        EXTERNAL = 317,
-        FALSE = 318,
-        FROM = 319,
-        GeneralizedTime = 320,
-        GeneralString = 321,
-        GraphicString = 322,
-        IA5String = 323,
-        IDENTIFIER = 324,
-        IMPLICIT = 325,
-        IMPLIED = 326,
-        IMPORTS = 327,
-        INCLUDES = 328,
-        INSTANCE = 329,
-        INSTRUCTIONS = 330,
-        INTEGER = 331,
-        INTERSECTION = 332,
-        ISO646String = 333,
-        MAX = 334,
-        MIN = 335,
-        MINUS_INFINITY = 336,
-        NOT_A_NUMBER = 337,
-        NumericString = 338,
-        OBJECT = 339,
-        ObjectDescriptor = 340,
-        OCTET = 341,
-        OF = 342,
-        OID_IRI = 343,
-        OPTIONAL = 344,
-        PATTERN = 345,
-        PDV = 346,
-        PLUS_INFINITY = 347,
-        PRESENT = 348,
-        PrintableString = 349,
-        PRIVATE = 350,
-        REAL = 351,
-        RELATIVE_OID = 352,
-        RELATIVE_OID_IRI = 353,
-        SEQUENCE = 354,
-        SET = 355,
-        SETTINGS = 356,
-        SIZE = 357,
-        STRING = 358,
-        SYNTAX = 359,
-        T61String = 360,
-        TAGS = 361,
-        TeletexString = 362,
-        TIME = 363,
-        TIME_OF_DAY = 364,
-        TRUE = 365,
-        TYPE_IDENTIFIER = 366,
-        UNION = 367,
-        UNIQUE = 368,
-        UNIVERSAL = 369,
-        UniversalString = 370,
-        UTCTime = 371,
-        UTF8String = 372,
-        VideotexString = 373,
-        VisibleString = 374,
-        WITH = 375,
-        DEFINED_AS = 376,
-        ELIPSIS = 377,
-        RANGE = 378,
-        OPEN_BRACE = 379,
-        CLOSE_BRACE = 380,
-        OPEN_PARENTHESIS = 381,
-        CLOSE_PARENTHESIS = 382,
-        OPEN_SQUARE_BRACKET = 383,
-        CLOSE_SQUARE_BRACKET = 384,
-        LESS_THAN = 385,
-        GREATER_THAN = 386,
-        EXCLAMATION_MARK = 387,
-        QUOTATION_MARK = 388,
-        AMPERSAND = 389,
-        APOSTROPHE = 390,
-        ASTERISK = 391,
-        COMMA = 392,
-        FULL_STOP = 393,
-        HYPHEN_MINUS = 394,
-        SOLIDUS = 395,
-        COLON = 396,
-        SEMICOLON = 397,
-        EQUALS_SIGN = 398,
-        AT = 399,
-        VERTICAL_LINE = 400,
-        ACCENT = 401,
-        PLUS = 402,
-        STAR = 403,
-        GENERIC_IDENTIFIER_UPPERCASE = 404,
-        GENERIC_IDENTIFIER_LOWERCASE = 405,
-        GENERIC_INTEGER = 406,
-        xmlasn1typename = 407
+      enum token_kind_type
+      {
+        YYEMPTY = -2,
+    END_OF_FILE = 0,               // END_OF_FILE
+    YYerror = 256,                 // error
+    YYUNDEF = 257,                 // "invalid token"
+    comment = 258,                 // comment
+    number = 259,                  // number
+    negativenumber = 260,          // negativenumber
+    realnumber = 261,              // realnumber
+    bstring = 262,                 // bstring
+    xmlbstring = 263,              // xmlbstring
+    hstring = 264,                 // hstring
+    xmlhstring = 265,              // xmlhstring
+    cstring = 266,                 // cstring
+    xmlcstring = 267,              // xmlcstring
+    simplestring = 268,            // simplestring
+    xmltstring = 269,              // xmltstring
+    psname = 270,                  // psname
+    encodingreference = 271,       // encodingreference
+    integerUnicodeLabel = 272,     // integerUnicodeLabel
+    tstring = 275,                 // tstring
+    objectreference = 277,         // objectreference
+    objectsetreference = 278,      // objectsetreference
+    typefieldreference = 279,      // typefieldreference
+    valuefieldreference = 280,     // valuefieldreference
+    valuesetfieldreference = 281,  // valuesetfieldreference
+    objectfieldreference = 282,    // objectfieldreference
+    objectsetfieldreference = 283, // objectsetfieldreference
+    ABSENT = 284,                  // ABSENT
+    ABSTRACT_SYNTAX = 285,         // ABSTRACT_SYNTAX
+    ALL = 286,                     // ALL
+    ANY = 287,                     // ANY
+    APPLICATION = 288,             // APPLICATION
+    ASN_NULL = 289,                // ASN_NULL
+    AUTOMATIC = 290,               // AUTOMATIC
+    BEGIN = 291,                   // BEGIN
+    BIT = 292,                     // BIT
+    BMPString = 293,               // BMPString
+    BOOLEAN = 294,                 // BOOLEAN
+    BY = 295,                      // BY
+    CHARACTER = 296,               // CHARACTER
+    CHOICE = 297,                  // CHOICE
+    CLASS = 298,                   // CLASS
+    COMPONENT = 299,               // COMPONENT
+    COMPONENTS = 300,              // COMPONENTS
+    CONSTRAINED = 301,             // CONSTRAINED
+    CONTAINING = 302,              // CONTAINING
+    DATE = 303,                    // DATE
+    DATE_TIME = 304,               // DATE_TIME
+    DEFAULT = 305,                 // DEFAULT
+    DEFINITIONS = 306,             // DEFINITIONS
+    DURATION = 307,                // DURATION
+    EMBEDDED = 308,                // EMBEDDED
+    ENCODED = 309,                 // ENCODED
+    ENCODING_CONTROL = 310,        // ENCODING_CONTROL
+    END = 311,                     // END
+    ENUMERATED = 312,              // ENUMERATED
+    EXCEPT = 313,                  // EXCEPT
+    EXPLICIT = 314,                // EXPLICIT
+    EXPORTS = 315,                 // EXPORTS
+    EXTENSIBILITY = 316,           // EXTENSIBILITY
+    EXTERNAL = 317,                // EXTERNAL
+    FALSE = 318,                   // FALSE
+    FROM = 319,                    // FROM
+    GeneralizedTime = 320,         // GeneralizedTime
+    GeneralString = 321,           // GeneralString
+    GraphicString = 322,           // GraphicString
+    IA5String = 323,               // IA5String
+    IDENTIFIER = 324,              // IDENTIFIER
+    IMPLICIT = 325,                // IMPLICIT
+    IMPLIED = 326,                 // IMPLIED
+    IMPORTS = 327,                 // IMPORTS
+    INCLUDES = 328,                // "INCLUDES"
+    INSTANCE = 329,                // INSTANCE
+    INSTRUCTIONS = 330,            // INSTRUCTIONS
+    INTEGER = 331,                 // INTEGER
+    INTERSECTION = 332,            // INTERSECTION
+    ISO646String = 333,            // ISO646String
+    MAX = 334,                     // MAX
+    MIN = 335,                     // MIN
+    MINUS_INFINITY = 336,          // MINUS_INFINITY
+    NOT_A_NUMBER = 337,            // NOT_A_NUMBER
+    NumericString = 338,           // NumericString
+    OBJECT = 339,                  // OBJECT
+    ObjectDescriptor = 340,        // ObjectDescriptor
+    OCTET = 341,                   // OCTET
+    OF = 342,                      // OF
+    OID_IRI = 343,                 // OID_IRI
+    OPTIONAL = 344,                // OPTIONAL
+    PATTERN = 345,                 // PATTERN
+    PDV = 346,                     // PDV
+    PLUS_INFINITY = 347,           // PLUS_INFINITY
+    PRESENT = 348,                 // PRESENT
+    PrintableString = 349,         // PrintableString
+    PRIVATE = 350,                 // PRIVATE
+    REAL = 351,                    // REAL
+    RELATIVE_OID = 352,            // RELATIVE_OID
+    RELATIVE_OID_IRI = 353,        // RELATIVE_OID_IRI
+    SEQUENCE = 354,                // SEQUENCE
+    SET = 355,                     // SET
+    SETTINGS = 356,                // SETTINGS
+    SIZE = 357,                    // SIZE
+    STRING = 358,                  // STRING
+    SYNTAX = 359,                  // SYNTAX
+    T61String = 360,               // T61String
+    TAGS = 361,                    // TAGS
+    TeletexString = 362,           // TeletexString
+    TIME = 363,                    // TIME
+    TIME_OF_DAY = 364,             // TIME_OF_DAY
+    TRUE = 365,                    // TRUE
+    TYPE_IDENTIFIER = 366,         // TYPE_IDENTIFIER
+    UNION = 367,                   // UNION
+    UNIQUE = 368,                  // UNIQUE
+    UNIVERSAL = 369,               // UNIVERSAL
+    UniversalString = 370,         // UniversalString
+    UTCTime = 371,                 // UTCTime
+    UTF8String = 372,              // UTF8String
+    VideotexString = 373,          // VideotexString
+    VisibleString = 374,           // VisibleString
+    WITH = 375,                    // WITH
+    DEFINED_AS = 376,              // "::="
+    ELIPSIS = 377,                 // "..."
+    RANGE = 378,                   // ".."
+    OPEN_BRACE = 379,              // "{"
+    CLOSE_BRACE = 380,             // "}"
+    OPEN_PARENTHESIS = 381,        // "("
+    CLOSE_PARENTHESIS = 382,       // ")"
+    OPEN_SQUARE_BRACKET = 383,     // "["
+    CLOSE_SQUARE_BRACKET = 384,    // "]"
+    LESS_THAN = 385,               // "<"
+    GREATER_THAN = 386,            // ">"
+    EXCLAMATION_MARK = 387,        // "!"
+    QUOTATION_MARK = 388,          // "\""
+    AMPERSAND = 389,               // "&"
+    APOSTROPHE = 390,              // "\'"
+    ASTERISK = 391,                // "*"
+    COMMA = 392,                   // ","
+    FULL_STOP = 393,               // "."
+    HYPHEN_MINUS = 394,            // "-"
+    SOLIDUS = 395,                 // "/"
+    COLON = 396,                   // ":"
+    SEMICOLON = 397,               // ";"
+    EQUALS_SIGN = 398,             // "="
+    AT = 399,                      // "@"
+    VERTICAL_LINE = 400,           // "|"
+    ACCENT = 401,                  // "^"
+    PLUS = 402,                    // PLUS
+    STAR = 403,                    // STAR
+    GENERIC_IDENTIFIER_UPPERCASE = 404, // GENERIC_IDENTIFIER_UPPERCASE
+    GENERIC_IDENTIFIER_LOWERCASE = 405, // GENERIC_IDENTIFIER_LOWERCASE
+    GENERIC_INTEGER = 406,         // GENERIC_INTEGER
+    xmlasn1typename = 407          // xmlasn1typename
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
+
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 153, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // END_OF_FILE
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_comment = 3,                           // comment
+        S_number = 4,                            // number
+        S_negativenumber = 5,                    // negativenumber
+        S_realnumber = 6,                        // realnumber
+        S_bstring = 7,                           // bstring
+        S_xmlbstring = 8,                        // xmlbstring
+        S_hstring = 9,                           // hstring
+        S_xmlhstring = 10,                       // xmlhstring
+        S_cstring = 11,                          // cstring
+        S_xmlcstring = 12,                       // xmlcstring
+        S_simplestring = 13,                     // simplestring
+        S_xmltstring = 14,                       // xmltstring
+        S_psname = 15,                           // psname
+        S_encodingreference = 16,                // encodingreference
+        S_integerUnicodeLabel = 17,              // integerUnicodeLabel
+        S_18_non_integerUnicodeLabel = 18,       // non-integerUnicodeLabel
+        S_19_extended_true = 19,                 // extended-true
+        S_tstring = 20,                          // tstring
+        S_21_extended_false = 21,                // extended-false
+        S_objectreference = 22,                  // objectreference
+        S_objectsetreference = 23,               // objectsetreference
+        S_typefieldreference = 24,               // typefieldreference
+        S_valuefieldreference = 25,              // valuefieldreference
+        S_valuesetfieldreference = 26,           // valuesetfieldreference
+        S_objectfieldreference = 27,             // objectfieldreference
+        S_objectsetfieldreference = 28,          // objectsetfieldreference
+        S_ABSENT = 29,                           // ABSENT
+        S_ABSTRACT_SYNTAX = 30,                  // ABSTRACT_SYNTAX
+        S_ALL = 31,                              // ALL
+        S_ANY = 32,                              // ANY
+        S_APPLICATION = 33,                      // APPLICATION
+        S_ASN_NULL = 34,                         // ASN_NULL
+        S_AUTOMATIC = 35,                        // AUTOMATIC
+        S_BEGIN = 36,                            // BEGIN
+        S_BIT = 37,                              // BIT
+        S_BMPString = 38,                        // BMPString
+        S_BOOLEAN = 39,                          // BOOLEAN
+        S_BY = 40,                               // BY
+        S_CHARACTER = 41,                        // CHARACTER
+        S_CHOICE = 42,                           // CHOICE
+        S_CLASS = 43,                            // CLASS
+        S_COMPONENT = 44,                        // COMPONENT
+        S_COMPONENTS = 45,                       // COMPONENTS
+        S_CONSTRAINED = 46,                      // CONSTRAINED
+        S_CONTAINING = 47,                       // CONTAINING
+        S_DATE = 48,                             // DATE
+        S_DATE_TIME = 49,                        // DATE_TIME
+        S_DEFAULT = 50,                          // DEFAULT
+        S_DEFINITIONS = 51,                      // DEFINITIONS
+        S_DURATION = 52,                         // DURATION
+        S_EMBEDDED = 53,                         // EMBEDDED
+        S_ENCODED = 54,                          // ENCODED
+        S_ENCODING_CONTROL = 55,                 // ENCODING_CONTROL
+        S_END = 56,                              // END
+        S_ENUMERATED = 57,                       // ENUMERATED
+        S_EXCEPT = 58,                           // EXCEPT
+        S_EXPLICIT = 59,                         // EXPLICIT
+        S_EXPORTS = 60,                          // EXPORTS
+        S_EXTENSIBILITY = 61,                    // EXTENSIBILITY
+        S_EXTERNAL = 62,                         // EXTERNAL
+        S_FALSE = 63,                            // FALSE
+        S_FROM = 64,                             // FROM
+        S_GeneralizedTime = 65,                  // GeneralizedTime
+        S_GeneralString = 66,                    // GeneralString
+        S_GraphicString = 67,                    // GraphicString
+        S_IA5String = 68,                        // IA5String
+        S_IDENTIFIER = 69,                       // IDENTIFIER
+        S_IMPLICIT = 70,                         // IMPLICIT
+        S_IMPLIED = 71,                          // IMPLIED
+        S_IMPORTS = 72,                          // IMPORTS
+        S_INCLUDES = 73,                         // "INCLUDES"
+        S_INSTANCE = 74,                         // INSTANCE
+        S_INSTRUCTIONS = 75,                     // INSTRUCTIONS
+        S_INTEGER = 76,                          // INTEGER
+        S_INTERSECTION = 77,                     // INTERSECTION
+        S_ISO646String = 78,                     // ISO646String
+        S_MAX = 79,                              // MAX
+        S_MIN = 80,                              // MIN
+        S_MINUS_INFINITY = 81,                   // MINUS_INFINITY
+        S_NOT_A_NUMBER = 82,                     // NOT_A_NUMBER
+        S_NumericString = 83,                    // NumericString
+        S_OBJECT = 84,                           // OBJECT
+        S_ObjectDescriptor = 85,                 // ObjectDescriptor
+        S_OCTET = 86,                            // OCTET
+        S_OF = 87,                               // OF
+        S_OID_IRI = 88,                          // OID_IRI
+        S_OPTIONAL = 89,                         // OPTIONAL
+        S_PATTERN = 90,                          // PATTERN
+        S_PDV = 91,                              // PDV
+        S_PLUS_INFINITY = 92,                    // PLUS_INFINITY
+        S_PRESENT = 93,                          // PRESENT
+        S_PrintableString = 94,                  // PrintableString
+        S_PRIVATE = 95,                          // PRIVATE
+        S_REAL = 96,                             // REAL
+        S_RELATIVE_OID = 97,                     // RELATIVE_OID
+        S_RELATIVE_OID_IRI = 98,                 // RELATIVE_OID_IRI
+        S_SEQUENCE = 99,                         // SEQUENCE
+        S_SET = 100,                             // SET
+        S_SETTINGS = 101,                        // SETTINGS
+        S_SIZE = 102,                            // SIZE
+        S_STRING = 103,                          // STRING
+        S_SYNTAX = 104,                          // SYNTAX
+        S_T61String = 105,                       // T61String
+        S_TAGS = 106,                            // TAGS
+        S_TeletexString = 107,                   // TeletexString
+        S_TIME = 108,                            // TIME
+        S_TIME_OF_DAY = 109,                     // TIME_OF_DAY
+        S_TRUE = 110,                            // TRUE
+        S_TYPE_IDENTIFIER = 111,                 // TYPE_IDENTIFIER
+        S_UNION = 112,                           // UNION
+        S_UNIQUE = 113,                          // UNIQUE
+        S_UNIVERSAL = 114,                       // UNIVERSAL
+        S_UniversalString = 115,                 // UniversalString
+        S_UTCTime = 116,                         // UTCTime
+        S_UTF8String = 117,                      // UTF8String
+        S_VideotexString = 118,                  // VideotexString
+        S_VisibleString = 119,                   // VisibleString
+        S_WITH = 120,                            // WITH
+        S_DEFINED_AS = 121,                      // "::="
+        S_ELIPSIS = 122,                         // "..."
+        S_RANGE = 123,                           // ".."
+        S_OPEN_BRACE = 124,                      // "{"
+        S_CLOSE_BRACE = 125,                     // "}"
+        S_OPEN_PARENTHESIS = 126,                // "("
+        S_CLOSE_PARENTHESIS = 127,               // ")"
+        S_OPEN_SQUARE_BRACKET = 128,             // "["
+        S_CLOSE_SQUARE_BRACKET = 129,            // "]"
+        S_LESS_THAN = 130,                       // "<"
+        S_GREATER_THAN = 131,                    // ">"
+        S_EXCLAMATION_MARK = 132,                // "!"
+        S_QUOTATION_MARK = 133,                  // "\""
+        S_AMPERSAND = 134,                       // "&"
+        S_APOSTROPHE = 135,                      // "\'"
+        S_ASTERISK = 136,                        // "*"
+        S_COMMA = 137,                           // ","
+        S_FULL_STOP = 138,                       // "."
+        S_HYPHEN_MINUS = 139,                    // "-"
+        S_SOLIDUS = 140,                         // "/"
+        S_COLON = 141,                           // ":"
+        S_SEMICOLON = 142,                       // ";"
+        S_EQUALS_SIGN = 143,                     // "="
+        S_AT = 144,                              // "@"
+        S_VERTICAL_LINE = 145,                   // "|"
+        S_ACCENT = 146,                          // "^"
+        S_PLUS = 147,                            // PLUS
+        S_STAR = 148,                            // STAR
+        S_GENERIC_IDENTIFIER_UPPERCASE = 149,    // GENERIC_IDENTIFIER_UPPERCASE
+        S_GENERIC_IDENTIFIER_LOWERCASE = 150,    // GENERIC_IDENTIFIER_LOWERCASE
+        S_GENERIC_INTEGER = 151,                 // GENERIC_INTEGER
+        S_xmlasn1typename = 152,                 // xmlasn1typename
+        S_YYACCEPT = 153,                        // $accept
+        S_ModuleDefinitionList = 154,            // ModuleDefinitionList
+        S_ModuleDefinition = 155,                // ModuleDefinition
+        S_SyntaxList = 156,                      // SyntaxList
+        S_DefinedObjectClass = 157,              // DefinedObjectClass
+        S_ExternalObjectClassReference = 158,    // ExternalObjectClassReference
+        S_UsefulObjectClassReference = 159,      // UsefulObjectClassReference
+        S_ObjectClassAssignment = 160,           // ObjectClassAssignment
+        S_ObjectClass = 161,                     // ObjectClass
+        S_ObjectClassDefn = 162,                 // ObjectClassDefn
+        S_FieldSpecList = 163,                   // FieldSpecList
+        S_FieldSpec = 164,                       // FieldSpec
+        S_FieldName = 165,                       // FieldName
+        S_FieldNameList = 166,                   // FieldNameList
+        S_TypeFieldSpec = 167,                   // TypeFieldSpec
+        S_OneOrManyTypeFieldReference = 168,     // OneOrManyTypeFieldReference
+        S_TypeOptionalitySpec = 169,             // TypeOptionalitySpec
+        S_OptionalUnique = 170,                  // OptionalUnique
+        S_FixedTypeValueFieldSpec = 171,         // FixedTypeValueFieldSpec
+        S_ValueOptionalitySpec = 172,            // ValueOptionalitySpec
+        S_VariableTypeValueFieldSpec = 173,      // VariableTypeValueFieldSpec
+        S_FixedTypeValueSetFieldSpec = 174,      // FixedTypeValueSetFieldSpec
+        S_ValueSetDefaultSpec = 175,             // ValueSetDefaultSpec
+        S_ObjectFieldSpec = 176,                 // ObjectFieldSpec
+        S_ObjectOptionalitySpec = 177,           // ObjectOptionalitySpec
+        S_ObjectSetFieldSpec = 178,              // ObjectSetFieldSpec
+        S_ObjectSetOptionalitySpec = 179,        // ObjectSetOptionalitySpec
+        S_WithSyntaxSpec = 180,                  // WithSyntaxSpec
+        S_TokenOrGroupSpecList = 181,            // TokenOrGroupSpecList
+        S_TokenOrGroupSpec = 182,                // TokenOrGroupSpec
+        S_OptionalGroup = 183,                   // OptionalGroup
+        S_RequiredToken = 184,                   // RequiredToken
+        S_LiteralList = 185,                     // LiteralList
+        S_Literal = 186,                         // Literal
+        S_DefinedObject = 187,                   // DefinedObject
+        S_ExternalObjectReference = 188,         // ExternalObjectReference
+        S_Object = 189,                          // Object
+        S_ObjectDefn = 190,                      // ObjectDefn
+        S_DefaultSyntax = 191,                   // DefaultSyntax
+        S_FieldSetting = 192,                    // FieldSetting
+        S_DefinedSyntax = 193,                   // DefinedSyntax
+        S_DefinedSyntaxList = 194,               // DefinedSyntaxList
+        S_DefinedSyntaxToken = 195,              // DefinedSyntaxToken
+        S_Setting = 196,                         // Setting
+        S_DefinedObjectSet = 197,                // DefinedObjectSet
+        S_ExternalObjectSetReference = 198,      // ExternalObjectSetReference
+        S_ObjectSetAssignment = 199,             // ObjectSetAssignment
+        S_ObjectSet = 200,                       // ObjectSet
+        S_ObjectSetSpec = 201,                   // ObjectSetSpec
+        S_ObjectClassFieldType = 202,            // ObjectClassFieldType
+        S_ParameterizedAssignment = 203,         // ParameterizedAssignment
+        S_ParameterizedTypeAssignment = 204,     // ParameterizedTypeAssignment
+        S_ParameterizedValueAssignment = 205,    // ParameterizedValueAssignment
+        S_ParameterizedValueSetTypeAssignment = 206, // ParameterizedValueSetTypeAssignment
+        S_ParameterizedObjectClassAssignment = 207, // ParameterizedObjectClassAssignment
+        S_ParameterList = 208,                   // ParameterList
+        S_ParameterSeries = 209,                 // ParameterSeries
+        S_Parameter = 210,                       // Parameter
+        S_ParamGovernor = 211,                   // ParamGovernor
+        S_Governor = 212,                        // Governor
+        S_ReferencedObjects = 213,               // ReferencedObjects
+        S_TypeFromObject = 214,                  // TypeFromObject
+        S_InstanceOfType = 215,                  // InstanceOfType
+        S_SimpleDefinedType = 216,               // SimpleDefinedType
+        S_SimpleDefinedValue = 217,              // SimpleDefinedValue
+        S_GeneralConstraint = 218,               // GeneralConstraint
+        S_UserDefinedConstraint = 219,           // UserDefinedConstraint
+        S_UserDefinedConstraintParameter = 220,  // UserDefinedConstraintParameter
+        S_TableConstraint = 221,                 // TableConstraint
+        S_AtNotationList = 222,                  // AtNotationList
+        S_AtNotation = 223,                      // AtNotation
+        S_Level = 224,                           // Level
+        S_ComponentIdList = 225,                 // ComponentIdList
+        S_ContentsConstraint = 226,              // ContentsConstraint
+        S_EncodingControlSections = 227,         // EncodingControlSections
+        S_ModuleIdentifier = 228,                // ModuleIdentifier
+        S_DefinitiveIdentification = 229,        // DefinitiveIdentification
+        S_DefinitiveOID = 230,                   // DefinitiveOID
+        S_DefinitiveOIDandIRI = 231,             // DefinitiveOIDandIRI
+        S_DefinitiveObjIdComponentList = 232,    // DefinitiveObjIdComponentList
+        S_DefinitiveObjIdComponent = 233,        // DefinitiveObjIdComponent
+        S_DefinitiveNumberForm = 234,            // DefinitiveNumberForm
+        S_DefinitiveNameAndNumberForm = 235,     // DefinitiveNameAndNumberForm
+        S_EncodingReferenceDefault = 236,        // EncodingReferenceDefault
+        S_TagDefault = 237,                      // TagDefault
+        S_ExtensionDefault = 238,                // ExtensionDefault
+        S_ModuleBody = 239,                      // ModuleBody
+        S_Exports = 240,                         // Exports
+        S_SymbolsExported = 241,                 // SymbolsExported
+        S_Imports = 242,                         // Imports
+        S_SymbolsImported = 243,                 // SymbolsImported
+        S_SymbolsFromModuleList = 244,           // SymbolsFromModuleList
+        S_SymbolsFromModule = 245,               // SymbolsFromModule
+        S_GlobalModuleReference = 246,           // GlobalModuleReference
+        S_SymbolList = 247,                      // SymbolList
+        S_Symbol = 248,                          // Symbol
+        S_Reference = 249,                       // Reference
+        S_AssignmentList = 250,                  // AssignmentList
+        S_Assignment = 251,                      // Assignment
+        S_DefinedType = 252,                     // DefinedType
+        S_DefinedValue = 253,                    // DefinedValue
+        S_ParameterizedType = 254,               // ParameterizedType
+        S_ParameterizedValue = 255,              // ParameterizedValue
+        S_ActualParameterList = 256,             // ActualParameterList
+        S_ActualParameter = 257,                 // ActualParameter
+        S_ExternalTypeReference = 258,           // ExternalTypeReference
+        S_ExternalValueReference = 259,          // ExternalValueReference
+        S_TypeAssignment = 260,                  // TypeAssignment
+        S_ValueAssignment = 261,                 // ValueAssignment
+        S_ValueSetTypeAssignment = 262,          // ValueSetTypeAssignment
+        S_Type = 263,                            // Type
+        S_BuiltinType = 264,                     // BuiltinType
+        S_NamedType = 265,                       // NamedType
+        S_ValueWithoutTypeIdentifier = 266,      // ValueWithoutTypeIdentifier
+        S_Value = 267,                           // Value
+        S_ValueCommaListChoice = 268,            // ValueCommaListChoice
+        S_ValueChoice = 269,                     // ValueChoice
+        S_ValueSet = 270,                        // ValueSet
+        S_SequenceOfValues = 271,                // SequenceOfValues
+        S_BooleanType = 272,                     // BooleanType
+        S_BooleanValue = 273,                    // BooleanValue
+        S_IntegerType = 274,                     // IntegerType
+        S_NamedNumberList = 275,                 // NamedNumberList
+        S_NamedNumber = 276,                     // NamedNumber
+        S_SignedNumber = 277,                    // SignedNumber
+        S_EnumeratedType = 278,                  // EnumeratedType
+        S_Enumerations = 279,                    // Enumerations
+        S_Enumeration = 280,                     // Enumeration
+        S_EnumerationItem = 281,                 // EnumerationItem
+        S_RealType = 282,                        // RealType
+        S_BitStringType = 283,                   // BitStringType
+        S_NamedBitList = 284,                    // NamedBitList
+        S_NamedBit = 285,                        // NamedBit
+        S_OctetStringType = 286,                 // OctetStringType
+        S_NullType = 287,                        // NullType
+        S_SequenceType = 288,                    // SequenceType
+        S_ComponentTypeLists = 289,              // ComponentTypeLists
+        S_ComponentTypeList = 290,               // ComponentTypeList
+        S_ComponentType = 291,                   // ComponentType
+        S_SequenceOfType = 292,                  // SequenceOfType
+        S_SetType = 293,                         // SetType
+        S_SetOfType = 294,                       // SetOfType
+        S_ChoiceType = 295,                      // ChoiceType
+        S_AlternativeTypeLists = 296,            // AlternativeTypeLists
+        S_RootAlternativeTypeList = 297,         // RootAlternativeTypeList
+        S_AlternativeTypeList = 298,             // AlternativeTypeList
+        S_SelectionType = 299,                   // SelectionType
+        S_PrefixedType = 300,                    // PrefixedType
+        S_TaggedType = 301,                      // TaggedType
+        S_Tag = 302,                             // Tag
+        S_EncodingReference = 303,               // EncodingReference
+        S_ClassNumber = 304,                     // ClassNumber
+        S_Class = 305,                           // Class
+        S_ObjectIdentifierType = 306,            // ObjectIdentifierType
+        S_ObjectIdentifierValue = 307,           // ObjectIdentifierValue
+        S_ObjIdComponentsList = 308,             // ObjIdComponentsList
+        S_ObjIdComponents = 309,                 // ObjIdComponents
+        S_NameForm = 310,                        // NameForm
+        S_NumberForm = 311,                      // NumberForm
+        S_NameAndNumberForm = 312,               // NameAndNumberForm
+        S_RelativeOIDType = 313,                 // RelativeOIDType
+        S_IRIType = 314,                         // IRIType
+        S_IRIValue = 315,                        // IRIValue
+        S_FirstArcIdentifier = 316,              // FirstArcIdentifier
+        S_SubsequentArcIdentifier = 317,         // SubsequentArcIdentifier
+        S_ArcIdentifier = 318,                   // ArcIdentifier
+        S_RelativeIRIType = 319,                 // RelativeIRIType
+        S_EmbeddedPDVType = 320,                 // EmbeddedPDVType
+        S_ExternalType = 321,                    // ExternalType
+        S_TimeType = 322,                        // TimeType
+        S_TimeValue = 323,                       // TimeValue
+        S_DateType = 324,                        // DateType
+        S_TimeOfDayType = 325,                   // TimeOfDayType
+        S_DateTimeType = 326,                    // DateTimeType
+        S_DurationType = 327,                    // DurationType
+        S_CharacterStringType = 328,             // CharacterStringType
+        S_RestrictedCharacterStringType = 329,   // RestrictedCharacterStringType
+        S_UnrestrictedCharacterStringType = 330, // UnrestrictedCharacterStringType
+        S_ConstrainedType = 331,                 // ConstrainedType
+        S_TypeWithConstraint = 332,              // TypeWithConstraint
+        S_Constraint = 333,                      // Constraint
+        S_ConstraintSpec = 334,                  // ConstraintSpec
+        S_SubtypeConstraint = 335,               // SubtypeConstraint
+        S_ElementSetSpecs = 336,                 // ElementSetSpecs
+        S_ElementSetSpec = 337,                  // ElementSetSpec
+        S_Unions = 338,                          // Unions
+        S_UElems = 339,                          // UElems
+        S_Intersections = 340,                   // Intersections
+        S_IElems = 341,                          // IElems
+        S_IntersectionElements = 342,            // IntersectionElements
+        S_Elems = 343,                           // Elems
+        S_Exclusions = 344,                      // Exclusions
+        S_UnionMark = 345,                       // UnionMark
+        S_IntersectionMark = 346,                // IntersectionMark
+        S_Elements = 347,                        // Elements
+        S_SubtypeElements = 348,                 // SubtypeElements
+        S_SingleValue = 349,                     // SingleValue
+        S_ContainedSubtype = 350,                // ContainedSubtype
+        S_Includes = 351,                        // Includes
+        S_ValueRange = 352,                      // ValueRange
+        S_LowerEndpoint = 353,                   // LowerEndpoint
+        S_UpperEndpoint = 354,                   // UpperEndpoint
+        S_LowerEndValue = 355,                   // LowerEndValue
+        S_UpperEndValue = 356,                   // UpperEndValue
+        S_SizeConstraint = 357,                  // SizeConstraint
+        S_TypeConstraint = 358,                  // TypeConstraint
+        S_PermittedAlphabet = 359,               // PermittedAlphabet
+        S_InnerTypeConstraints = 360,            // InnerTypeConstraints
+        S_SingleTypeConstraint = 361,            // SingleTypeConstraint
+        S_MultipleTypeConstraints = 362,         // MultipleTypeConstraints
+        S_TypeConstraints = 363,                 // TypeConstraints
+        S_NamedConstraint = 364,                 // NamedConstraint
+        S_ComponentConstraint = 365,             // ComponentConstraint
+        S_ValueConstraint = 366,                 // ValueConstraint
+        S_PresenceConstraint = 367,              // PresenceConstraint
+        S_PatternConstraint = 368,               // PatternConstraint
+        S_PropertySettings = 369,                // PropertySettings
+        S_ExceptionSpec = 370,                   // ExceptionSpec
+        S_ExceptionIdentification = 371,         // ExceptionIdentification
+        S_typereference = 372,                   // typereference
+        S_identifier = 373,                      // identifier
+        S_valuereference = 374,                  // valuereference
+        S_modulereference = 375,                 // modulereference
+        S_objectclassreference = 376,            // objectclassreference
+        S_word = 377                             // word
+      };
+    };
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get ().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -1104,20 +1543,381 @@ namespace yy {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ()
+      basic_symbol () YY_NOEXCEPT
         : value ()
         , location ()
       {}
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      basic_symbol (basic_symbol&& that);
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_ObjectClassAssignment: // ObjectClassAssignment
+      case symbol_kind::S_ObjectSetAssignment: // ObjectSetAssignment
+      case symbol_kind::S_ParameterizedAssignment: // ParameterizedAssignment
+      case symbol_kind::S_ParameterizedTypeAssignment: // ParameterizedTypeAssignment
+      case symbol_kind::S_ParameterizedValueAssignment: // ParameterizedValueAssignment
+      case symbol_kind::S_ParameterizedValueSetTypeAssignment: // ParameterizedValueSetTypeAssignment
+      case symbol_kind::S_ParameterizedObjectClassAssignment: // ParameterizedObjectClassAssignment
+      case symbol_kind::S_Assignment: // Assignment
+      case symbol_kind::S_TypeAssignment: // TypeAssignment
+      case symbol_kind::S_ValueAssignment: // ValueAssignment
+      case symbol_kind::S_ValueSetTypeAssignment: // ValueSetTypeAssignment
+        value.move< Assignment > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_BitStringType: // BitStringType
+        value.move< BitStringType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_BooleanType: // BooleanType
+        value.move< BooleanType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_BooleanValue: // BooleanValue
+        value.move< BooleanValue > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_BuiltinType: // BuiltinType
+        value.move< BuiltinType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_CharacterStringType: // CharacterStringType
+      case symbol_kind::S_RestrictedCharacterStringType: // RestrictedCharacterStringType
+      case symbol_kind::S_UnrestrictedCharacterStringType: // UnrestrictedCharacterStringType
+        value.move< CharacterStringType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ChoiceType: // ChoiceType
+        value.move< ChoiceType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_Class: // Class
+        value.move< Class > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ComponentTypeLists: // ComponentTypeLists
+        value.move< Collection > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ComponentType: // ComponentType
+        value.move< ComponentType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ComponentTypeList: // ComponentTypeList
+        value.move< ComponentTypeList > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_Constraint: // Constraint
+      case symbol_kind::S_ConstraintSpec: // ConstraintSpec
+      case symbol_kind::S_SubtypeConstraint: // SubtypeConstraint
+      case symbol_kind::S_ElementSetSpecs: // ElementSetSpecs
+      case symbol_kind::S_ElementSetSpec: // ElementSetSpec
+      case symbol_kind::S_Unions: // Unions
+      case symbol_kind::S_UElems: // UElems
+      case symbol_kind::S_Intersections: // Intersections
+      case symbol_kind::S_IElems: // IElems
+      case symbol_kind::S_IntersectionElements: // IntersectionElements
+      case symbol_kind::S_Elems: // Elems
+      case symbol_kind::S_Elements: // Elements
+      case symbol_kind::S_SubtypeElements: // SubtypeElements
+      case symbol_kind::S_ValueRange: // ValueRange
+      case symbol_kind::S_SizeConstraint: // SizeConstraint
+        value.move< Constraint > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_DateTimeType: // DateTimeType
+        value.move< DateTimeType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_DateType: // DateType
+        value.move< DateType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_DefinedType: // DefinedType
+      case symbol_kind::S_ParameterizedType: // ParameterizedType
+      case symbol_kind::S_ExternalTypeReference: // ExternalTypeReference
+        value.move< DefinedType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_DefinedValue: // DefinedValue
+        value.move< DefinedValue > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_DurationType: // DurationType
+        value.move< DurationType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_EmbeddedPDVType: // EmbeddedPDVType
+        value.move< EmbeddedPDVType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_EnumeratedType: // EnumeratedType
+      case symbol_kind::S_Enumerations: // Enumerations
+      case symbol_kind::S_Enumeration: // Enumeration
+        value.move< EnumeratedType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_EnumerationItem: // EnumerationItem
+        value.move< EnumerationValue > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ExternalType: // ExternalType
+        value.move< ExternalType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_IRIType: // IRIType
+        value.move< IRIType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_SymbolsFromModule: // SymbolsFromModule
+        value.move< Import > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_InstanceOfType: // InstanceOfType
+        value.move< InstanceOfType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_IntegerType: // IntegerType
+        value.move< IntegerType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ModuleBody: // ModuleBody
+        value.move< Module > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_NamedNumber: // NamedNumber
+        value.move< NamedNumber > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_NamedType: // NamedType
+        value.move< NamedType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_NullType: // NullType
+        value.move< NullType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ObjectClass: // ObjectClass
+      case symbol_kind::S_ObjectClassDefn: // ObjectClassDefn
+        value.move< ObjectClassAssignment > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ObjectClassFieldType: // ObjectClassFieldType
+        value.move< ObjectClassFieldType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ObjIdComponents: // ObjIdComponents
+      case symbol_kind::S_NameForm: // NameForm
+      case symbol_kind::S_NumberForm: // NumberForm
+      case symbol_kind::S_NameAndNumberForm: // NameAndNumberForm
+        value.move< ObjectIdComponentValue > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ObjectIdentifierType: // ObjectIdentifierType
+        value.move< ObjectIdentifierType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_OctetStringType: // OctetStringType
+        value.move< OctetStringType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_Parameter: // Parameter
+        value.move< Parameter > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_PrefixedType: // PrefixedType
+        value.move< PrefixedType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_RealType: // RealType
+        value.move< RealType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_RelativeIRIType: // RelativeIRIType
+        value.move< RelativeIRIType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_RelativeOIDType: // RelativeOIDType
+        value.move< RelativeOIDType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_SequenceOfType: // SequenceOfType
+        value.move< SequenceOfType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_SequenceType: // SequenceType
+        value.move< SequenceType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_SetOfType: // SetOfType
+        value.move< SetOfType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_SetType: // SetType
+        value.move< SetType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_Tag: // Tag
+        value.move< Tag > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_TaggedType: // TaggedType
+        value.move< TaggedType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_TagDefault: // TagDefault
+        value.move< TaggingMode > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_TimeOfDayType: // TimeOfDayType
+        value.move< TimeOfDayType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_TimeType: // TimeType
+        value.move< TimeType > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_TimeValue: // TimeValue
+        value.move< TimeValue > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ParamGovernor: // ParamGovernor
+      case symbol_kind::S_Governor: // Governor
+      case symbol_kind::S_ActualParameter: // ActualParameter
+      case symbol_kind::S_Type: // Type
+      case symbol_kind::S_ConstrainedType: // ConstrainedType
+      case symbol_kind::S_TypeWithConstraint: // TypeWithConstraint
+        value.move< Type > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ValueWithoutTypeIdentifier: // ValueWithoutTypeIdentifier
+      case symbol_kind::S_Value: // Value
+      case symbol_kind::S_SingleValue: // SingleValue
+        value.move< Value > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_LowerEndpoint: // LowerEndpoint
+      case symbol_kind::S_UpperEndpoint: // UpperEndpoint
+      case symbol_kind::S_LowerEndValue: // LowerEndValue
+      case symbol_kind::S_UpperEndValue: // UpperEndValue
+        value.move< absl::optional<ConstraintBound> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_realnumber: // realnumber
+        value.move< double > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ClassNumber: // ClassNumber
+        value.move< int > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_negativenumber: // negativenumber
+      case symbol_kind::S_SignedNumber: // SignedNumber
+        value.move< int64_t > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_bstring: // bstring
+      case symbol_kind::S_xmlbstring: // xmlbstring
+      case symbol_kind::S_hstring: // hstring
+      case symbol_kind::S_xmlhstring: // xmlhstring
+      case symbol_kind::S_cstring: // cstring
+      case symbol_kind::S_xmlcstring: // xmlcstring
+      case symbol_kind::S_simplestring: // simplestring
+      case symbol_kind::S_xmltstring: // xmltstring
+      case symbol_kind::S_objectreference: // objectreference
+      case symbol_kind::S_typefieldreference: // typefieldreference
+      case symbol_kind::S_valuefieldreference: // valuefieldreference
+      case symbol_kind::S_GENERIC_IDENTIFIER_UPPERCASE: // GENERIC_IDENTIFIER_UPPERCASE
+      case symbol_kind::S_GENERIC_IDENTIFIER_LOWERCASE: // GENERIC_IDENTIFIER_LOWERCASE
+      case symbol_kind::S_UsefulObjectClassReference: // UsefulObjectClassReference
+      case symbol_kind::S_FieldName: // FieldName
+      case symbol_kind::S_SimpleDefinedType: // SimpleDefinedType
+      case symbol_kind::S_ModuleIdentifier: // ModuleIdentifier
+      case symbol_kind::S_GlobalModuleReference: // GlobalModuleReference
+      case symbol_kind::S_Symbol: // Symbol
+      case symbol_kind::S_Reference: // Reference
+      case symbol_kind::S_typereference: // typereference
+      case symbol_kind::S_identifier: // identifier
+      case symbol_kind::S_valuereference: // valuereference
+      case symbol_kind::S_modulereference: // modulereference
+      case symbol_kind::S_objectclassreference: // objectclassreference
+      case symbol_kind::S_word: // word
+        value.move< std::string > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_AssignmentList: // AssignmentList
+        value.move< std::vector<Assignment> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_FieldSpecList: // FieldSpecList
+      case symbol_kind::S_FieldSpec: // FieldSpec
+      case symbol_kind::S_TypeFieldSpec: // TypeFieldSpec
+      case symbol_kind::S_FixedTypeValueFieldSpec: // FixedTypeValueFieldSpec
+        value.move< std::vector<ClassField> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_Exports: // Exports
+        value.move< std::vector<Export> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_Imports: // Imports
+      case symbol_kind::S_SymbolsImported: // SymbolsImported
+      case symbol_kind::S_SymbolsFromModuleList: // SymbolsFromModuleList
+        value.move< std::vector<Import> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_NamedNumberList: // NamedNumberList
+        value.move< std::vector<NamedNumber> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_AlternativeTypeLists: // AlternativeTypeLists
+      case symbol_kind::S_RootAlternativeTypeList: // RootAlternativeTypeList
+      case symbol_kind::S_AlternativeTypeList: // AlternativeTypeList
+        value.move< std::vector<NamedType> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ObjectIdentifierValue: // ObjectIdentifierValue
+      case symbol_kind::S_ObjIdComponentsList: // ObjIdComponentsList
+        value.move< std::vector<ObjectIdComponentValue> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ParameterList: // ParameterList
+      case symbol_kind::S_ParameterSeries: // ParameterSeries
+        value.move< std::vector<Parameter> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_ActualParameterList: // ActualParameterList
+        value.move< std::vector<Type> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_SequenceOfValues: // SequenceOfValues
+        value.move< std::vector<Value> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_FieldNameList: // FieldNameList
+      case symbol_kind::S_OneOrManyTypeFieldReference: // OneOrManyTypeFieldReference
+      case symbol_kind::S_SymbolList: // SymbolList
+        value.move< std::vector<std::string> > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
 #endif
 
       /// Copy constructor.
       basic_symbol (const basic_symbol& that);
 
-      /// Constructor for valueless symbols, and symbols from each type.
+      /// Constructors for typed symbols.
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, location_type&& l)
         : Base (t)
@@ -1129,6 +1929,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, Assignment&& v, location_type&& l)
         : Base (t)
@@ -1142,6 +1943,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, BitStringType&& v, location_type&& l)
         : Base (t)
@@ -1155,6 +1957,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, BooleanType&& v, location_type&& l)
         : Base (t)
@@ -1168,6 +1971,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, BooleanValue&& v, location_type&& l)
         : Base (t)
@@ -1181,6 +1985,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, BuiltinType&& v, location_type&& l)
         : Base (t)
@@ -1194,6 +1999,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, CharacterStringType&& v, location_type&& l)
         : Base (t)
@@ -1207,6 +2013,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ChoiceType&& v, location_type&& l)
         : Base (t)
@@ -1220,6 +2027,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, Class&& v, location_type&& l)
         : Base (t)
@@ -1233,6 +2041,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, Collection&& v, location_type&& l)
         : Base (t)
@@ -1246,6 +2055,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ComponentType&& v, location_type&& l)
         : Base (t)
@@ -1259,6 +2069,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ComponentTypeList&& v, location_type&& l)
         : Base (t)
@@ -1272,6 +2083,21 @@ namespace yy {
         , location (l)
       {}
 #endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, Constraint&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const Constraint& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, DateTimeType&& v, location_type&& l)
         : Base (t)
@@ -1285,6 +2111,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, DateType&& v, location_type&& l)
         : Base (t)
@@ -1298,6 +2125,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, DefinedType&& v, location_type&& l)
         : Base (t)
@@ -1311,6 +2139,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, DefinedValue&& v, location_type&& l)
         : Base (t)
@@ -1324,6 +2153,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, DurationType&& v, location_type&& l)
         : Base (t)
@@ -1337,6 +2167,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, EmbeddedPDVType&& v, location_type&& l)
         : Base (t)
@@ -1350,6 +2181,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, EnumeratedType&& v, location_type&& l)
         : Base (t)
@@ -1363,6 +2195,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, EnumerationValue&& v, location_type&& l)
         : Base (t)
@@ -1376,6 +2209,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ExternalType&& v, location_type&& l)
         : Base (t)
@@ -1389,6 +2223,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, IRIType&& v, location_type&& l)
         : Base (t)
@@ -1402,6 +2237,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, Import&& v, location_type&& l)
         : Base (t)
@@ -1415,6 +2251,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, InstanceOfType&& v, location_type&& l)
         : Base (t)
@@ -1428,6 +2265,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, IntegerType&& v, location_type&& l)
         : Base (t)
@@ -1441,6 +2279,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, Module&& v, location_type&& l)
         : Base (t)
@@ -1454,6 +2293,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, NamedNumber&& v, location_type&& l)
         : Base (t)
@@ -1467,6 +2307,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, NamedType&& v, location_type&& l)
         : Base (t)
@@ -1480,6 +2321,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, NullType&& v, location_type&& l)
         : Base (t)
@@ -1493,6 +2335,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ObjectClassAssignment&& v, location_type&& l)
         : Base (t)
@@ -1506,6 +2349,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ObjectClassFieldType&& v, location_type&& l)
         : Base (t)
@@ -1519,6 +2363,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ObjectIdComponentValue&& v, location_type&& l)
         : Base (t)
@@ -1532,6 +2377,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ObjectIdentifierType&& v, location_type&& l)
         : Base (t)
@@ -1545,6 +2391,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, OctetStringType&& v, location_type&& l)
         : Base (t)
@@ -1558,6 +2405,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, Parameter&& v, location_type&& l)
         : Base (t)
@@ -1571,6 +2419,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, PrefixedType&& v, location_type&& l)
         : Base (t)
@@ -1584,6 +2433,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, RealType&& v, location_type&& l)
         : Base (t)
@@ -1597,6 +2447,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, RelativeIRIType&& v, location_type&& l)
         : Base (t)
@@ -1610,6 +2461,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, RelativeOIDType&& v, location_type&& l)
         : Base (t)
@@ -1623,6 +2475,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, SequenceOfType&& v, location_type&& l)
         : Base (t)
@@ -1636,6 +2489,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, SequenceType&& v, location_type&& l)
         : Base (t)
@@ -1649,6 +2503,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, SetOfType&& v, location_type&& l)
         : Base (t)
@@ -1662,6 +2517,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, SetType&& v, location_type&& l)
         : Base (t)
@@ -1675,6 +2531,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, Tag&& v, location_type&& l)
         : Base (t)
@@ -1688,6 +2545,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, TaggedType&& v, location_type&& l)
         : Base (t)
@@ -1701,6 +2559,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, TaggingMode&& v, location_type&& l)
         : Base (t)
@@ -1714,6 +2573,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, TimeOfDayType&& v, location_type&& l)
         : Base (t)
@@ -1727,6 +2587,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, TimeType&& v, location_type&& l)
         : Base (t)
@@ -1740,6 +2601,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, TimeValue&& v, location_type&& l)
         : Base (t)
@@ -1753,6 +2615,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, Type&& v, location_type&& l)
         : Base (t)
@@ -1766,6 +2629,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, Value&& v, location_type&& l)
         : Base (t)
@@ -1779,6 +2643,21 @@ namespace yy {
         , location (l)
       {}
 #endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, absl::optional<ConstraintBound>&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const absl::optional<ConstraintBound>& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
         : Base (t)
@@ -1792,6 +2671,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, int&& v, location_type&& l)
         : Base (t)
@@ -1805,6 +2685,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
         : Base (t)
@@ -1818,6 +2699,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
         : Base (t)
@@ -1831,6 +2713,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::vector<Assignment>&& v, location_type&& l)
         : Base (t)
@@ -1844,6 +2727,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::vector<ClassField>&& v, location_type&& l)
         : Base (t)
@@ -1857,6 +2741,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::vector<Export>&& v, location_type&& l)
         : Base (t)
@@ -1870,6 +2755,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::vector<Import>&& v, location_type&& l)
         : Base (t)
@@ -1883,6 +2769,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::vector<NamedNumber>&& v, location_type&& l)
         : Base (t)
@@ -1896,6 +2783,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::vector<NamedType>&& v, location_type&& l)
         : Base (t)
@@ -1909,6 +2797,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::vector<ObjectIdComponentValue>&& v, location_type&& l)
         : Base (t)
@@ -1922,6 +2811,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::vector<Parameter>&& v, location_type&& l)
         : Base (t)
@@ -1935,6 +2825,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::vector<Type>&& v, location_type&& l)
         : Base (t)
@@ -1948,6 +2839,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::vector<Value>&& v, location_type&& l)
         : Base (t)
@@ -1961,6 +2853,7 @@ namespace yy {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::vector<std::string>&& v, location_type&& l)
         : Base (t)
@@ -1981,344 +2874,371 @@ namespace yy {
         clear ();
       }
 
+
+
       /// Destroy contents, and record that is empty.
-      void clear ()
+      void clear () YY_NOEXCEPT
       {
         // User destructor.
-        symbol_number_type yytype = this->type_get ();
+        symbol_kind_type yykind = this->kind ();
         basic_symbol<Base>& yysym = *this;
         (void) yysym;
-        switch (yytype)
+        switch (yykind)
         {
        default:
           break;
         }
 
-        // Type destructor.
-switch (yytype)
+        // Value type destructor.
+switch (yykind)
     {
-      case 160: // ObjectClassAssignment
-      case 199: // ObjectSetAssignment
-      case 203: // ParameterizedAssignment
-      case 204: // ParameterizedTypeAssignment
-      case 205: // ParameterizedValueAssignment
-      case 206: // ParameterizedValueSetTypeAssignment
-      case 207: // ParameterizedObjectClassAssignment
-      case 251: // Assignment
-      case 260: // TypeAssignment
-      case 261: // ValueAssignment
-      case 262: // ValueSetTypeAssignment
+      case symbol_kind::S_ObjectClassAssignment: // ObjectClassAssignment
+      case symbol_kind::S_ObjectSetAssignment: // ObjectSetAssignment
+      case symbol_kind::S_ParameterizedAssignment: // ParameterizedAssignment
+      case symbol_kind::S_ParameterizedTypeAssignment: // ParameterizedTypeAssignment
+      case symbol_kind::S_ParameterizedValueAssignment: // ParameterizedValueAssignment
+      case symbol_kind::S_ParameterizedValueSetTypeAssignment: // ParameterizedValueSetTypeAssignment
+      case symbol_kind::S_ParameterizedObjectClassAssignment: // ParameterizedObjectClassAssignment
+      case symbol_kind::S_Assignment: // Assignment
+      case symbol_kind::S_TypeAssignment: // TypeAssignment
+      case symbol_kind::S_ValueAssignment: // ValueAssignment
+      case symbol_kind::S_ValueSetTypeAssignment: // ValueSetTypeAssignment
         value.template destroy< Assignment > ();
         break;
 
-      case 283: // BitStringType
+      case symbol_kind::S_BitStringType: // BitStringType
         value.template destroy< BitStringType > ();
         break;
 
-      case 272: // BooleanType
+      case symbol_kind::S_BooleanType: // BooleanType
         value.template destroy< BooleanType > ();
         break;
 
-      case 273: // BooleanValue
+      case symbol_kind::S_BooleanValue: // BooleanValue
         value.template destroy< BooleanValue > ();
         break;
 
-      case 264: // BuiltinType
+      case symbol_kind::S_BuiltinType: // BuiltinType
         value.template destroy< BuiltinType > ();
         break;
 
-      case 328: // CharacterStringType
-      case 329: // RestrictedCharacterStringType
-      case 330: // UnrestrictedCharacterStringType
+      case symbol_kind::S_CharacterStringType: // CharacterStringType
+      case symbol_kind::S_RestrictedCharacterStringType: // RestrictedCharacterStringType
+      case symbol_kind::S_UnrestrictedCharacterStringType: // UnrestrictedCharacterStringType
         value.template destroy< CharacterStringType > ();
         break;
 
-      case 295: // ChoiceType
+      case symbol_kind::S_ChoiceType: // ChoiceType
         value.template destroy< ChoiceType > ();
         break;
 
-      case 305: // Class
+      case symbol_kind::S_Class: // Class
         value.template destroy< Class > ();
         break;
 
-      case 289: // ComponentTypeLists
+      case symbol_kind::S_ComponentTypeLists: // ComponentTypeLists
         value.template destroy< Collection > ();
         break;
 
-      case 291: // ComponentType
+      case symbol_kind::S_ComponentType: // ComponentType
         value.template destroy< ComponentType > ();
         break;
 
-      case 290: // ComponentTypeList
+      case symbol_kind::S_ComponentTypeList: // ComponentTypeList
         value.template destroy< ComponentTypeList > ();
         break;
 
-      case 326: // DateTimeType
+      case symbol_kind::S_Constraint: // Constraint
+      case symbol_kind::S_ConstraintSpec: // ConstraintSpec
+      case symbol_kind::S_SubtypeConstraint: // SubtypeConstraint
+      case symbol_kind::S_ElementSetSpecs: // ElementSetSpecs
+      case symbol_kind::S_ElementSetSpec: // ElementSetSpec
+      case symbol_kind::S_Unions: // Unions
+      case symbol_kind::S_UElems: // UElems
+      case symbol_kind::S_Intersections: // Intersections
+      case symbol_kind::S_IElems: // IElems
+      case symbol_kind::S_IntersectionElements: // IntersectionElements
+      case symbol_kind::S_Elems: // Elems
+      case symbol_kind::S_Elements: // Elements
+      case symbol_kind::S_SubtypeElements: // SubtypeElements
+      case symbol_kind::S_ValueRange: // ValueRange
+      case symbol_kind::S_SizeConstraint: // SizeConstraint
+        value.template destroy< Constraint > ();
+        break;
+
+      case symbol_kind::S_DateTimeType: // DateTimeType
         value.template destroy< DateTimeType > ();
         break;
 
-      case 324: // DateType
+      case symbol_kind::S_DateType: // DateType
         value.template destroy< DateType > ();
         break;
 
-      case 252: // DefinedType
-      case 254: // ParameterizedType
-      case 258: // ExternalTypeReference
+      case symbol_kind::S_DefinedType: // DefinedType
+      case symbol_kind::S_ParameterizedType: // ParameterizedType
+      case symbol_kind::S_ExternalTypeReference: // ExternalTypeReference
         value.template destroy< DefinedType > ();
         break;
 
-      case 253: // DefinedValue
+      case symbol_kind::S_DefinedValue: // DefinedValue
         value.template destroy< DefinedValue > ();
         break;
 
-      case 327: // DurationType
+      case symbol_kind::S_DurationType: // DurationType
         value.template destroy< DurationType > ();
         break;
 
-      case 320: // EmbeddedPDVType
+      case symbol_kind::S_EmbeddedPDVType: // EmbeddedPDVType
         value.template destroy< EmbeddedPDVType > ();
         break;
 
-      case 278: // EnumeratedType
-      case 279: // Enumerations
-      case 280: // Enumeration
+      case symbol_kind::S_EnumeratedType: // EnumeratedType
+      case symbol_kind::S_Enumerations: // Enumerations
+      case symbol_kind::S_Enumeration: // Enumeration
         value.template destroy< EnumeratedType > ();
         break;
 
-      case 281: // EnumerationItem
+      case symbol_kind::S_EnumerationItem: // EnumerationItem
         value.template destroy< EnumerationValue > ();
         break;
 
-      case 321: // ExternalType
+      case symbol_kind::S_ExternalType: // ExternalType
         value.template destroy< ExternalType > ();
         break;
 
-      case 314: // IRIType
+      case symbol_kind::S_IRIType: // IRIType
         value.template destroy< IRIType > ();
         break;
 
-      case 245: // SymbolsFromModule
+      case symbol_kind::S_SymbolsFromModule: // SymbolsFromModule
         value.template destroy< Import > ();
         break;
 
-      case 215: // InstanceOfType
+      case symbol_kind::S_InstanceOfType: // InstanceOfType
         value.template destroy< InstanceOfType > ();
         break;
 
-      case 274: // IntegerType
+      case symbol_kind::S_IntegerType: // IntegerType
         value.template destroy< IntegerType > ();
         break;
 
-      case 239: // ModuleBody
+      case symbol_kind::S_ModuleBody: // ModuleBody
         value.template destroy< Module > ();
         break;
 
-      case 276: // NamedNumber
+      case symbol_kind::S_NamedNumber: // NamedNumber
         value.template destroy< NamedNumber > ();
         break;
 
-      case 265: // NamedType
+      case symbol_kind::S_NamedType: // NamedType
         value.template destroy< NamedType > ();
         break;
 
-      case 287: // NullType
+      case symbol_kind::S_NullType: // NullType
         value.template destroy< NullType > ();
         break;
 
-      case 161: // ObjectClass
-      case 162: // ObjectClassDefn
+      case symbol_kind::S_ObjectClass: // ObjectClass
+      case symbol_kind::S_ObjectClassDefn: // ObjectClassDefn
         value.template destroy< ObjectClassAssignment > ();
         break;
 
-      case 202: // ObjectClassFieldType
+      case symbol_kind::S_ObjectClassFieldType: // ObjectClassFieldType
         value.template destroy< ObjectClassFieldType > ();
         break;
 
-      case 309: // ObjIdComponents
-      case 310: // NameForm
-      case 311: // NumberForm
-      case 312: // NameAndNumberForm
+      case symbol_kind::S_ObjIdComponents: // ObjIdComponents
+      case symbol_kind::S_NameForm: // NameForm
+      case symbol_kind::S_NumberForm: // NumberForm
+      case symbol_kind::S_NameAndNumberForm: // NameAndNumberForm
         value.template destroy< ObjectIdComponentValue > ();
         break;
 
-      case 306: // ObjectIdentifierType
+      case symbol_kind::S_ObjectIdentifierType: // ObjectIdentifierType
         value.template destroy< ObjectIdentifierType > ();
         break;
 
-      case 286: // OctetStringType
+      case symbol_kind::S_OctetStringType: // OctetStringType
         value.template destroy< OctetStringType > ();
         break;
 
-      case 210: // Parameter
+      case symbol_kind::S_Parameter: // Parameter
         value.template destroy< Parameter > ();
         break;
 
-      case 300: // PrefixedType
+      case symbol_kind::S_PrefixedType: // PrefixedType
         value.template destroy< PrefixedType > ();
         break;
 
-      case 282: // RealType
+      case symbol_kind::S_RealType: // RealType
         value.template destroy< RealType > ();
         break;
 
-      case 319: // RelativeIRIType
+      case symbol_kind::S_RelativeIRIType: // RelativeIRIType
         value.template destroy< RelativeIRIType > ();
         break;
 
-      case 313: // RelativeOIDType
+      case symbol_kind::S_RelativeOIDType: // RelativeOIDType
         value.template destroy< RelativeOIDType > ();
         break;
 
-      case 292: // SequenceOfType
+      case symbol_kind::S_SequenceOfType: // SequenceOfType
         value.template destroy< SequenceOfType > ();
         break;
 
-      case 288: // SequenceType
+      case symbol_kind::S_SequenceType: // SequenceType
         value.template destroy< SequenceType > ();
         break;
 
-      case 294: // SetOfType
+      case symbol_kind::S_SetOfType: // SetOfType
         value.template destroy< SetOfType > ();
         break;
 
-      case 293: // SetType
+      case symbol_kind::S_SetType: // SetType
         value.template destroy< SetType > ();
         break;
 
-      case 302: // Tag
+      case symbol_kind::S_Tag: // Tag
         value.template destroy< Tag > ();
         break;
 
-      case 301: // TaggedType
+      case symbol_kind::S_TaggedType: // TaggedType
         value.template destroy< TaggedType > ();
         break;
 
-      case 237: // TagDefault
+      case symbol_kind::S_TagDefault: // TagDefault
         value.template destroy< TaggingMode > ();
         break;
 
-      case 325: // TimeOfDayType
+      case symbol_kind::S_TimeOfDayType: // TimeOfDayType
         value.template destroy< TimeOfDayType > ();
         break;
 
-      case 322: // TimeType
+      case symbol_kind::S_TimeType: // TimeType
         value.template destroy< TimeType > ();
         break;
 
-      case 323: // TimeValue
+      case symbol_kind::S_TimeValue: // TimeValue
         value.template destroy< TimeValue > ();
         break;
 
-      case 211: // ParamGovernor
-      case 212: // Governor
-      case 257: // ActualParameter
-      case 263: // Type
-      case 331: // ConstrainedType
-      case 332: // TypeWithConstraint
+      case symbol_kind::S_ParamGovernor: // ParamGovernor
+      case symbol_kind::S_Governor: // Governor
+      case symbol_kind::S_ActualParameter: // ActualParameter
+      case symbol_kind::S_Type: // Type
+      case symbol_kind::S_ConstrainedType: // ConstrainedType
+      case symbol_kind::S_TypeWithConstraint: // TypeWithConstraint
         value.template destroy< Type > ();
         break;
 
-      case 266: // ValueWithoutTypeIdentifier
-      case 267: // Value
-      case 349: // SingleValue
+      case symbol_kind::S_ValueWithoutTypeIdentifier: // ValueWithoutTypeIdentifier
+      case symbol_kind::S_Value: // Value
+      case symbol_kind::S_SingleValue: // SingleValue
         value.template destroy< Value > ();
         break;
 
-      case 6: // realnumber
+      case symbol_kind::S_LowerEndpoint: // LowerEndpoint
+      case symbol_kind::S_UpperEndpoint: // UpperEndpoint
+      case symbol_kind::S_LowerEndValue: // LowerEndValue
+      case symbol_kind::S_UpperEndValue: // UpperEndValue
+        value.template destroy< absl::optional<ConstraintBound> > ();
+        break;
+
+      case symbol_kind::S_realnumber: // realnumber
         value.template destroy< double > ();
         break;
 
-      case 304: // ClassNumber
+      case symbol_kind::S_ClassNumber: // ClassNumber
         value.template destroy< int > ();
         break;
 
-      case 4: // number
-      case 5: // negativenumber
-      case 277: // SignedNumber
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_negativenumber: // negativenumber
+      case symbol_kind::S_SignedNumber: // SignedNumber
         value.template destroy< int64_t > ();
         break;
 
-      case 7: // bstring
-      case 8: // xmlbstring
-      case 9: // hstring
-      case 10: // xmlhstring
-      case 11: // cstring
-      case 12: // xmlcstring
-      case 13: // simplestring
-      case 14: // xmltstring
-      case 22: // objectreference
-      case 24: // typefieldreference
-      case 25: // valuefieldreference
-      case 149: // GENERIC_IDENTIFIER_UPPERCASE
-      case 150: // GENERIC_IDENTIFIER_LOWERCASE
-      case 159: // UsefulObjectClassReference
-      case 165: // FieldName
-      case 216: // SimpleDefinedType
-      case 228: // ModuleIdentifier
-      case 246: // GlobalModuleReference
-      case 248: // Symbol
-      case 249: // Reference
-      case 372: // typereference
-      case 373: // identifier
-      case 374: // valuereference
-      case 375: // modulereference
-      case 376: // objectclassreference
-      case 377: // word
+      case symbol_kind::S_bstring: // bstring
+      case symbol_kind::S_xmlbstring: // xmlbstring
+      case symbol_kind::S_hstring: // hstring
+      case symbol_kind::S_xmlhstring: // xmlhstring
+      case symbol_kind::S_cstring: // cstring
+      case symbol_kind::S_xmlcstring: // xmlcstring
+      case symbol_kind::S_simplestring: // simplestring
+      case symbol_kind::S_xmltstring: // xmltstring
+      case symbol_kind::S_objectreference: // objectreference
+      case symbol_kind::S_typefieldreference: // typefieldreference
+      case symbol_kind::S_valuefieldreference: // valuefieldreference
+      case symbol_kind::S_GENERIC_IDENTIFIER_UPPERCASE: // GENERIC_IDENTIFIER_UPPERCASE
+      case symbol_kind::S_GENERIC_IDENTIFIER_LOWERCASE: // GENERIC_IDENTIFIER_LOWERCASE
+      case symbol_kind::S_UsefulObjectClassReference: // UsefulObjectClassReference
+      case symbol_kind::S_FieldName: // FieldName
+      case symbol_kind::S_SimpleDefinedType: // SimpleDefinedType
+      case symbol_kind::S_ModuleIdentifier: // ModuleIdentifier
+      case symbol_kind::S_GlobalModuleReference: // GlobalModuleReference
+      case symbol_kind::S_Symbol: // Symbol
+      case symbol_kind::S_Reference: // Reference
+      case symbol_kind::S_typereference: // typereference
+      case symbol_kind::S_identifier: // identifier
+      case symbol_kind::S_valuereference: // valuereference
+      case symbol_kind::S_modulereference: // modulereference
+      case symbol_kind::S_objectclassreference: // objectclassreference
+      case symbol_kind::S_word: // word
         value.template destroy< std::string > ();
         break;
 
-      case 250: // AssignmentList
+      case symbol_kind::S_AssignmentList: // AssignmentList
         value.template destroy< std::vector<Assignment> > ();
         break;
 
-      case 163: // FieldSpecList
-      case 164: // FieldSpec
-      case 167: // TypeFieldSpec
-      case 171: // FixedTypeValueFieldSpec
+      case symbol_kind::S_FieldSpecList: // FieldSpecList
+      case symbol_kind::S_FieldSpec: // FieldSpec
+      case symbol_kind::S_TypeFieldSpec: // TypeFieldSpec
+      case symbol_kind::S_FixedTypeValueFieldSpec: // FixedTypeValueFieldSpec
         value.template destroy< std::vector<ClassField> > ();
         break;
 
-      case 240: // Exports
+      case symbol_kind::S_Exports: // Exports
         value.template destroy< std::vector<Export> > ();
         break;
 
-      case 242: // Imports
-      case 243: // SymbolsImported
-      case 244: // SymbolsFromModuleList
+      case symbol_kind::S_Imports: // Imports
+      case symbol_kind::S_SymbolsImported: // SymbolsImported
+      case symbol_kind::S_SymbolsFromModuleList: // SymbolsFromModuleList
         value.template destroy< std::vector<Import> > ();
         break;
 
-      case 275: // NamedNumberList
+      case symbol_kind::S_NamedNumberList: // NamedNumberList
         value.template destroy< std::vector<NamedNumber> > ();
         break;
 
-      case 296: // AlternativeTypeLists
-      case 297: // RootAlternativeTypeList
-      case 298: // AlternativeTypeList
+      case symbol_kind::S_AlternativeTypeLists: // AlternativeTypeLists
+      case symbol_kind::S_RootAlternativeTypeList: // RootAlternativeTypeList
+      case symbol_kind::S_AlternativeTypeList: // AlternativeTypeList
         value.template destroy< std::vector<NamedType> > ();
         break;
 
-      case 307: // ObjectIdentifierValue
-      case 308: // ObjIdComponentsList
+      case symbol_kind::S_ObjectIdentifierValue: // ObjectIdentifierValue
+      case symbol_kind::S_ObjIdComponentsList: // ObjIdComponentsList
         value.template destroy< std::vector<ObjectIdComponentValue> > ();
         break;
 
-      case 208: // ParameterList
-      case 209: // ParameterSeries
+      case symbol_kind::S_ParameterList: // ParameterList
+      case symbol_kind::S_ParameterSeries: // ParameterSeries
         value.template destroy< std::vector<Parameter> > ();
         break;
 
-      case 256: // ActualParameterList
+      case symbol_kind::S_ActualParameterList: // ActualParameterList
         value.template destroy< std::vector<Type> > ();
         break;
 
-      case 271: // SequenceOfValues
+      case symbol_kind::S_SequenceOfValues: // SequenceOfValues
         value.template destroy< std::vector<Value> > ();
         break;
 
-      case 166: // FieldNameList
-      case 168: // OneOrManyTypeFieldReference
-      case 247: // SymbolList
+      case symbol_kind::S_FieldNameList: // FieldNameList
+      case symbol_kind::S_OneOrManyTypeFieldReference: // OneOrManyTypeFieldReference
+      case symbol_kind::S_SymbolList: // SymbolList
         value.template destroy< std::vector<std::string> > ();
         break;
 
@@ -2329,6 +3249,15 @@ switch (yytype)
         Base::clear ();
       }
 
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return asn1_parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
       /// Whether empty.
       bool empty () const YY_NOEXCEPT;
 
@@ -2336,7 +3265,7 @@ switch (yytype)
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
@@ -2349,112 +3278,127 @@ switch (yytype)
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      by_type (by_type&& that);
+      by_kind (by_kind&& that) YY_NOEXCEPT;
 #endif
 
       /// Copy constructor.
-      by_type (const by_type& that);
-
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const YY_NOEXCEPT;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const YY_NOEXCEPT;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
     /// "External" symbols: returned by the scanner.
-    struct symbol_type : basic_symbol<by_type>
+    struct symbol_type : basic_symbol<by_kind>
     {
       /// Superclass.
-      typedef basic_symbol<by_type> super_type;
+      typedef basic_symbol<by_kind> super_type;
 
       /// Empty symbol.
-      symbol_type () {}
+      symbol_type () YY_NOEXCEPT {}
 
       /// Constructor for valueless symbols, and symbols from each type.
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, location_type l)
-        : super_type(token_type (tok), std::move (l))
-      {
-        YYASSERT (tok == token::END_OF_FILE || tok == token::comment || tok == token::psname || tok == token::encodingreference || tok == token::integerUnicodeLabel || tok == 273 || tok == 274 || tok == token::tstring || tok == 276 || tok == token::objectsetreference || tok == token::valuesetfieldreference || tok == token::objectfieldreference || tok == token::objectsetfieldreference || tok == token::ABSENT || tok == token::ABSTRACT_SYNTAX || tok == token::ALL || tok == token::ANY || tok == token::APPLICATION || tok == token::ASN_NULL || tok == token::AUTOMATIC || tok == token::BEGIN || tok == token::BIT || tok == token::BMPString || tok == token::BOOLEAN || tok == token::BY || tok == token::CHARACTER || tok == token::CHOICE || tok == token::CLASS || tok == token::COMPONENT || tok == token::COMPONENTS || tok == token::CONSTRAINED || tok == token::CONTAINING || tok == token::DATE || tok == token::DATE_TIME || tok == token::DEFAULT || tok == token::DEFINITIONS || tok == token::DURATION || tok == token::EMBEDDED || tok == token::ENCODED || tok == token::ENCODING_CONTROL || tok == token::END || tok == token::ENUMERATED || tok == token::EXCEPT || tok == token::EXPLICIT || tok == token::EXPORTS || tok == token::EXTENSIBILITY || tok == token::EXTERNAL || tok == token::FALSE || tok == token::FROM || tok == token::GeneralizedTime || tok == token::GeneralString || tok == token::GraphicString || tok == token::IA5String || tok == token::IDENTIFIER || tok == token::IMPLICIT || tok == token::IMPLIED || tok == token::IMPORTS || tok == token::INCLUDES || tok == token::INSTANCE || tok == token::INSTRUCTIONS || tok == token::INTEGER || tok == token::INTERSECTION || tok == token::ISO646String || tok == token::MAX || tok == token::MIN || tok == token::MINUS_INFINITY || tok == token::NOT_A_NUMBER || tok == token::NumericString || tok == token::OBJECT || tok == token::ObjectDescriptor || tok == token::OCTET || tok == token::OF || tok == token::OID_IRI || tok == token::OPTIONAL || tok == token::PATTERN || tok == token::PDV || tok == token::PLUS_INFINITY || tok == token::PRESENT || tok == token::PrintableString || tok == token::PRIVATE || tok == token::REAL || tok == token::RELATIVE_OID || tok == token::RELATIVE_OID_IRI || tok == token::SEQUENCE || tok == token::SET || tok == token::SETTINGS || tok == token::SIZE || tok == token::STRING || tok == token::SYNTAX || tok == token::T61String || tok == token::TAGS || tok == token::TeletexString || tok == token::TIME || tok == token::TIME_OF_DAY || tok == token::TRUE || tok == token::TYPE_IDENTIFIER || tok == token::UNION || tok == token::UNIQUE || tok == token::UNIVERSAL || tok == token::UniversalString || tok == token::UTCTime || tok == token::UTF8String || tok == token::VideotexString || tok == token::VisibleString || tok == token::WITH || tok == token::DEFINED_AS || tok == token::ELIPSIS || tok == token::RANGE || tok == token::OPEN_BRACE || tok == token::CLOSE_BRACE || tok == token::OPEN_PARENTHESIS || tok == token::CLOSE_PARENTHESIS || tok == token::OPEN_SQUARE_BRACKET || tok == token::CLOSE_SQUARE_BRACKET || tok == token::LESS_THAN || tok == token::GREATER_THAN || tok == token::EXCLAMATION_MARK || tok == token::QUOTATION_MARK || tok == token::AMPERSAND || tok == token::APOSTROPHE || tok == token::ASTERISK || tok == token::COMMA || tok == token::FULL_STOP || tok == token::HYPHEN_MINUS || tok == token::SOLIDUS || tok == token::COLON || tok == token::SEMICOLON || tok == token::EQUALS_SIGN || tok == token::AT || tok == token::VERTICAL_LINE || tok == token::ACCENT || tok == token::PLUS || tok == token::STAR || tok == token::GENERIC_INTEGER || tok == token::xmlasn1typename);
-      }
+        : super_type (token_kind_type (tok), std::move (l))
 #else
       symbol_type (int tok, const location_type& l)
-        : super_type(token_type (tok), l)
+        : super_type (token_kind_type (tok), l)
+#endif
       {
-        YYASSERT (tok == token::END_OF_FILE || tok == token::comment || tok == token::psname || tok == token::encodingreference || tok == token::integerUnicodeLabel || tok == 273 || tok == 274 || tok == token::tstring || tok == 276 || tok == token::objectsetreference || tok == token::valuesetfieldreference || tok == token::objectfieldreference || tok == token::objectsetfieldreference || tok == token::ABSENT || tok == token::ABSTRACT_SYNTAX || tok == token::ALL || tok == token::ANY || tok == token::APPLICATION || tok == token::ASN_NULL || tok == token::AUTOMATIC || tok == token::BEGIN || tok == token::BIT || tok == token::BMPString || tok == token::BOOLEAN || tok == token::BY || tok == token::CHARACTER || tok == token::CHOICE || tok == token::CLASS || tok == token::COMPONENT || tok == token::COMPONENTS || tok == token::CONSTRAINED || tok == token::CONTAINING || tok == token::DATE || tok == token::DATE_TIME || tok == token::DEFAULT || tok == token::DEFINITIONS || tok == token::DURATION || tok == token::EMBEDDED || tok == token::ENCODED || tok == token::ENCODING_CONTROL || tok == token::END || tok == token::ENUMERATED || tok == token::EXCEPT || tok == token::EXPLICIT || tok == token::EXPORTS || tok == token::EXTENSIBILITY || tok == token::EXTERNAL || tok == token::FALSE || tok == token::FROM || tok == token::GeneralizedTime || tok == token::GeneralString || tok == token::GraphicString || tok == token::IA5String || tok == token::IDENTIFIER || tok == token::IMPLICIT || tok == token::IMPLIED || tok == token::IMPORTS || tok == token::INCLUDES || tok == token::INSTANCE || tok == token::INSTRUCTIONS || tok == token::INTEGER || tok == token::INTERSECTION || tok == token::ISO646String || tok == token::MAX || tok == token::MIN || tok == token::MINUS_INFINITY || tok == token::NOT_A_NUMBER || tok == token::NumericString || tok == token::OBJECT || tok == token::ObjectDescriptor || tok == token::OCTET || tok == token::OF || tok == token::OID_IRI || tok == token::OPTIONAL || tok == token::PATTERN || tok == token::PDV || tok == token::PLUS_INFINITY || tok == token::PRESENT || tok == token::PrintableString || tok == token::PRIVATE || tok == token::REAL || tok == token::RELATIVE_OID || tok == token::RELATIVE_OID_IRI || tok == token::SEQUENCE || tok == token::SET || tok == token::SETTINGS || tok == token::SIZE || tok == token::STRING || tok == token::SYNTAX || tok == token::T61String || tok == token::TAGS || tok == token::TeletexString || tok == token::TIME || tok == token::TIME_OF_DAY || tok == token::TRUE || tok == token::TYPE_IDENTIFIER || tok == token::UNION || tok == token::UNIQUE || tok == token::UNIVERSAL || tok == token::UniversalString || tok == token::UTCTime || tok == token::UTF8String || tok == token::VideotexString || tok == token::VisibleString || tok == token::WITH || tok == token::DEFINED_AS || tok == token::ELIPSIS || tok == token::RANGE || tok == token::OPEN_BRACE || tok == token::CLOSE_BRACE || tok == token::OPEN_PARENTHESIS || tok == token::CLOSE_PARENTHESIS || tok == token::OPEN_SQUARE_BRACKET || tok == token::CLOSE_SQUARE_BRACKET || tok == token::LESS_THAN || tok == token::GREATER_THAN || tok == token::EXCLAMATION_MARK || tok == token::QUOTATION_MARK || tok == token::AMPERSAND || tok == token::APOSTROPHE || tok == token::ASTERISK || tok == token::COMMA || tok == token::FULL_STOP || tok == token::HYPHEN_MINUS || tok == token::SOLIDUS || tok == token::COLON || tok == token::SEMICOLON || tok == token::EQUALS_SIGN || tok == token::AT || tok == token::VERTICAL_LINE || tok == token::ACCENT || tok == token::PLUS || tok == token::STAR || tok == token::GENERIC_INTEGER || tok == token::xmlasn1typename);
-      }
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT (tok == token::END_OF_FILE
+                   || (token::YYerror <= tok && tok <= token::comment)
+                   || (token::psname <= tok && tok <= 276)
+                   || tok == token::objectsetreference
+                   || (token::valuesetfieldreference <= tok && tok <= token::STAR)
+                   || (token::GENERIC_INTEGER <= tok && tok <= token::xmlasn1typename));
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, double v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::realnumber);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const double& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::realnumber);
-      }
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT (tok == token::realnumber);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, int64_t v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::number || tok == token::negativenumber);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const int64_t& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::number || tok == token::negativenumber);
-      }
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT ((token::number <= tok && tok <= token::negativenumber));
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, std::string v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::bstring || tok == token::xmlbstring || tok == token::hstring || tok == token::xmlhstring || tok == token::cstring || tok == token::xmlcstring || tok == token::simplestring || tok == token::xmltstring || tok == token::objectreference || tok == token::typefieldreference || tok == token::valuefieldreference || tok == token::GENERIC_IDENTIFIER_UPPERCASE || tok == token::GENERIC_IDENTIFIER_LOWERCASE);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const std::string& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::bstring || tok == token::xmlbstring || tok == token::hstring || tok == token::xmlhstring || tok == token::cstring || tok == token::xmlcstring || tok == token::simplestring || tok == token::xmltstring || tok == token::objectreference || tok == token::typefieldreference || tok == token::valuefieldreference || tok == token::GENERIC_IDENTIFIER_UPPERCASE || tok == token::GENERIC_IDENTIFIER_LOWERCASE);
-      }
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT ((token::bstring <= tok && tok <= token::xmltstring)
+                   || tok == token::objectreference
+                   || (token::typefieldreference <= tok && tok <= token::valuefieldreference)
+                   || (token::GENERIC_IDENTIFIER_UPPERCASE <= tok && tok <= token::GENERIC_IDENTIFIER_LOWERCASE));
 #endif
+      }
     };
 
     /// Build a parser object.
     asn1_parser (Context& context__yyarg);
     virtual ~asn1_parser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    asn1_parser (const asn1_parser&) = delete;
+    /// Non copyable.
+    asn1_parser& operator= (const asn1_parser&) = delete;
+#endif
+
     /// Parse.  An alias for parse ().
     /// \returns  0 iff parsing succeeded.
     int operator() ();
@@ -2485,7 +3429,11 @@ switch (yytype)
     /// Report a syntax error.
     void error (const syntax_error& err);
 
-    // Implementation of make_symbol for each symbol type.
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
+
+    // Implementation of make_symbol for each token kind.
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -2501,6 +3449,36 @@ switch (yytype)
         return symbol_type (token::END_OF_FILE, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYerror (location_type l)
+      {
+        return symbol_type (token::YYerror, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYerror (const location_type& l)
+      {
+        return symbol_type (token::YYerror, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYUNDEF (location_type l)
+      {
+        return symbol_type (token::YYUNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYUNDEF (const location_type& l)
+      {
+        return symbol_type (token::YYUNDEF, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -4708,93 +5686,119 @@ switch (yytype)
 #endif
 
 
+    class context
+    {
+    public:
+      context (const asn1_parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
+
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
+
+    private:
+      const asn1_parser& yyparser_;
+      const symbol_type& yyla_;
+    };
+
   private:
-    /// This class is not copyable.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
     asn1_parser (const asn1_parser&);
+    /// Non copyable.
     asn1_parser& operator= (const asn1_parser&);
+#endif
 
-    /// State numbers.
-    typedef int state_type;
 
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
 
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
+
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
     /// Compute post-reduction state.
     /// \param yystate   the current state
     /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
     /// Whether the given \c yypact_ value indicates a defaulted state.
     /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
     /// Whether the given \c yytable_ value indicates a syntax error.
     /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
     static const short yypact_ninf_;
     static const short yytable_ninf_;
 
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short yypact_[];
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
+
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned short yydefact_[];
 
-  // YYPGOTO[NTERM-NUM].
-  static const short yypgoto_[];
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  // YYDEFGOTO[NTERM-NUM].
-  static const short yydefgoto_[];
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const short yydefact_[];
 
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const short yytable_[];
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
 
-  static const short yycheck_[];
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned short yystos_[];
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned short yyr1_[];
+    static const short yycheck_[];
 
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const short yystos_[];
 
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const short yyr1_[];
 
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
 
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
 #if YYDEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short yyrline_[];
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
     /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
+    virtual void yy_reduce_print_ (int r) const;
     /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
+    virtual void yy_stack_print_ () const;
 
     /// Debugging level.
     int yydebug_;
     /// Debug stream.
     std::ostream* yycdebug_;
 
-    /// \brief Display a symbol type, value and location.
+    /// \brief Display a symbol kind, value and location.
     /// \param yyo    The output stream.
     /// \param yysym  The symbol.
     template <typename Base>
@@ -4815,7 +5819,7 @@ switch (yytype)
       /// Default constructor.
       by_state () YY_NOEXCEPT;
 
-      /// The symbol type as needed by the constructor.
+      /// The symbol kind as needed by the constructor.
       typedef state_type kind_type;
 
       /// Constructor.
@@ -4827,15 +5831,16 @@ switch (yytype)
       /// Record that this symbol is empty.
       void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
+      /// Steal the symbol kind from \a that.
       void move (by_state& that);
 
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const YY_NOEXCEPT;
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
       /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
       /// The state.
       /// \a empty when empty.
@@ -4857,6 +5862,10 @@ switch (yytype)
       /// Assignment, needed by push_back by some old implementations.
       /// Moves the contents of that.
       stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
 #endif
     };
 
@@ -4866,48 +5875,38 @@ switch (yytype)
     {
     public:
       // Hide our reversed order.
-      typedef typename S::reverse_iterator iterator;
-      typedef typename S::const_reverse_iterator const_iterator;
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
       typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
 
-      stack (size_type n = 200)
+      stack (size_type n = 200) YY_NOEXCEPT
         : seq_ (n)
       {}
 
-      /// Random access.
-      ///
-      /// Index 0 returns the topmost element.
-      T&
-      operator[] (size_type i)
-      {
-        return seq_[size () - 1 - i];
-      }
-
-      /// Random access.
-      ///
-      /// Index 0 returns the topmost element.
-      T&
-      operator[] (int i)
-      {
-        return operator[] (size_type (i));
-      }
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
 
       /// Random access.
       ///
       /// Index 0 returns the topmost element.
       const T&
-      operator[] (size_type i) const
+      operator[] (index_type i) const
       {
-        return seq_[size () - 1 - i];
+        return seq_[size_type (size () - 1 - i)];
       }
 
       /// Random access.
       ///
       /// Index 0 returns the topmost element.
-      const T&
-      operator[] (int i) const
+      T&
+      operator[] (index_type i)
       {
-        return operator[] (size_type (i));
+        return seq_[size_type (size () - 1 - i)];
       }
 
       /// Steal the contents of \a t.
@@ -4922,7 +5921,7 @@ switch (yytype)
 
       /// Pop elements from the stack.
       void
-      pop (int n = 1) YY_NOEXCEPT
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
       {
         for (; 0 < n; --n)
           seq_.pop_back ();
@@ -4936,49 +5935,53 @@ switch (yytype)
       }
 
       /// Number of elements on the stack.
-      size_type
+      index_type
       size () const YY_NOEXCEPT
       {
-        return seq_.size ();
+        return index_type (seq_.size ());
       }
 
       /// Iterator on top of the stack (going downwards).
       const_iterator
       begin () const YY_NOEXCEPT
       {
-        return seq_.rbegin ();
+        return seq_.begin ();
       }
 
       /// Bottom of the stack.
       const_iterator
       end () const YY_NOEXCEPT
       {
-        return seq_.rend ();
+        return seq_.end ();
       }
 
       /// Present a slice of the top of a stack.
       class slice
       {
       public:
-        slice (const stack& stack, int range)
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
           : stack_ (stack)
           , range_ (range)
         {}
 
         const T&
-        operator[] (int i) const
+        operator[] (index_type i) const
         {
           return stack_[range_ - i];
         }
 
       private:
         const stack& stack_;
-        int range_;
+        index_type range_;
       };
 
     private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
       stack (const stack&);
+      /// Non copyable.
       stack& operator= (const stack&);
+#endif
       /// The wrapped container.
       S seq_;
     };
@@ -5006,32 +6009,29 @@ switch (yytype)
     void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
     /// Pop \a n symbols from the stack.
-    void yypop_ (int n = 1);
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
     /// Constants.
     enum
     {
-      yyeof_ = 0,
       yylast_ = 5042,     ///< Last index in yytable_.
       yynnts_ = 225,  ///< Number of nonterminal symbols.
-      yyfinal_ = 6, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 153  ///< Number of tokens.
+      yyfinal_ = 6 ///< Termination state number.
     };
 
 
     // User arguments.
     Context& context_;
+
   };
 
-  asn1_parser::token_number_type
-  asn1_parser::yytranslate_ (token_type t)
+  asn1_parser::symbol_kind_type
+  asn1_parser::yytranslate_ (int t) YY_NOEXCEPT
   {
     // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
     // TOKEN-NUM as returned by yylex.
     static
-    const token_number_type
+    const unsigned char
     translate_table[] =
     {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -5076,689 +6076,373 @@ switch (yytype)
      135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
      145,   146,   147,   148,   149,   150,   151,   152
     };
-    const unsigned user_token_number_max_ = 407;
-    const token_number_type undef_token_ = 2;
+    // Last valid token kind.
+    const int code_max = 407;
 
-    if (static_cast<int> (t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned> (t) <= user_token_number_max_)
-      return translate_table[t];
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
     else
-      return undef_token_;
+      return symbol_kind::S_YYUNDEF;
   }
 
   // basic_symbol.
-#if 201103L <= YY_CPLUSPLUS
   template <typename Base>
-  asn1_parser::basic_symbol<Base>::basic_symbol (basic_symbol&& that)
-    : Base (std::move (that))
+  asn1_parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
     , value ()
-    , location (std::move (that.location))
+    , location (that.location)
   {
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 160: // ObjectClassAssignment
-      case 199: // ObjectSetAssignment
-      case 203: // ParameterizedAssignment
-      case 204: // ParameterizedTypeAssignment
-      case 205: // ParameterizedValueAssignment
-      case 206: // ParameterizedValueSetTypeAssignment
-      case 207: // ParameterizedObjectClassAssignment
-      case 251: // Assignment
-      case 260: // TypeAssignment
-      case 261: // ValueAssignment
-      case 262: // ValueSetTypeAssignment
-        value.move< Assignment > (std::move (that.value));
+      case symbol_kind::S_ObjectClassAssignment: // ObjectClassAssignment
+      case symbol_kind::S_ObjectSetAssignment: // ObjectSetAssignment
+      case symbol_kind::S_ParameterizedAssignment: // ParameterizedAssignment
+      case symbol_kind::S_ParameterizedTypeAssignment: // ParameterizedTypeAssignment
+      case symbol_kind::S_ParameterizedValueAssignment: // ParameterizedValueAssignment
+      case symbol_kind::S_ParameterizedValueSetTypeAssignment: // ParameterizedValueSetTypeAssignment
+      case symbol_kind::S_ParameterizedObjectClassAssignment: // ParameterizedObjectClassAssignment
+      case symbol_kind::S_Assignment: // Assignment
+      case symbol_kind::S_TypeAssignment: // TypeAssignment
+      case symbol_kind::S_ValueAssignment: // ValueAssignment
+      case symbol_kind::S_ValueSetTypeAssignment: // ValueSetTypeAssignment
+        value.copy< Assignment > (YY_MOVE (that.value));
         break;
 
-      case 283: // BitStringType
-        value.move< BitStringType > (std::move (that.value));
+      case symbol_kind::S_BitStringType: // BitStringType
+        value.copy< BitStringType > (YY_MOVE (that.value));
         break;
 
-      case 272: // BooleanType
-        value.move< BooleanType > (std::move (that.value));
+      case symbol_kind::S_BooleanType: // BooleanType
+        value.copy< BooleanType > (YY_MOVE (that.value));
         break;
 
-      case 273: // BooleanValue
-        value.move< BooleanValue > (std::move (that.value));
+      case symbol_kind::S_BooleanValue: // BooleanValue
+        value.copy< BooleanValue > (YY_MOVE (that.value));
         break;
 
-      case 264: // BuiltinType
-        value.move< BuiltinType > (std::move (that.value));
+      case symbol_kind::S_BuiltinType: // BuiltinType
+        value.copy< BuiltinType > (YY_MOVE (that.value));
         break;
 
-      case 328: // CharacterStringType
-      case 329: // RestrictedCharacterStringType
-      case 330: // UnrestrictedCharacterStringType
-        value.move< CharacterStringType > (std::move (that.value));
+      case symbol_kind::S_CharacterStringType: // CharacterStringType
+      case symbol_kind::S_RestrictedCharacterStringType: // RestrictedCharacterStringType
+      case symbol_kind::S_UnrestrictedCharacterStringType: // UnrestrictedCharacterStringType
+        value.copy< CharacterStringType > (YY_MOVE (that.value));
         break;
 
-      case 295: // ChoiceType
-        value.move< ChoiceType > (std::move (that.value));
+      case symbol_kind::S_ChoiceType: // ChoiceType
+        value.copy< ChoiceType > (YY_MOVE (that.value));
         break;
 
-      case 305: // Class
-        value.move< Class > (std::move (that.value));
+      case symbol_kind::S_Class: // Class
+        value.copy< Class > (YY_MOVE (that.value));
         break;
 
-      case 289: // ComponentTypeLists
-        value.move< Collection > (std::move (that.value));
+      case symbol_kind::S_ComponentTypeLists: // ComponentTypeLists
+        value.copy< Collection > (YY_MOVE (that.value));
         break;
 
-      case 291: // ComponentType
-        value.move< ComponentType > (std::move (that.value));
+      case symbol_kind::S_ComponentType: // ComponentType
+        value.copy< ComponentType > (YY_MOVE (that.value));
         break;
 
-      case 290: // ComponentTypeList
-        value.move< ComponentTypeList > (std::move (that.value));
+      case symbol_kind::S_ComponentTypeList: // ComponentTypeList
+        value.copy< ComponentTypeList > (YY_MOVE (that.value));
         break;
 
-      case 326: // DateTimeType
-        value.move< DateTimeType > (std::move (that.value));
+      case symbol_kind::S_Constraint: // Constraint
+      case symbol_kind::S_ConstraintSpec: // ConstraintSpec
+      case symbol_kind::S_SubtypeConstraint: // SubtypeConstraint
+      case symbol_kind::S_ElementSetSpecs: // ElementSetSpecs
+      case symbol_kind::S_ElementSetSpec: // ElementSetSpec
+      case symbol_kind::S_Unions: // Unions
+      case symbol_kind::S_UElems: // UElems
+      case symbol_kind::S_Intersections: // Intersections
+      case symbol_kind::S_IElems: // IElems
+      case symbol_kind::S_IntersectionElements: // IntersectionElements
+      case symbol_kind::S_Elems: // Elems
+      case symbol_kind::S_Elements: // Elements
+      case symbol_kind::S_SubtypeElements: // SubtypeElements
+      case symbol_kind::S_ValueRange: // ValueRange
+      case symbol_kind::S_SizeConstraint: // SizeConstraint
+        value.copy< Constraint > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_DateTimeType: // DateTimeType
+        value.copy< DateTimeType > (YY_MOVE (that.value));
         break;
 
-      case 324: // DateType
-        value.move< DateType > (std::move (that.value));
+      case symbol_kind::S_DateType: // DateType
+        value.copy< DateType > (YY_MOVE (that.value));
         break;
 
-      case 252: // DefinedType
-      case 254: // ParameterizedType
-      case 258: // ExternalTypeReference
-        value.move< DefinedType > (std::move (that.value));
+      case symbol_kind::S_DefinedType: // DefinedType
+      case symbol_kind::S_ParameterizedType: // ParameterizedType
+      case symbol_kind::S_ExternalTypeReference: // ExternalTypeReference
+        value.copy< DefinedType > (YY_MOVE (that.value));
         break;
 
-      case 253: // DefinedValue
-        value.move< DefinedValue > (std::move (that.value));
+      case symbol_kind::S_DefinedValue: // DefinedValue
+        value.copy< DefinedValue > (YY_MOVE (that.value));
         break;
 
-      case 327: // DurationType
-        value.move< DurationType > (std::move (that.value));
+      case symbol_kind::S_DurationType: // DurationType
+        value.copy< DurationType > (YY_MOVE (that.value));
         break;
 
-      case 320: // EmbeddedPDVType
-        value.move< EmbeddedPDVType > (std::move (that.value));
+      case symbol_kind::S_EmbeddedPDVType: // EmbeddedPDVType
+        value.copy< EmbeddedPDVType > (YY_MOVE (that.value));
         break;
 
-      case 278: // EnumeratedType
-      case 279: // Enumerations
-      case 280: // Enumeration
-        value.move< EnumeratedType > (std::move (that.value));
+      case symbol_kind::S_EnumeratedType: // EnumeratedType
+      case symbol_kind::S_Enumerations: // Enumerations
+      case symbol_kind::S_Enumeration: // Enumeration
+        value.copy< EnumeratedType > (YY_MOVE (that.value));
         break;
 
-      case 281: // EnumerationItem
-        value.move< EnumerationValue > (std::move (that.value));
+      case symbol_kind::S_EnumerationItem: // EnumerationItem
+        value.copy< EnumerationValue > (YY_MOVE (that.value));
         break;
 
-      case 321: // ExternalType
-        value.move< ExternalType > (std::move (that.value));
+      case symbol_kind::S_ExternalType: // ExternalType
+        value.copy< ExternalType > (YY_MOVE (that.value));
         break;
 
-      case 314: // IRIType
-        value.move< IRIType > (std::move (that.value));
+      case symbol_kind::S_IRIType: // IRIType
+        value.copy< IRIType > (YY_MOVE (that.value));
         break;
 
-      case 245: // SymbolsFromModule
-        value.move< Import > (std::move (that.value));
+      case symbol_kind::S_SymbolsFromModule: // SymbolsFromModule
+        value.copy< Import > (YY_MOVE (that.value));
         break;
 
-      case 215: // InstanceOfType
-        value.move< InstanceOfType > (std::move (that.value));
+      case symbol_kind::S_InstanceOfType: // InstanceOfType
+        value.copy< InstanceOfType > (YY_MOVE (that.value));
         break;
 
-      case 274: // IntegerType
-        value.move< IntegerType > (std::move (that.value));
+      case symbol_kind::S_IntegerType: // IntegerType
+        value.copy< IntegerType > (YY_MOVE (that.value));
         break;
 
-      case 239: // ModuleBody
-        value.move< Module > (std::move (that.value));
+      case symbol_kind::S_ModuleBody: // ModuleBody
+        value.copy< Module > (YY_MOVE (that.value));
         break;
 
-      case 276: // NamedNumber
-        value.move< NamedNumber > (std::move (that.value));
+      case symbol_kind::S_NamedNumber: // NamedNumber
+        value.copy< NamedNumber > (YY_MOVE (that.value));
         break;
 
-      case 265: // NamedType
-        value.move< NamedType > (std::move (that.value));
+      case symbol_kind::S_NamedType: // NamedType
+        value.copy< NamedType > (YY_MOVE (that.value));
         break;
 
-      case 287: // NullType
-        value.move< NullType > (std::move (that.value));
+      case symbol_kind::S_NullType: // NullType
+        value.copy< NullType > (YY_MOVE (that.value));
         break;
 
-      case 161: // ObjectClass
-      case 162: // ObjectClassDefn
-        value.move< ObjectClassAssignment > (std::move (that.value));
+      case symbol_kind::S_ObjectClass: // ObjectClass
+      case symbol_kind::S_ObjectClassDefn: // ObjectClassDefn
+        value.copy< ObjectClassAssignment > (YY_MOVE (that.value));
         break;
 
-      case 202: // ObjectClassFieldType
-        value.move< ObjectClassFieldType > (std::move (that.value));
+      case symbol_kind::S_ObjectClassFieldType: // ObjectClassFieldType
+        value.copy< ObjectClassFieldType > (YY_MOVE (that.value));
         break;
 
-      case 309: // ObjIdComponents
-      case 310: // NameForm
-      case 311: // NumberForm
-      case 312: // NameAndNumberForm
-        value.move< ObjectIdComponentValue > (std::move (that.value));
+      case symbol_kind::S_ObjIdComponents: // ObjIdComponents
+      case symbol_kind::S_NameForm: // NameForm
+      case symbol_kind::S_NumberForm: // NumberForm
+      case symbol_kind::S_NameAndNumberForm: // NameAndNumberForm
+        value.copy< ObjectIdComponentValue > (YY_MOVE (that.value));
         break;
 
-      case 306: // ObjectIdentifierType
-        value.move< ObjectIdentifierType > (std::move (that.value));
+      case symbol_kind::S_ObjectIdentifierType: // ObjectIdentifierType
+        value.copy< ObjectIdentifierType > (YY_MOVE (that.value));
         break;
 
-      case 286: // OctetStringType
-        value.move< OctetStringType > (std::move (that.value));
+      case symbol_kind::S_OctetStringType: // OctetStringType
+        value.copy< OctetStringType > (YY_MOVE (that.value));
         break;
 
-      case 210: // Parameter
-        value.move< Parameter > (std::move (that.value));
-        break;
-
-      case 300: // PrefixedType
-        value.move< PrefixedType > (std::move (that.value));
-        break;
-
-      case 282: // RealType
-        value.move< RealType > (std::move (that.value));
-        break;
-
-      case 319: // RelativeIRIType
-        value.move< RelativeIRIType > (std::move (that.value));
-        break;
-
-      case 313: // RelativeOIDType
-        value.move< RelativeOIDType > (std::move (that.value));
-        break;
-
-      case 292: // SequenceOfType
-        value.move< SequenceOfType > (std::move (that.value));
-        break;
-
-      case 288: // SequenceType
-        value.move< SequenceType > (std::move (that.value));
-        break;
-
-      case 294: // SetOfType
-        value.move< SetOfType > (std::move (that.value));
-        break;
-
-      case 293: // SetType
-        value.move< SetType > (std::move (that.value));
-        break;
-
-      case 302: // Tag
-        value.move< Tag > (std::move (that.value));
-        break;
-
-      case 301: // TaggedType
-        value.move< TaggedType > (std::move (that.value));
-        break;
-
-      case 237: // TagDefault
-        value.move< TaggingMode > (std::move (that.value));
-        break;
-
-      case 325: // TimeOfDayType
-        value.move< TimeOfDayType > (std::move (that.value));
-        break;
-
-      case 322: // TimeType
-        value.move< TimeType > (std::move (that.value));
-        break;
-
-      case 323: // TimeValue
-        value.move< TimeValue > (std::move (that.value));
-        break;
-
-      case 211: // ParamGovernor
-      case 212: // Governor
-      case 257: // ActualParameter
-      case 263: // Type
-      case 331: // ConstrainedType
-      case 332: // TypeWithConstraint
-        value.move< Type > (std::move (that.value));
-        break;
-
-      case 266: // ValueWithoutTypeIdentifier
-      case 267: // Value
-      case 349: // SingleValue
-        value.move< Value > (std::move (that.value));
-        break;
-
-      case 6: // realnumber
-        value.move< double > (std::move (that.value));
-        break;
-
-      case 304: // ClassNumber
-        value.move< int > (std::move (that.value));
-        break;
-
-      case 4: // number
-      case 5: // negativenumber
-      case 277: // SignedNumber
-        value.move< int64_t > (std::move (that.value));
-        break;
-
-      case 7: // bstring
-      case 8: // xmlbstring
-      case 9: // hstring
-      case 10: // xmlhstring
-      case 11: // cstring
-      case 12: // xmlcstring
-      case 13: // simplestring
-      case 14: // xmltstring
-      case 22: // objectreference
-      case 24: // typefieldreference
-      case 25: // valuefieldreference
-      case 149: // GENERIC_IDENTIFIER_UPPERCASE
-      case 150: // GENERIC_IDENTIFIER_LOWERCASE
-      case 159: // UsefulObjectClassReference
-      case 165: // FieldName
-      case 216: // SimpleDefinedType
-      case 228: // ModuleIdentifier
-      case 246: // GlobalModuleReference
-      case 248: // Symbol
-      case 249: // Reference
-      case 372: // typereference
-      case 373: // identifier
-      case 374: // valuereference
-      case 375: // modulereference
-      case 376: // objectclassreference
-      case 377: // word
-        value.move< std::string > (std::move (that.value));
-        break;
-
-      case 250: // AssignmentList
-        value.move< std::vector<Assignment> > (std::move (that.value));
-        break;
-
-      case 163: // FieldSpecList
-      case 164: // FieldSpec
-      case 167: // TypeFieldSpec
-      case 171: // FixedTypeValueFieldSpec
-        value.move< std::vector<ClassField> > (std::move (that.value));
-        break;
-
-      case 240: // Exports
-        value.move< std::vector<Export> > (std::move (that.value));
-        break;
-
-      case 242: // Imports
-      case 243: // SymbolsImported
-      case 244: // SymbolsFromModuleList
-        value.move< std::vector<Import> > (std::move (that.value));
-        break;
-
-      case 275: // NamedNumberList
-        value.move< std::vector<NamedNumber> > (std::move (that.value));
-        break;
-
-      case 296: // AlternativeTypeLists
-      case 297: // RootAlternativeTypeList
-      case 298: // AlternativeTypeList
-        value.move< std::vector<NamedType> > (std::move (that.value));
-        break;
-
-      case 307: // ObjectIdentifierValue
-      case 308: // ObjIdComponentsList
-        value.move< std::vector<ObjectIdComponentValue> > (std::move (that.value));
-        break;
-
-      case 208: // ParameterList
-      case 209: // ParameterSeries
-        value.move< std::vector<Parameter> > (std::move (that.value));
-        break;
-
-      case 256: // ActualParameterList
-        value.move< std::vector<Type> > (std::move (that.value));
-        break;
-
-      case 271: // SequenceOfValues
-        value.move< std::vector<Value> > (std::move (that.value));
-        break;
-
-      case 166: // FieldNameList
-      case 168: // OneOrManyTypeFieldReference
-      case 247: // SymbolList
-        value.move< std::vector<std::string> > (std::move (that.value));
-        break;
-
-      default:
-        break;
-    }
-
-  }
-#endif
-
-  template <typename Base>
-  asn1_parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
-    : Base (that)
-    , value ()
-    , location (that.location)
-  {
-    switch (this->type_get ())
-    {
-      case 160: // ObjectClassAssignment
-      case 199: // ObjectSetAssignment
-      case 203: // ParameterizedAssignment
-      case 204: // ParameterizedTypeAssignment
-      case 205: // ParameterizedValueAssignment
-      case 206: // ParameterizedValueSetTypeAssignment
-      case 207: // ParameterizedObjectClassAssignment
-      case 251: // Assignment
-      case 260: // TypeAssignment
-      case 261: // ValueAssignment
-      case 262: // ValueSetTypeAssignment
-        value.copy< Assignment > (YY_MOVE (that.value));
-        break;
-
-      case 283: // BitStringType
-        value.copy< BitStringType > (YY_MOVE (that.value));
-        break;
-
-      case 272: // BooleanType
-        value.copy< BooleanType > (YY_MOVE (that.value));
-        break;
-
-      case 273: // BooleanValue
-        value.copy< BooleanValue > (YY_MOVE (that.value));
-        break;
-
-      case 264: // BuiltinType
-        value.copy< BuiltinType > (YY_MOVE (that.value));
-        break;
-
-      case 328: // CharacterStringType
-      case 329: // RestrictedCharacterStringType
-      case 330: // UnrestrictedCharacterStringType
-        value.copy< CharacterStringType > (YY_MOVE (that.value));
-        break;
-
-      case 295: // ChoiceType
-        value.copy< ChoiceType > (YY_MOVE (that.value));
-        break;
-
-      case 305: // Class
-        value.copy< Class > (YY_MOVE (that.value));
-        break;
-
-      case 289: // ComponentTypeLists
-        value.copy< Collection > (YY_MOVE (that.value));
-        break;
-
-      case 291: // ComponentType
-        value.copy< ComponentType > (YY_MOVE (that.value));
-        break;
-
-      case 290: // ComponentTypeList
-        value.copy< ComponentTypeList > (YY_MOVE (that.value));
-        break;
-
-      case 326: // DateTimeType
-        value.copy< DateTimeType > (YY_MOVE (that.value));
-        break;
-
-      case 324: // DateType
-        value.copy< DateType > (YY_MOVE (that.value));
-        break;
-
-      case 252: // DefinedType
-      case 254: // ParameterizedType
-      case 258: // ExternalTypeReference
-        value.copy< DefinedType > (YY_MOVE (that.value));
-        break;
-
-      case 253: // DefinedValue
-        value.copy< DefinedValue > (YY_MOVE (that.value));
-        break;
-
-      case 327: // DurationType
-        value.copy< DurationType > (YY_MOVE (that.value));
-        break;
-
-      case 320: // EmbeddedPDVType
-        value.copy< EmbeddedPDVType > (YY_MOVE (that.value));
-        break;
-
-      case 278: // EnumeratedType
-      case 279: // Enumerations
-      case 280: // Enumeration
-        value.copy< EnumeratedType > (YY_MOVE (that.value));
-        break;
-
-      case 281: // EnumerationItem
-        value.copy< EnumerationValue > (YY_MOVE (that.value));
-        break;
-
-      case 321: // ExternalType
-        value.copy< ExternalType > (YY_MOVE (that.value));
-        break;
-
-      case 314: // IRIType
-        value.copy< IRIType > (YY_MOVE (that.value));
-        break;
-
-      case 245: // SymbolsFromModule
-        value.copy< Import > (YY_MOVE (that.value));
-        break;
-
-      case 215: // InstanceOfType
-        value.copy< InstanceOfType > (YY_MOVE (that.value));
-        break;
-
-      case 274: // IntegerType
-        value.copy< IntegerType > (YY_MOVE (that.value));
-        break;
-
-      case 239: // ModuleBody
-        value.copy< Module > (YY_MOVE (that.value));
-        break;
-
-      case 276: // NamedNumber
-        value.copy< NamedNumber > (YY_MOVE (that.value));
-        break;
-
-      case 265: // NamedType
-        value.copy< NamedType > (YY_MOVE (that.value));
-        break;
-
-      case 287: // NullType
-        value.copy< NullType > (YY_MOVE (that.value));
-        break;
-
-      case 161: // ObjectClass
-      case 162: // ObjectClassDefn
-        value.copy< ObjectClassAssignment > (YY_MOVE (that.value));
-        break;
-
-      case 202: // ObjectClassFieldType
-        value.copy< ObjectClassFieldType > (YY_MOVE (that.value));
-        break;
-
-      case 309: // ObjIdComponents
-      case 310: // NameForm
-      case 311: // NumberForm
-      case 312: // NameAndNumberForm
-        value.copy< ObjectIdComponentValue > (YY_MOVE (that.value));
-        break;
-
-      case 306: // ObjectIdentifierType
-        value.copy< ObjectIdentifierType > (YY_MOVE (that.value));
-        break;
-
-      case 286: // OctetStringType
-        value.copy< OctetStringType > (YY_MOVE (that.value));
-        break;
-
-      case 210: // Parameter
+      case symbol_kind::S_Parameter: // Parameter
         value.copy< Parameter > (YY_MOVE (that.value));
         break;
 
-      case 300: // PrefixedType
+      case symbol_kind::S_PrefixedType: // PrefixedType
         value.copy< PrefixedType > (YY_MOVE (that.value));
         break;
 
-      case 282: // RealType
+      case symbol_kind::S_RealType: // RealType
         value.copy< RealType > (YY_MOVE (that.value));
         break;
 
-      case 319: // RelativeIRIType
+      case symbol_kind::S_RelativeIRIType: // RelativeIRIType
         value.copy< RelativeIRIType > (YY_MOVE (that.value));
         break;
 
-      case 313: // RelativeOIDType
+      case symbol_kind::S_RelativeOIDType: // RelativeOIDType
         value.copy< RelativeOIDType > (YY_MOVE (that.value));
         break;
 
-      case 292: // SequenceOfType
+      case symbol_kind::S_SequenceOfType: // SequenceOfType
         value.copy< SequenceOfType > (YY_MOVE (that.value));
         break;
 
-      case 288: // SequenceType
+      case symbol_kind::S_SequenceType: // SequenceType
         value.copy< SequenceType > (YY_MOVE (that.value));
         break;
 
-      case 294: // SetOfType
+      case symbol_kind::S_SetOfType: // SetOfType
         value.copy< SetOfType > (YY_MOVE (that.value));
         break;
 
-      case 293: // SetType
+      case symbol_kind::S_SetType: // SetType
         value.copy< SetType > (YY_MOVE (that.value));
         break;
 
-      case 302: // Tag
+      case symbol_kind::S_Tag: // Tag
         value.copy< Tag > (YY_MOVE (that.value));
         break;
 
-      case 301: // TaggedType
+      case symbol_kind::S_TaggedType: // TaggedType
         value.copy< TaggedType > (YY_MOVE (that.value));
         break;
 
-      case 237: // TagDefault
+      case symbol_kind::S_TagDefault: // TagDefault
         value.copy< TaggingMode > (YY_MOVE (that.value));
         break;
 
-      case 325: // TimeOfDayType
+      case symbol_kind::S_TimeOfDayType: // TimeOfDayType
         value.copy< TimeOfDayType > (YY_MOVE (that.value));
         break;
 
-      case 322: // TimeType
+      case symbol_kind::S_TimeType: // TimeType
         value.copy< TimeType > (YY_MOVE (that.value));
         break;
 
-      case 323: // TimeValue
+      case symbol_kind::S_TimeValue: // TimeValue
         value.copy< TimeValue > (YY_MOVE (that.value));
         break;
 
-      case 211: // ParamGovernor
-      case 212: // Governor
-      case 257: // ActualParameter
-      case 263: // Type
-      case 331: // ConstrainedType
-      case 332: // TypeWithConstraint
+      case symbol_kind::S_ParamGovernor: // ParamGovernor
+      case symbol_kind::S_Governor: // Governor
+      case symbol_kind::S_ActualParameter: // ActualParameter
+      case symbol_kind::S_Type: // Type
+      case symbol_kind::S_ConstrainedType: // ConstrainedType
+      case symbol_kind::S_TypeWithConstraint: // TypeWithConstraint
         value.copy< Type > (YY_MOVE (that.value));
         break;
 
-      case 266: // ValueWithoutTypeIdentifier
-      case 267: // Value
-      case 349: // SingleValue
+      case symbol_kind::S_ValueWithoutTypeIdentifier: // ValueWithoutTypeIdentifier
+      case symbol_kind::S_Value: // Value
+      case symbol_kind::S_SingleValue: // SingleValue
         value.copy< Value > (YY_MOVE (that.value));
         break;
 
-      case 6: // realnumber
+      case symbol_kind::S_LowerEndpoint: // LowerEndpoint
+      case symbol_kind::S_UpperEndpoint: // UpperEndpoint
+      case symbol_kind::S_LowerEndValue: // LowerEndValue
+      case symbol_kind::S_UpperEndValue: // UpperEndValue
+        value.copy< absl::optional<ConstraintBound> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_realnumber: // realnumber
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 304: // ClassNumber
+      case symbol_kind::S_ClassNumber: // ClassNumber
         value.copy< int > (YY_MOVE (that.value));
         break;
 
-      case 4: // number
-      case 5: // negativenumber
-      case 277: // SignedNumber
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_negativenumber: // negativenumber
+      case symbol_kind::S_SignedNumber: // SignedNumber
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 7: // bstring
-      case 8: // xmlbstring
-      case 9: // hstring
-      case 10: // xmlhstring
-      case 11: // cstring
-      case 12: // xmlcstring
-      case 13: // simplestring
-      case 14: // xmltstring
-      case 22: // objectreference
-      case 24: // typefieldreference
-      case 25: // valuefieldreference
-      case 149: // GENERIC_IDENTIFIER_UPPERCASE
-      case 150: // GENERIC_IDENTIFIER_LOWERCASE
-      case 159: // UsefulObjectClassReference
-      case 165: // FieldName
-      case 216: // SimpleDefinedType
-      case 228: // ModuleIdentifier
-      case 246: // GlobalModuleReference
-      case 248: // Symbol
-      case 249: // Reference
-      case 372: // typereference
-      case 373: // identifier
-      case 374: // valuereference
-      case 375: // modulereference
-      case 376: // objectclassreference
-      case 377: // word
+      case symbol_kind::S_bstring: // bstring
+      case symbol_kind::S_xmlbstring: // xmlbstring
+      case symbol_kind::S_hstring: // hstring
+      case symbol_kind::S_xmlhstring: // xmlhstring
+      case symbol_kind::S_cstring: // cstring
+      case symbol_kind::S_xmlcstring: // xmlcstring
+      case symbol_kind::S_simplestring: // simplestring
+      case symbol_kind::S_xmltstring: // xmltstring
+      case symbol_kind::S_objectreference: // objectreference
+      case symbol_kind::S_typefieldreference: // typefieldreference
+      case symbol_kind::S_valuefieldreference: // valuefieldreference
+      case symbol_kind::S_GENERIC_IDENTIFIER_UPPERCASE: // GENERIC_IDENTIFIER_UPPERCASE
+      case symbol_kind::S_GENERIC_IDENTIFIER_LOWERCASE: // GENERIC_IDENTIFIER_LOWERCASE
+      case symbol_kind::S_UsefulObjectClassReference: // UsefulObjectClassReference
+      case symbol_kind::S_FieldName: // FieldName
+      case symbol_kind::S_SimpleDefinedType: // SimpleDefinedType
+      case symbol_kind::S_ModuleIdentifier: // ModuleIdentifier
+      case symbol_kind::S_GlobalModuleReference: // GlobalModuleReference
+      case symbol_kind::S_Symbol: // Symbol
+      case symbol_kind::S_Reference: // Reference
+      case symbol_kind::S_typereference: // typereference
+      case symbol_kind::S_identifier: // identifier
+      case symbol_kind::S_valuereference: // valuereference
+      case symbol_kind::S_modulereference: // modulereference
+      case symbol_kind::S_objectclassreference: // objectclassreference
+      case symbol_kind::S_word: // word
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
-      case 250: // AssignmentList
+      case symbol_kind::S_AssignmentList: // AssignmentList
         value.copy< std::vector<Assignment> > (YY_MOVE (that.value));
         break;
 
-      case 163: // FieldSpecList
-      case 164: // FieldSpec
-      case 167: // TypeFieldSpec
-      case 171: // FixedTypeValueFieldSpec
+      case symbol_kind::S_FieldSpecList: // FieldSpecList
+      case symbol_kind::S_FieldSpec: // FieldSpec
+      case symbol_kind::S_TypeFieldSpec: // TypeFieldSpec
+      case symbol_kind::S_FixedTypeValueFieldSpec: // FixedTypeValueFieldSpec
         value.copy< std::vector<ClassField> > (YY_MOVE (that.value));
         break;
 
-      case 240: // Exports
+      case symbol_kind::S_Exports: // Exports
         value.copy< std::vector<Export> > (YY_MOVE (that.value));
         break;
 
-      case 242: // Imports
-      case 243: // SymbolsImported
-      case 244: // SymbolsFromModuleList
+      case symbol_kind::S_Imports: // Imports
+      case symbol_kind::S_SymbolsImported: // SymbolsImported
+      case symbol_kind::S_SymbolsFromModuleList: // SymbolsFromModuleList
         value.copy< std::vector<Import> > (YY_MOVE (that.value));
         break;
 
-      case 275: // NamedNumberList
+      case symbol_kind::S_NamedNumberList: // NamedNumberList
         value.copy< std::vector<NamedNumber> > (YY_MOVE (that.value));
         break;
 
-      case 296: // AlternativeTypeLists
-      case 297: // RootAlternativeTypeList
-      case 298: // AlternativeTypeList
+      case symbol_kind::S_AlternativeTypeLists: // AlternativeTypeLists
+      case symbol_kind::S_RootAlternativeTypeList: // RootAlternativeTypeList
+      case symbol_kind::S_AlternativeTypeList: // AlternativeTypeList
         value.copy< std::vector<NamedType> > (YY_MOVE (that.value));
         break;
 
-      case 307: // ObjectIdentifierValue
-      case 308: // ObjIdComponentsList
+      case symbol_kind::S_ObjectIdentifierValue: // ObjectIdentifierValue
+      case symbol_kind::S_ObjIdComponentsList: // ObjIdComponentsList
         value.copy< std::vector<ObjectIdComponentValue> > (YY_MOVE (that.value));
         break;
 
-      case 208: // ParameterList
-      case 209: // ParameterSeries
+      case symbol_kind::S_ParameterList: // ParameterList
+      case symbol_kind::S_ParameterSeries: // ParameterSeries
         value.copy< std::vector<Parameter> > (YY_MOVE (that.value));
         break;
 
-      case 256: // ActualParameterList
+      case symbol_kind::S_ActualParameterList: // ActualParameterList
         value.copy< std::vector<Type> > (YY_MOVE (that.value));
         break;
 
-      case 271: // SequenceOfValues
+      case symbol_kind::S_SequenceOfValues: // SequenceOfValues
         value.copy< std::vector<Value> > (YY_MOVE (that.value));
         break;
 
-      case 166: // FieldNameList
-      case 168: // OneOrManyTypeFieldReference
-      case 247: // SymbolList
+      case symbol_kind::S_FieldNameList: // FieldNameList
+      case symbol_kind::S_OneOrManyTypeFieldReference: // OneOrManyTypeFieldReference
+      case symbol_kind::S_SymbolList: // SymbolList
         value.copy< std::vector<std::string> > (YY_MOVE (that.value));
         break;
 
@@ -5770,11 +6454,20 @@ switch (yytype)
 
 
 
+
+  template <typename Base>
+  asn1_parser::symbol_kind_type
+  asn1_parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
   template <typename Base>
   bool
   asn1_parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return Base::type_get () == empty_symbol;
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
   template <typename Base>
@@ -5782,330 +6475,355 @@ switch (yytype)
   asn1_parser::basic_symbol<Base>::move (basic_symbol& s)
   {
     super_type::move (s);
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 160: // ObjectClassAssignment
-      case 199: // ObjectSetAssignment
-      case 203: // ParameterizedAssignment
-      case 204: // ParameterizedTypeAssignment
-      case 205: // ParameterizedValueAssignment
-      case 206: // ParameterizedValueSetTypeAssignment
-      case 207: // ParameterizedObjectClassAssignment
-      case 251: // Assignment
-      case 260: // TypeAssignment
-      case 261: // ValueAssignment
-      case 262: // ValueSetTypeAssignment
+      case symbol_kind::S_ObjectClassAssignment: // ObjectClassAssignment
+      case symbol_kind::S_ObjectSetAssignment: // ObjectSetAssignment
+      case symbol_kind::S_ParameterizedAssignment: // ParameterizedAssignment
+      case symbol_kind::S_ParameterizedTypeAssignment: // ParameterizedTypeAssignment
+      case symbol_kind::S_ParameterizedValueAssignment: // ParameterizedValueAssignment
+      case symbol_kind::S_ParameterizedValueSetTypeAssignment: // ParameterizedValueSetTypeAssignment
+      case symbol_kind::S_ParameterizedObjectClassAssignment: // ParameterizedObjectClassAssignment
+      case symbol_kind::S_Assignment: // Assignment
+      case symbol_kind::S_TypeAssignment: // TypeAssignment
+      case symbol_kind::S_ValueAssignment: // ValueAssignment
+      case symbol_kind::S_ValueSetTypeAssignment: // ValueSetTypeAssignment
         value.move< Assignment > (YY_MOVE (s.value));
         break;
 
-      case 283: // BitStringType
+      case symbol_kind::S_BitStringType: // BitStringType
         value.move< BitStringType > (YY_MOVE (s.value));
         break;
 
-      case 272: // BooleanType
+      case symbol_kind::S_BooleanType: // BooleanType
         value.move< BooleanType > (YY_MOVE (s.value));
         break;
 
-      case 273: // BooleanValue
+      case symbol_kind::S_BooleanValue: // BooleanValue
         value.move< BooleanValue > (YY_MOVE (s.value));
         break;
 
-      case 264: // BuiltinType
+      case symbol_kind::S_BuiltinType: // BuiltinType
         value.move< BuiltinType > (YY_MOVE (s.value));
         break;
 
-      case 328: // CharacterStringType
-      case 329: // RestrictedCharacterStringType
-      case 330: // UnrestrictedCharacterStringType
+      case symbol_kind::S_CharacterStringType: // CharacterStringType
+      case symbol_kind::S_RestrictedCharacterStringType: // RestrictedCharacterStringType
+      case symbol_kind::S_UnrestrictedCharacterStringType: // UnrestrictedCharacterStringType
         value.move< CharacterStringType > (YY_MOVE (s.value));
         break;
 
-      case 295: // ChoiceType
+      case symbol_kind::S_ChoiceType: // ChoiceType
         value.move< ChoiceType > (YY_MOVE (s.value));
         break;
 
-      case 305: // Class
+      case symbol_kind::S_Class: // Class
         value.move< Class > (YY_MOVE (s.value));
         break;
 
-      case 289: // ComponentTypeLists
+      case symbol_kind::S_ComponentTypeLists: // ComponentTypeLists
         value.move< Collection > (YY_MOVE (s.value));
         break;
 
-      case 291: // ComponentType
+      case symbol_kind::S_ComponentType: // ComponentType
         value.move< ComponentType > (YY_MOVE (s.value));
         break;
 
-      case 290: // ComponentTypeList
+      case symbol_kind::S_ComponentTypeList: // ComponentTypeList
         value.move< ComponentTypeList > (YY_MOVE (s.value));
         break;
 
-      case 326: // DateTimeType
+      case symbol_kind::S_Constraint: // Constraint
+      case symbol_kind::S_ConstraintSpec: // ConstraintSpec
+      case symbol_kind::S_SubtypeConstraint: // SubtypeConstraint
+      case symbol_kind::S_ElementSetSpecs: // ElementSetSpecs
+      case symbol_kind::S_ElementSetSpec: // ElementSetSpec
+      case symbol_kind::S_Unions: // Unions
+      case symbol_kind::S_UElems: // UElems
+      case symbol_kind::S_Intersections: // Intersections
+      case symbol_kind::S_IElems: // IElems
+      case symbol_kind::S_IntersectionElements: // IntersectionElements
+      case symbol_kind::S_Elems: // Elems
+      case symbol_kind::S_Elements: // Elements
+      case symbol_kind::S_SubtypeElements: // SubtypeElements
+      case symbol_kind::S_ValueRange: // ValueRange
+      case symbol_kind::S_SizeConstraint: // SizeConstraint
+        value.move< Constraint > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_DateTimeType: // DateTimeType
         value.move< DateTimeType > (YY_MOVE (s.value));
         break;
 
-      case 324: // DateType
+      case symbol_kind::S_DateType: // DateType
         value.move< DateType > (YY_MOVE (s.value));
         break;
 
-      case 252: // DefinedType
-      case 254: // ParameterizedType
-      case 258: // ExternalTypeReference
+      case symbol_kind::S_DefinedType: // DefinedType
+      case symbol_kind::S_ParameterizedType: // ParameterizedType
+      case symbol_kind::S_ExternalTypeReference: // ExternalTypeReference
         value.move< DefinedType > (YY_MOVE (s.value));
         break;
 
-      case 253: // DefinedValue
+      case symbol_kind::S_DefinedValue: // DefinedValue
         value.move< DefinedValue > (YY_MOVE (s.value));
         break;
 
-      case 327: // DurationType
+      case symbol_kind::S_DurationType: // DurationType
         value.move< DurationType > (YY_MOVE (s.value));
         break;
 
-      case 320: // EmbeddedPDVType
+      case symbol_kind::S_EmbeddedPDVType: // EmbeddedPDVType
         value.move< EmbeddedPDVType > (YY_MOVE (s.value));
         break;
 
-      case 278: // EnumeratedType
-      case 279: // Enumerations
-      case 280: // Enumeration
+      case symbol_kind::S_EnumeratedType: // EnumeratedType
+      case symbol_kind::S_Enumerations: // Enumerations
+      case symbol_kind::S_Enumeration: // Enumeration
         value.move< EnumeratedType > (YY_MOVE (s.value));
         break;
 
-      case 281: // EnumerationItem
+      case symbol_kind::S_EnumerationItem: // EnumerationItem
         value.move< EnumerationValue > (YY_MOVE (s.value));
         break;
 
-      case 321: // ExternalType
+      case symbol_kind::S_ExternalType: // ExternalType
         value.move< ExternalType > (YY_MOVE (s.value));
         break;
 
-      case 314: // IRIType
+      case symbol_kind::S_IRIType: // IRIType
         value.move< IRIType > (YY_MOVE (s.value));
         break;
 
-      case 245: // SymbolsFromModule
+      case symbol_kind::S_SymbolsFromModule: // SymbolsFromModule
         value.move< Import > (YY_MOVE (s.value));
         break;
 
-      case 215: // InstanceOfType
+      case symbol_kind::S_InstanceOfType: // InstanceOfType
         value.move< InstanceOfType > (YY_MOVE (s.value));
         break;
 
-      case 274: // IntegerType
+      case symbol_kind::S_IntegerType: // IntegerType
         value.move< IntegerType > (YY_MOVE (s.value));
         break;
 
-      case 239: // ModuleBody
+      case symbol_kind::S_ModuleBody: // ModuleBody
         value.move< Module > (YY_MOVE (s.value));
         break;
 
-      case 276: // NamedNumber
+      case symbol_kind::S_NamedNumber: // NamedNumber
         value.move< NamedNumber > (YY_MOVE (s.value));
         break;
 
-      case 265: // NamedType
+      case symbol_kind::S_NamedType: // NamedType
         value.move< NamedType > (YY_MOVE (s.value));
         break;
 
-      case 287: // NullType
+      case symbol_kind::S_NullType: // NullType
         value.move< NullType > (YY_MOVE (s.value));
         break;
 
-      case 161: // ObjectClass
-      case 162: // ObjectClassDefn
+      case symbol_kind::S_ObjectClass: // ObjectClass
+      case symbol_kind::S_ObjectClassDefn: // ObjectClassDefn
         value.move< ObjectClassAssignment > (YY_MOVE (s.value));
         break;
 
-      case 202: // ObjectClassFieldType
+      case symbol_kind::S_ObjectClassFieldType: // ObjectClassFieldType
         value.move< ObjectClassFieldType > (YY_MOVE (s.value));
         break;
 
-      case 309: // ObjIdComponents
-      case 310: // NameForm
-      case 311: // NumberForm
-      case 312: // NameAndNumberForm
+      case symbol_kind::S_ObjIdComponents: // ObjIdComponents
+      case symbol_kind::S_NameForm: // NameForm
+      case symbol_kind::S_NumberForm: // NumberForm
+      case symbol_kind::S_NameAndNumberForm: // NameAndNumberForm
         value.move< ObjectIdComponentValue > (YY_MOVE (s.value));
         break;
 
-      case 306: // ObjectIdentifierType
+      case symbol_kind::S_ObjectIdentifierType: // ObjectIdentifierType
         value.move< ObjectIdentifierType > (YY_MOVE (s.value));
         break;
 
-      case 286: // OctetStringType
+      case symbol_kind::S_OctetStringType: // OctetStringType
         value.move< OctetStringType > (YY_MOVE (s.value));
         break;
 
-      case 210: // Parameter
+      case symbol_kind::S_Parameter: // Parameter
         value.move< Parameter > (YY_MOVE (s.value));
         break;
 
-      case 300: // PrefixedType
+      case symbol_kind::S_PrefixedType: // PrefixedType
         value.move< PrefixedType > (YY_MOVE (s.value));
         break;
 
-      case 282: // RealType
+      case symbol_kind::S_RealType: // RealType
         value.move< RealType > (YY_MOVE (s.value));
         break;
 
-      case 319: // RelativeIRIType
+      case symbol_kind::S_RelativeIRIType: // RelativeIRIType
         value.move< RelativeIRIType > (YY_MOVE (s.value));
         break;
 
-      case 313: // RelativeOIDType
+      case symbol_kind::S_RelativeOIDType: // RelativeOIDType
         value.move< RelativeOIDType > (YY_MOVE (s.value));
         break;
 
-      case 292: // SequenceOfType
+      case symbol_kind::S_SequenceOfType: // SequenceOfType
         value.move< SequenceOfType > (YY_MOVE (s.value));
         break;
 
-      case 288: // SequenceType
+      case symbol_kind::S_SequenceType: // SequenceType
         value.move< SequenceType > (YY_MOVE (s.value));
         break;
 
-      case 294: // SetOfType
+      case symbol_kind::S_SetOfType: // SetOfType
         value.move< SetOfType > (YY_MOVE (s.value));
         break;
 
-      case 293: // SetType
+      case symbol_kind::S_SetType: // SetType
         value.move< SetType > (YY_MOVE (s.value));
         break;
 
-      case 302: // Tag
+      case symbol_kind::S_Tag: // Tag
         value.move< Tag > (YY_MOVE (s.value));
         break;
 
-      case 301: // TaggedType
+      case symbol_kind::S_TaggedType: // TaggedType
         value.move< TaggedType > (YY_MOVE (s.value));
         break;
 
-      case 237: // TagDefault
+      case symbol_kind::S_TagDefault: // TagDefault
         value.move< TaggingMode > (YY_MOVE (s.value));
         break;
 
-      case 325: // TimeOfDayType
+      case symbol_kind::S_TimeOfDayType: // TimeOfDayType
         value.move< TimeOfDayType > (YY_MOVE (s.value));
         break;
 
-      case 322: // TimeType
+      case symbol_kind::S_TimeType: // TimeType
         value.move< TimeType > (YY_MOVE (s.value));
         break;
 
-      case 323: // TimeValue
+      case symbol_kind::S_TimeValue: // TimeValue
         value.move< TimeValue > (YY_MOVE (s.value));
         break;
 
-      case 211: // ParamGovernor
-      case 212: // Governor
-      case 257: // ActualParameter
-      case 263: // Type
-      case 331: // ConstrainedType
-      case 332: // TypeWithConstraint
+      case symbol_kind::S_ParamGovernor: // ParamGovernor
+      case symbol_kind::S_Governor: // Governor
+      case symbol_kind::S_ActualParameter: // ActualParameter
+      case symbol_kind::S_Type: // Type
+      case symbol_kind::S_ConstrainedType: // ConstrainedType
+      case symbol_kind::S_TypeWithConstraint: // TypeWithConstraint
         value.move< Type > (YY_MOVE (s.value));
         break;
 
-      case 266: // ValueWithoutTypeIdentifier
-      case 267: // Value
-      case 349: // SingleValue
+      case symbol_kind::S_ValueWithoutTypeIdentifier: // ValueWithoutTypeIdentifier
+      case symbol_kind::S_Value: // Value
+      case symbol_kind::S_SingleValue: // SingleValue
         value.move< Value > (YY_MOVE (s.value));
         break;
 
-      case 6: // realnumber
+      case symbol_kind::S_LowerEndpoint: // LowerEndpoint
+      case symbol_kind::S_UpperEndpoint: // UpperEndpoint
+      case symbol_kind::S_LowerEndValue: // LowerEndValue
+      case symbol_kind::S_UpperEndValue: // UpperEndValue
+        value.move< absl::optional<ConstraintBound> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_realnumber: // realnumber
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 304: // ClassNumber
+      case symbol_kind::S_ClassNumber: // ClassNumber
         value.move< int > (YY_MOVE (s.value));
         break;
 
-      case 4: // number
-      case 5: // negativenumber
-      case 277: // SignedNumber
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_negativenumber: // negativenumber
+      case symbol_kind::S_SignedNumber: // SignedNumber
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 7: // bstring
-      case 8: // xmlbstring
-      case 9: // hstring
-      case 10: // xmlhstring
-      case 11: // cstring
-      case 12: // xmlcstring
-      case 13: // simplestring
-      case 14: // xmltstring
-      case 22: // objectreference
-      case 24: // typefieldreference
-      case 25: // valuefieldreference
-      case 149: // GENERIC_IDENTIFIER_UPPERCASE
-      case 150: // GENERIC_IDENTIFIER_LOWERCASE
-      case 159: // UsefulObjectClassReference
-      case 165: // FieldName
-      case 216: // SimpleDefinedType
-      case 228: // ModuleIdentifier
-      case 246: // GlobalModuleReference
-      case 248: // Symbol
-      case 249: // Reference
-      case 372: // typereference
-      case 373: // identifier
-      case 374: // valuereference
-      case 375: // modulereference
-      case 376: // objectclassreference
-      case 377: // word
+      case symbol_kind::S_bstring: // bstring
+      case symbol_kind::S_xmlbstring: // xmlbstring
+      case symbol_kind::S_hstring: // hstring
+      case symbol_kind::S_xmlhstring: // xmlhstring
+      case symbol_kind::S_cstring: // cstring
+      case symbol_kind::S_xmlcstring: // xmlcstring
+      case symbol_kind::S_simplestring: // simplestring
+      case symbol_kind::S_xmltstring: // xmltstring
+      case symbol_kind::S_objectreference: // objectreference
+      case symbol_kind::S_typefieldreference: // typefieldreference
+      case symbol_kind::S_valuefieldreference: // valuefieldreference
+      case symbol_kind::S_GENERIC_IDENTIFIER_UPPERCASE: // GENERIC_IDENTIFIER_UPPERCASE
+      case symbol_kind::S_GENERIC_IDENTIFIER_LOWERCASE: // GENERIC_IDENTIFIER_LOWERCASE
+      case symbol_kind::S_UsefulObjectClassReference: // UsefulObjectClassReference
+      case symbol_kind::S_FieldName: // FieldName
+      case symbol_kind::S_SimpleDefinedType: // SimpleDefinedType
+      case symbol_kind::S_ModuleIdentifier: // ModuleIdentifier
+      case symbol_kind::S_GlobalModuleReference: // GlobalModuleReference
+      case symbol_kind::S_Symbol: // Symbol
+      case symbol_kind::S_Reference: // Reference
+      case symbol_kind::S_typereference: // typereference
+      case symbol_kind::S_identifier: // identifier
+      case symbol_kind::S_valuereference: // valuereference
+      case symbol_kind::S_modulereference: // modulereference
+      case symbol_kind::S_objectclassreference: // objectclassreference
+      case symbol_kind::S_word: // word
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
-      case 250: // AssignmentList
+      case symbol_kind::S_AssignmentList: // AssignmentList
         value.move< std::vector<Assignment> > (YY_MOVE (s.value));
         break;
 
-      case 163: // FieldSpecList
-      case 164: // FieldSpec
-      case 167: // TypeFieldSpec
-      case 171: // FixedTypeValueFieldSpec
+      case symbol_kind::S_FieldSpecList: // FieldSpecList
+      case symbol_kind::S_FieldSpec: // FieldSpec
+      case symbol_kind::S_TypeFieldSpec: // TypeFieldSpec
+      case symbol_kind::S_FixedTypeValueFieldSpec: // FixedTypeValueFieldSpec
         value.move< std::vector<ClassField> > (YY_MOVE (s.value));
         break;
 
-      case 240: // Exports
+      case symbol_kind::S_Exports: // Exports
         value.move< std::vector<Export> > (YY_MOVE (s.value));
         break;
 
-      case 242: // Imports
-      case 243: // SymbolsImported
-      case 244: // SymbolsFromModuleList
+      case symbol_kind::S_Imports: // Imports
+      case symbol_kind::S_SymbolsImported: // SymbolsImported
+      case symbol_kind::S_SymbolsFromModuleList: // SymbolsFromModuleList
         value.move< std::vector<Import> > (YY_MOVE (s.value));
         break;
 
-      case 275: // NamedNumberList
+      case symbol_kind::S_NamedNumberList: // NamedNumberList
         value.move< std::vector<NamedNumber> > (YY_MOVE (s.value));
         break;
 
-      case 296: // AlternativeTypeLists
-      case 297: // RootAlternativeTypeList
-      case 298: // AlternativeTypeList
+      case symbol_kind::S_AlternativeTypeLists: // AlternativeTypeLists
+      case symbol_kind::S_RootAlternativeTypeList: // RootAlternativeTypeList
+      case symbol_kind::S_AlternativeTypeList: // AlternativeTypeList
         value.move< std::vector<NamedType> > (YY_MOVE (s.value));
         break;
 
-      case 307: // ObjectIdentifierValue
-      case 308: // ObjIdComponentsList
+      case symbol_kind::S_ObjectIdentifierValue: // ObjectIdentifierValue
+      case symbol_kind::S_ObjIdComponentsList: // ObjIdComponentsList
         value.move< std::vector<ObjectIdComponentValue> > (YY_MOVE (s.value));
         break;
 
-      case 208: // ParameterList
-      case 209: // ParameterSeries
+      case symbol_kind::S_ParameterList: // ParameterList
+      case symbol_kind::S_ParameterSeries: // ParameterSeries
         value.move< std::vector<Parameter> > (YY_MOVE (s.value));
         break;
 
-      case 256: // ActualParameterList
+      case symbol_kind::S_ActualParameterList: // ActualParameterList
         value.move< std::vector<Type> > (YY_MOVE (s.value));
         break;
 
-      case 271: // SequenceOfValues
+      case symbol_kind::S_SequenceOfValues: // SequenceOfValues
         value.move< std::vector<Value> > (YY_MOVE (s.value));
         break;
 
-      case 166: // FieldNameList
-      case 168: // OneOrManyTypeFieldReference
-      case 247: // SymbolList
+      case symbol_kind::S_FieldNameList: // FieldNameList
+      case symbol_kind::S_OneOrManyTypeFieldReference: // OneOrManyTypeFieldReference
+      case symbol_kind::S_SymbolList: // SymbolList
         value.move< std::vector<std::string> > (YY_MOVE (s.value));
         break;
 
@@ -6116,78 +6834,58 @@ switch (yytype)
     location = YY_MOVE (s.location);
   }
 
-  // by_type.
-  asn1_parser::by_type::by_type ()
-    : type (empty_symbol)
+  // by_kind.
+  asn1_parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
   {}
 
 #if 201103L <= YY_CPLUSPLUS
-  asn1_parser::by_type::by_type (by_type&& that)
-    : type (that.type)
+  asn1_parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
     that.clear ();
   }
 #endif
 
-  asn1_parser::by_type::by_type (const by_type& that)
-    : type (that.type)
+  asn1_parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {}
 
-  asn1_parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
+  asn1_parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
   {}
 
+
+
   void
-  asn1_parser::by_type::clear ()
+  asn1_parser::by_kind::clear () YY_NOEXCEPT
   {
-    type = empty_symbol;
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
   void
-  asn1_parser::by_type::move (by_type& that)
+  asn1_parser::by_kind::move (by_kind& that)
   {
-    type = that.type;
+    kind_ = that.kind_;
     that.clear ();
   }
 
-  int
-  asn1_parser::by_type::type_get () const YY_NOEXCEPT
+  asn1_parser::symbol_kind_type
+  asn1_parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return type;
+    return kind_;
   }
 
-  asn1_parser::token_type
-  asn1_parser::by_type::token () const YY_NOEXCEPT
+
+  asn1_parser::symbol_kind_type
+  asn1_parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short
-    yytoken_number_[] =
-    {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407
-    };
-    return token_type (yytoken_number_[type]);
+    return this->kind ();
   }
 
 
 } // yy
-#line 6189 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:431
+#line 6889 "/tmp/regen/asn_compiler.re"
 
 
 
@@ -6195,7 +6893,7 @@ switch (yytype)
 
 
 // Unqualified %code blocks.
-#line 16 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:435
+#line 16 "/root/repo/src/compiler/asn_compiler.yacc"
 
     struct Context
     {
@@ -6211,7 +6909,7 @@ switch (yytype)
 
     namespace yy { asn1_parser::symbol_type yylex(Context& c); }
 
-#line 6213 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:435
+#line 6913 "/tmp/regen/asn_compiler.re"
 
 
 #ifndef YY_
@@ -6226,6 +6924,7 @@ switch (yytype)
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -6256,9 +6955,6 @@ switch (yytype)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if YYDEBUG
 
@@ -6284,13 +6980,13 @@ switch (yytype)
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !YYDEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -6304,57 +7000,16 @@ switch (yytype)
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-
 namespace yy {
-#line 6308 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:510
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  asn1_parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr;
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              else
-                goto append;
-
-            append:
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 7005 "/tmp/regen/asn_compiler.re"
 
   /// Build a parser object.
   asn1_parser::asn1_parser (Context& context__yyarg)
-    :
 #if YYDEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       context_ (context__yyarg)
   {}
@@ -6365,9 +7020,9 @@ namespace yy {
   asn1_parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
   {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
@@ -6397,13 +7052,13 @@ namespace yy {
     : state (s)
   {}
 
-  asn1_parser::symbol_number_type
-  asn1_parser::by_state::type_get () const YY_NOEXCEPT
+  asn1_parser::symbol_kind_type
+  asn1_parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   asn1_parser::stack_symbol_type::stack_symbol_type ()
@@ -6412,330 +7067,355 @@ namespace yy {
   asn1_parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 160: // ObjectClassAssignment
-      case 199: // ObjectSetAssignment
-      case 203: // ParameterizedAssignment
-      case 204: // ParameterizedTypeAssignment
-      case 205: // ParameterizedValueAssignment
-      case 206: // ParameterizedValueSetTypeAssignment
-      case 207: // ParameterizedObjectClassAssignment
-      case 251: // Assignment
-      case 260: // TypeAssignment
-      case 261: // ValueAssignment
-      case 262: // ValueSetTypeAssignment
+      case symbol_kind::S_ObjectClassAssignment: // ObjectClassAssignment
+      case symbol_kind::S_ObjectSetAssignment: // ObjectSetAssignment
+      case symbol_kind::S_ParameterizedAssignment: // ParameterizedAssignment
+      case symbol_kind::S_ParameterizedTypeAssignment: // ParameterizedTypeAssignment
+      case symbol_kind::S_ParameterizedValueAssignment: // ParameterizedValueAssignment
+      case symbol_kind::S_ParameterizedValueSetTypeAssignment: // ParameterizedValueSetTypeAssignment
+      case symbol_kind::S_ParameterizedObjectClassAssignment: // ParameterizedObjectClassAssignment
+      case symbol_kind::S_Assignment: // Assignment
+      case symbol_kind::S_TypeAssignment: // TypeAssignment
+      case symbol_kind::S_ValueAssignment: // ValueAssignment
+      case symbol_kind::S_ValueSetTypeAssignment: // ValueSetTypeAssignment
         value.YY_MOVE_OR_COPY< Assignment > (YY_MOVE (that.value));
         break;
 
-      case 283: // BitStringType
+      case symbol_kind::S_BitStringType: // BitStringType
         value.YY_MOVE_OR_COPY< BitStringType > (YY_MOVE (that.value));
         break;
 
-      case 272: // BooleanType
+      case symbol_kind::S_BooleanType: // BooleanType
         value.YY_MOVE_OR_COPY< BooleanType > (YY_MOVE (that.value));
         break;
 
-      case 273: // BooleanValue
+      case symbol_kind::S_BooleanValue: // BooleanValue
         value.YY_MOVE_OR_COPY< BooleanValue > (YY_MOVE (that.value));
         break;
 
-      case 264: // BuiltinType
+      case symbol_kind::S_BuiltinType: // BuiltinType
         value.YY_MOVE_OR_COPY< BuiltinType > (YY_MOVE (that.value));
         break;
 
-      case 328: // CharacterStringType
-      case 329: // RestrictedCharacterStringType
-      case 330: // UnrestrictedCharacterStringType
+      case symbol_kind::S_CharacterStringType: // CharacterStringType
+      case symbol_kind::S_RestrictedCharacterStringType: // RestrictedCharacterStringType
+      case symbol_kind::S_UnrestrictedCharacterStringType: // UnrestrictedCharacterStringType
         value.YY_MOVE_OR_COPY< CharacterStringType > (YY_MOVE (that.value));
         break;
 
-      case 295: // ChoiceType
+      case symbol_kind::S_ChoiceType: // ChoiceType
         value.YY_MOVE_OR_COPY< ChoiceType > (YY_MOVE (that.value));
         break;
 
-      case 305: // Class
+      case symbol_kind::S_Class: // Class
         value.YY_MOVE_OR_COPY< Class > (YY_MOVE (that.value));
         break;
 
-      case 289: // ComponentTypeLists
+      case symbol_kind::S_ComponentTypeLists: // ComponentTypeLists
         value.YY_MOVE_OR_COPY< Collection > (YY_MOVE (that.value));
         break;
 
-      case 291: // ComponentType
+      case symbol_kind::S_ComponentType: // ComponentType
         value.YY_MOVE_OR_COPY< ComponentType > (YY_MOVE (that.value));
         break;
 
-      case 290: // ComponentTypeList
+      case symbol_kind::S_ComponentTypeList: // ComponentTypeList
         value.YY_MOVE_OR_COPY< ComponentTypeList > (YY_MOVE (that.value));
         break;
 
-      case 326: // DateTimeType
+      case symbol_kind::S_Constraint: // Constraint
+      case symbol_kind::S_ConstraintSpec: // ConstraintSpec
+      case symbol_kind::S_SubtypeConstraint: // SubtypeConstraint
+      case symbol_kind::S_ElementSetSpecs: // ElementSetSpecs
+      case symbol_kind::S_ElementSetSpec: // ElementSetSpec
+      case symbol_kind::S_Unions: // Unions
+      case symbol_kind::S_UElems: // UElems
+      case symbol_kind::S_Intersections: // Intersections
+      case symbol_kind::S_IElems: // IElems
+      case symbol_kind::S_IntersectionElements: // IntersectionElements
+      case symbol_kind::S_Elems: // Elems
+      case symbol_kind::S_Elements: // Elements
+      case symbol_kind::S_SubtypeElements: // SubtypeElements
+      case symbol_kind::S_ValueRange: // ValueRange
+      case symbol_kind::S_SizeConstraint: // SizeConstraint
+        value.YY_MOVE_OR_COPY< Constraint > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_DateTimeType: // DateTimeType
         value.YY_MOVE_OR_COPY< DateTimeType > (YY_MOVE (that.value));
         break;
 
-      case 324: // DateType
+      case symbol_kind::S_DateType: // DateType
         value.YY_MOVE_OR_COPY< DateType > (YY_MOVE (that.value));
         break;
 
-      case 252: // DefinedType
-      case 254: // ParameterizedType
-      case 258: // ExternalTypeReference
+      case symbol_kind::S_DefinedType: // DefinedType
+      case symbol_kind::S_ParameterizedType: // ParameterizedType
+      case symbol_kind::S_ExternalTypeReference: // ExternalTypeReference
         value.YY_MOVE_OR_COPY< DefinedType > (YY_MOVE (that.value));
         break;
 
-      case 253: // DefinedValue
+      case symbol_kind::S_DefinedValue: // DefinedValue
         value.YY_MOVE_OR_COPY< DefinedValue > (YY_MOVE (that.value));
         break;
 
-      case 327: // DurationType
+      case symbol_kind::S_DurationType: // DurationType
         value.YY_MOVE_OR_COPY< DurationType > (YY_MOVE (that.value));
         break;
 
-      case 320: // EmbeddedPDVType
+      case symbol_kind::S_EmbeddedPDVType: // EmbeddedPDVType
         value.YY_MOVE_OR_COPY< EmbeddedPDVType > (YY_MOVE (that.value));
         break;
 
-      case 278: // EnumeratedType
-      case 279: // Enumerations
-      case 280: // Enumeration
+      case symbol_kind::S_EnumeratedType: // EnumeratedType
+      case symbol_kind::S_Enumerations: // Enumerations
+      case symbol_kind::S_Enumeration: // Enumeration
         value.YY_MOVE_OR_COPY< EnumeratedType > (YY_MOVE (that.value));
         break;
 
-      case 281: // EnumerationItem
+      case symbol_kind::S_EnumerationItem: // EnumerationItem
         value.YY_MOVE_OR_COPY< EnumerationValue > (YY_MOVE (that.value));
         break;
 
-      case 321: // ExternalType
+      case symbol_kind::S_ExternalType: // ExternalType
         value.YY_MOVE_OR_COPY< ExternalType > (YY_MOVE (that.value));
         break;
 
-      case 314: // IRIType
+      case symbol_kind::S_IRIType: // IRIType
         value.YY_MOVE_OR_COPY< IRIType > (YY_MOVE (that.value));
         break;
 
-      case 245: // SymbolsFromModule
+      case symbol_kind::S_SymbolsFromModule: // SymbolsFromModule
         value.YY_MOVE_OR_COPY< Import > (YY_MOVE (that.value));
         break;
 
-      case 215: // InstanceOfType
+      case symbol_kind::S_InstanceOfType: // InstanceOfType
         value.YY_MOVE_OR_COPY< InstanceOfType > (YY_MOVE (that.value));
         break;
 
-      case 274: // IntegerType
+      case symbol_kind::S_IntegerType: // IntegerType
         value.YY_MOVE_OR_COPY< IntegerType > (YY_MOVE (that.value));
         break;
 
-      case 239: // ModuleBody
+      case symbol_kind::S_ModuleBody: // ModuleBody
         value.YY_MOVE_OR_COPY< Module > (YY_MOVE (that.value));
         break;
 
-      case 276: // NamedNumber
+      case symbol_kind::S_NamedNumber: // NamedNumber
         value.YY_MOVE_OR_COPY< NamedNumber > (YY_MOVE (that.value));
         break;
 
-      case 265: // NamedType
+      case symbol_kind::S_NamedType: // NamedType
         value.YY_MOVE_OR_COPY< NamedType > (YY_MOVE (that.value));
         break;
 
-      case 287: // NullType
+      case symbol_kind::S_NullType: // NullType
         value.YY_MOVE_OR_COPY< NullType > (YY_MOVE (that.value));
         break;
 
-      case 161: // ObjectClass
-      case 162: // ObjectClassDefn
+      case symbol_kind::S_ObjectClass: // ObjectClass
+      case symbol_kind::S_ObjectClassDefn: // ObjectClassDefn
         value.YY_MOVE_OR_COPY< ObjectClassAssignment > (YY_MOVE (that.value));
         break;
 
-      case 202: // ObjectClassFieldType
+      case symbol_kind::S_ObjectClassFieldType: // ObjectClassFieldType
         value.YY_MOVE_OR_COPY< ObjectClassFieldType > (YY_MOVE (that.value));
         break;
 
-      case 309: // ObjIdComponents
-      case 310: // NameForm
-      case 311: // NumberForm
-      case 312: // NameAndNumberForm
+      case symbol_kind::S_ObjIdComponents: // ObjIdComponents
+      case symbol_kind::S_NameForm: // NameForm
+      case symbol_kind::S_NumberForm: // NumberForm
+      case symbol_kind::S_NameAndNumberForm: // NameAndNumberForm
         value.YY_MOVE_OR_COPY< ObjectIdComponentValue > (YY_MOVE (that.value));
         break;
 
-      case 306: // ObjectIdentifierType
+      case symbol_kind::S_ObjectIdentifierType: // ObjectIdentifierType
         value.YY_MOVE_OR_COPY< ObjectIdentifierType > (YY_MOVE (that.value));
         break;
 
-      case 286: // OctetStringType
+      case symbol_kind::S_OctetStringType: // OctetStringType
         value.YY_MOVE_OR_COPY< OctetStringType > (YY_MOVE (that.value));
         break;
 
-      case 210: // Parameter
+      case symbol_kind::S_Parameter: // Parameter
         value.YY_MOVE_OR_COPY< Parameter > (YY_MOVE (that.value));
         break;
 
-      case 300: // PrefixedType
+      case symbol_kind::S_PrefixedType: // PrefixedType
         value.YY_MOVE_OR_COPY< PrefixedType > (YY_MOVE (that.value));
         break;
 
-      case 282: // RealType
+      case symbol_kind::S_RealType: // RealType
         value.YY_MOVE_OR_COPY< RealType > (YY_MOVE (that.value));
         break;
 
-      case 319: // RelativeIRIType
+      case symbol_kind::S_RelativeIRIType: // RelativeIRIType
         value.YY_MOVE_OR_COPY< RelativeIRIType > (YY_MOVE (that.value));
         break;
 
-      case 313: // RelativeOIDType
+      case symbol_kind::S_RelativeOIDType: // RelativeOIDType
         value.YY_MOVE_OR_COPY< RelativeOIDType > (YY_MOVE (that.value));
         break;
 
-      case 292: // SequenceOfType
+      case symbol_kind::S_SequenceOfType: // SequenceOfType
         value.YY_MOVE_OR_COPY< SequenceOfType > (YY_MOVE (that.value));
         break;
 
-      case 288: // SequenceType
+      case symbol_kind::S_SequenceType: // SequenceType
         value.YY_MOVE_OR_COPY< SequenceType > (YY_MOVE (that.value));
         break;
 
-      case 294: // SetOfType
+      case symbol_kind::S_SetOfType: // SetOfType
         value.YY_MOVE_OR_COPY< SetOfType > (YY_MOVE (that.value));
         break;
 
-      case 293: // SetType
+      case symbol_kind::S_SetType: // SetType
         value.YY_MOVE_OR_COPY< SetType > (YY_MOVE (that.value));
         break;
 
-      case 302: // Tag
+      case symbol_kind::S_Tag: // Tag
         value.YY_MOVE_OR_COPY< Tag > (YY_MOVE (that.value));
         break;
 
-      case 301: // TaggedType
+      case symbol_kind::S_TaggedType: // TaggedType
         value.YY_MOVE_OR_COPY< TaggedType > (YY_MOVE (that.value));
         break;
 
-      case 237: // TagDefault
+      case symbol_kind::S_TagDefault: // TagDefault
         value.YY_MOVE_OR_COPY< TaggingMode > (YY_MOVE (that.value));
         break;
 
-      case 325: // TimeOfDayType
+      case symbol_kind::S_TimeOfDayType: // TimeOfDayType
         value.YY_MOVE_OR_COPY< TimeOfDayType > (YY_MOVE (that.value));
         break;
 
-      case 322: // TimeType
+      case symbol_kind::S_TimeType: // TimeType
         value.YY_MOVE_OR_COPY< TimeType > (YY_MOVE (that.value));
         break;
 
-      case 323: // TimeValue
+      case symbol_kind::S_TimeValue: // TimeValue
         value.YY_MOVE_OR_COPY< TimeValue > (YY_MOVE (that.value));
         break;
 
-      case 211: // ParamGovernor
-      case 212: // Governor
-      case 257: // ActualParameter
-      case 263: // Type
-      case 331: // ConstrainedType
-      case 332: // TypeWithConstraint
+      case symbol_kind::S_ParamGovernor: // ParamGovernor
+      case symbol_kind::S_Governor: // Governor
+      case symbol_kind::S_ActualParameter: // ActualParameter
+      case symbol_kind::S_Type: // Type
+      case symbol_kind::S_ConstrainedType: // ConstrainedType
+      case symbol_kind::S_TypeWithConstraint: // TypeWithConstraint
         value.YY_MOVE_OR_COPY< Type > (YY_MOVE (that.value));
         break;
 
-      case 266: // ValueWithoutTypeIdentifier
-      case 267: // Value
-      case 349: // SingleValue
+      case symbol_kind::S_ValueWithoutTypeIdentifier: // ValueWithoutTypeIdentifier
+      case symbol_kind::S_Value: // Value
+      case symbol_kind::S_SingleValue: // SingleValue
         value.YY_MOVE_OR_COPY< Value > (YY_MOVE (that.value));
         break;
 
-      case 6: // realnumber
+      case symbol_kind::S_LowerEndpoint: // LowerEndpoint
+      case symbol_kind::S_UpperEndpoint: // UpperEndpoint
+      case symbol_kind::S_LowerEndValue: // LowerEndValue
+      case symbol_kind::S_UpperEndValue: // UpperEndValue
+        value.YY_MOVE_OR_COPY< absl::optional<ConstraintBound> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_realnumber: // realnumber
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 304: // ClassNumber
+      case symbol_kind::S_ClassNumber: // ClassNumber
         value.YY_MOVE_OR_COPY< int > (YY_MOVE (that.value));
         break;
 
-      case 4: // number
-      case 5: // negativenumber
-      case 277: // SignedNumber
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_negativenumber: // negativenumber
+      case symbol_kind::S_SignedNumber: // SignedNumber
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 7: // bstring
-      case 8: // xmlbstring
-      case 9: // hstring
-      case 10: // xmlhstring
-      case 11: // cstring
-      case 12: // xmlcstring
-      case 13: // simplestring
-      case 14: // xmltstring
-      case 22: // objectreference
-      case 24: // typefieldreference
-      case 25: // valuefieldreference
-      case 149: // GENERIC_IDENTIFIER_UPPERCASE
-      case 150: // GENERIC_IDENTIFIER_LOWERCASE
-      case 159: // UsefulObjectClassReference
-      case 165: // FieldName
-      case 216: // SimpleDefinedType
-      case 228: // ModuleIdentifier
-      case 246: // GlobalModuleReference
-      case 248: // Symbol
-      case 249: // Reference
-      case 372: // typereference
-      case 373: // identifier
-      case 374: // valuereference
-      case 375: // modulereference
-      case 376: // objectclassreference
-      case 377: // word
+      case symbol_kind::S_bstring: // bstring
+      case symbol_kind::S_xmlbstring: // xmlbstring
+      case symbol_kind::S_hstring: // hstring
+      case symbol_kind::S_xmlhstring: // xmlhstring
+      case symbol_kind::S_cstring: // cstring
+      case symbol_kind::S_xmlcstring: // xmlcstring
+      case symbol_kind::S_simplestring: // simplestring
+      case symbol_kind::S_xmltstring: // xmltstring
+      case symbol_kind::S_objectreference: // objectreference
+      case symbol_kind::S_typefieldreference: // typefieldreference
+      case symbol_kind::S_valuefieldreference: // valuefieldreference
+      case symbol_kind::S_GENERIC_IDENTIFIER_UPPERCASE: // GENERIC_IDENTIFIER_UPPERCASE
+      case symbol_kind::S_GENERIC_IDENTIFIER_LOWERCASE: // GENERIC_IDENTIFIER_LOWERCASE
+      case symbol_kind::S_UsefulObjectClassReference: // UsefulObjectClassReference
+      case symbol_kind::S_FieldName: // FieldName
+      case symbol_kind::S_SimpleDefinedType: // SimpleDefinedType
+      case symbol_kind::S_ModuleIdentifier: // ModuleIdentifier
+      case symbol_kind::S_GlobalModuleReference: // GlobalModuleReference
+      case symbol_kind::S_Symbol: // Symbol
+      case symbol_kind::S_Reference: // Reference
+      case symbol_kind::S_typereference: // typereference
+      case symbol_kind::S_identifier: // identifier
+      case symbol_kind::S_valuereference: // valuereference
+      case symbol_kind::S_modulereference: // modulereference
+      case symbol_kind::S_objectclassreference: // objectclassreference
+      case symbol_kind::S_word: // word
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
-      case 250: // AssignmentList
+      case symbol_kind::S_AssignmentList: // AssignmentList
         value.YY_MOVE_OR_COPY< std::vector<Assignment> > (YY_MOVE (that.value));
         break;
 
-      case 163: // FieldSpecList
-      case 164: // FieldSpec
-      case 167: // TypeFieldSpec
-      case 171: // FixedTypeValueFieldSpec
+      case symbol_kind::S_FieldSpecList: // FieldSpecList
+      case symbol_kind::S_FieldSpec: // FieldSpec
+      case symbol_kind::S_TypeFieldSpec: // TypeFieldSpec
+      case symbol_kind::S_FixedTypeValueFieldSpec: // FixedTypeValueFieldSpec
         value.YY_MOVE_OR_COPY< std::vector<ClassField> > (YY_MOVE (that.value));
         break;
 
-      case 240: // Exports
+      case symbol_kind::S_Exports: // Exports
         value.YY_MOVE_OR_COPY< std::vector<Export> > (YY_MOVE (that.value));
         break;
 
-      case 242: // Imports
-      case 243: // SymbolsImported
-      case 244: // SymbolsFromModuleList
+      case symbol_kind::S_Imports: // Imports
+      case symbol_kind::S_SymbolsImported: // SymbolsImported
+      case symbol_kind::S_SymbolsFromModuleList: // SymbolsFromModuleList
         value.YY_MOVE_OR_COPY< std::vector<Import> > (YY_MOVE (that.value));
         break;
 
-      case 275: // NamedNumberList
+      case symbol_kind::S_NamedNumberList: // NamedNumberList
         value.YY_MOVE_OR_COPY< std::vector<NamedNumber> > (YY_MOVE (that.value));
         break;
 
-      case 296: // AlternativeTypeLists
-      case 297: // RootAlternativeTypeList
-      case 298: // AlternativeTypeList
+      case symbol_kind::S_AlternativeTypeLists: // AlternativeTypeLists
+      case symbol_kind::S_RootAlternativeTypeList: // RootAlternativeTypeList
+      case symbol_kind::S_AlternativeTypeList: // AlternativeTypeList
         value.YY_MOVE_OR_COPY< std::vector<NamedType> > (YY_MOVE (that.value));
         break;
 
-      case 307: // ObjectIdentifierValue
-      case 308: // ObjIdComponentsList
+      case symbol_kind::S_ObjectIdentifierValue: // ObjectIdentifierValue
+      case symbol_kind::S_ObjIdComponentsList: // ObjIdComponentsList
         value.YY_MOVE_OR_COPY< std::vector<ObjectIdComponentValue> > (YY_MOVE (that.value));
         break;
 
-      case 208: // ParameterList
-      case 209: // ParameterSeries
+      case symbol_kind::S_ParameterList: // ParameterList
+      case symbol_kind::S_ParameterSeries: // ParameterSeries
         value.YY_MOVE_OR_COPY< std::vector<Parameter> > (YY_MOVE (that.value));
         break;
 
-      case 256: // ActualParameterList
+      case symbol_kind::S_ActualParameterList: // ActualParameterList
         value.YY_MOVE_OR_COPY< std::vector<Type> > (YY_MOVE (that.value));
         break;
 
-      case 271: // SequenceOfValues
+      case symbol_kind::S_SequenceOfValues: // SequenceOfValues
         value.YY_MOVE_OR_COPY< std::vector<Value> > (YY_MOVE (that.value));
         break;
 
-      case 166: // FieldNameList
-      case 168: // OneOrManyTypeFieldReference
-      case 247: // SymbolList
+      case symbol_kind::S_FieldNameList: // FieldNameList
+      case symbol_kind::S_OneOrManyTypeFieldReference: // OneOrManyTypeFieldReference
+      case symbol_kind::S_SymbolList: // SymbolList
         value.YY_MOVE_OR_COPY< std::vector<std::string> > (YY_MOVE (that.value));
         break;
 
@@ -6752,670 +7432,1084 @@ namespace yy {
   asn1_parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 160: // ObjectClassAssignment
-      case 199: // ObjectSetAssignment
-      case 203: // ParameterizedAssignment
-      case 204: // ParameterizedTypeAssignment
-      case 205: // ParameterizedValueAssignment
-      case 206: // ParameterizedValueSetTypeAssignment
-      case 207: // ParameterizedObjectClassAssignment
-      case 251: // Assignment
-      case 260: // TypeAssignment
-      case 261: // ValueAssignment
-      case 262: // ValueSetTypeAssignment
+      case symbol_kind::S_ObjectClassAssignment: // ObjectClassAssignment
+      case symbol_kind::S_ObjectSetAssignment: // ObjectSetAssignment
+      case symbol_kind::S_ParameterizedAssignment: // ParameterizedAssignment
+      case symbol_kind::S_ParameterizedTypeAssignment: // ParameterizedTypeAssignment
+      case symbol_kind::S_ParameterizedValueAssignment: // ParameterizedValueAssignment
+      case symbol_kind::S_ParameterizedValueSetTypeAssignment: // ParameterizedValueSetTypeAssignment
+      case symbol_kind::S_ParameterizedObjectClassAssignment: // ParameterizedObjectClassAssignment
+      case symbol_kind::S_Assignment: // Assignment
+      case symbol_kind::S_TypeAssignment: // TypeAssignment
+      case symbol_kind::S_ValueAssignment: // ValueAssignment
+      case symbol_kind::S_ValueSetTypeAssignment: // ValueSetTypeAssignment
         value.move< Assignment > (YY_MOVE (that.value));
         break;
 
-      case 283: // BitStringType
+      case symbol_kind::S_BitStringType: // BitStringType
         value.move< BitStringType > (YY_MOVE (that.value));
         break;
 
-      case 272: // BooleanType
+      case symbol_kind::S_BooleanType: // BooleanType
         value.move< BooleanType > (YY_MOVE (that.value));
         break;
 
-      case 273: // BooleanValue
+      case symbol_kind::S_BooleanValue: // BooleanValue
         value.move< BooleanValue > (YY_MOVE (that.value));
         break;
 
-      case 264: // BuiltinType
+      case symbol_kind::S_BuiltinType: // BuiltinType
         value.move< BuiltinType > (YY_MOVE (that.value));
         break;
 
-      case 328: // CharacterStringType
-      case 329: // RestrictedCharacterStringType
-      case 330: // UnrestrictedCharacterStringType
+      case symbol_kind::S_CharacterStringType: // CharacterStringType
+      case symbol_kind::S_RestrictedCharacterStringType: // RestrictedCharacterStringType
+      case symbol_kind::S_UnrestrictedCharacterStringType: // UnrestrictedCharacterStringType
         value.move< CharacterStringType > (YY_MOVE (that.value));
         break;
 
-      case 295: // ChoiceType
+      case symbol_kind::S_ChoiceType: // ChoiceType
         value.move< ChoiceType > (YY_MOVE (that.value));
         break;
 
-      case 305: // Class
+      case symbol_kind::S_Class: // Class
         value.move< Class > (YY_MOVE (that.value));
         break;
 
-      case 289: // ComponentTypeLists
-        value.move< Collection > (YY_MOVE (that.value));
+      case symbol_kind::S_ComponentTypeLists: // ComponentTypeLists
+        value.move< Collection > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ComponentType: // ComponentType
+        value.move< ComponentType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ComponentTypeList: // ComponentTypeList
+        value.move< ComponentTypeList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_Constraint: // Constraint
+      case symbol_kind::S_ConstraintSpec: // ConstraintSpec
+      case symbol_kind::S_SubtypeConstraint: // SubtypeConstraint
+      case symbol_kind::S_ElementSetSpecs: // ElementSetSpecs
+      case symbol_kind::S_ElementSetSpec: // ElementSetSpec
+      case symbol_kind::S_Unions: // Unions
+      case symbol_kind::S_UElems: // UElems
+      case symbol_kind::S_Intersections: // Intersections
+      case symbol_kind::S_IElems: // IElems
+      case symbol_kind::S_IntersectionElements: // IntersectionElements
+      case symbol_kind::S_Elems: // Elems
+      case symbol_kind::S_Elements: // Elements
+      case symbol_kind::S_SubtypeElements: // SubtypeElements
+      case symbol_kind::S_ValueRange: // ValueRange
+      case symbol_kind::S_SizeConstraint: // SizeConstraint
+        value.move< Constraint > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_DateTimeType: // DateTimeType
+        value.move< DateTimeType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_DateType: // DateType
+        value.move< DateType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_DefinedType: // DefinedType
+      case symbol_kind::S_ParameterizedType: // ParameterizedType
+      case symbol_kind::S_ExternalTypeReference: // ExternalTypeReference
+        value.move< DefinedType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_DefinedValue: // DefinedValue
+        value.move< DefinedValue > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_DurationType: // DurationType
+        value.move< DurationType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_EmbeddedPDVType: // EmbeddedPDVType
+        value.move< EmbeddedPDVType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_EnumeratedType: // EnumeratedType
+      case symbol_kind::S_Enumerations: // Enumerations
+      case symbol_kind::S_Enumeration: // Enumeration
+        value.move< EnumeratedType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_EnumerationItem: // EnumerationItem
+        value.move< EnumerationValue > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ExternalType: // ExternalType
+        value.move< ExternalType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_IRIType: // IRIType
+        value.move< IRIType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_SymbolsFromModule: // SymbolsFromModule
+        value.move< Import > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_InstanceOfType: // InstanceOfType
+        value.move< InstanceOfType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_IntegerType: // IntegerType
+        value.move< IntegerType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ModuleBody: // ModuleBody
+        value.move< Module > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_NamedNumber: // NamedNumber
+        value.move< NamedNumber > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_NamedType: // NamedType
+        value.move< NamedType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_NullType: // NullType
+        value.move< NullType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ObjectClass: // ObjectClass
+      case symbol_kind::S_ObjectClassDefn: // ObjectClassDefn
+        value.move< ObjectClassAssignment > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ObjectClassFieldType: // ObjectClassFieldType
+        value.move< ObjectClassFieldType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ObjIdComponents: // ObjIdComponents
+      case symbol_kind::S_NameForm: // NameForm
+      case symbol_kind::S_NumberForm: // NumberForm
+      case symbol_kind::S_NameAndNumberForm: // NameAndNumberForm
+        value.move< ObjectIdComponentValue > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ObjectIdentifierType: // ObjectIdentifierType
+        value.move< ObjectIdentifierType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_OctetStringType: // OctetStringType
+        value.move< OctetStringType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_Parameter: // Parameter
+        value.move< Parameter > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_PrefixedType: // PrefixedType
+        value.move< PrefixedType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_RealType: // RealType
+        value.move< RealType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_RelativeIRIType: // RelativeIRIType
+        value.move< RelativeIRIType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_RelativeOIDType: // RelativeOIDType
+        value.move< RelativeOIDType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_SequenceOfType: // SequenceOfType
+        value.move< SequenceOfType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_SequenceType: // SequenceType
+        value.move< SequenceType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_SetOfType: // SetOfType
+        value.move< SetOfType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_SetType: // SetType
+        value.move< SetType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_Tag: // Tag
+        value.move< Tag > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TaggedType: // TaggedType
+        value.move< TaggedType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TagDefault: // TagDefault
+        value.move< TaggingMode > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TimeOfDayType: // TimeOfDayType
+        value.move< TimeOfDayType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TimeType: // TimeType
+        value.move< TimeType > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TimeValue: // TimeValue
+        value.move< TimeValue > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ParamGovernor: // ParamGovernor
+      case symbol_kind::S_Governor: // Governor
+      case symbol_kind::S_ActualParameter: // ActualParameter
+      case symbol_kind::S_Type: // Type
+      case symbol_kind::S_ConstrainedType: // ConstrainedType
+      case symbol_kind::S_TypeWithConstraint: // TypeWithConstraint
+        value.move< Type > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ValueWithoutTypeIdentifier: // ValueWithoutTypeIdentifier
+      case symbol_kind::S_Value: // Value
+      case symbol_kind::S_SingleValue: // SingleValue
+        value.move< Value > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_LowerEndpoint: // LowerEndpoint
+      case symbol_kind::S_UpperEndpoint: // UpperEndpoint
+      case symbol_kind::S_LowerEndValue: // LowerEndValue
+      case symbol_kind::S_UpperEndValue: // UpperEndValue
+        value.move< absl::optional<ConstraintBound> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_realnumber: // realnumber
+        value.move< double > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ClassNumber: // ClassNumber
+        value.move< int > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_negativenumber: // negativenumber
+      case symbol_kind::S_SignedNumber: // SignedNumber
+        value.move< int64_t > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_bstring: // bstring
+      case symbol_kind::S_xmlbstring: // xmlbstring
+      case symbol_kind::S_hstring: // hstring
+      case symbol_kind::S_xmlhstring: // xmlhstring
+      case symbol_kind::S_cstring: // cstring
+      case symbol_kind::S_xmlcstring: // xmlcstring
+      case symbol_kind::S_simplestring: // simplestring
+      case symbol_kind::S_xmltstring: // xmltstring
+      case symbol_kind::S_objectreference: // objectreference
+      case symbol_kind::S_typefieldreference: // typefieldreference
+      case symbol_kind::S_valuefieldreference: // valuefieldreference
+      case symbol_kind::S_GENERIC_IDENTIFIER_UPPERCASE: // GENERIC_IDENTIFIER_UPPERCASE
+      case symbol_kind::S_GENERIC_IDENTIFIER_LOWERCASE: // GENERIC_IDENTIFIER_LOWERCASE
+      case symbol_kind::S_UsefulObjectClassReference: // UsefulObjectClassReference
+      case symbol_kind::S_FieldName: // FieldName
+      case symbol_kind::S_SimpleDefinedType: // SimpleDefinedType
+      case symbol_kind::S_ModuleIdentifier: // ModuleIdentifier
+      case symbol_kind::S_GlobalModuleReference: // GlobalModuleReference
+      case symbol_kind::S_Symbol: // Symbol
+      case symbol_kind::S_Reference: // Reference
+      case symbol_kind::S_typereference: // typereference
+      case symbol_kind::S_identifier: // identifier
+      case symbol_kind::S_valuereference: // valuereference
+      case symbol_kind::S_modulereference: // modulereference
+      case symbol_kind::S_objectclassreference: // objectclassreference
+      case symbol_kind::S_word: // word
+        value.move< std::string > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_AssignmentList: // AssignmentList
+        value.move< std::vector<Assignment> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FieldSpecList: // FieldSpecList
+      case symbol_kind::S_FieldSpec: // FieldSpec
+      case symbol_kind::S_TypeFieldSpec: // TypeFieldSpec
+      case symbol_kind::S_FixedTypeValueFieldSpec: // FixedTypeValueFieldSpec
+        value.move< std::vector<ClassField> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_Exports: // Exports
+        value.move< std::vector<Export> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_Imports: // Imports
+      case symbol_kind::S_SymbolsImported: // SymbolsImported
+      case symbol_kind::S_SymbolsFromModuleList: // SymbolsFromModuleList
+        value.move< std::vector<Import> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_NamedNumberList: // NamedNumberList
+        value.move< std::vector<NamedNumber> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_AlternativeTypeLists: // AlternativeTypeLists
+      case symbol_kind::S_RootAlternativeTypeList: // RootAlternativeTypeList
+      case symbol_kind::S_AlternativeTypeList: // AlternativeTypeList
+        value.move< std::vector<NamedType> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ObjectIdentifierValue: // ObjectIdentifierValue
+      case symbol_kind::S_ObjIdComponentsList: // ObjIdComponentsList
+        value.move< std::vector<ObjectIdComponentValue> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ParameterList: // ParameterList
+      case symbol_kind::S_ParameterSeries: // ParameterSeries
+        value.move< std::vector<Parameter> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ActualParameterList: // ActualParameterList
+        value.move< std::vector<Type> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_SequenceOfValues: // SequenceOfValues
+        value.move< std::vector<Value> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FieldNameList: // FieldNameList
+      case symbol_kind::S_OneOrManyTypeFieldReference: // OneOrManyTypeFieldReference
+      case symbol_kind::S_SymbolList: // SymbolList
+        value.move< std::vector<std::string> > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+    // that is emptied.
+    that.kind_ = symbol_kind::S_YYEMPTY;
+  }
+
+#if YY_CPLUSPLUS < 201103L
+  asn1_parser::stack_symbol_type&
+  asn1_parser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_ObjectClassAssignment: // ObjectClassAssignment
+      case symbol_kind::S_ObjectSetAssignment: // ObjectSetAssignment
+      case symbol_kind::S_ParameterizedAssignment: // ParameterizedAssignment
+      case symbol_kind::S_ParameterizedTypeAssignment: // ParameterizedTypeAssignment
+      case symbol_kind::S_ParameterizedValueAssignment: // ParameterizedValueAssignment
+      case symbol_kind::S_ParameterizedValueSetTypeAssignment: // ParameterizedValueSetTypeAssignment
+      case symbol_kind::S_ParameterizedObjectClassAssignment: // ParameterizedObjectClassAssignment
+      case symbol_kind::S_Assignment: // Assignment
+      case symbol_kind::S_TypeAssignment: // TypeAssignment
+      case symbol_kind::S_ValueAssignment: // ValueAssignment
+      case symbol_kind::S_ValueSetTypeAssignment: // ValueSetTypeAssignment
+        value.copy< Assignment > (that.value);
+        break;
+
+      case symbol_kind::S_BitStringType: // BitStringType
+        value.copy< BitStringType > (that.value);
+        break;
+
+      case symbol_kind::S_BooleanType: // BooleanType
+        value.copy< BooleanType > (that.value);
+        break;
+
+      case symbol_kind::S_BooleanValue: // BooleanValue
+        value.copy< BooleanValue > (that.value);
+        break;
+
+      case symbol_kind::S_BuiltinType: // BuiltinType
+        value.copy< BuiltinType > (that.value);
+        break;
+
+      case symbol_kind::S_CharacterStringType: // CharacterStringType
+      case symbol_kind::S_RestrictedCharacterStringType: // RestrictedCharacterStringType
+      case symbol_kind::S_UnrestrictedCharacterStringType: // UnrestrictedCharacterStringType
+        value.copy< CharacterStringType > (that.value);
+        break;
+
+      case symbol_kind::S_ChoiceType: // ChoiceType
+        value.copy< ChoiceType > (that.value);
+        break;
+
+      case symbol_kind::S_Class: // Class
+        value.copy< Class > (that.value);
+        break;
+
+      case symbol_kind::S_ComponentTypeLists: // ComponentTypeLists
+        value.copy< Collection > (that.value);
+        break;
+
+      case symbol_kind::S_ComponentType: // ComponentType
+        value.copy< ComponentType > (that.value);
+        break;
+
+      case symbol_kind::S_ComponentTypeList: // ComponentTypeList
+        value.copy< ComponentTypeList > (that.value);
         break;
 
-      case 291: // ComponentType
-        value.move< ComponentType > (YY_MOVE (that.value));
+      case symbol_kind::S_Constraint: // Constraint
+      case symbol_kind::S_ConstraintSpec: // ConstraintSpec
+      case symbol_kind::S_SubtypeConstraint: // SubtypeConstraint
+      case symbol_kind::S_ElementSetSpecs: // ElementSetSpecs
+      case symbol_kind::S_ElementSetSpec: // ElementSetSpec
+      case symbol_kind::S_Unions: // Unions
+      case symbol_kind::S_UElems: // UElems
+      case symbol_kind::S_Intersections: // Intersections
+      case symbol_kind::S_IElems: // IElems
+      case symbol_kind::S_IntersectionElements: // IntersectionElements
+      case symbol_kind::S_Elems: // Elems
+      case symbol_kind::S_Elements: // Elements
+      case symbol_kind::S_SubtypeElements: // SubtypeElements
+      case symbol_kind::S_ValueRange: // ValueRange
+      case symbol_kind::S_SizeConstraint: // SizeConstraint
+        value.copy< Constraint > (that.value);
         break;
 
-      case 290: // ComponentTypeList
-        value.move< ComponentTypeList > (YY_MOVE (that.value));
+      case symbol_kind::S_DateTimeType: // DateTimeType
+        value.copy< DateTimeType > (that.value);
         break;
 
-      case 326: // DateTimeType
-        value.move< DateTimeType > (YY_MOVE (that.value));
+      case symbol_kind::S_DateType: // DateType
+        value.copy< DateType > (that.value);
         break;
 
-      case 324: // DateType
-        value.move< DateType > (YY_MOVE (that.value));
+      case symbol_kind::S_DefinedType: // DefinedType
+      case symbol_kind::S_ParameterizedType: // ParameterizedType
+      case symbol_kind::S_ExternalTypeReference: // ExternalTypeReference
+        value.copy< DefinedType > (that.value);
         break;
 
-      case 252: // DefinedType
-      case 254: // ParameterizedType
-      case 258: // ExternalTypeReference
-        value.move< DefinedType > (YY_MOVE (that.value));
+      case symbol_kind::S_DefinedValue: // DefinedValue
+        value.copy< DefinedValue > (that.value);
         break;
 
-      case 253: // DefinedValue
-        value.move< DefinedValue > (YY_MOVE (that.value));
+      case symbol_kind::S_DurationType: // DurationType
+        value.copy< DurationType > (that.value);
         break;
 
-      case 327: // DurationType
-        value.move< DurationType > (YY_MOVE (that.value));
+      case symbol_kind::S_EmbeddedPDVType: // EmbeddedPDVType
+        value.copy< EmbeddedPDVType > (that.value);
         break;
 
-      case 320: // EmbeddedPDVType
-        value.move< EmbeddedPDVType > (YY_MOVE (that.value));
+      case symbol_kind::S_EnumeratedType: // EnumeratedType
+      case symbol_kind::S_Enumerations: // Enumerations
+      case symbol_kind::S_Enumeration: // Enumeration
+        value.copy< EnumeratedType > (that.value);
         break;
 
-      case 278: // EnumeratedType
-      case 279: // Enumerations
-      case 280: // Enumeration
-        value.move< EnumeratedType > (YY_MOVE (that.value));
+      case symbol_kind::S_EnumerationItem: // EnumerationItem
+        value.copy< EnumerationValue > (that.value);
         break;
 
-      case 281: // EnumerationItem
-        value.move< EnumerationValue > (YY_MOVE (that.value));
+      case symbol_kind::S_ExternalType: // ExternalType
+        value.copy< ExternalType > (that.value);
         break;
 
-      case 321: // ExternalType
-        value.move< ExternalType > (YY_MOVE (that.value));
+      case symbol_kind::S_IRIType: // IRIType
+        value.copy< IRIType > (that.value);
         break;
 
-      case 314: // IRIType
-        value.move< IRIType > (YY_MOVE (that.value));
+      case symbol_kind::S_SymbolsFromModule: // SymbolsFromModule
+        value.copy< Import > (that.value);
         break;
 
-      case 245: // SymbolsFromModule
-        value.move< Import > (YY_MOVE (that.value));
+      case symbol_kind::S_InstanceOfType: // InstanceOfType
+        value.copy< InstanceOfType > (that.value);
         break;
 
-      case 215: // InstanceOfType
-        value.move< InstanceOfType > (YY_MOVE (that.value));
+      case symbol_kind::S_IntegerType: // IntegerType
+        value.copy< IntegerType > (that.value);
         break;
 
-      case 274: // IntegerType
-        value.move< IntegerType > (YY_MOVE (that.value));
+      case symbol_kind::S_ModuleBody: // ModuleBody
+        value.copy< Module > (that.value);
         break;
 
-      case 239: // ModuleBody
-        value.move< Module > (YY_MOVE (that.value));
+      case symbol_kind::S_NamedNumber: // NamedNumber
+        value.copy< NamedNumber > (that.value);
         break;
 
-      case 276: // NamedNumber
-        value.move< NamedNumber > (YY_MOVE (that.value));
+      case symbol_kind::S_NamedType: // NamedType
+        value.copy< NamedType > (that.value);
         break;
 
-      case 265: // NamedType
-        value.move< NamedType > (YY_MOVE (that.value));
+      case symbol_kind::S_NullType: // NullType
+        value.copy< NullType > (that.value);
         break;
 
-      case 287: // NullType
-        value.move< NullType > (YY_MOVE (that.value));
+      case symbol_kind::S_ObjectClass: // ObjectClass
+      case symbol_kind::S_ObjectClassDefn: // ObjectClassDefn
+        value.copy< ObjectClassAssignment > (that.value);
         break;
 
-      case 161: // ObjectClass
-      case 162: // ObjectClassDefn
-        value.move< ObjectClassAssignment > (YY_MOVE (that.value));
+      case symbol_kind::S_ObjectClassFieldType: // ObjectClassFieldType
+        value.copy< ObjectClassFieldType > (that.value);
         break;
 
-      case 202: // ObjectClassFieldType
-        value.move< ObjectClassFieldType > (YY_MOVE (that.value));
+      case symbol_kind::S_ObjIdComponents: // ObjIdComponents
+      case symbol_kind::S_NameForm: // NameForm
+      case symbol_kind::S_NumberForm: // NumberForm
+      case symbol_kind::S_NameAndNumberForm: // NameAndNumberForm
+        value.copy< ObjectIdComponentValue > (that.value);
         break;
 
-      case 309: // ObjIdComponents
-      case 310: // NameForm
-      case 311: // NumberForm
-      case 312: // NameAndNumberForm
-        value.move< ObjectIdComponentValue > (YY_MOVE (that.value));
+      case symbol_kind::S_ObjectIdentifierType: // ObjectIdentifierType
+        value.copy< ObjectIdentifierType > (that.value);
         break;
 
-      case 306: // ObjectIdentifierType
-        value.move< ObjectIdentifierType > (YY_MOVE (that.value));
+      case symbol_kind::S_OctetStringType: // OctetStringType
+        value.copy< OctetStringType > (that.value);
         break;
 
-      case 286: // OctetStringType
-        value.move< OctetStringType > (YY_MOVE (that.value));
+      case symbol_kind::S_Parameter: // Parameter
+        value.copy< Parameter > (that.value);
         break;
 
-      case 210: // Parameter
-        value.move< Parameter > (YY_MOVE (that.value));
+      case symbol_kind::S_PrefixedType: // PrefixedType
+        value.copy< PrefixedType > (that.value);
         break;
 
-      case 300: // PrefixedType
-        value.move< PrefixedType > (YY_MOVE (that.value));
+      case symbol_kind::S_RealType: // RealType
+        value.copy< RealType > (that.value);
         break;
 
-      case 282: // RealType
-        value.move< RealType > (YY_MOVE (that.value));
+      case symbol_kind::S_RelativeIRIType: // RelativeIRIType
+        value.copy< RelativeIRIType > (that.value);
         break;
 
-      case 319: // RelativeIRIType
-        value.move< RelativeIRIType > (YY_MOVE (that.value));
+      case symbol_kind::S_RelativeOIDType: // RelativeOIDType
+        value.copy< RelativeOIDType > (that.value);
         break;
 
-      case 313: // RelativeOIDType
-        value.move< RelativeOIDType > (YY_MOVE (that.value));
+      case symbol_kind::S_SequenceOfType: // SequenceOfType
+        value.copy< SequenceOfType > (that.value);
         break;
 
-      case 292: // SequenceOfType
-        value.move< SequenceOfType > (YY_MOVE (that.value));
+      case symbol_kind::S_SequenceType: // SequenceType
+        value.copy< SequenceType > (that.value);
         break;
 
-      case 288: // SequenceType
-        value.move< SequenceType > (YY_MOVE (that.value));
+      case symbol_kind::S_SetOfType: // SetOfType
+        value.copy< SetOfType > (that.value);
         break;
 
-      case 294: // SetOfType
-        value.move< SetOfType > (YY_MOVE (that.value));
+      case symbol_kind::S_SetType: // SetType
+        value.copy< SetType > (that.value);
         break;
 
-      case 293: // SetType
-        value.move< SetType > (YY_MOVE (that.value));
+      case symbol_kind::S_Tag: // Tag
+        value.copy< Tag > (that.value);
         break;
 
-      case 302: // Tag
-        value.move< Tag > (YY_MOVE (that.value));
+      case symbol_kind::S_TaggedType: // TaggedType
+        value.copy< TaggedType > (that.value);
         break;
 
-      case 301: // TaggedType
-        value.move< TaggedType > (YY_MOVE (that.value));
+      case symbol_kind::S_TagDefault: // TagDefault
+        value.copy< TaggingMode > (that.value);
         break;
 
-      case 237: // TagDefault
-        value.move< TaggingMode > (YY_MOVE (that.value));
+      case symbol_kind::S_TimeOfDayType: // TimeOfDayType
+        value.copy< TimeOfDayType > (that.value);
         break;
 
-      case 325: // TimeOfDayType
-        value.move< TimeOfDayType > (YY_MOVE (that.value));
+      case symbol_kind::S_TimeType: // TimeType
+        value.copy< TimeType > (that.value);
         break;
 
-      case 322: // TimeType
-        value.move< TimeType > (YY_MOVE (that.value));
+      case symbol_kind::S_TimeValue: // TimeValue
+        value.copy< TimeValue > (that.value);
         break;
 
-      case 323: // TimeValue
-        value.move< TimeValue > (YY_MOVE (that.value));
+      case symbol_kind::S_ParamGovernor: // ParamGovernor
+      case symbol_kind::S_Governor: // Governor
+      case symbol_kind::S_ActualParameter: // ActualParameter
+      case symbol_kind::S_Type: // Type
+      case symbol_kind::S_ConstrainedType: // ConstrainedType
+      case symbol_kind::S_TypeWithConstraint: // TypeWithConstraint
+        value.copy< Type > (that.value);
         break;
 
-      case 211: // ParamGovernor
-      case 212: // Governor
-      case 257: // ActualParameter
-      case 263: // Type
-      case 331: // ConstrainedType
-      case 332: // TypeWithConstraint
-        value.move< Type > (YY_MOVE (that.value));
+      case symbol_kind::S_ValueWithoutTypeIdentifier: // ValueWithoutTypeIdentifier
+      case symbol_kind::S_Value: // Value
+      case symbol_kind::S_SingleValue: // SingleValue
+        value.copy< Value > (that.value);
         break;
 
-      case 266: // ValueWithoutTypeIdentifier
-      case 267: // Value
-      case 349: // SingleValue
-        value.move< Value > (YY_MOVE (that.value));
+      case symbol_kind::S_LowerEndpoint: // LowerEndpoint
+      case symbol_kind::S_UpperEndpoint: // UpperEndpoint
+      case symbol_kind::S_LowerEndValue: // LowerEndValue
+      case symbol_kind::S_UpperEndValue: // UpperEndValue
+        value.copy< absl::optional<ConstraintBound> > (that.value);
         break;
 
-      case 6: // realnumber
-        value.move< double > (YY_MOVE (that.value));
+      case symbol_kind::S_realnumber: // realnumber
+        value.copy< double > (that.value);
         break;
 
-      case 304: // ClassNumber
-        value.move< int > (YY_MOVE (that.value));
+      case symbol_kind::S_ClassNumber: // ClassNumber
+        value.copy< int > (that.value);
         break;
 
-      case 4: // number
-      case 5: // negativenumber
-      case 277: // SignedNumber
-        value.move< int64_t > (YY_MOVE (that.value));
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_negativenumber: // negativenumber
+      case symbol_kind::S_SignedNumber: // SignedNumber
+        value.copy< int64_t > (that.value);
         break;
 
-      case 7: // bstring
-      case 8: // xmlbstring
-      case 9: // hstring
-      case 10: // xmlhstring
-      case 11: // cstring
-      case 12: // xmlcstring
-      case 13: // simplestring
-      case 14: // xmltstring
-      case 22: // objectreference
-      case 24: // typefieldreference
-      case 25: // valuefieldreference
-      case 149: // GENERIC_IDENTIFIER_UPPERCASE
-      case 150: // GENERIC_IDENTIFIER_LOWERCASE
-      case 159: // UsefulObjectClassReference
-      case 165: // FieldName
-      case 216: // SimpleDefinedType
-      case 228: // ModuleIdentifier
-      case 246: // GlobalModuleReference
-      case 248: // Symbol
-      case 249: // Reference
-      case 372: // typereference
-      case 373: // identifier
-      case 374: // valuereference
-      case 375: // modulereference
-      case 376: // objectclassreference
-      case 377: // word
-        value.move< std::string > (YY_MOVE (that.value));
+      case symbol_kind::S_bstring: // bstring
+      case symbol_kind::S_xmlbstring: // xmlbstring
+      case symbol_kind::S_hstring: // hstring
+      case symbol_kind::S_xmlhstring: // xmlhstring
+      case symbol_kind::S_cstring: // cstring
+      case symbol_kind::S_xmlcstring: // xmlcstring
+      case symbol_kind::S_simplestring: // simplestring
+      case symbol_kind::S_xmltstring: // xmltstring
+      case symbol_kind::S_objectreference: // objectreference
+      case symbol_kind::S_typefieldreference: // typefieldreference
+      case symbol_kind::S_valuefieldreference: // valuefieldreference
+      case symbol_kind::S_GENERIC_IDENTIFIER_UPPERCASE: // GENERIC_IDENTIFIER_UPPERCASE
+      case symbol_kind::S_GENERIC_IDENTIFIER_LOWERCASE: // GENERIC_IDENTIFIER_LOWERCASE
+      case symbol_kind::S_UsefulObjectClassReference: // UsefulObjectClassReference
+      case symbol_kind::S_FieldName: // FieldName
+      case symbol_kind::S_SimpleDefinedType: // SimpleDefinedType
+      case symbol_kind::S_ModuleIdentifier: // ModuleIdentifier
+      case symbol_kind::S_GlobalModuleReference: // GlobalModuleReference
+      case symbol_kind::S_Symbol: // Symbol
+      case symbol_kind::S_Reference: // Reference
+      case symbol_kind::S_typereference: // typereference
+      case symbol_kind::S_identifier: // identifier
+      case symbol_kind::S_valuereference: // valuereference
+      case symbol_kind::S_modulereference: // modulereference
+      case symbol_kind::S_objectclassreference: // objectclassreference
+      case symbol_kind::S_word: // word
+        value.copy< std::string > (that.value);
         break;
 
-      case 250: // AssignmentList
-        value.move< std::vector<Assignment> > (YY_MOVE (that.value));
+      case symbol_kind::S_AssignmentList: // AssignmentList
+        value.copy< std::vector<Assignment> > (that.value);
         break;
 
-      case 163: // FieldSpecList
-      case 164: // FieldSpec
-      case 167: // TypeFieldSpec
-      case 171: // FixedTypeValueFieldSpec
-        value.move< std::vector<ClassField> > (YY_MOVE (that.value));
+      case symbol_kind::S_FieldSpecList: // FieldSpecList
+      case symbol_kind::S_FieldSpec: // FieldSpec
+      case symbol_kind::S_TypeFieldSpec: // TypeFieldSpec
+      case symbol_kind::S_FixedTypeValueFieldSpec: // FixedTypeValueFieldSpec
+        value.copy< std::vector<ClassField> > (that.value);
         break;
 
-      case 240: // Exports
-        value.move< std::vector<Export> > (YY_MOVE (that.value));
+      case symbol_kind::S_Exports: // Exports
+        value.copy< std::vector<Export> > (that.value);
         break;
 
-      case 242: // Imports
-      case 243: // SymbolsImported
-      case 244: // SymbolsFromModuleList
-        value.move< std::vector<Import> > (YY_MOVE (that.value));
+      case symbol_kind::S_Imports: // Imports
+      case symbol_kind::S_SymbolsImported: // SymbolsImported
+      case symbol_kind::S_SymbolsFromModuleList: // SymbolsFromModuleList
+        value.copy< std::vector<Import> > (that.value);
         break;
 
-      case 275: // NamedNumberList
-        value.move< std::vector<NamedNumber> > (YY_MOVE (that.value));
+      case symbol_kind::S_NamedNumberList: // NamedNumberList
+        value.copy< std::vector<NamedNumber> > (that.value);
         break;
 
-      case 296: // AlternativeTypeLists
-      case 297: // RootAlternativeTypeList
-      case 298: // AlternativeTypeList
-        value.move< std::vector<NamedType> > (YY_MOVE (that.value));
+      case symbol_kind::S_AlternativeTypeLists: // AlternativeTypeLists
+      case symbol_kind::S_RootAlternativeTypeList: // RootAlternativeTypeList
+      case symbol_kind::S_AlternativeTypeList: // AlternativeTypeList
+        value.copy< std::vector<NamedType> > (that.value);
         break;
 
-      case 307: // ObjectIdentifierValue
-      case 308: // ObjIdComponentsList
-        value.move< std::vector<ObjectIdComponentValue> > (YY_MOVE (that.value));
+      case symbol_kind::S_ObjectIdentifierValue: // ObjectIdentifierValue
+      case symbol_kind::S_ObjIdComponentsList: // ObjIdComponentsList
+        value.copy< std::vector<ObjectIdComponentValue> > (that.value);
         break;
 
-      case 208: // ParameterList
-      case 209: // ParameterSeries
-        value.move< std::vector<Parameter> > (YY_MOVE (that.value));
+      case symbol_kind::S_ParameterList: // ParameterList
+      case symbol_kind::S_ParameterSeries: // ParameterSeries
+        value.copy< std::vector<Parameter> > (that.value);
         break;
 
-      case 256: // ActualParameterList
-        value.move< std::vector<Type> > (YY_MOVE (that.value));
+      case symbol_kind::S_ActualParameterList: // ActualParameterList
+        value.copy< std::vector<Type> > (that.value);
         break;
 
-      case 271: // SequenceOfValues
-        value.move< std::vector<Value> > (YY_MOVE (that.value));
+      case symbol_kind::S_SequenceOfValues: // SequenceOfValues
+        value.copy< std::vector<Value> > (that.value);
         break;
 
-      case 166: // FieldNameList
-      case 168: // OneOrManyTypeFieldReference
-      case 247: // SymbolList
-        value.move< std::vector<std::string> > (YY_MOVE (that.value));
+      case symbol_kind::S_FieldNameList: // FieldNameList
+      case symbol_kind::S_OneOrManyTypeFieldReference: // OneOrManyTypeFieldReference
+      case symbol_kind::S_SymbolList: // SymbolList
+        value.copy< std::vector<std::string> > (that.value);
         break;
 
       default:
         break;
     }
 
-    // that is emptied.
-    that.type = empty_symbol;
+    location = that.location;
+    return *this;
   }
 
-#if YY_CPLUSPLUS < 201103L
   asn1_parser::stack_symbol_type&
   asn1_parser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 160: // ObjectClassAssignment
-      case 199: // ObjectSetAssignment
-      case 203: // ParameterizedAssignment
-      case 204: // ParameterizedTypeAssignment
-      case 205: // ParameterizedValueAssignment
-      case 206: // ParameterizedValueSetTypeAssignment
-      case 207: // ParameterizedObjectClassAssignment
-      case 251: // Assignment
-      case 260: // TypeAssignment
-      case 261: // ValueAssignment
-      case 262: // ValueSetTypeAssignment
+      case symbol_kind::S_ObjectClassAssignment: // ObjectClassAssignment
+      case symbol_kind::S_ObjectSetAssignment: // ObjectSetAssignment
+      case symbol_kind::S_ParameterizedAssignment: // ParameterizedAssignment
+      case symbol_kind::S_ParameterizedTypeAssignment: // ParameterizedTypeAssignment
+      case symbol_kind::S_ParameterizedValueAssignment: // ParameterizedValueAssignment
+      case symbol_kind::S_ParameterizedValueSetTypeAssignment: // ParameterizedValueSetTypeAssignment
+      case symbol_kind::S_ParameterizedObjectClassAssignment: // ParameterizedObjectClassAssignment
+      case symbol_kind::S_Assignment: // Assignment
+      case symbol_kind::S_TypeAssignment: // TypeAssignment
+      case symbol_kind::S_ValueAssignment: // ValueAssignment
+      case symbol_kind::S_ValueSetTypeAssignment: // ValueSetTypeAssignment
         value.move< Assignment > (that.value);
         break;
 
-      case 283: // BitStringType
+      case symbol_kind::S_BitStringType: // BitStringType
         value.move< BitStringType > (that.value);
         break;
 
-      case 272: // BooleanType
+      case symbol_kind::S_BooleanType: // BooleanType
         value.move< BooleanType > (that.value);
         break;
 
-      case 273: // BooleanValue
+      case symbol_kind::S_BooleanValue: // BooleanValue
         value.move< BooleanValue > (that.value);
         break;
 
-      case 264: // BuiltinType
+      case symbol_kind::S_BuiltinType: // BuiltinType
         value.move< BuiltinType > (that.value);
         break;
 
-      case 328: // CharacterStringType
-      case 329: // RestrictedCharacterStringType
-      case 330: // UnrestrictedCharacterStringType
+      case symbol_kind::S_CharacterStringType: // CharacterStringType
+      case symbol_kind::S_RestrictedCharacterStringType: // RestrictedCharacterStringType
+      case symbol_kind::S_UnrestrictedCharacterStringType: // UnrestrictedCharacterStringType
         value.move< CharacterStringType > (that.value);
         break;
 
-      case 295: // ChoiceType
+      case symbol_kind::S_ChoiceType: // ChoiceType
         value.move< ChoiceType > (that.value);
         break;
 
-      case 305: // Class
+      case symbol_kind::S_Class: // Class
         value.move< Class > (that.value);
         break;
 
-      case 289: // ComponentTypeLists
+      case symbol_kind::S_ComponentTypeLists: // ComponentTypeLists
         value.move< Collection > (that.value);
         break;
 
-      case 291: // ComponentType
+      case symbol_kind::S_ComponentType: // ComponentType
         value.move< ComponentType > (that.value);
         break;
 
-      case 290: // ComponentTypeList
+      case symbol_kind::S_ComponentTypeList: // ComponentTypeList
         value.move< ComponentTypeList > (that.value);
         break;
 
-      case 326: // DateTimeType
+      case symbol_kind::S_Constraint: // Constraint
+      case symbol_kind::S_ConstraintSpec: // ConstraintSpec
+      case symbol_kind::S_SubtypeConstraint: // SubtypeConstraint
+      case symbol_kind::S_ElementSetSpecs: // ElementSetSpecs
+      case symbol_kind::S_ElementSetSpec: // ElementSetSpec
+      case symbol_kind::S_Unions: // Unions
+      case symbol_kind::S_UElems: // UElems
+      case symbol_kind::S_Intersections: // Intersections
+      case symbol_kind::S_IElems: // IElems
+      case symbol_kind::S_IntersectionElements: // IntersectionElements
+      case symbol_kind::S_Elems: // Elems
+      case symbol_kind::S_Elements: // Elements
+      case symbol_kind::S_SubtypeElements: // SubtypeElements
+      case symbol_kind::S_ValueRange: // ValueRange
+      case symbol_kind::S_SizeConstraint: // SizeConstraint
+        value.move< Constraint > (that.value);
+        break;
+
+      case symbol_kind::S_DateTimeType: // DateTimeType
         value.move< DateTimeType > (that.value);
         break;
 
-      case 324: // DateType
+      case symbol_kind::S_DateType: // DateType
         value.move< DateType > (that.value);
         break;
 
-      case 252: // DefinedType
-      case 254: // ParameterizedType
-      case 258: // ExternalTypeReference
+      case symbol_kind::S_DefinedType: // DefinedType
+      case symbol_kind::S_ParameterizedType: // ParameterizedType
+      case symbol_kind::S_ExternalTypeReference: // ExternalTypeReference
         value.move< DefinedType > (that.value);
         break;
 
-      case 253: // DefinedValue
+      case symbol_kind::S_DefinedValue: // DefinedValue
         value.move< DefinedValue > (that.value);
         break;
 
-      case 327: // DurationType
+      case symbol_kind::S_DurationType: // DurationType
         value.move< DurationType > (that.value);
         break;
 
-      case 320: // EmbeddedPDVType
+      case symbol_kind::S_EmbeddedPDVType: // EmbeddedPDVType
         value.move< EmbeddedPDVType > (that.value);
         break;
 
-      case 278: // EnumeratedType
-      case 279: // Enumerations
-      case 280: // Enumeration
+      case symbol_kind::S_EnumeratedType: // EnumeratedType
+      case symbol_kind::S_Enumerations: // Enumerations
+      case symbol_kind::S_Enumeration: // Enumeration
         value.move< EnumeratedType > (that.value);
         break;
 
-      case 281: // EnumerationItem
+      case symbol_kind::S_EnumerationItem: // EnumerationItem
         value.move< EnumerationValue > (that.value);
         break;
 
-      case 321: // ExternalType
+      case symbol_kind::S_ExternalType: // ExternalType
         value.move< ExternalType > (that.value);
         break;
 
-      case 314: // IRIType
+      case symbol_kind::S_IRIType: // IRIType
         value.move< IRIType > (that.value);
         break;
 
-      case 245: // SymbolsFromModule
+      case symbol_kind::S_SymbolsFromModule: // SymbolsFromModule
         value.move< Import > (that.value);
         break;
 
-      case 215: // InstanceOfType
+      case symbol_kind::S_InstanceOfType: // InstanceOfType
         value.move< InstanceOfType > (that.value);
         break;
 
-      case 274: // IntegerType
+      case symbol_kind::S_IntegerType: // IntegerType
         value.move< IntegerType > (that.value);
         break;
 
-      case 239: // ModuleBody
+      case symbol_kind::S_ModuleBody: // ModuleBody
         value.move< Module > (that.value);
         break;
 
-      case 276: // NamedNumber
+      case symbol_kind::S_NamedNumber: // NamedNumber
         value.move< NamedNumber > (that.value);
         break;
 
-      case 265: // NamedType
+      case symbol_kind::S_NamedType: // NamedType
         value.move< NamedType > (that.value);
         break;
 
-      case 287: // NullType
+      case symbol_kind::S_NullType: // NullType
         value.move< NullType > (that.value);
         break;
 
-      case 161: // ObjectClass
-      case 162: // ObjectClassDefn
+      case symbol_kind::S_ObjectClass: // ObjectClass
+      case symbol_kind::S_ObjectClassDefn: // ObjectClassDefn
         value.move< ObjectClassAssignment > (that.value);
         break;
 
-      case 202: // ObjectClassFieldType
+      case symbol_kind::S_ObjectClassFieldType: // ObjectClassFieldType
         value.move< ObjectClassFieldType > (that.value);
         break;
 
-      case 309: // ObjIdComponents
-      case 310: // NameForm
-      case 311: // NumberForm
-      case 312: // NameAndNumberForm
+      case symbol_kind::S_ObjIdComponents: // ObjIdComponents
+      case symbol_kind::S_NameForm: // NameForm
+      case symbol_kind::S_NumberForm: // NumberForm
+      case symbol_kind::S_NameAndNumberForm: // NameAndNumberForm
         value.move< ObjectIdComponentValue > (that.value);
         break;
 
-      case 306: // ObjectIdentifierType
+      case symbol_kind::S_ObjectIdentifierType: // ObjectIdentifierType
         value.move< ObjectIdentifierType > (that.value);
         break;
 
-      case 286: // OctetStringType
+      case symbol_kind::S_OctetStringType: // OctetStringType
         value.move< OctetStringType > (that.value);
         break;
 
-      case 210: // Parameter
+      case symbol_kind::S_Parameter: // Parameter
         value.move< Parameter > (that.value);
         break;
 
-      case 300: // PrefixedType
+      case symbol_kind::S_PrefixedType: // PrefixedType
         value.move< PrefixedType > (that.value);
         break;
 
-      case 282: // RealType
+      case symbol_kind::S_RealType: // RealType
         value.move< RealType > (that.value);
         break;
 
-      case 319: // RelativeIRIType
+      case symbol_kind::S_RelativeIRIType: // RelativeIRIType
         value.move< RelativeIRIType > (that.value);
         break;
 
-      case 313: // RelativeOIDType
+      case symbol_kind::S_RelativeOIDType: // RelativeOIDType
         value.move< RelativeOIDType > (that.value);
         break;
 
-      case 292: // SequenceOfType
+      case symbol_kind::S_SequenceOfType: // SequenceOfType
         value.move< SequenceOfType > (that.value);
         break;
 
-      case 288: // SequenceType
+      case symbol_kind::S_SequenceType: // SequenceType
         value.move< SequenceType > (that.value);
         break;
 
-      case 294: // SetOfType
+      case symbol_kind::S_SetOfType: // SetOfType
         value.move< SetOfType > (that.value);
         break;
 
-      case 293: // SetType
+      case symbol_kind::S_SetType: // SetType
         value.move< SetType > (that.value);
         break;
 
-      case 302: // Tag
+      case symbol_kind::S_Tag: // Tag
         value.move< Tag > (that.value);
         break;
 
-      case 301: // TaggedType
+      case symbol_kind::S_TaggedType: // TaggedType
         value.move< TaggedType > (that.value);
         break;
 
-      case 237: // TagDefault
+      case symbol_kind::S_TagDefault: // TagDefault
         value.move< TaggingMode > (that.value);
         break;
 
-      case 325: // TimeOfDayType
+      case symbol_kind::S_TimeOfDayType: // TimeOfDayType
         value.move< TimeOfDayType > (that.value);
         break;
 
-      case 322: // TimeType
+      case symbol_kind::S_TimeType: // TimeType
         value.move< TimeType > (that.value);
         break;
 
-      case 323: // TimeValue
+      case symbol_kind::S_TimeValue: // TimeValue
         value.move< TimeValue > (that.value);
         break;
 
-      case 211: // ParamGovernor
-      case 212: // Governor
-      case 257: // ActualParameter
-      case 263: // Type
-      case 331: // ConstrainedType
-      case 332: // TypeWithConstraint
+      case symbol_kind::S_ParamGovernor: // ParamGovernor
+      case symbol_kind::S_Governor: // Governor
+      case symbol_kind::S_ActualParameter: // ActualParameter
+      case symbol_kind::S_Type: // Type
+      case symbol_kind::S_ConstrainedType: // ConstrainedType
+      case symbol_kind::S_TypeWithConstraint: // TypeWithConstraint
         value.move< Type > (that.value);
         break;
 
-      case 266: // ValueWithoutTypeIdentifier
-      case 267: // Value
-      case 349: // SingleValue
+      case symbol_kind::S_ValueWithoutTypeIdentifier: // ValueWithoutTypeIdentifier
+      case symbol_kind::S_Value: // Value
+      case symbol_kind::S_SingleValue: // SingleValue
         value.move< Value > (that.value);
         break;
 
-      case 6: // realnumber
+      case symbol_kind::S_LowerEndpoint: // LowerEndpoint
+      case symbol_kind::S_UpperEndpoint: // UpperEndpoint
+      case symbol_kind::S_LowerEndValue: // LowerEndValue
+      case symbol_kind::S_UpperEndValue: // UpperEndValue
+        value.move< absl::optional<ConstraintBound> > (that.value);
+        break;
+
+      case symbol_kind::S_realnumber: // realnumber
         value.move< double > (that.value);
         break;
 
-      case 304: // ClassNumber
+      case symbol_kind::S_ClassNumber: // ClassNumber
         value.move< int > (that.value);
         break;
 
-      case 4: // number
-      case 5: // negativenumber
-      case 277: // SignedNumber
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_negativenumber: // negativenumber
+      case symbol_kind::S_SignedNumber: // SignedNumber
         value.move< int64_t > (that.value);
         break;
 
-      case 7: // bstring
-      case 8: // xmlbstring
-      case 9: // hstring
-      case 10: // xmlhstring
-      case 11: // cstring
-      case 12: // xmlcstring
-      case 13: // simplestring
-      case 14: // xmltstring
-      case 22: // objectreference
-      case 24: // typefieldreference
-      case 25: // valuefieldreference
-      case 149: // GENERIC_IDENTIFIER_UPPERCASE
-      case 150: // GENERIC_IDENTIFIER_LOWERCASE
-      case 159: // UsefulObjectClassReference
-      case 165: // FieldName
-      case 216: // SimpleDefinedType
-      case 228: // ModuleIdentifier
-      case 246: // GlobalModuleReference
-      case 248: // Symbol
-      case 249: // Reference
-      case 372: // typereference
-      case 373: // identifier
-      case 374: // valuereference
-      case 375: // modulereference
-      case 376: // objectclassreference
-      case 377: // word
+      case symbol_kind::S_bstring: // bstring
+      case symbol_kind::S_xmlbstring: // xmlbstring
+      case symbol_kind::S_hstring: // hstring
+      case symbol_kind::S_xmlhstring: // xmlhstring
+      case symbol_kind::S_cstring: // cstring
+      case symbol_kind::S_xmlcstring: // xmlcstring
+      case symbol_kind::S_simplestring: // simplestring
+      case symbol_kind::S_xmltstring: // xmltstring
+      case symbol_kind::S_objectreference: // objectreference
+      case symbol_kind::S_typefieldreference: // typefieldreference
+      case symbol_kind::S_valuefieldreference: // valuefieldreference
+      case symbol_kind::S_GENERIC_IDENTIFIER_UPPERCASE: // GENERIC_IDENTIFIER_UPPERCASE
+      case symbol_kind::S_GENERIC_IDENTIFIER_LOWERCASE: // GENERIC_IDENTIFIER_LOWERCASE
+      case symbol_kind::S_UsefulObjectClassReference: // UsefulObjectClassReference
+      case symbol_kind::S_FieldName: // FieldName
+      case symbol_kind::S_SimpleDefinedType: // SimpleDefinedType
+      case symbol_kind::S_ModuleIdentifier: // ModuleIdentifier
+      case symbol_kind::S_GlobalModuleReference: // GlobalModuleReference
+      case symbol_kind::S_Symbol: // Symbol
+      case symbol_kind::S_Reference: // Reference
+      case symbol_kind::S_typereference: // typereference
+      case symbol_kind::S_identifier: // identifier
+      case symbol_kind::S_valuereference: // valuereference
+      case symbol_kind::S_modulereference: // modulereference
+      case symbol_kind::S_objectclassreference: // objectclassreference
+      case symbol_kind::S_word: // word
         value.move< std::string > (that.value);
         break;
 
-      case 250: // AssignmentList
+      case symbol_kind::S_AssignmentList: // AssignmentList
         value.move< std::vector<Assignment> > (that.value);
         break;
 
-      case 163: // FieldSpecList
-      case 164: // FieldSpec
-      case 167: // TypeFieldSpec
-      case 171: // FixedTypeValueFieldSpec
+      case symbol_kind::S_FieldSpecList: // FieldSpecList
+      case symbol_kind::S_FieldSpec: // FieldSpec
+      case symbol_kind::S_TypeFieldSpec: // TypeFieldSpec
+      case symbol_kind::S_FixedTypeValueFieldSpec: // FixedTypeValueFieldSpec
         value.move< std::vector<ClassField> > (that.value);
         break;
 
-      case 240: // Exports
+      case symbol_kind::S_Exports: // Exports
         value.move< std::vector<Export> > (that.value);
         break;
 
-      case 242: // Imports
-      case 243: // SymbolsImported
-      case 244: // SymbolsFromModuleList
+      case symbol_kind::S_Imports: // Imports
+      case symbol_kind::S_SymbolsImported: // SymbolsImported
+      case symbol_kind::S_SymbolsFromModuleList: // SymbolsFromModuleList
         value.move< std::vector<Import> > (that.value);
         break;
 
-      case 275: // NamedNumberList
+      case symbol_kind::S_NamedNumberList: // NamedNumberList
         value.move< std::vector<NamedNumber> > (that.value);
         break;
 
-      case 296: // AlternativeTypeLists
-      case 297: // RootAlternativeTypeList
-      case 298: // AlternativeTypeList
+      case symbol_kind::S_AlternativeTypeLists: // AlternativeTypeLists
+      case symbol_kind::S_RootAlternativeTypeList: // RootAlternativeTypeList
+      case symbol_kind::S_AlternativeTypeList: // AlternativeTypeList
         value.move< std::vector<NamedType> > (that.value);
         break;
 
-      case 307: // ObjectIdentifierValue
-      case 308: // ObjIdComponentsList
+      case symbol_kind::S_ObjectIdentifierValue: // ObjectIdentifierValue
+      case symbol_kind::S_ObjIdComponentsList: // ObjIdComponentsList
         value.move< std::vector<ObjectIdComponentValue> > (that.value);
         break;
 
-      case 208: // ParameterList
-      case 209: // ParameterSeries
+      case symbol_kind::S_ParameterList: // ParameterList
+      case symbol_kind::S_ParameterSeries: // ParameterSeries
         value.move< std::vector<Parameter> > (that.value);
         break;
 
-      case 256: // ActualParameterList
+      case symbol_kind::S_ActualParameterList: // ActualParameterList
         value.move< std::vector<Type> > (that.value);
         break;
 
-      case 271: // SequenceOfValues
+      case symbol_kind::S_SequenceOfValues: // SequenceOfValues
         value.move< std::vector<Value> > (that.value);
         break;
 
-      case 166: // FieldNameList
-      case 168: // OneOrManyTypeFieldReference
-      case 247: // SymbolList
+      case symbol_kind::S_FieldNameList: // FieldNameList
+      case symbol_kind::S_OneOrManyTypeFieldReference: // OneOrManyTypeFieldReference
+      case symbol_kind::S_SymbolList: // SymbolList
         value.move< std::vector<std::string> > (that.value);
         break;
 
@@ -7441,23 +8535,21 @@ namespace yy {
 #if YYDEBUG
   template <typename Base>
   void
-  asn1_parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  asn1_parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-#if defined __GNUC__ && ! defined __clang__ && ! defined __ICC && __GNUC__ * 100 + __GNUC_MINOR__ <= 408
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-#endif
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    YYUSE (yytype);
-    yyo << ')';
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        YY_USE (yykind);
+        yyo << ')';
+      }
   }
 #endif
 
@@ -7481,7 +8573,7 @@ namespace yy {
   }
 
   void
-  asn1_parser::yypop_ (int n)
+  asn1_parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -7516,21 +8608,21 @@ namespace yy {
   asn1_parser::state_type
   asn1_parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  asn1_parser::yy_pact_value_is_default_ (int yyvalue)
+  asn1_parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  asn1_parser::yy_table_value_is_error_ (int yyvalue)
+  asn1_parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -7544,7 +8636,6 @@ namespace yy {
   int
   asn1_parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -7580,7 +8671,8 @@ namespace yy {
   | yynewstate -- push a new symbol on the stack.  |
   `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
@@ -7594,14 +8686,14 @@ namespace yy {
   `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -7620,11 +8712,23 @@ namespace yy {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -7641,7 +8745,7 @@ namespace yy {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
 
@@ -7649,7 +8753,7 @@ namespace yy {
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
@@ -7668,328 +8772,353 @@ namespace yy {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 160: // ObjectClassAssignment
-      case 199: // ObjectSetAssignment
-      case 203: // ParameterizedAssignment
-      case 204: // ParameterizedTypeAssignment
-      case 205: // ParameterizedValueAssignment
-      case 206: // ParameterizedValueSetTypeAssignment
-      case 207: // ParameterizedObjectClassAssignment
-      case 251: // Assignment
-      case 260: // TypeAssignment
-      case 261: // ValueAssignment
-      case 262: // ValueSetTypeAssignment
+      case symbol_kind::S_ObjectClassAssignment: // ObjectClassAssignment
+      case symbol_kind::S_ObjectSetAssignment: // ObjectSetAssignment
+      case symbol_kind::S_ParameterizedAssignment: // ParameterizedAssignment
+      case symbol_kind::S_ParameterizedTypeAssignment: // ParameterizedTypeAssignment
+      case symbol_kind::S_ParameterizedValueAssignment: // ParameterizedValueAssignment
+      case symbol_kind::S_ParameterizedValueSetTypeAssignment: // ParameterizedValueSetTypeAssignment
+      case symbol_kind::S_ParameterizedObjectClassAssignment: // ParameterizedObjectClassAssignment
+      case symbol_kind::S_Assignment: // Assignment
+      case symbol_kind::S_TypeAssignment: // TypeAssignment
+      case symbol_kind::S_ValueAssignment: // ValueAssignment
+      case symbol_kind::S_ValueSetTypeAssignment: // ValueSetTypeAssignment
         yylhs.value.emplace< Assignment > ();
         break;
 
-      case 283: // BitStringType
+      case symbol_kind::S_BitStringType: // BitStringType
         yylhs.value.emplace< BitStringType > ();
         break;
 
-      case 272: // BooleanType
+      case symbol_kind::S_BooleanType: // BooleanType
         yylhs.value.emplace< BooleanType > ();
         break;
 
-      case 273: // BooleanValue
+      case symbol_kind::S_BooleanValue: // BooleanValue
         yylhs.value.emplace< BooleanValue > ();
         break;
 
-      case 264: // BuiltinType
+      case symbol_kind::S_BuiltinType: // BuiltinType
         yylhs.value.emplace< BuiltinType > ();
         break;
 
-      case 328: // CharacterStringType
-      case 329: // RestrictedCharacterStringType
-      case 330: // UnrestrictedCharacterStringType
+      case symbol_kind::S_CharacterStringType: // CharacterStringType
+      case symbol_kind::S_RestrictedCharacterStringType: // RestrictedCharacterStringType
+      case symbol_kind::S_UnrestrictedCharacterStringType: // UnrestrictedCharacterStringType
         yylhs.value.emplace< CharacterStringType > ();
         break;
 
-      case 295: // ChoiceType
+      case symbol_kind::S_ChoiceType: // ChoiceType
         yylhs.value.emplace< ChoiceType > ();
         break;
 
-      case 305: // Class
+      case symbol_kind::S_Class: // Class
         yylhs.value.emplace< Class > ();
         break;
 
-      case 289: // ComponentTypeLists
+      case symbol_kind::S_ComponentTypeLists: // ComponentTypeLists
         yylhs.value.emplace< Collection > ();
         break;
 
-      case 291: // ComponentType
+      case symbol_kind::S_ComponentType: // ComponentType
         yylhs.value.emplace< ComponentType > ();
         break;
 
-      case 290: // ComponentTypeList
+      case symbol_kind::S_ComponentTypeList: // ComponentTypeList
         yylhs.value.emplace< ComponentTypeList > ();
         break;
 
-      case 326: // DateTimeType
+      case symbol_kind::S_Constraint: // Constraint
+      case symbol_kind::S_ConstraintSpec: // ConstraintSpec
+      case symbol_kind::S_SubtypeConstraint: // SubtypeConstraint
+      case symbol_kind::S_ElementSetSpecs: // ElementSetSpecs
+      case symbol_kind::S_ElementSetSpec: // ElementSetSpec
+      case symbol_kind::S_Unions: // Unions
+      case symbol_kind::S_UElems: // UElems
+      case symbol_kind::S_Intersections: // Intersections
+      case symbol_kind::S_IElems: // IElems
+      case symbol_kind::S_IntersectionElements: // IntersectionElements
+      case symbol_kind::S_Elems: // Elems
+      case symbol_kind::S_Elements: // Elements
+      case symbol_kind::S_SubtypeElements: // SubtypeElements
+      case symbol_kind::S_ValueRange: // ValueRange
+      case symbol_kind::S_SizeConstraint: // SizeConstraint
+        yylhs.value.emplace< Constraint > ();
+        break;
+
+      case symbol_kind::S_DateTimeType: // DateTimeType
         yylhs.value.emplace< DateTimeType > ();
         break;
 
-      case 324: // DateType
+      case symbol_kind::S_DateType: // DateType
         yylhs.value.emplace< DateType > ();
         break;
 
-      case 252: // DefinedType
-      case 254: // ParameterizedType
-      case 258: // ExternalTypeReference
+      case symbol_kind::S_DefinedType: // DefinedType
+      case symbol_kind::S_ParameterizedType: // ParameterizedType
+      case symbol_kind::S_ExternalTypeReference: // ExternalTypeReference
         yylhs.value.emplace< DefinedType > ();
         break;
 
-      case 253: // DefinedValue
+      case symbol_kind::S_DefinedValue: // DefinedValue
         yylhs.value.emplace< DefinedValue > ();
         break;
 
-      case 327: // DurationType
+      case symbol_kind::S_DurationType: // DurationType
         yylhs.value.emplace< DurationType > ();
         break;
 
-      case 320: // EmbeddedPDVType
+      case symbol_kind::S_EmbeddedPDVType: // EmbeddedPDVType
         yylhs.value.emplace< EmbeddedPDVType > ();
         break;
 
-      case 278: // EnumeratedType
-      case 279: // Enumerations
-      case 280: // Enumeration
+      case symbol_kind::S_EnumeratedType: // EnumeratedType
+      case symbol_kind::S_Enumerations: // Enumerations
+      case symbol_kind::S_Enumeration: // Enumeration
         yylhs.value.emplace< EnumeratedType > ();
         break;
 
-      case 281: // EnumerationItem
+      case symbol_kind::S_EnumerationItem: // EnumerationItem
         yylhs.value.emplace< EnumerationValue > ();
         break;
 
-      case 321: // ExternalType
+      case symbol_kind::S_ExternalType: // ExternalType
         yylhs.value.emplace< ExternalType > ();
         break;
 
-      case 314: // IRIType
+      case symbol_kind::S_IRIType: // IRIType
         yylhs.value.emplace< IRIType > ();
         break;
 
-      case 245: // SymbolsFromModule
+      case symbol_kind::S_SymbolsFromModule: // SymbolsFromModule
         yylhs.value.emplace< Import > ();
         break;
 
-      case 215: // InstanceOfType
+      case symbol_kind::S_InstanceOfType: // InstanceOfType
         yylhs.value.emplace< InstanceOfType > ();
         break;
 
-      case 274: // IntegerType
+      case symbol_kind::S_IntegerType: // IntegerType
         yylhs.value.emplace< IntegerType > ();
         break;
 
-      case 239: // ModuleBody
+      case symbol_kind::S_ModuleBody: // ModuleBody
         yylhs.value.emplace< Module > ();
         break;
 
-      case 276: // NamedNumber
+      case symbol_kind::S_NamedNumber: // NamedNumber
         yylhs.value.emplace< NamedNumber > ();
         break;
 
-      case 265: // NamedType
+      case symbol_kind::S_NamedType: // NamedType
         yylhs.value.emplace< NamedType > ();
         break;
 
-      case 287: // NullType
+      case symbol_kind::S_NullType: // NullType
         yylhs.value.emplace< NullType > ();
         break;
 
-      case 161: // ObjectClass
-      case 162: // ObjectClassDefn
+      case symbol_kind::S_ObjectClass: // ObjectClass
+      case symbol_kind::S_ObjectClassDefn: // ObjectClassDefn
         yylhs.value.emplace< ObjectClassAssignment > ();
         break;
 
-      case 202: // ObjectClassFieldType
+      case symbol_kind::S_ObjectClassFieldType: // ObjectClassFieldType
         yylhs.value.emplace< ObjectClassFieldType > ();
         break;
 
-      case 309: // ObjIdComponents
-      case 310: // NameForm
-      case 311: // NumberForm
-      case 312: // NameAndNumberForm
+      case symbol_kind::S_ObjIdComponents: // ObjIdComponents
+      case symbol_kind::S_NameForm: // NameForm
+      case symbol_kind::S_NumberForm: // NumberForm
+      case symbol_kind::S_NameAndNumberForm: // NameAndNumberForm
         yylhs.value.emplace< ObjectIdComponentValue > ();
         break;
 
-      case 306: // ObjectIdentifierType
+      case symbol_kind::S_ObjectIdentifierType: // ObjectIdentifierType
         yylhs.value.emplace< ObjectIdentifierType > ();
         break;
 
-      case 286: // OctetStringType
+      case symbol_kind::S_OctetStringType: // OctetStringType
         yylhs.value.emplace< OctetStringType > ();
         break;
 
-      case 210: // Parameter
+      case symbol_kind::S_Parameter: // Parameter
         yylhs.value.emplace< Parameter > ();
         break;
 
-      case 300: // PrefixedType
+      case symbol_kind::S_PrefixedType: // PrefixedType
         yylhs.value.emplace< PrefixedType > ();
         break;
 
-      case 282: // RealType
+      case symbol_kind::S_RealType: // RealType
         yylhs.value.emplace< RealType > ();
         break;
 
-      case 319: // RelativeIRIType
+      case symbol_kind::S_RelativeIRIType: // RelativeIRIType
         yylhs.value.emplace< RelativeIRIType > ();
         break;
 
-      case 313: // RelativeOIDType
+      case symbol_kind::S_RelativeOIDType: // RelativeOIDType
         yylhs.value.emplace< RelativeOIDType > ();
         break;
 
-      case 292: // SequenceOfType
+      case symbol_kind::S_SequenceOfType: // SequenceOfType
         yylhs.value.emplace< SequenceOfType > ();
         break;
 
-      case 288: // SequenceType
+      case symbol_kind::S_SequenceType: // SequenceType
         yylhs.value.emplace< SequenceType > ();
         break;
 
-      case 294: // SetOfType
+      case symbol_kind::S_SetOfType: // SetOfType
         yylhs.value.emplace< SetOfType > ();
         break;
 
-      case 293: // SetType
+      case symbol_kind::S_SetType: // SetType
         yylhs.value.emplace< SetType > ();
         break;
 
-      case 302: // Tag
+      case symbol_kind::S_Tag: // Tag
         yylhs.value.emplace< Tag > ();
         break;
 
-      case 301: // TaggedType
+      case symbol_kind::S_TaggedType: // TaggedType
         yylhs.value.emplace< TaggedType > ();
         break;
 
-      case 237: // TagDefault
+      case symbol_kind::S_TagDefault: // TagDefault
         yylhs.value.emplace< TaggingMode > ();
         break;
 
-      case 325: // TimeOfDayType
+      case symbol_kind::S_TimeOfDayType: // TimeOfDayType
         yylhs.value.emplace< TimeOfDayType > ();
         break;
 
-      case 322: // TimeType
+      case symbol_kind::S_TimeType: // TimeType
         yylhs.value.emplace< TimeType > ();
         break;
 
-      case 323: // TimeValue
+      case symbol_kind::S_TimeValue: // TimeValue
         yylhs.value.emplace< TimeValue > ();
         break;
 
-      case 211: // ParamGovernor
-      case 212: // Governor
-      case 257: // ActualParameter
-      case 263: // Type
-      case 331: // ConstrainedType
-      case 332: // TypeWithConstraint
+      case symbol_kind::S_ParamGovernor: // ParamGovernor
+      case symbol_kind::S_Governor: // Governor
+      case symbol_kind::S_ActualParameter: // ActualParameter
+      case symbol_kind::S_Type: // Type
+      case symbol_kind::S_ConstrainedType: // ConstrainedType
+      case symbol_kind::S_TypeWithConstraint: // TypeWithConstraint
         yylhs.value.emplace< Type > ();
         break;
 
-      case 266: // ValueWithoutTypeIdentifier
-      case 267: // Value
-      case 349: // SingleValue
+      case symbol_kind::S_ValueWithoutTypeIdentifier: // ValueWithoutTypeIdentifier
+      case symbol_kind::S_Value: // Value
+      case symbol_kind::S_SingleValue: // SingleValue
         yylhs.value.emplace< Value > ();
         break;
 
-      case 6: // realnumber
+      case symbol_kind::S_LowerEndpoint: // LowerEndpoint
+      case symbol_kind::S_UpperEndpoint: // UpperEndpoint
+      case symbol_kind::S_LowerEndValue: // LowerEndValue
+      case symbol_kind::S_UpperEndValue: // UpperEndValue
+        yylhs.value.emplace< absl::optional<ConstraintBound> > ();
+        break;
+
+      case symbol_kind::S_realnumber: // realnumber
         yylhs.value.emplace< double > ();
         break;
 
-      case 304: // ClassNumber
+      case symbol_kind::S_ClassNumber: // ClassNumber
         yylhs.value.emplace< int > ();
         break;
 
-      case 4: // number
-      case 5: // negativenumber
-      case 277: // SignedNumber
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_negativenumber: // negativenumber
+      case symbol_kind::S_SignedNumber: // SignedNumber
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 7: // bstring
-      case 8: // xmlbstring
-      case 9: // hstring
-      case 10: // xmlhstring
-      case 11: // cstring
-      case 12: // xmlcstring
-      case 13: // simplestring
-      case 14: // xmltstring
-      case 22: // objectreference
-      case 24: // typefieldreference
-      case 25: // valuefieldreference
-      case 149: // GENERIC_IDENTIFIER_UPPERCASE
-      case 150: // GENERIC_IDENTIFIER_LOWERCASE
-      case 159: // UsefulObjectClassReference
-      case 165: // FieldName
-      case 216: // SimpleDefinedType
-      case 228: // ModuleIdentifier
-      case 246: // GlobalModuleReference
-      case 248: // Symbol
-      case 249: // Reference
-      case 372: // typereference
-      case 373: // identifier
-      case 374: // valuereference
-      case 375: // modulereference
-      case 376: // objectclassreference
-      case 377: // word
+      case symbol_kind::S_bstring: // bstring
+      case symbol_kind::S_xmlbstring: // xmlbstring
+      case symbol_kind::S_hstring: // hstring
+      case symbol_kind::S_xmlhstring: // xmlhstring
+      case symbol_kind::S_cstring: // cstring
+      case symbol_kind::S_xmlcstring: // xmlcstring
+      case symbol_kind::S_simplestring: // simplestring
+      case symbol_kind::S_xmltstring: // xmltstring
+      case symbol_kind::S_objectreference: // objectreference
+      case symbol_kind::S_typefieldreference: // typefieldreference
+      case symbol_kind::S_valuefieldreference: // valuefieldreference
+      case symbol_kind::S_GENERIC_IDENTIFIER_UPPERCASE: // GENERIC_IDENTIFIER_UPPERCASE
+      case symbol_kind::S_GENERIC_IDENTIFIER_LOWERCASE: // GENERIC_IDENTIFIER_LOWERCASE
+      case symbol_kind::S_UsefulObjectClassReference: // UsefulObjectClassReference
+      case symbol_kind::S_FieldName: // FieldName
+      case symbol_kind::S_SimpleDefinedType: // SimpleDefinedType
+      case symbol_kind::S_ModuleIdentifier: // ModuleIdentifier
+      case symbol_kind::S_GlobalModuleReference: // GlobalModuleReference
+      case symbol_kind::S_Symbol: // Symbol
+      case symbol_kind::S_Reference: // Reference
+      case symbol_kind::S_typereference: // typereference
+      case symbol_kind::S_identifier: // identifier
+      case symbol_kind::S_valuereference: // valuereference
+      case symbol_kind::S_modulereference: // modulereference
+      case symbol_kind::S_objectclassreference: // objectclassreference
+      case symbol_kind::S_word: // word
         yylhs.value.emplace< std::string > ();
         break;
 
-      case 250: // AssignmentList
+      case symbol_kind::S_AssignmentList: // AssignmentList
         yylhs.value.emplace< std::vector<Assignment> > ();
         break;
 
-      case 163: // FieldSpecList
-      case 164: // FieldSpec
-      case 167: // TypeFieldSpec
-      case 171: // FixedTypeValueFieldSpec
+      case symbol_kind::S_FieldSpecList: // FieldSpecList
+      case symbol_kind::S_FieldSpec: // FieldSpec
+      case symbol_kind::S_TypeFieldSpec: // TypeFieldSpec
+      case symbol_kind::S_FixedTypeValueFieldSpec: // FixedTypeValueFieldSpec
         yylhs.value.emplace< std::vector<ClassField> > ();
         break;
 
-      case 240: // Exports
+      case symbol_kind::S_Exports: // Exports
         yylhs.value.emplace< std::vector<Export> > ();
         break;
 
-      case 242: // Imports
-      case 243: // SymbolsImported
-      case 244: // SymbolsFromModuleList
+      case symbol_kind::S_Imports: // Imports
+      case symbol_kind::S_SymbolsImported: // SymbolsImported
+      case symbol_kind::S_SymbolsFromModuleList: // SymbolsFromModuleList
         yylhs.value.emplace< std::vector<Import> > ();
         break;
 
-      case 275: // NamedNumberList
+      case symbol_kind::S_NamedNumberList: // NamedNumberList
         yylhs.value.emplace< std::vector<NamedNumber> > ();
         break;
 
-      case 296: // AlternativeTypeLists
-      case 297: // RootAlternativeTypeList
-      case 298: // AlternativeTypeList
+      case symbol_kind::S_AlternativeTypeLists: // AlternativeTypeLists
+      case symbol_kind::S_RootAlternativeTypeList: // RootAlternativeTypeList
+      case symbol_kind::S_AlternativeTypeList: // AlternativeTypeList
         yylhs.value.emplace< std::vector<NamedType> > ();
         break;
 
-      case 307: // ObjectIdentifierValue
-      case 308: // ObjIdComponentsList
+      case symbol_kind::S_ObjectIdentifierValue: // ObjectIdentifierValue
+      case symbol_kind::S_ObjIdComponentsList: // ObjIdComponentsList
         yylhs.value.emplace< std::vector<ObjectIdComponentValue> > ();
         break;
 
-      case 208: // ParameterList
-      case 209: // ParameterSeries
+      case symbol_kind::S_ParameterList: // ParameterList
+      case symbol_kind::S_ParameterSeries: // ParameterSeries
         yylhs.value.emplace< std::vector<Parameter> > ();
         break;
 
-      case 256: // ActualParameterList
+      case symbol_kind::S_ActualParameterList: // ActualParameterList
         yylhs.value.emplace< std::vector<Type> > ();
         break;
 
-      case 271: // SequenceOfValues
+      case symbol_kind::S_SequenceOfValues: // SequenceOfValues
         yylhs.value.emplace< std::vector<Value> > ();
         break;
 
-      case 166: // FieldNameList
-      case 168: // OneOrManyTypeFieldReference
-      case 247: // SymbolList
+      case symbol_kind::S_FieldNameList: // FieldNameList
+      case symbol_kind::S_OneOrManyTypeFieldReference: // OneOrManyTypeFieldReference
+      case symbol_kind::S_SymbolList: // SymbolList
         yylhs.value.emplace< std::vector<std::string> > ();
         break;
 
@@ -8013,342 +9142,342 @@ namespace yy {
         {
           switch (yyn)
             {
-  case 4:
-#line 341 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 4: // ModuleDefinition: ModuleIdentifier DEFINITIONS EncodingReferenceDefault TagDefault ExtensionDefault "::=" BEGIN ModuleBody EncodingControlSections END
+#line 360 "/root/repo/src/compiler/asn_compiler.yacc"
     { yystack_[2].value.as < Module > ().module_reference = yystack_[9].value.as < std::string > ();
       yystack_[2].value.as < Module > ().tagging_default = yystack_[6].value.as < TaggingMode > ();
       context_.asn1_tree.modules.push_back(yystack_[2].value.as < Module > ()); }
-#line 8020 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9151 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 10:
-#line 358 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 10: // UsefulObjectClassReference: TYPE_IDENTIFIER
+#line 377 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = "TYPE-IDENTIFIER"; }
-#line 8026 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9157 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 11:
-#line 360 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 11: // UsefulObjectClassReference: ABSTRACT_SYNTAX
+#line 379 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = "TYPE-IDENTIFIER"; }
-#line 8032 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9163 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 12:
-#line 364 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 12: // ObjectClassAssignment: typereference "::=" ObjectClass
+#line 383 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = Assignment{yystack_[2].value.as < std::string > (), yystack_[0].value.as < ObjectClassAssignment > ()}; }
-#line 8038 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9169 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 13:
-#line 368 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 13: // ObjectClass: DefinedObjectClass
+#line 387 "/root/repo/src/compiler/asn_compiler.yacc"
     { feature_not_implemented(context_.location, context_.asn1_tree, "ObjectClass"); }
-#line 8044 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9175 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 14:
-#line 370 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 14: // ObjectClass: ObjectClassDefn
+#line 389 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ObjectClassAssignment > () = yystack_[0].value.as < ObjectClassAssignment > (); }
-#line 8050 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9181 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 15:
-#line 375 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 15: // ObjectClassDefn: CLASS "{" FieldSpecList "}" WithSyntaxSpec
+#line 394 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ObjectClassAssignment > () = {yystack_[2].value.as < std::vector<ClassField> > ()}; }
-#line 8056 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9187 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 16:
-#line 379 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 16: // FieldSpecList: FieldSpec
+#line 398 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<ClassField> > () = yystack_[0].value.as < std::vector<ClassField> > (); }
-#line 8062 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9193 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 17:
-#line 381 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 17: // FieldSpecList: FieldSpecList "," FieldSpec
+#line 400 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<ClassField> > () = yystack_[2].value.as < std::vector<ClassField> > (); yylhs.value.as < std::vector<ClassField> > ().insert(yylhs.value.as < std::vector<ClassField> > ().end(), yystack_[0].value.as < std::vector<ClassField> > ().begin(), yystack_[0].value.as < std::vector<ClassField> > ().end()); }
-#line 8068 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9199 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 18:
-#line 385 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 18: // FieldSpec: TypeFieldSpec
+#line 404 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<ClassField> > () = yystack_[0].value.as < std::vector<ClassField> > (); }
-#line 8074 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9205 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 19:
-#line 387 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 19: // FieldSpec: FixedTypeValueFieldSpec
+#line 406 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<ClassField> > () = yystack_[0].value.as < std::vector<ClassField> > (); }
-#line 8080 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9211 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 24:
-#line 395 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 24: // FieldName: typefieldreference
+#line 414 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 8086 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9217 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 25:
-#line 397 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 25: // FieldName: valuefieldreference
+#line 416 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 8092 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9223 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 26:
-#line 405 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 26: // FieldNameList: FieldName
+#line 424 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<std::string> > ().push_back(yystack_[0].value.as < std::string > ()); }
-#line 8098 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9229 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 27:
-#line 407 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 27: // FieldNameList: FieldNameList "." FieldName
+#line 426 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<std::string> > () = yystack_[2].value.as < std::vector<std::string> > (); yylhs.value.as < std::vector<std::string> > ().push_back(yystack_[0].value.as < std::string > ()); }
-#line 8104 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9235 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 28:
-#line 411 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 28: // TypeFieldSpec: OneOrManyTypeFieldReference TypeOptionalitySpec
+#line 430 "/root/repo/src/compiler/asn_compiler.yacc"
     { for (const std::string& name : yystack_[1].value.as < std::vector<std::string> > ()) yylhs.value.as < std::vector<ClassField> > ().push_back(ClassField{name, TypeField{}}); }
-#line 8110 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9241 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 29:
-#line 415 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 29: // OneOrManyTypeFieldReference: typefieldreference
+#line 434 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<std::string> > ().push_back(yystack_[0].value.as < std::string > ()); }
-#line 8116 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9247 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 30:
-#line 417 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 30: // OneOrManyTypeFieldReference: OneOrManyTypeFieldReference typefieldreference
+#line 436 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<std::string> > () = yystack_[1].value.as < std::vector<std::string> > (); yylhs.value.as < std::vector<std::string> > ().push_back(yystack_[0].value.as < std::string > ()); }
-#line 8122 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9253 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 37:
-#line 431 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 37: // FixedTypeValueFieldSpec: valuefieldreference Type OptionalUnique ValueOptionalitySpec
+#line 450 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<ClassField> > ().push_back(ClassField{yystack_[3].value.as < std::string > (), FixedTypeValueField{yystack_[2].value.as < Type > ()}}); }
-#line 8128 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9259 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 86:
-#line 546 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 86: // ObjectSetAssignment: typereference DefinedObjectSet "::=" ObjectSet
+#line 565 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = Assignment{yystack_[3].value.as < std::string > (), ObjectSetAssignment{}}; }
-#line 8134 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9265 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 93:
-#line 566 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 93: // ObjectClassFieldType: UsefulObjectClassReference "." FieldNameList
+#line 585 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ObjectClassFieldType > () = {DefinedType{{}, }, yystack_[0].value.as < std::vector<std::string> > ()}; }
-#line 8140 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9271 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 94:
-#line 568 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 94: // ObjectClassFieldType: typereference "." FieldNameList
+#line 587 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ObjectClassFieldType > () = {DefinedType{{}, yystack_[2].value.as < std::string > ()}, yystack_[0].value.as < std::vector<std::string> > ()}; }
-#line 8146 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9277 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 95:
-#line 575 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 95: // ParameterizedAssignment: ParameterizedTypeAssignment
+#line 594 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = yystack_[0].value.as < Assignment > (); }
-#line 8152 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9283 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 96:
-#line 577 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 96: // ParameterizedAssignment: ParameterizedValueAssignment
+#line 596 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = yystack_[0].value.as < Assignment > (); }
-#line 8158 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9289 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 97:
-#line 579 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 97: // ParameterizedAssignment: ParameterizedValueSetTypeAssignment
+#line 598 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = yystack_[0].value.as < Assignment > (); }
-#line 8164 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9295 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 98:
-#line 581 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 98: // ParameterizedAssignment: ParameterizedObjectClassAssignment
+#line 600 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = yystack_[0].value.as < Assignment > (); }
-#line 8170 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9301 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 99:
-#line 588 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 99: // ParameterizedTypeAssignment: typereference ParameterList "::=" Type
+#line 607 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = Assignment{ yystack_[3].value.as < std::string > (), TypeAssignment{yystack_[0].value.as < Type > ()}, {}, yystack_[2].value.as < std::vector<Parameter> > () }; }
-#line 8176 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9307 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 100:
-#line 592 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 100: // ParameterizedValueAssignment: valuereference ParameterList Type "::=" Value
+#line 611 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = Assignment{ yystack_[4].value.as < std::string > (), ValueAssignment{} }; }
-#line 8182 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9313 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 101:
-#line 596 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 101: // ParameterizedValueSetTypeAssignment: typereference ParameterList Type "::=" Value
+#line 615 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = Assignment{ yystack_[4].value.as < std::string > (), ValueAssignment{} }; }
-#line 8188 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9319 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 102:
-#line 600 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 102: // ParameterizedObjectClassAssignment: typereference ParameterList "::=" ObjectClass
+#line 619 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = Assignment{ yystack_[3].value.as < std::string > (), ObjectClassAssignment{} }; }
-#line 8194 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9325 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 103:
-#line 612 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 103: // ParameterList: "{" ParameterSeries "}"
+#line 631 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Parameter> > () = yystack_[1].value.as < std::vector<Parameter> > (); }
-#line 8200 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9331 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 104:
-#line 616 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 104: // ParameterSeries: Parameter
+#line 635 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Parameter> > ().push_back(yystack_[0].value.as < Parameter > ()); }
-#line 8206 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9337 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 105:
-#line 618 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 105: // ParameterSeries: ParameterSeries "," Parameter
+#line 637 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Parameter> > () = yystack_[2].value.as < std::vector<Parameter> > (); yylhs.value.as < std::vector<Parameter> > ().push_back(yystack_[0].value.as < Parameter > ()); }
-#line 8212 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9343 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 106:
-#line 622 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 106: // Parameter: ParamGovernor ":" Reference
+#line 641 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Parameter > () = Parameter{yystack_[2].value.as < Type > (), yystack_[0].value.as < std::string > ()}; }
-#line 8218 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9349 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 107:
-#line 624 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 107: // Parameter: Reference
+#line 643 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Parameter > () = Parameter{{}, yystack_[0].value.as < std::string > ()}; }
-#line 8224 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9355 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 108:
-#line 628 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 108: // ParamGovernor: Governor
+#line 647 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Type > () = yystack_[0].value.as < Type > (); }
-#line 8230 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9361 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 109:
-#line 630 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 109: // ParamGovernor: Reference
+#line 649 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Type > () = DefinedType{{}, yystack_[0].value.as < std::string > ()}; }
-#line 8236 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9367 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 110:
-#line 634 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 110: // Governor: Type
+#line 653 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Type > () = yystack_[0].value.as < Type > (); }
-#line 8242 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9373 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 111:
-#line 636 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 111: // Governor: DefinedObjectClass
+#line 655 "/root/repo/src/compiler/asn_compiler.yacc"
     { }
-#line 8248 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9379 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 114:
-#line 673 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 114: // InstanceOfType: INSTANCE OF DefinedObjectClass
+#line 692 "/root/repo/src/compiler/asn_compiler.yacc"
     { feature_not_implemented(context_.location, context_.asn1_tree, "InstanceOfType"); }
-#line 8254 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9385 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 116:
-#line 682 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 116: // SimpleDefinedType: typereference
+#line 701 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 8260 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9391 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 122:
-#line 695 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 122: // UserDefinedConstraint: CONSTRAINED BY "{" UserDefinedConstraintParameter "}"
+#line 714 "/root/repo/src/compiler/asn_compiler.yacc"
     { feature_not_implemented(context_.location, context_.asn1_tree, "UserDefinedConstraint", "Not yet checking contraints. "); }
-#line 8266 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9397 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 130:
-#line 709 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 130: // TableConstraint: ObjectSet
+#line 728 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << "Simple constraint\n"; }
-#line 8272 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9403 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 131:
-#line 711 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 131: // TableConstraint: ObjectSet "{" AtNotationList "}"
+#line 730 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << "Relation constraint\n"; }
-#line 8278 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9409 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 144:
-#line 753 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    {
+  case 144: // ModuleIdentifier: modulereference DefinitiveIdentification
+#line 772 "/root/repo/src/compiler/asn_compiler.yacc"
+{
     yylhs.value.as < std::string > () = yystack_[1].value.as < std::string > ();
 }
-#line 8286 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9417 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 159:
-#line 792 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 159: // TagDefault: EXPLICIT TAGS
+#line 811 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < TaggingMode > () = TaggingMode::explicit_; }
-#line 8292 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9423 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 160:
-#line 794 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 160: // TagDefault: IMPLICIT TAGS
+#line 813 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < TaggingMode > () = TaggingMode::implicit; }
-#line 8298 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9429 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 161:
-#line 796 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 161: // TagDefault: AUTOMATIC TAGS
+#line 815 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < TaggingMode > () = TaggingMode::automatic; }
-#line 8304 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9435 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 162:
-#line 798 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 162: // TagDefault: %empty
+#line 817 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < TaggingMode > () = TaggingMode::explicit_; }
-#line 8310 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9441 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 165:
-#line 806 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 165: // ModuleBody: Exports Imports AssignmentList
+#line 825 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Module > () = Module{ {}, TaggingMode(), yystack_[2].value.as < std::vector<Export> > (), yystack_[1].value.as < std::vector<Import> > (), yystack_[0].value.as < std::vector<Assignment> > ()}; }
-#line 8316 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9447 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 166:
-#line 808 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 166: // ModuleBody: %empty
+#line 827 "/root/repo/src/compiler/asn_compiler.yacc"
     { }
-#line 8322 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9453 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 172:
-#line 821 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 172: // Imports: IMPORTS SymbolsImported ";"
+#line 840 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Import> > () = yystack_[1].value.as < std::vector<Import> > (); }
-#line 8328 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9459 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 174:
-#line 826 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 174: // SymbolsImported: SymbolsFromModuleList
+#line 845 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Import> > () = yystack_[0].value.as < std::vector<Import> > (); }
-#line 8334 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9465 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 176:
-#line 831 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 176: // SymbolsFromModuleList: SymbolsFromModule
+#line 850 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Import> > ().push_back(yystack_[0].value.as < Import > ()); }
-#line 8340 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9471 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 177:
-#line 833 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 177: // SymbolsFromModuleList: SymbolsFromModuleList SymbolsFromModule
+#line 852 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Import> > () = yystack_[1].value.as < std::vector<Import> > (); yylhs.value.as < std::vector<Import> > ().push_back(yystack_[0].value.as < Import > ()); }
-#line 8346 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9477 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 178:
-#line 837 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 178: // SymbolsFromModule: SymbolList FROM GlobalModuleReference
+#line 856 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Import > () = Import{ yystack_[0].value.as < std::string > (), {}, {} };
       for (const std::string& ref: yystack_[2].value.as < std::vector<std::string> > ())
       {
@@ -8362,1267 +9491,1496 @@ namespace yy {
         }
       }
     }
-#line 8364 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9495 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 179:
-#line 853 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 179: // GlobalModuleReference: modulereference
+#line 872 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 8370 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9501 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 180:
-#line 855 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 180: // GlobalModuleReference: modulereference ObjectIdentifierValue
+#line 874 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[1].value.as < std::string > (); }
-#line 8376 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9507 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 181:
-#line 861 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 181: // SymbolList: Symbol
+#line 880 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<std::string> > ().push_back(yystack_[0].value.as < std::string > ()); }
-#line 8382 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9513 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 182:
-#line 863 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 182: // SymbolList: SymbolList "," Symbol
+#line 882 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<std::string> > () = yystack_[2].value.as < std::vector<std::string> > (); yylhs.value.as < std::vector<std::string> > ().push_back(yystack_[0].value.as < std::string > ()); }
-#line 8388 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9519 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 183:
-#line 867 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 183: // Symbol: Reference
+#line 886 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 8394 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9525 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 184:
-#line 871 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 184: // Reference: typereference
+#line 890 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 8400 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9531 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 185:
-#line 873 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 185: // Reference: typereference "{" "}"
+#line 892 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[2].value.as < std::string > (); }
-#line 8406 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9537 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 186:
-#line 875 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 186: // Reference: valuereference
+#line 894 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 8412 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9543 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 187:
-#line 884 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 187: // AssignmentList: Assignment
+#line 903 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Assignment> > ().push_back(yystack_[0].value.as < Assignment > ()); }
-#line 8418 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9549 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 188:
-#line 886 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 188: // AssignmentList: Assignment AssignmentList
+#line 905 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Assignment> > () = yystack_[0].value.as < std::vector<Assignment> > (); yylhs.value.as < std::vector<Assignment> > ().push_back(yystack_[1].value.as < Assignment > ()); }
-#line 8424 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9555 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 189:
-#line 890 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 189: // Assignment: TypeAssignment
+#line 909 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = yystack_[0].value.as < Assignment > (); }
-#line 8430 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9561 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 190:
-#line 892 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 190: // Assignment: ValueAssignment
+#line 911 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = yystack_[0].value.as < Assignment > (); }
-#line 8436 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9567 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 191:
-#line 894 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 191: // Assignment: ObjectClassAssignment
+#line 913 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = yystack_[0].value.as < Assignment > (); }
-#line 8442 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9573 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 192:
-#line 896 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 192: // Assignment: ValueSetTypeAssignment
+#line 915 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = yystack_[0].value.as < Assignment > (); }
-#line 8448 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9579 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 193:
-#line 899 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 193: // Assignment: ObjectSetAssignment
+#line 918 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = yystack_[0].value.as < Assignment > (); }
-#line 8454 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9585 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 194:
-#line 901 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 194: // Assignment: ParameterizedAssignment
+#line 920 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = yystack_[0].value.as < Assignment > (); }
-#line 8460 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9591 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 195:
-#line 905 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 195: // DefinedType: ExternalTypeReference
+#line 924 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < DefinedType > () = yystack_[0].value.as < DefinedType > (); }
-#line 8466 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9597 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 196:
-#line 907 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 196: // DefinedType: typereference
+#line 926 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < DefinedType > () = DefinedType{absl::nullopt, yystack_[0].value.as < std::string > (), {}}; }
-#line 8472 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9603 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 197:
-#line 909 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 197: // DefinedType: ParameterizedType
+#line 928 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < DefinedType > () = yystack_[0].value.as < DefinedType > (); }
-#line 8478 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9609 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 198:
-#line 915 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 198: // DefinedValue: valuereference
+#line 934 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < DefinedValue > () = DefinedValue{yystack_[0].value.as < std::string > ()}; }
-#line 8484 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9615 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 200:
-#line 920 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 200: // ParameterizedType: SimpleDefinedType "{" ActualParameterList "}"
+#line 939 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < DefinedType > () = DefinedType{ absl::nullopt, yystack_[3].value.as < std::string > (), yystack_[1].value.as < std::vector<Type> > ()}; }
-#line 8490 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9621 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 202:
-#line 927 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 202: // ActualParameterList: ActualParameter
+#line 946 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Type> > ().push_back(yystack_[0].value.as < Type > ()); }
-#line 8496 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9627 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 203:
-#line 929 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 203: // ActualParameterList: ActualParameter "," ActualParameterList
+#line 948 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Type> > () = yystack_[0].value.as < std::vector<Type> > (); yylhs.value.as < std::vector<Type> > ().push_back(yystack_[2].value.as < Type > ()); }
-#line 8502 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9633 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 204:
-#line 933 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 204: // ActualParameter: Type
+#line 952 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Type > () = yystack_[0].value.as < Type > (); }
-#line 8508 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9639 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 205:
-#line 935 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 205: // ActualParameter: ValueWithoutTypeIdentifier
+#line 954 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << "Warning: Not yet dealing with value paramaters\n"; }
-#line 8514 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9645 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 207:
-#line 948 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 207: // ExternalTypeReference: typereference "." typereference
+#line 967 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < DefinedType > () = DefinedType{yystack_[2].value.as < std::string > (), yystack_[0].value.as < std::string > (), {}}; }
-#line 8520 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9651 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 209:
-#line 977 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 209: // TypeAssignment: typereference "::=" Type
+#line 996 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = Assignment{ yystack_[2].value.as < std::string > (), TypeAssignment{yystack_[0].value.as < Type > ()}, {} }; }
-#line 8526 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9657 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 210:
-#line 981 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 210: // ValueAssignment: valuereference Type "::=" Value
+#line 1000 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = Assignment{ yystack_[3].value.as < std::string > (), ValueAssignment{yystack_[2].value.as < Type > (), yystack_[0].value.as < Value > ()}, {} }; }
-#line 8532 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9663 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 211:
-#line 985 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 211: // ValueSetTypeAssignment: typereference Type "::=" ValueSet
+#line 1004 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Assignment > () = Assignment{ yystack_[3].value.as < std::string > (), TypeAssignment{yystack_[2].value.as < Type > ()}, {} }; }
-#line 8538 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9669 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 212:
-#line 989 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 212: // Type: BuiltinType
+#line 1008 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Type > () = yystack_[0].value.as < BuiltinType > (); }
-#line 8544 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9675 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 213:
-#line 991 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 213: // Type: ConstrainedType
+#line 1010 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Type > () = yystack_[0].value.as < Type > (); }
-#line 8550 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9681 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 214:
-#line 993 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 214: // Type: DefinedType
+#line 1012 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Type > () = yystack_[0].value.as < DefinedType > (); }
-#line 8556 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9687 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 215:
-#line 995 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 215: // Type: SelectionType
+#line 1014 "/root/repo/src/compiler/asn_compiler.yacc"
     { feature_not_implemented(context_.location, context_.asn1_tree, "SelectionType"); }
-#line 8562 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9693 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 216:
-#line 997 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 216: // Type: TypeFromObject
+#line 1016 "/root/repo/src/compiler/asn_compiler.yacc"
     { feature_not_implemented(context_.location, context_.asn1_tree, "TypeFromObject"); }
-#line 8568 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9699 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 217:
-#line 1001 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = AnyType(); }
-#line 8574 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 217: // BuiltinType: ANY
+#line 1020 "/root/repo/src/compiler/asn_compiler.yacc"
+        { yylhs.value.as < BuiltinType > () = AnyType(); }
+#line 9705 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 218:
-#line 1002 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < BitStringType > (); }
-#line 8580 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 218: // BuiltinType: BitStringType
+#line 1021 "/root/repo/src/compiler/asn_compiler.yacc"
+                  { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < BitStringType > (); }
+#line 9711 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 219:
-#line 1003 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < BooleanType > (); }
-#line 8586 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 219: // BuiltinType: BooleanType
+#line 1022 "/root/repo/src/compiler/asn_compiler.yacc"
+                { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < BooleanType > (); }
+#line 9717 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 220:
-#line 1004 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < CharacterStringType > (); }
-#line 8592 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 220: // BuiltinType: CharacterStringType
+#line 1023 "/root/repo/src/compiler/asn_compiler.yacc"
+                        { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < CharacterStringType > (); }
+#line 9723 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 221:
-#line 1005 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < ChoiceType > (); }
-#line 8598 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 221: // BuiltinType: ChoiceType
+#line 1024 "/root/repo/src/compiler/asn_compiler.yacc"
+               { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < ChoiceType > (); }
+#line 9729 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 222:
-#line 1006 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < DateType > (); feature_not_implemented(context_.location, context_.asn1_tree, "DateType"); }
-#line 8604 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 222: // BuiltinType: DateType
+#line 1025 "/root/repo/src/compiler/asn_compiler.yacc"
+             { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < DateType > (); feature_not_implemented(context_.location, context_.asn1_tree, "DateType"); }
+#line 9735 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 223:
-#line 1007 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < DateTimeType > (); feature_not_implemented(context_.location, context_.asn1_tree, "DateTimeType"); }
-#line 8610 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 223: // BuiltinType: DateTimeType
+#line 1026 "/root/repo/src/compiler/asn_compiler.yacc"
+                 { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < DateTimeType > (); feature_not_implemented(context_.location, context_.asn1_tree, "DateTimeType"); }
+#line 9741 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 224:
-#line 1008 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < DurationType > (); feature_not_implemented(context_.location, context_.asn1_tree, "DurationType"); }
-#line 8616 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 224: // BuiltinType: DurationType
+#line 1027 "/root/repo/src/compiler/asn_compiler.yacc"
+                 { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < DurationType > (); feature_not_implemented(context_.location, context_.asn1_tree, "DurationType"); }
+#line 9747 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 225:
-#line 1009 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < EmbeddedPDVType > (); feature_not_implemented(context_.location, context_.asn1_tree, "EmbeddedPDVType"); }
-#line 8622 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 225: // BuiltinType: EmbeddedPDVType
+#line 1028 "/root/repo/src/compiler/asn_compiler.yacc"
+                    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < EmbeddedPDVType > (); feature_not_implemented(context_.location, context_.asn1_tree, "EmbeddedPDVType"); }
+#line 9753 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 226:
-#line 1010 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < EnumeratedType > (); }
-#line 8628 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 226: // BuiltinType: EnumeratedType
+#line 1029 "/root/repo/src/compiler/asn_compiler.yacc"
+                   { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < EnumeratedType > (); }
+#line 9759 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 227:
-#line 1011 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < ExternalType > (); feature_not_implemented(context_.location, context_.asn1_tree, "ExternalType"); }
-#line 8634 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 227: // BuiltinType: ExternalType
+#line 1030 "/root/repo/src/compiler/asn_compiler.yacc"
+                 { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < ExternalType > (); feature_not_implemented(context_.location, context_.asn1_tree, "ExternalType"); }
+#line 9765 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 228:
-#line 1012 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = GeneralizedTimeType(); }
-#line 8640 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 228: // BuiltinType: GeneralizedTime
+#line 1031 "/root/repo/src/compiler/asn_compiler.yacc"
+                    { yylhs.value.as < BuiltinType > () = GeneralizedTimeType(); }
+#line 9771 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 229:
-#line 1013 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < InstanceOfType > (); feature_not_implemented(context_.location, context_.asn1_tree, "InstanceOfType"); }
-#line 8646 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 229: // BuiltinType: InstanceOfType
+#line 1032 "/root/repo/src/compiler/asn_compiler.yacc"
+                   { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < InstanceOfType > (); feature_not_implemented(context_.location, context_.asn1_tree, "InstanceOfType"); }
+#line 9777 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 230:
-#line 1014 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < IntegerType > (); }
-#line 8652 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 230: // BuiltinType: IntegerType
+#line 1033 "/root/repo/src/compiler/asn_compiler.yacc"
+                { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < IntegerType > (); }
+#line 9783 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 231:
-#line 1015 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < IRIType > (); feature_not_implemented(context_.location, context_.asn1_tree, "IRIType"); }
-#line 8658 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 231: // BuiltinType: IRIType
+#line 1034 "/root/repo/src/compiler/asn_compiler.yacc"
+            { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < IRIType > (); feature_not_implemented(context_.location, context_.asn1_tree, "IRIType"); }
+#line 9789 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 232:
-#line 1016 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < NullType > (); }
-#line 8664 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 232: // BuiltinType: NullType
+#line 1035 "/root/repo/src/compiler/asn_compiler.yacc"
+             { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < NullType > (); }
+#line 9795 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 233:
-#line 1017 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < ObjectClassFieldType > (); feature_not_implemented(context_.location, context_.asn1_tree, "ObjectClassFieldType"); }
-#line 8670 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 233: // BuiltinType: ObjectClassFieldType
+#line 1036 "/root/repo/src/compiler/asn_compiler.yacc"
+                         { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < ObjectClassFieldType > (); feature_not_implemented(context_.location, context_.asn1_tree, "ObjectClassFieldType"); }
+#line 9801 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 234:
-#line 1018 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = ObjectDescriptorType(); }
-#line 8676 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 234: // BuiltinType: ObjectDescriptor
+#line 1037 "/root/repo/src/compiler/asn_compiler.yacc"
+                     { yylhs.value.as < BuiltinType > () = ObjectDescriptorType(); }
+#line 9807 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 235:
-#line 1019 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < ObjectIdentifierType > (); }
-#line 8682 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 235: // BuiltinType: ObjectIdentifierType
+#line 1038 "/root/repo/src/compiler/asn_compiler.yacc"
+                         { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < ObjectIdentifierType > (); }
+#line 9813 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 236:
-#line 1020 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < OctetStringType > (); }
-#line 8688 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 236: // BuiltinType: OctetStringType
+#line 1039 "/root/repo/src/compiler/asn_compiler.yacc"
+                    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < OctetStringType > (); }
+#line 9819 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 237:
-#line 1021 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < RealType > (); feature_not_implemented(context_.location, context_.asn1_tree, "RealType"); }
-#line 8694 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 237: // BuiltinType: RealType
+#line 1040 "/root/repo/src/compiler/asn_compiler.yacc"
+             { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < RealType > (); feature_not_implemented(context_.location, context_.asn1_tree, "RealType"); }
+#line 9825 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 238:
-#line 1022 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < RelativeIRIType > (); feature_not_implemented(context_.location, context_.asn1_tree, "RelativeIRIType"); }
-#line 8700 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 238: // BuiltinType: RelativeIRIType
+#line 1041 "/root/repo/src/compiler/asn_compiler.yacc"
+                    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < RelativeIRIType > (); feature_not_implemented(context_.location, context_.asn1_tree, "RelativeIRIType"); }
+#line 9831 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 239:
-#line 1023 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < RelativeOIDType > (); feature_not_implemented(context_.location, context_.asn1_tree, "RelativeOIDType"); }
-#line 8706 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 239: // BuiltinType: RelativeOIDType
+#line 1042 "/root/repo/src/compiler/asn_compiler.yacc"
+                    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < RelativeOIDType > (); feature_not_implemented(context_.location, context_.asn1_tree, "RelativeOIDType"); }
+#line 9837 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 240:
-#line 1024 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < SequenceType > (); }
-#line 8712 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 240: // BuiltinType: SequenceType
+#line 1043 "/root/repo/src/compiler/asn_compiler.yacc"
+                 { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < SequenceType > (); }
+#line 9843 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 241:
-#line 1025 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < SequenceOfType > (); }
-#line 8718 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 241: // BuiltinType: SequenceOfType
+#line 1044 "/root/repo/src/compiler/asn_compiler.yacc"
+                   { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < SequenceOfType > (); }
+#line 9849 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 242:
-#line 1026 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < SetType > (); }
-#line 8724 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 242: // BuiltinType: SetType
+#line 1045 "/root/repo/src/compiler/asn_compiler.yacc"
+            { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < SetType > (); }
+#line 9855 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 243:
-#line 1027 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < SetOfType > (); }
-#line 8730 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 243: // BuiltinType: SetOfType
+#line 1046 "/root/repo/src/compiler/asn_compiler.yacc"
+              { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < SetOfType > (); }
+#line 9861 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 244:
-#line 1028 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < PrefixedType > (); }
-#line 8736 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 244: // BuiltinType: PrefixedType
+#line 1047 "/root/repo/src/compiler/asn_compiler.yacc"
+                 { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < PrefixedType > (); }
+#line 9867 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 245:
-#line 1029 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < TimeType > (); feature_not_implemented(context_.location, context_.asn1_tree, "TimeType"); }
-#line 8742 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 245: // BuiltinType: TimeType
+#line 1048 "/root/repo/src/compiler/asn_compiler.yacc"
+             { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < TimeType > (); feature_not_implemented(context_.location, context_.asn1_tree, "TimeType"); }
+#line 9873 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 246:
-#line 1030 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < TimeOfDayType > (); feature_not_implemented(context_.location, context_.asn1_tree, "TimeOfDayType"); }
-#line 8748 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 246: // BuiltinType: TimeOfDayType
+#line 1049 "/root/repo/src/compiler/asn_compiler.yacc"
+                  { yylhs.value.as < BuiltinType > () = yystack_[0].value.as < TimeOfDayType > (); feature_not_implemented(context_.location, context_.asn1_tree, "TimeOfDayType"); }
+#line 9879 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 247:
-#line 1031 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < BuiltinType > () = UTCTimeType(); feature_not_implemented(context_.location, context_.asn1_tree, "UTCTime"); }
-#line 8754 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 247: // BuiltinType: UTCTime
+#line 1050 "/root/repo/src/compiler/asn_compiler.yacc"
+            { yylhs.value.as < BuiltinType > () = UTCTimeType(); feature_not_implemented(context_.location, context_.asn1_tree, "UTCTime"); }
+#line 9885 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 248:
-#line 1035 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 248: // NamedType: identifier Type
+#line 1054 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < NamedType > () = NamedType{ yystack_[1].value.as < std::string > (), yystack_[0].value.as < Type > () }; }
-#line 8760 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9891 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 249:
-#line 1039 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 249: // ValueWithoutTypeIdentifier: BooleanValue
+#line 1058 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: BooleanValue\n"); }
-#line 8766 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9897 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 250:
-#line 1041 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 250: // ValueWithoutTypeIdentifier: IRIValue
+#line 1060 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: IRIValue\n"); }
-#line 8772 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9903 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 251:
-#line 1043 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 251: // ValueWithoutTypeIdentifier: ASN_NULL
+#line 1062 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: ASN_NULL\n"); }
-#line 8778 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9909 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 252:
-#line 1045 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 252: // ValueWithoutTypeIdentifier: TimeValue
+#line 1064 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: TimeValue\n"); }
-#line 8784 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9915 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 253:
-#line 1047 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 253: // ValueWithoutTypeIdentifier: bstring
+#line 1066 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = BitStringValue{yystack_[0].value.as < std::string > ()}; }
-#line 8790 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9921 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 254:
-#line 1049 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 254: // ValueWithoutTypeIdentifier: hstring
+#line 1068 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = HexStringValue{yystack_[0].value.as < std::string > ()}; }
-#line 8796 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9927 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 255:
-#line 1051 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 255: // ValueWithoutTypeIdentifier: cstring
+#line 1070 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = CharStringValue{yystack_[0].value.as < std::string > ()}; }
-#line 8802 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9933 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 256:
-#line 1053 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 256: // ValueWithoutTypeIdentifier: CONTAINING Value
+#line 1072 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: CONTAINING\n"); }
-#line 8808 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9939 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 257:
-#line 1055 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 257: // ValueWithoutTypeIdentifier: DefinedValue
+#line 1074 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < DefinedValue > (); }
-#line 8814 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9945 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 258:
-#line 1057 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 258: // ValueWithoutTypeIdentifier: GENERIC_IDENTIFIER_LOWERCASE "(" number ")"
+#line 1076 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = NamedNumber{yystack_[3].value.as < std::string > (), yystack_[1].value.as < int64_t > ()}; }
-#line 8820 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9951 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 260:
-#line 1060 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 260: // ValueWithoutTypeIdentifier: SignedNumber
+#line 1079 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < int64_t > (); }
-#line 8826 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9957 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 261:
-#line 1062 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 261: // ValueWithoutTypeIdentifier: realnumber
+#line 1081 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < double > (); }
-#line 8832 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9963 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 262:
-#line 1064 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 262: // ValueWithoutTypeIdentifier: ObjectClassFieldType
+#line 1083 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: ValueCommaListChoice\n"); }
-#line 8838 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9969 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 263:
-#line 1066 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 263: // ValueWithoutTypeIdentifier: Value ":" Value
+#line 1085 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: ValueCommaListChoice\n"); }
-#line 8844 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9975 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 268:
-#line 1074 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 268: // ValueWithoutTypeIdentifier: "{" SequenceOfValues "}"
+#line 1093 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[1].value.as < std::vector<Value> > (); }
-#line 8850 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9981 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 269:
-#line 1076 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 269: // ValueWithoutTypeIdentifier: ValueChoice
+#line 1095 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: ValueChoice\n"); }
-#line 8856 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9987 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 270:
-#line 1078 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 270: // ValueWithoutTypeIdentifier: OPTIONAL
+#line 1097 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: OPTIONAL\n"); }
-#line 8862 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9993 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 271:
-#line 1080 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 271: // ValueWithoutTypeIdentifier: ValueCommaListChoice
+#line 1099 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: ValueCommaListChoice\n"); }
-#line 8868 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 9999 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 272:
-#line 1082 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 272: // ValueWithoutTypeIdentifier: BY
+#line 1101 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: BY\n"); }
-#line 8874 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10005 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 273:
-#line 1084 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 273: // ValueWithoutTypeIdentifier: WITH
+#line 1103 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << std::string("Warning: Unhandled field: WITH\n"); }
-#line 8880 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10011 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 274:
-#line 1089 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 274: // Value: ValueWithoutTypeIdentifier
+#line 1108 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > () = yystack_[0].value.as < Value > (); }
-#line 8886 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10017 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 275:
-#line 1091 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 275: // Value: GENERIC_IDENTIFIER_UPPERCASE
+#line 1110 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < std::string > (); }
-#line 8892 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10023 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 282:
-#line 1107 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 282: // SequenceOfValues: Value
+#line 1126 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Value> > ().push_back(yystack_[0].value.as < Value > ()); }
-#line 8898 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10029 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 283:
-#line 1109 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 283: // SequenceOfValues: SequenceOfValues Value
+#line 1128 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<Value> > () = yystack_[1].value.as < std::vector<Value> > (); yylhs.value.as < std::vector<Value> > ().push_back(yystack_[0].value.as < Value > ()); }
-#line 8904 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10035 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 285:
-#line 1120 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 285: // BooleanValue: TRUE
+#line 1139 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < BooleanValue > () = {true}; }
-#line 8910 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10041 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 286:
-#line 1122 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 286: // BooleanValue: FALSE
+#line 1141 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < BooleanValue > () = {false}; }
-#line 8916 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10047 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 287:
-#line 1126 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 287: // IntegerType: INTEGER
+#line 1145 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < IntegerType > () = IntegerType{{}}; }
-#line 8922 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10053 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 288:
-#line 1128 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 288: // IntegerType: INTEGER "{" NamedNumberList "}"
+#line 1147 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < IntegerType > () = IntegerType{yystack_[1].value.as < std::vector<NamedNumber> > ()}; }
-#line 8928 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10059 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 289:
-#line 1132 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 289: // NamedNumberList: NamedNumber
+#line 1151 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<NamedNumber> > () = {yystack_[0].value.as < NamedNumber > ()}; }
-#line 8934 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10065 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 290:
-#line 1134 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 290: // NamedNumberList: NamedNumberList "," NamedNumber
+#line 1153 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<NamedNumber> > () = yystack_[2].value.as < std::vector<NamedNumber> > (); yylhs.value.as < std::vector<NamedNumber> > ().push_back(yystack_[0].value.as < NamedNumber > ()); }
-#line 8940 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10071 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 291:
-#line 1138 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 291: // NamedNumber: identifier "(" SignedNumber ")"
+#line 1157 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < NamedNumber > () = NamedNumber{ yystack_[3].value.as < std::string > (), yystack_[1].value.as < int64_t > () }; }
-#line 8946 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10077 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 292:
-#line 1140 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 292: // NamedNumber: identifier "(" DefinedValue ")"
+#line 1159 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < NamedNumber > () = NamedNumber{ yystack_[3].value.as < std::string > (), 0 }; }
-#line 8952 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10083 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 293:
-#line 1144 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 293: // SignedNumber: number
+#line 1163 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < int64_t > () = yystack_[0].value.as < int64_t > (); }
-#line 8958 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10089 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 294:
-#line 1146 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 294: // SignedNumber: negativenumber
+#line 1165 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < int64_t > () = yystack_[0].value.as < int64_t > (); }
-#line 8964 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10095 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 295:
-#line 1150 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 295: // EnumeratedType: ENUMERATED "{" Enumerations "}"
+#line 1169 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < EnumeratedType > () = yystack_[1].value.as < EnumeratedType > (); }
-#line 8970 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10101 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 296:
-#line 1154 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 296: // Enumerations: Enumeration
+#line 1173 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < EnumeratedType > () = yystack_[0].value.as < EnumeratedType > ();
       yylhs.value.as < EnumeratedType > ().accept_anything = false; }
-#line 8977 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10108 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 297:
-#line 1157 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 297: // Enumerations: Enumeration "," "..." ExceptionSpec
+#line 1176 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < EnumeratedType > () = yystack_[3].value.as < EnumeratedType > ();
       yylhs.value.as < EnumeratedType > ().accept_anything = true; }
-#line 8984 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10115 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 298:
-#line 1160 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 298: // Enumerations: Enumeration "," "..." ExceptionSpec "," Enumeration
+#line 1179 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < EnumeratedType > () = yystack_[5].value.as < EnumeratedType > ();
       yylhs.value.as < EnumeratedType > ().accept_anything = true;
       yylhs.value.as < EnumeratedType > ().enum_values.insert(yylhs.value.as < EnumeratedType > ().enum_values.end(), yystack_[0].value.as < EnumeratedType > ().enum_values.begin(), yystack_[0].value.as < EnumeratedType > ().enum_values.end()); }
-#line 8992 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10123 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 300:
-#line 1167 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 300: // Enumeration: EnumerationItem
+#line 1186 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < EnumeratedType > ().enum_values.push_back(yystack_[0].value.as < EnumerationValue > ()); }
-#line 8998 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10129 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 301:
-#line 1169 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 301: // Enumeration: Enumeration "," EnumerationItem
+#line 1188 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < EnumeratedType > () = yystack_[2].value.as < EnumeratedType > (); yylhs.value.as < EnumeratedType > ().enum_values.push_back(yystack_[0].value.as < EnumerationValue > ()); }
-#line 9004 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10135 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 302:
-#line 1173 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 302: // EnumerationItem: identifier
+#line 1192 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < EnumerationValue > ().name  = yystack_[0].value.as < std::string > (); }
-#line 9010 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10141 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 303:
-#line 1175 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 303: // EnumerationItem: NamedNumber
+#line 1194 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < EnumerationValue > ().name  = yystack_[0].value.as < NamedNumber > ().name;
       yylhs.value.as < EnumerationValue > ().value = yystack_[0].value.as < NamedNumber > ().number; }
-#line 9017 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10148 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 305:
-#line 1186 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 305: // BitStringType: BIT STRING
+#line 1205 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < BitStringType > () = BitStringType{}; }
-#line 9023 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10154 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 306:
-#line 1188 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 306: // BitStringType: BIT STRING "{" NamedBitList "}"
+#line 1207 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < BitStringType > () = BitStringType{}; }
-#line 9029 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10160 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 313:
-#line 1217 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 313: // SequenceType: SEQUENCE "{" "}"
+#line 1236 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < SequenceType > () = SequenceType(); }
-#line 9035 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10166 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 314:
-#line 1219 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 314: // SequenceType: SEQUENCE "{" ComponentTypeLists "}"
+#line 1238 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < SequenceType > () = SequenceType{yystack_[1].value.as < Collection > ()}; }
-#line 9041 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10172 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 315:
-#line 1223 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 315: // ComponentTypeLists: ComponentTypeList
+#line 1242 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Collection > ().components = yystack_[0].value.as < ComponentTypeList > (); }
-#line 9047 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10178 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 316:
-#line 1225 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 316: // ComponentTypeLists: ComponentTypeList "," "..." ExceptionSpec
+#line 1244 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Collection > ().components = yystack_[3].value.as < ComponentTypeList > ();
       yylhs.value.as < Collection > ().allow_extensions = true; }
-#line 9054 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10185 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 317:
-#line 1228 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 317: // ComponentTypeLists: ComponentTypeList "," "..." ExceptionSpec "," ComponentTypeList
+#line 1247 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Collection > ().components = yystack_[5].value.as < ComponentTypeList > ();
       yylhs.value.as < Collection > ().components.insert(yylhs.value.as < Collection > ().components.end(), yystack_[0].value.as < ComponentTypeList > ().begin(), yystack_[0].value.as < ComponentTypeList > ().end());
       yylhs.value.as < Collection > ().allow_extensions = true; }
-#line 9062 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10193 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 318:
-#line 1232 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 318: // ComponentTypeLists: ComponentTypeList "," "..." ExceptionSpec "," ComponentTypeList "," "..."
+#line 1251 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Collection > ().components = yystack_[7].value.as < ComponentTypeList > ();
       yylhs.value.as < Collection > ().components.insert(yylhs.value.as < Collection > ().components.end(), yystack_[2].value.as < ComponentTypeList > ().begin(), yystack_[2].value.as < ComponentTypeList > ().end());
       yylhs.value.as < Collection > ().allow_extensions = true; }
-#line 9070 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10201 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 319:
-#line 1236 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 319: // ComponentTypeLists: ComponentTypeList "," "..." ExceptionSpec "," ComponentTypeList "," "..." "," ComponentTypeList
+#line 1255 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Collection > ().components = yystack_[9].value.as < ComponentTypeList > ();
       yylhs.value.as < Collection > ().components.insert(yylhs.value.as < Collection > ().components.end(), yystack_[4].value.as < ComponentTypeList > ().begin(), yystack_[4].value.as < ComponentTypeList > ().end());
       yylhs.value.as < Collection > ().components.insert(yylhs.value.as < Collection > ().components.end(), yystack_[0].value.as < ComponentTypeList > ().begin(), yystack_[0].value.as < ComponentTypeList > ().end());
       yylhs.value.as < Collection > ().allow_extensions = true; }
-#line 9079 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10210 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 320:
-#line 1241 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 320: // ComponentTypeLists: "..." ExceptionSpec "," ComponentTypeList
+#line 1260 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Collection > ().components = yystack_[0].value.as < ComponentTypeList > ();
       yylhs.value.as < Collection > ().allow_extensions = true; }
-#line 9086 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10217 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 321:
-#line 1244 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 321: // ComponentTypeLists: "..." ExceptionSpec "," ComponentTypeList "," "..."
+#line 1263 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Collection > ().components = yystack_[2].value.as < ComponentTypeList > ();
       yylhs.value.as < Collection > ().allow_extensions = true; }
-#line 9093 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10224 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 322:
-#line 1247 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 322: // ComponentTypeLists: "..." ExceptionSpec
+#line 1266 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Collection > ().components = {};
       yylhs.value.as < Collection > ().allow_extensions = true; }
-#line 9100 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10231 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 323:
-#line 1250 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 323: // ComponentTypeLists: "..." ExceptionSpec "," "..."
+#line 1269 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Collection > ().components = {};
       yylhs.value.as < Collection > ().allow_extensions = true; }
-#line 9107 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10238 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 324:
-#line 1255 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 324: // ComponentTypeList: ComponentType
+#line 1274 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ComponentTypeList > () = ComponentTypeList{yystack_[0].value.as < ComponentType > ()}; }
-#line 9113 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10244 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 325:
-#line 1257 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 325: // ComponentTypeList: ComponentTypeList "," ComponentType
+#line 1276 "/root/repo/src/compiler/asn_compiler.yacc"
     { yystack_[2].value.as < ComponentTypeList > ().push_back(yystack_[0].value.as < ComponentType > ()); yylhs.value.as < ComponentTypeList > () = yystack_[2].value.as < ComponentTypeList > (); }
-#line 9119 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10250 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 326:
-#line 1261 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 326: // ComponentType: Type
+#line 1280 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << context_.location << " WARNING: unnamed type\n";
       yylhs.value.as < ComponentType > () = ComponentType{{gen_anon_member_name(), yystack_[0].value.as < Type > ()}, false, absl::nullopt, absl::nullopt, StorageMode::static_ }; }
-#line 9126 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10257 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 327:
-#line 1264 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 327: // ComponentType: Type OPTIONAL
+#line 1283 "/root/repo/src/compiler/asn_compiler.yacc"
     { std::cerr << context_.location << " WARNING: unnamed type\n";
       yylhs.value.as < ComponentType > () = ComponentType{{gen_anon_member_name(), yystack_[1].value.as < Type > ()}, true, absl::nullopt, absl::nullopt, StorageMode::static_ }; }
-#line 9133 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10264 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 328:
-#line 1267 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 328: // ComponentType: Type DEFAULT SingleValue
+#line 1286 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ComponentType > () = ComponentType{{gen_anon_member_name(), yystack_[2].value.as < Type > ()}, false, yystack_[0].value.as < Value > (), absl::nullopt, StorageMode::static_ };
       std::cerr << context_.location << " WARNING: unnamed type\n"; }
-#line 9140 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10271 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 329:
-#line 1270 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 329: // ComponentType: NamedType
+#line 1289 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ComponentType > () = ComponentType{yystack_[0].value.as < NamedType > (), false, absl::nullopt, absl::nullopt, StorageMode::static_ }; }
-#line 9146 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10277 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 330:
-#line 1272 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 330: // ComponentType: NamedType OPTIONAL
+#line 1291 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ComponentType > () = ComponentType{yystack_[1].value.as < NamedType > (), true, absl::nullopt, absl::nullopt, StorageMode::static_ }; }
-#line 9152 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10283 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 331:
-#line 1274 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 331: // ComponentType: NamedType DEFAULT SingleValue
+#line 1293 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ComponentType > () = ComponentType{yystack_[2].value.as < NamedType > (), false, yystack_[0].value.as < Value > (), absl::nullopt, StorageMode::static_ }; }
-#line 9158 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10289 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 332:
-#line 1276 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 332: // ComponentType: COMPONENTS OF Type
+#line 1295 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ComponentType > () = ComponentType{{}, false, absl::nullopt, yystack_[0].value.as < Type > (), StorageMode::static_}; }
-#line 9164 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10295 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 333:
-#line 1288 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 333: // SequenceOfType: SEQUENCE OF Type
+#line 1307 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < SequenceOfType > () = SequenceOfType{ false, nullptr, std::unique_ptr<Type>(new Type(yystack_[0].value.as < Type > ())) }; }
-#line 9170 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10301 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 334:
-#line 1290 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 334: // SequenceOfType: SEQUENCE OF NamedType
+#line 1309 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < SequenceOfType > () = SequenceOfType{ true, std::unique_ptr<NamedType>(new NamedType(yystack_[0].value.as < NamedType > ())), nullptr }; }
-#line 9176 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10307 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 335:
-#line 1294 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 335: // SetType: SET "{" "}"
+#line 1313 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < SetType > () = SetType{}; }
-#line 9182 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10313 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 336:
-#line 1296 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 336: // SetType: SET "{" ComponentTypeLists "}"
+#line 1315 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < SetType > () = SetType{yystack_[1].value.as < Collection > ()}; }
-#line 9188 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10319 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 337:
-#line 1300 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 337: // SetOfType: SET OF Type
+#line 1319 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < SetOfType > () = SetOfType{ false, nullptr, std::unique_ptr<Type>(new Type(yystack_[0].value.as < Type > ())) }; }
-#line 9194 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10325 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 338:
-#line 1302 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 338: // SetOfType: SET OF NamedType
+#line 1321 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < SetOfType > () = SetOfType{ true, std::unique_ptr<NamedType>(new NamedType(yystack_[0].value.as < NamedType > ())), nullptr }; }
-#line 9200 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10331 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 339:
-#line 1306 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 339: // ChoiceType: CHOICE "{" AlternativeTypeLists "}"
+#line 1325 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ChoiceType > () = ChoiceType{ yystack_[1].value.as < std::vector<NamedType> > (), StorageMode::static_ }; }
-#line 9206 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10337 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 340:
-#line 1310 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 340: // AlternativeTypeLists: RootAlternativeTypeList
+#line 1329 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<NamedType> > () = yystack_[0].value.as < std::vector<NamedType> > (); }
-#line 9212 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10343 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 341:
-#line 1314 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 341: // RootAlternativeTypeList: AlternativeTypeList
+#line 1333 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<NamedType> > () = yystack_[0].value.as < std::vector<NamedType> > (); }
-#line 9218 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10349 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 342:
-#line 1316 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 342: // RootAlternativeTypeList: AlternativeTypeList "," "..."
+#line 1335 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<NamedType> > () = yystack_[2].value.as < std::vector<NamedType> > (); }
-#line 9224 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10355 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 343:
-#line 1318 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 343: // RootAlternativeTypeList: AlternativeTypeList "," "..." "," AlternativeTypeList
+#line 1337 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<NamedType> > () = yystack_[4].value.as < std::vector<NamedType> > (); yylhs.value.as < std::vector<NamedType> > ().insert(yylhs.value.as < std::vector<NamedType> > ().begin(), yystack_[0].value.as < std::vector<NamedType> > ().begin(), yystack_[0].value.as < std::vector<NamedType> > ().end()); }
-#line 9230 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10361 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 344:
-#line 1322 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 344: // AlternativeTypeList: NamedType
+#line 1341 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<NamedType> > () = std::vector<NamedType> { yystack_[0].value.as < NamedType > () }; }
-#line 9236 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10367 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 345:
-#line 1324 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 345: // AlternativeTypeList: AlternativeTypeList "," NamedType
+#line 1343 "/root/repo/src/compiler/asn_compiler.yacc"
     { yystack_[2].value.as < std::vector<NamedType> > ().push_back( yystack_[0].value.as < NamedType > () ); yylhs.value.as < std::vector<NamedType> > () = yystack_[2].value.as < std::vector<NamedType> > (); }
-#line 9242 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10373 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 347:
-#line 1334 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 347: // PrefixedType: TaggedType
+#line 1353 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < PrefixedType > () = PrefixedType(yystack_[0].value.as < TaggedType > ()); }
-#line 9248 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10379 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 348:
-#line 1338 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 348: // TaggedType: Tag Type
+#line 1357 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < TaggedType > () = TaggedType{ yystack_[1].value.as < Tag > (), TaggingMode::automatic, yystack_[0].value.as < Type > () }; }
-#line 9254 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10385 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 349:
-#line 1340 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 349: // TaggedType: Tag IMPLICIT Type
+#line 1359 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < TaggedType > () = TaggedType{ yystack_[2].value.as < Tag > (), TaggingMode::implicit, yystack_[0].value.as < Type > () }; }
-#line 9260 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10391 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 350:
-#line 1342 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 350: // TaggedType: Tag EXPLICIT Type
+#line 1361 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < TaggedType > () = TaggedType{ yystack_[2].value.as < Tag > (), TaggingMode::explicit_, yystack_[0].value.as < Type > () }; }
-#line 9266 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10397 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 351:
-#line 1346 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 351: // Tag: "[" EncodingReference Class ClassNumber "]"
+#line 1365 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Tag > () = Tag{ yystack_[2].value.as < Class > (), yystack_[1].value.as < int > () }; }
-#line 9272 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10403 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 354:
-#line 1354 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 354: // ClassNumber: number
+#line 1373 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < int > () = yystack_[0].value.as < int64_t > (); }
-#line 9278 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10409 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 356:
-#line 1359 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 356: // Class: UNIVERSAL
+#line 1378 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Class > () = Class::universal; }
-#line 9284 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10415 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 357:
-#line 1361 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 357: // Class: APPLICATION
+#line 1380 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Class > () = Class::application; }
-#line 9290 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10421 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 358:
-#line 1363 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 358: // Class: PRIVATE
+#line 1382 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Class > () = Class::private_; }
-#line 9296 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10427 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 359:
-#line 1365 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 359: // Class: %empty
+#line 1384 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Class > () = Class::context_specific; }
-#line 9302 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10433 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 361:
-#line 1378 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 361: // ObjectIdentifierValue: "{" ObjIdComponentsList "}"
+#line 1397 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<ObjectIdComponentValue> > () = yystack_[1].value.as < std::vector<ObjectIdComponentValue> > (); std::reverse(yylhs.value.as < std::vector<ObjectIdComponentValue> > ().begin(), yylhs.value.as < std::vector<ObjectIdComponentValue> > ().end()); }
-#line 9308 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10439 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 362:
-#line 1380 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 362: // ObjectIdentifierValue: "{" DefinedValue ObjIdComponentsList "}"
+#line 1399 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<ObjectIdComponentValue> > () = yystack_[1].value.as < std::vector<ObjectIdComponentValue> > (); std::reverse(yylhs.value.as < std::vector<ObjectIdComponentValue> > ().begin(), yylhs.value.as < std::vector<ObjectIdComponentValue> > ().end()); }
-#line 9314 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10445 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 363:
-#line 1384 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 363: // ObjIdComponentsList: ObjIdComponents
+#line 1403 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<ObjectIdComponentValue> > ().push_back(yystack_[0].value.as < ObjectIdComponentValue > ()); }
-#line 9320 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10451 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 364:
-#line 1386 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 364: // ObjIdComponentsList: ObjIdComponents ObjIdComponentsList
+#line 1405 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::vector<ObjectIdComponentValue> > () = yystack_[0].value.as < std::vector<ObjectIdComponentValue> > (); yylhs.value.as < std::vector<ObjectIdComponentValue> > ().push_back(yystack_[1].value.as < ObjectIdComponentValue > ()); }
-#line 9326 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10457 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 365:
-#line 1390 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 365: // ObjIdComponents: NameForm
+#line 1409 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ObjectIdComponentValue > () = yystack_[0].value.as < ObjectIdComponentValue > (); }
-#line 9332 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10463 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 366:
-#line 1392 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 366: // ObjIdComponents: NumberForm
+#line 1411 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ObjectIdComponentValue > () = yystack_[0].value.as < ObjectIdComponentValue > (); }
-#line 9338 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10469 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 367:
-#line 1394 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 367: // ObjIdComponents: NameAndNumberForm
+#line 1413 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ObjectIdComponentValue > () = yystack_[0].value.as < ObjectIdComponentValue > (); }
-#line 9344 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10475 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 368:
-#line 1398 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 368: // NameForm: identifier
+#line 1417 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ObjectIdComponentValue > ().name = yystack_[0].value.as < std::string > (); }
-#line 9350 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10481 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 369:
-#line 1402 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 369: // NumberForm: number
+#line 1421 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ObjectIdComponentValue > ().value = yystack_[0].value.as < int64_t > (); }
-#line 9356 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10487 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 371:
-#line 1407 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 371: // NameAndNumberForm: identifier "(" NumberForm ")"
+#line 1426 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < ObjectIdComponentValue > () = yystack_[1].value.as < ObjectIdComponentValue > (); yylhs.value.as < ObjectIdComponentValue > ().name = yystack_[3].value.as < std::string > (); }
-#line 9362 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10493 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 389:
-#line 1480 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 389: // CharacterStringType: RestrictedCharacterStringType
+#line 1499 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < CharacterStringType > () = yystack_[0].value.as < CharacterStringType > (); }
-#line 9368 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10499 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 390:
-#line 1482 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 390: // CharacterStringType: UnrestrictedCharacterStringType
+#line 1501 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < CharacterStringType > () = yystack_[0].value.as < CharacterStringType > (); }
-#line 9374 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10505 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 391: // RestrictedCharacterStringType: BMPString
+#line 1505 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::bmp_string, {}}; }
+#line 10511 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 392: // RestrictedCharacterStringType: GeneralString
+#line 1507 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::general_string, {}}; }
+#line 10517 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 393: // RestrictedCharacterStringType: GraphicString
+#line 1509 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::graphic_string, {}}; }
+#line 10523 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 394: // RestrictedCharacterStringType: IA5String
+#line 1511 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::ia5_string, {}}; }
+#line 10529 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 395: // RestrictedCharacterStringType: ISO646String
+#line 1513 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::iso646_string, {}}; }
+#line 10535 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 396: // RestrictedCharacterStringType: NumericString
+#line 1515 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::numeric_string, {}}; }
+#line 10541 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 397: // RestrictedCharacterStringType: PrintableString
+#line 1517 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::printable_string, {}}; }
+#line 10547 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 398: // RestrictedCharacterStringType: TeletexString
+#line 1519 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::teletex_string, {}}; }
+#line 10553 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 399: // RestrictedCharacterStringType: T61String
+#line 1521 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::t61_string, {}}; }
+#line 10559 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 400: // RestrictedCharacterStringType: UniversalString
+#line 1523 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::universal_string, {}}; }
+#line 10565 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 401: // RestrictedCharacterStringType: UTF8String
+#line 1525 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::utf8_string, {}}; }
+#line 10571 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 402: // RestrictedCharacterStringType: VideotexString
+#line 1527 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::videotex_string, {}}; }
+#line 10577 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 403: // RestrictedCharacterStringType: VisibleString
+#line 1529 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::visible_string, {}}; }
+#line 10583 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 404: // UnrestrictedCharacterStringType: CHARACTER STRING
+#line 1533 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < CharacterStringType > () = CharacterStringType{CharacterStringKind::character_string, {}}; }
+#line 10589 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 405: // ConstrainedType: Type Constraint
+#line 1537 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Type > () = yystack_[1].value.as < Type > (); add_constraint(yylhs.value.as < Type > (), yystack_[0].value.as < Constraint > ()); }
+#line 10595 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 406: // ConstrainedType: TypeWithConstraint
+#line 1539 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Type > () = yystack_[0].value.as < Type > (); }
+#line 10601 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 407: // TypeWithConstraint: SET Constraint OF Type
+#line 1543 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Type > () = SetOfType{ false, nullptr, std::unique_ptr<Type>(new Type(yystack_[0].value.as < Type > ())) }; add_constraint(yylhs.value.as < Type > (), yystack_[2].value.as < Constraint > ()); }
+#line 10607 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 408: // TypeWithConstraint: SET SizeConstraint OF Type
+#line 1545 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Type > () = SetOfType{ false, nullptr, std::unique_ptr<Type>(new Type(yystack_[0].value.as < Type > ())) }; add_constraint(yylhs.value.as < Type > (), yystack_[2].value.as < Constraint > ()); }
+#line 10613 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 409: // TypeWithConstraint: SEQUENCE Constraint OF Type
+#line 1547 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Type > () = SequenceOfType{ false, nullptr, std::unique_ptr<Type>(new Type(yystack_[0].value.as < Type > ())) }; add_constraint(yylhs.value.as < Type > (), yystack_[2].value.as < Constraint > ()); }
+#line 10619 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 410: // TypeWithConstraint: SEQUENCE SizeConstraint OF Type
+#line 1549 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Type > () = SequenceOfType{ false, nullptr, std::unique_ptr<Type>(new Type(yystack_[0].value.as < Type > ())) }; add_constraint(yylhs.value.as < Type > (), yystack_[2].value.as < Constraint > ()); }
+#line 10625 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 411: // TypeWithConstraint: SET Constraint OF NamedType
+#line 1551 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Type > () = SetOfType{ true, std::unique_ptr<NamedType>(new NamedType(yystack_[0].value.as < NamedType > ())), nullptr }; add_constraint(yylhs.value.as < Type > (), yystack_[2].value.as < Constraint > ()); }
+#line 10631 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 412: // TypeWithConstraint: SET SizeConstraint OF NamedType
+#line 1553 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Type > () = SetOfType{ true, std::unique_ptr<NamedType>(new NamedType(yystack_[0].value.as < NamedType > ())), nullptr }; add_constraint(yylhs.value.as < Type > (), yystack_[2].value.as < Constraint > ()); }
+#line 10637 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 413: // TypeWithConstraint: SEQUENCE Constraint OF NamedType
+#line 1555 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Type > () = SequenceOfType{ true, std::unique_ptr<NamedType>(new NamedType(yystack_[0].value.as < NamedType > ())), nullptr }; add_constraint(yylhs.value.as < Type > (), yystack_[2].value.as < Constraint > ()); }
+#line 10643 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 414: // TypeWithConstraint: SEQUENCE SizeConstraint OF NamedType
+#line 1557 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Type > () = SequenceOfType{ true, std::unique_ptr<NamedType>(new NamedType(yystack_[0].value.as < NamedType > ())), nullptr }; add_constraint(yylhs.value.as < Type > (), yystack_[2].value.as < Constraint > ()); }
+#line 10649 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 415: // Constraint: "(" ConstraintSpec ExceptionSpec ")"
+#line 1561 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[2].value.as < Constraint > (); }
+#line 10655 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 391:
-#line 1486 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::bmp_string; }
-#line 9380 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 416: // ConstraintSpec: SubtypeConstraint
+#line 1565 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10661 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 392:
-#line 1488 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::general_string; }
-#line 9386 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 417: // ConstraintSpec: GeneralConstraint
+#line 1567 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = Constraint{}; }
+#line 10667 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 393:
-#line 1490 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::graphic_string; }
-#line 9392 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 418: // SubtypeConstraint: ElementSetSpecs
+#line 1571 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10673 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 394:
-#line 1492 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::ia5_string; }
-#line 9398 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 419: // ElementSetSpecs: ElementSetSpec
+#line 1575 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10679 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 395:
-#line 1494 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::iso646_string; }
-#line 9404 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 420: // ElementSetSpecs: ElementSetSpec "," "..."
+#line 1577 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = Constraint{}; }
+#line 10685 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 396:
-#line 1496 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::numeric_string; }
-#line 9410 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 421: // ElementSetSpecs: ElementSetSpec "," "..." "," ElementSetSpec
+#line 1579 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = Constraint{}; }
+#line 10691 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 397:
-#line 1498 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::printable_string; }
-#line 9416 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 422: // ElementSetSpec: Unions
+#line 1583 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10697 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 398:
-#line 1500 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::teletex_string; }
-#line 9422 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 423: // ElementSetSpec: ALL Exclusions
+#line 1585 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = Constraint{}; }
+#line 10703 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 399:
-#line 1502 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::t61_string; }
-#line 9428 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 424: // Unions: Intersections
+#line 1589 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10709 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 400:
-#line 1504 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::universal_string; }
-#line 9434 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 425: // Unions: UElems UnionMark Intersections
+#line 1591 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = constraint_union(yystack_[2].value.as < Constraint > (), yystack_[0].value.as < Constraint > ()); }
+#line 10715 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 401:
-#line 1506 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::utf8_string; }
-#line 9440 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 426: // UElems: Unions
+#line 1595 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10721 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 402:
-#line 1508 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::videotex_string; }
-#line 9446 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 427: // Intersections: IntersectionElements
+#line 1599 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10727 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 403:
-#line 1510 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::visible_string; }
-#line 9452 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 428: // Intersections: IElems IntersectionMark IntersectionElements
+#line 1601 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = constraint_intersection(yystack_[2].value.as < Constraint > (), yystack_[0].value.as < Constraint > ()); }
+#line 10733 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 404:
-#line 1514 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < CharacterStringType > () = CharacterStringType::character_string; }
-#line 9458 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 429: // IElems: Intersections
+#line 1605 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10739 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 405:
-#line 1518 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < Type > () = yystack_[1].value.as < Type > (); }
-#line 9464 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 430: // IntersectionElements: Elements
+#line 1609 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10745 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 406:
-#line 1520 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < Type > () = yystack_[0].value.as < Type > (); feature_not_implemented(context_.location, context_.asn1_tree, "TypeWithConstraint", "Not yet checking contraints. ");  }
-#line 9470 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 431: // IntersectionElements: Elems Exclusions
+#line 1611 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[1].value.as < Constraint > (); }
+#line 10751 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 407:
-#line 1524 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < Type > () = SetOfType{ false, nullptr, std::unique_ptr<Type>(new Type(yystack_[0].value.as < Type > ())) }; }
-#line 9476 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 432: // Elems: Elements
+#line 1615 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10757 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 408:
-#line 1526 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < Type > () = SetOfType{ false, nullptr, std::unique_ptr<Type>(new Type(yystack_[0].value.as < Type > ())) }; }
-#line 9482 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 438: // Elements: SubtypeElements
+#line 1630 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10763 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 409:
-#line 1528 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < Type > () = SequenceOfType{ false, nullptr, std::unique_ptr<Type>(new Type(yystack_[0].value.as < Type > ())) }; }
-#line 9488 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 439: // Elements: "(" ElementSetSpecs ")"
+#line 1633 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[1].value.as < Constraint > (); }
+#line 10769 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 410:
-#line 1530 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < Type > () = SequenceOfType{ false, nullptr, std::unique_ptr<Type>(new Type(yystack_[0].value.as < Type > ())) }; }
-#line 9494 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 440: // SubtypeElements: SingleValue
+#line 1637 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > ().value = ConstraintRange{constraint_bound(yystack_[0].value.as < Value > ()), constraint_bound(yystack_[0].value.as < Value > ())}; }
+#line 10775 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 411:
-#line 1532 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < Type > () = SetOfType{ true, std::unique_ptr<NamedType>(new NamedType(yystack_[0].value.as < NamedType > ())), nullptr }; }
-#line 9500 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 441: // SubtypeElements: ContainedSubtype
+#line 1639 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = Constraint{}; }
+#line 10781 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 412:
-#line 1534 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < Type > () = SetOfType{ true, std::unique_ptr<NamedType>(new NamedType(yystack_[0].value.as < NamedType > ())), nullptr }; }
-#line 9506 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 442: // SubtypeElements: ValueRange
+#line 1641 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10787 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 413:
-#line 1536 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < Type > () = SequenceOfType{ true, std::unique_ptr<NamedType>(new NamedType(yystack_[0].value.as < NamedType > ())), nullptr }; }
-#line 9512 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 443: // SubtypeElements: PermittedAlphabet
+#line 1643 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = Constraint{}; }
+#line 10793 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 414:
-#line 1538 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { yylhs.value.as < Type > () = SequenceOfType{ true, std::unique_ptr<NamedType>(new NamedType(yystack_[0].value.as < NamedType > ())), nullptr }; }
-#line 9518 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 444: // SubtypeElements: SizeConstraint
+#line 1645 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = yystack_[0].value.as < Constraint > (); }
+#line 10799 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 415:
-#line 1542 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
-    { feature_not_implemented(context_.location, context_.asn1_tree, "ConstraintSpec", "Not yet checking contraints. "); }
-#line 9524 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+  case 445: // SubtypeElements: TypeConstraint
+#line 1647 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = Constraint{}; }
+#line 10805 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 449:
-#line 1613 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 446: // SubtypeElements: InnerTypeConstraints
+#line 1649 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = Constraint{}; }
+#line 10811 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 447: // SubtypeElements: PatternConstraint
+#line 1651 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = Constraint{}; }
+#line 10817 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 448: // SubtypeElements: PropertySettings
+#line 1653 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > () = Constraint{}; }
+#line 10823 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 449: // SingleValue: BooleanValue
+#line 1660 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < BooleanValue > (); }
-#line 9530 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10829 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 450:
-#line 1616 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 450: // SingleValue: ASN_NULL
+#line 1663 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = NullValue{}; }
-#line 9536 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10835 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 451:
-#line 1618 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 451: // SingleValue: TimeValue
+#line 1665 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < TimeValue > (); }
-#line 9542 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10841 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 452:
-#line 1620 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 452: // SingleValue: bstring
+#line 1667 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < std::string > (); }
-#line 9548 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10847 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 453:
-#line 1622 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 453: // SingleValue: hstring
+#line 1669 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < std::string > (); }
-#line 9554 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10853 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 454:
-#line 1624 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 454: // SingleValue: cstring
+#line 1671 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < std::string > (); }
-#line 9560 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10859 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 455:
-#line 1626 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 455: // SingleValue: GENERIC_IDENTIFIER_UPPERCASE
+#line 1673 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < std::string > (); }
-#line 9566 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10865 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 456:
-#line 1628 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 456: // SingleValue: DefinedValue
+#line 1675 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < DefinedValue > (); }
-#line 9572 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10871 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 457:
-#line 1630 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 457: // SingleValue: SignedNumber
+#line 1677 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < int64_t > (); }
-#line 9578 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10877 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 458:
-#line 1632 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 458: // SingleValue: realnumber
+#line 1679 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < Value > ().value_selection = yystack_[0].value.as < double > (); }
-#line 9584 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10883 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 461: // ValueRange: LowerEndpoint ".." UpperEndpoint
+#line 1689 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > ().value = ConstraintRange{yystack_[2].value.as < absl::optional<ConstraintBound> > (), yystack_[0].value.as < absl::optional<ConstraintBound> > ()}; }
+#line 10889 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 462: // LowerEndpoint: LowerEndValue
+#line 1693 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < absl::optional<ConstraintBound> > () = yystack_[0].value.as < absl::optional<ConstraintBound> > (); }
+#line 10895 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 463: // LowerEndpoint: LowerEndValue "<"
+#line 1695 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < absl::optional<ConstraintBound> > () = exclusive_bound(yystack_[1].value.as < absl::optional<ConstraintBound> > (), 1); }
+#line 10901 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 464: // UpperEndpoint: UpperEndValue
+#line 1699 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < absl::optional<ConstraintBound> > () = yystack_[0].value.as < absl::optional<ConstraintBound> > (); }
+#line 10907 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 465: // UpperEndpoint: "<" UpperEndValue
+#line 1701 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < absl::optional<ConstraintBound> > () = exclusive_bound(yystack_[0].value.as < absl::optional<ConstraintBound> > (), -1); }
+#line 10913 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 497:
-#line 1717 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 466: // LowerEndValue: SingleValue
+#line 1705 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < absl::optional<ConstraintBound> > () = constraint_bound(yystack_[0].value.as < Value > ()); }
+#line 10919 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 467: // LowerEndValue: MIN
+#line 1707 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < absl::optional<ConstraintBound> > () = absl::nullopt; }
+#line 10925 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 468: // UpperEndValue: SingleValue
+#line 1711 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < absl::optional<ConstraintBound> > () = constraint_bound(yystack_[0].value.as < Value > ()); }
+#line 10931 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 469: // UpperEndValue: MAX
+#line 1713 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < absl::optional<ConstraintBound> > () = absl::nullopt; }
+#line 10937 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 470: // SizeConstraint: SIZE Constraint
+#line 1717 "/root/repo/src/compiler/asn_compiler.yacc"
+    { yylhs.value.as < Constraint > ().size = yystack_[0].value.as < Constraint > ().value; }
+#line 10943 "/tmp/regen/asn_compiler.re"
+    break;
+
+  case 497: // typereference: GENERIC_IDENTIFIER_UPPERCASE
+#line 1774 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 9590 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10949 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 498:
-#line 1721 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 498: // identifier: GENERIC_IDENTIFIER_LOWERCASE
+#line 1778 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 9596 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10955 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 499:
-#line 1725 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 499: // valuereference: GENERIC_IDENTIFIER_LOWERCASE
+#line 1782 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 9602 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10961 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 500:
-#line 1729 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 500: // modulereference: GENERIC_IDENTIFIER_UPPERCASE
+#line 1786 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 9608 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10967 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 501:
-#line 1733 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 501: // objectclassreference: GENERIC_IDENTIFIER_UPPERCASE
+#line 1790 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 9614 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10973 "/tmp/regen/asn_compiler.re"
     break;
 
-  case 502:
-#line 1736 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:919
+  case 502: // word: GENERIC_IDENTIFIER_UPPERCASE
+#line 1793 "/root/repo/src/compiler/asn_compiler.yacc"
     { yylhs.value.as < std::string > () = yystack_[0].value.as < std::string > (); }
-#line 9620 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10979 "/tmp/regen/asn_compiler.re"
     break;
 
 
-#line 9624 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:919
+#line 10983 "/tmp/regen/asn_compiler.re"
+
             default:
               break;
             }
@@ -9638,7 +10996,6 @@ namespace yy {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
@@ -9654,7 +11011,9 @@ namespace yy {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -9665,7 +11024,7 @@ namespace yy {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -9691,6 +11050,7 @@ namespace yy {
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
 
@@ -9699,37 +11059,39 @@ namespace yy {
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
@@ -9761,6 +11123,7 @@ namespace yy {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -9794,18 +11157,103 @@ namespace yy {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  asn1_parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  asn1_parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  asn1_parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // asn1_parser::context.
+  asn1_parser::context::context (const asn1_parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  asn1_parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
 
+  int
+  asn1_parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -9824,41 +11272,32 @@ namespace yy {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  asn1_parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -9879,11 +11318,11 @@ namespace yy {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -9989,7 +11428,7 @@ namespace yy {
     -663,  3943,  -663,  -663,   509,  3943
   };
 
-  const unsigned short
+  const short
   asn1_parser::yydefact_[] =
   {
        0,   500,     0,     2,     0,   147,     1,     3,   158,     0,
@@ -10113,7 +11552,7 @@ namespace yy {
   const short
   asn1_parser::yydefgoto_[] =
   {
-      -1,     2,     3,   815,   396,   223,   144,    77,   225,   226,
+       0,     2,     3,   815,   396,   223,   144,    77,   225,   226,
      502,   503,   373,   416,   504,   505,   600,   655,   506,   702,
      507,   508,   699,   509,   652,   510,   660,   662,   858,   859,
      860,   861,   862,   863,   145,   146,   693,   694,   695,   805,
@@ -11158,7 +12597,7 @@ namespace yy {
       -1,    -1,   145
   };
 
-  const unsigned short
+  const short
   asn1_parser::yystos_[] =
   {
        0,   149,   154,   155,   228,   375,     0,   154,    51,   124,
@@ -11251,7 +12690,7 @@ namespace yy {
      186,   137,   125,   129,   290,   137
   };
 
-  const unsigned short
+  const short
   asn1_parser::yyr1_[] =
   {
        0,   153,   154,   154,   155,   156,   157,   157,   157,   158,
@@ -11314,7 +12753,7 @@ namespace yy {
      377,   377,   377,   377,   377,   377,   377,   377,   377
   };
 
-  const unsigned char
+  const signed char
   asn1_parser::yyr2_[] =
   {
        0,     2,     1,     2,    10,     3,     1,     1,     1,     3,
@@ -11378,13 +12817,13 @@ namespace yy {
   };
 
 
-
+#if YYDEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const asn1_parser::yytname_[] =
   {
-  "END_OF_FILE", "error", "$undefined", "comment", "number",
+  "END_OF_FILE", "error", "\"invalid token\"", "comment", "number",
   "negativenumber", "realnumber", "bstring", "xmlbstring", "hstring",
   "xmlhstring", "cstring", "xmlcstring", "simplestring", "xmltstring",
   "psname", "encodingreference", "integerUnicodeLabel",
@@ -11410,7 +12849,7 @@ namespace yy {
   "UniversalString", "UTCTime", "UTF8String", "VideotexString",
   "VisibleString", "WITH", "\"::=\"", "\"...\"", "\"..\"", "\"{\"",
   "\"}\"", "\"(\"", "\")\"", "\"[\"", "\"]\"", "\"<\"", "\">\"", "\"!\"",
-  "\"\\\"\"", "\"&\"", "\"'\"", "\"*\"", "\",\"", "\".\"", "\"-\"",
+  "\"\\\"\"", "\"&\"", "\"\\'\"", "\"*\"", "\",\"", "\".\"", "\"-\"",
   "\"/\"", "\":\"", "\";\"", "\"=\"", "\"@\"", "\"|\"", "\"^\"", "PLUS",
   "STAR", "GENERIC_IDENTIFIER_UPPERCASE", "GENERIC_IDENTIFIER_LOWERCASE",
   "GENERIC_INTEGER", "xmlasn1typename", "$accept", "ModuleDefinitionList",
@@ -11482,89 +12921,89 @@ namespace yy {
   "ExceptionIdentification", "typereference", "identifier",
   "valuereference", "modulereference", "objectclassreference", "word", YY_NULLPTR
   };
+#endif
+
 
 #if YYDEBUG
-  const unsigned short
+  const short
   asn1_parser::yyrline_[] =
   {
-       0,   327,   327,   328,   331,   346,   349,   350,   351,   354,
-     357,   359,   363,   367,   369,   374,   378,   380,   384,   386,
-     388,   389,   390,   391,   394,   396,   404,   406,   410,   414,
-     416,   420,   421,   422,   425,   426,   427,   430,   434,   435,
-     436,   439,   442,   445,   446,   447,   450,   453,   454,   455,
-     458,   461,   462,   463,   469,   470,   473,   474,   477,   478,
-     481,   484,   487,   488,   489,   492,   493,   496,   497,   500,
-     506,   507,   512,   513,   516,   519,   522,   525,   526,   529,
-     530,   533,   534,   538,   539,   542,   545,   549,   552,   553,
-     554,   555,   556,   565,   567,   574,   576,   578,   580,   587,
-     591,   595,   599,   611,   615,   617,   621,   623,   627,   629,
-     633,   635,   651,   663,   672,   680,   681,   685,   686,   689,
-     690,   691,   694,   699,   700,   701,   702,   703,   704,   705,
-     708,   710,   714,   715,   718,   719,   722,   723,   726,   727,
-     730,   731,   732,   743,   751,   758,   759,   760,   763,   766,
-     770,   771,   775,   776,   777,   780,   783,   787,   788,   791,
-     793,   795,   797,   801,   802,   805,   807,   811,   812,   813,
-     816,   817,   820,   822,   825,   827,   830,   832,   836,   852,
-     854,   860,   862,   866,   870,   872,   874,   883,   885,   889,
-     891,   893,   895,   898,   900,   904,   906,   908,   914,   916,
-     919,   923,   926,   928,   932,   934,   937,   947,   951,   976,
-     980,   984,   988,   990,   992,   994,   996,  1001,  1002,  1003,
-    1004,  1005,  1006,  1007,  1008,  1009,  1010,  1011,  1012,  1013,
-    1014,  1015,  1016,  1017,  1018,  1019,  1020,  1021,  1022,  1023,
-    1024,  1025,  1026,  1027,  1028,  1029,  1030,  1031,  1034,  1038,
-    1040,  1042,  1044,  1046,  1048,  1050,  1052,  1054,  1056,  1058,
-    1059,  1061,  1063,  1065,  1069,  1070,  1071,  1072,  1073,  1075,
-    1077,  1079,  1081,  1083,  1088,  1090,  1092,  1095,  1096,  1099,
-    1100,  1103,  1106,  1108,  1116,  1119,  1121,  1125,  1127,  1131,
-    1133,  1137,  1139,  1143,  1145,  1149,  1153,  1156,  1159,  1163,
-    1166,  1168,  1172,  1174,  1182,  1185,  1187,  1191,  1192,  1195,
-    1196,  1210,  1213,  1216,  1218,  1222,  1224,  1227,  1231,  1235,
-    1240,  1243,  1246,  1249,  1254,  1256,  1260,  1263,  1266,  1269,
-    1271,  1273,  1275,  1287,  1289,  1293,  1295,  1299,  1301,  1305,
-    1309,  1313,  1315,  1317,  1321,  1323,  1330,  1333,  1337,  1339,
-    1341,  1345,  1349,  1350,  1353,  1355,  1358,  1360,  1362,  1364,
-    1374,  1377,  1379,  1383,  1385,  1389,  1391,  1393,  1397,  1401,
-    1403,  1406,  1410,  1422,  1425,  1431,  1434,  1435,  1438,  1439,
-    1442,  1448,  1455,  1461,  1464,  1467,  1470,  1473,  1476,  1479,
-    1481,  1485,  1487,  1489,  1491,  1493,  1495,  1497,  1499,  1501,
-    1503,  1505,  1507,  1509,  1513,  1517,  1519,  1523,  1525,  1527,
-    1529,  1531,  1533,  1535,  1537,  1541,  1545,  1546,  1549,  1552,
-    1553,  1554,  1557,  1558,  1561,  1562,  1565,  1568,  1569,  1572,
-    1575,  1576,  1579,  1582,  1585,  1586,  1589,  1590,  1593,  1595,
-    1598,  1599,  1600,  1601,  1602,  1603,  1604,  1605,  1606,  1612,
-    1615,  1617,  1619,  1621,  1623,  1625,  1627,  1629,  1631,  1635,
-    1638,  1641,  1644,  1645,  1648,  1649,  1652,  1653,  1656,  1657,
-    1660,  1663,  1666,  1669,  1670,  1673,  1675,  1676,  1677,  1678,
-    1681,  1682,  1685,  1688,  1691,  1692,  1695,  1696,  1697,  1698,
-    1701,  1704,  1707,  1708,  1711,  1712,  1713,  1716,  1720,  1724,
-    1728,  1732,  1736,  1737,  1738,  1739,  1740,  1741,  1742,  1743,
-    1744,  1745,  1746,  1747,  1748,  1749,  1750,  1751,  1752,  1753,
-    1754,  1755,  1756,  1757,  1758,  1759,  1760,  1761,  1762,  1763,
-    1764,  1765,  1766,  1767,  1768,  1769,  1770,  1771,  1772,  1773,
-    1774,  1775,  1776,  1777,  1778,  1779,  1780,  1781,  1782,  1783,
-    1784,  1785,  1786,  1787,  1788,  1789,  1790,  1791,  1792,  1793,
-    1794,  1795,  1796,  1797,  1798,  1799,  1800,  1801,  1802,  1803,
-    1804,  1805,  1806,  1807,  1808,  1809,  1810,  1811,  1812
+       0,   346,   346,   347,   350,   365,   368,   369,   370,   373,
+     376,   378,   382,   386,   388,   393,   397,   399,   403,   405,
+     407,   408,   409,   410,   413,   415,   423,   425,   429,   433,
+     435,   439,   440,   441,   444,   445,   446,   449,   453,   454,
+     455,   458,   461,   464,   465,   466,   469,   472,   473,   474,
+     477,   480,   481,   482,   488,   489,   492,   493,   496,   497,
+     500,   503,   506,   507,   508,   511,   512,   515,   516,   519,
+     525,   526,   531,   532,   535,   538,   541,   544,   545,   548,
+     549,   552,   553,   557,   558,   561,   564,   568,   571,   572,
+     573,   574,   575,   584,   586,   593,   595,   597,   599,   606,
+     610,   614,   618,   630,   634,   636,   640,   642,   646,   648,
+     652,   654,   670,   682,   691,   699,   700,   704,   705,   708,
+     709,   710,   713,   718,   719,   720,   721,   722,   723,   724,
+     727,   729,   733,   734,   737,   738,   741,   742,   745,   746,
+     749,   750,   751,   762,   770,   777,   778,   779,   782,   785,
+     789,   790,   794,   795,   796,   799,   802,   806,   807,   810,
+     812,   814,   816,   820,   821,   824,   826,   830,   831,   832,
+     835,   836,   839,   841,   844,   846,   849,   851,   855,   871,
+     873,   879,   881,   885,   889,   891,   893,   902,   904,   908,
+     910,   912,   914,   917,   919,   923,   925,   927,   933,   935,
+     938,   942,   945,   947,   951,   953,   956,   966,   970,   995,
+     999,  1003,  1007,  1009,  1011,  1013,  1015,  1020,  1021,  1022,
+    1023,  1024,  1025,  1026,  1027,  1028,  1029,  1030,  1031,  1032,
+    1033,  1034,  1035,  1036,  1037,  1038,  1039,  1040,  1041,  1042,
+    1043,  1044,  1045,  1046,  1047,  1048,  1049,  1050,  1053,  1057,
+    1059,  1061,  1063,  1065,  1067,  1069,  1071,  1073,  1075,  1077,
+    1078,  1080,  1082,  1084,  1088,  1089,  1090,  1091,  1092,  1094,
+    1096,  1098,  1100,  1102,  1107,  1109,  1111,  1114,  1115,  1118,
+    1119,  1122,  1125,  1127,  1135,  1138,  1140,  1144,  1146,  1150,
+    1152,  1156,  1158,  1162,  1164,  1168,  1172,  1175,  1178,  1182,
+    1185,  1187,  1191,  1193,  1201,  1204,  1206,  1210,  1211,  1214,
+    1215,  1229,  1232,  1235,  1237,  1241,  1243,  1246,  1250,  1254,
+    1259,  1262,  1265,  1268,  1273,  1275,  1279,  1282,  1285,  1288,
+    1290,  1292,  1294,  1306,  1308,  1312,  1314,  1318,  1320,  1324,
+    1328,  1332,  1334,  1336,  1340,  1342,  1349,  1352,  1356,  1358,
+    1360,  1364,  1368,  1369,  1372,  1374,  1377,  1379,  1381,  1383,
+    1393,  1396,  1398,  1402,  1404,  1408,  1410,  1412,  1416,  1420,
+    1422,  1425,  1429,  1441,  1444,  1450,  1453,  1454,  1457,  1458,
+    1461,  1467,  1474,  1480,  1483,  1486,  1489,  1492,  1495,  1498,
+    1500,  1504,  1506,  1508,  1510,  1512,  1514,  1516,  1518,  1520,
+    1522,  1524,  1526,  1528,  1532,  1536,  1538,  1542,  1544,  1546,
+    1548,  1550,  1552,  1554,  1556,  1560,  1564,  1566,  1570,  1574,
+    1576,  1578,  1582,  1584,  1588,  1590,  1594,  1598,  1600,  1604,
+    1608,  1610,  1614,  1618,  1621,  1622,  1625,  1626,  1629,  1632,
+    1636,  1638,  1640,  1642,  1644,  1646,  1648,  1650,  1652,  1659,
+    1662,  1664,  1666,  1668,  1670,  1672,  1674,  1676,  1678,  1682,
+    1685,  1688,  1692,  1694,  1698,  1700,  1704,  1706,  1710,  1712,
+    1716,  1720,  1723,  1726,  1727,  1730,  1732,  1733,  1734,  1735,
+    1738,  1739,  1742,  1745,  1748,  1749,  1752,  1753,  1754,  1755,
+    1758,  1761,  1764,  1765,  1768,  1769,  1770,  1773,  1777,  1781,
+    1785,  1789,  1793,  1794,  1795,  1796,  1797,  1798,  1799,  1800,
+    1801,  1802,  1803,  1804,  1805,  1806,  1807,  1808,  1809,  1810,
+    1811,  1812,  1813,  1814,  1815,  1816,  1817,  1818,  1819,  1820,
+    1821,  1822,  1823,  1824,  1825,  1826,  1827,  1828,  1829,  1830,
+    1831,  1832,  1833,  1834,  1835,  1836,  1837,  1838,  1839,  1840,
+    1841,  1842,  1843,  1844,  1845,  1846,  1847,  1848,  1849,  1850,
+    1851,  1852,  1853,  1854,  1855,  1856,  1857,  1858,  1859,  1860,
+    1861,  1862,  1863,  1864,  1865,  1866,  1867,  1868,  1869
   };
 
-  // Print the state stack on the debug stream.
   void
-  asn1_parser::yystack_print_ ()
+  asn1_parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  asn1_parser::yy_reduce_print_ (int yyrule)
+  asn1_parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -11577,10 +13016,10 @@ namespace yy {
 #endif // YYDEBUG
 
 
-
 } // yy
-#line 11581 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re" // lalr1.cc:1242
-#line 1814 "/home/styler/git/fast_ber/src/compiler/asn_compiler.yacc" // lalr1.cc:1243
+#line 13021 "/tmp/regen/asn_compiler.re"
+
+#line 1871 "/root/repo/src/compiler/asn_compiler.yacc"
 
 
 
@@ -24032,6 +25471,5 @@ yy811:
 #line 24033 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.hpp"
 }
 #line 11743 "/home/styler/git/fast_ber/build/src/autogen/asn_compiler.re"
-
     }
 }
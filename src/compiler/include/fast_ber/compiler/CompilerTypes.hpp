@@ -39,11 +39,27 @@ enum class StorageMode
     static_,
     small_buffer_optimised,
     dynamic,
+    arena,
+    sparse,
 };
 
 std::string to_string(Class class_, bool abbreviated = false);
 std::string to_string(StorageMode mode);
 
+// Representation of INTEGER and ENUMERATED values in generated code, both encode identically
+enum class ScalarStorage
+{
+    ber,    // Encoded contents are held, fast_ber::Integer
+    native, // Native value is held, fast_ber::NativeInteger
+};
+
+// Representation of strings, OBJECT IDENTIFIER and time types in generated code
+enum class StringStorage
+{
+    ber,     // Header and contents are held, fast_ber::BerStorage
+    compact, // Only contents are held, fast_ber::CompactStorage
+};
+
 struct ComponentType;
 struct TaggedType;
 using ComponentTypeList = std::vector<ComponentType>;
@@ -59,12 +75,35 @@ struct EnumerationValue
     std::string             name;
     absl::optional<int64_t> value;
 };
+struct DefinedValue
+{
+    std::string reference;
+};
+
+// End of a value range or SIZE constraint, ends given by reference are resolved when generating code
+using ConstraintBound = absl::variant<int64_t, DefinedValue>;
+
+// Inclusive range permitted by a constraint, an unset end is unbounded
+struct ConstraintRange
+{
+    absl::optional<ConstraintBound> lower;
+    absl::optional<ConstraintBound> upper;
+};
+
+// Bounds of a subtype constraint, used to select storage. Only single values, value ranges and SIZE constraints are
+// understood, any other constraint and any extensible constraint is treated as unbounded
+struct Constraint
+{
+    ConstraintRange value;
+    ConstraintRange size;
+};
 
 struct AnyType
 {
 };
 struct BitStringType
 {
+    Constraint constraint;
 };
 struct BooleanType
 {
@@ -174,7 +213,7 @@ inline std::string to_string(UniversalTag t) noexcept
     return "Unknown Universal Tag";
 }
 
-enum class CharacterStringType
+enum class CharacterStringKind
 {
     unknown,
     bmp_string,
@@ -193,81 +232,86 @@ enum class CharacterStringType
     character_string,
 };
 
-inline std::string to_string(CharacterStringType type)
+inline std::string to_string(CharacterStringKind type)
 {
     switch (type)
     {
-    case CharacterStringType::bmp_string:
+    case CharacterStringKind::bmp_string:
         return "fast_ber::BMPString";
-    case CharacterStringType::general_string:
+    case CharacterStringKind::general_string:
         return "fast_ber::GeneralString";
-    case CharacterStringType::graphic_string:
+    case CharacterStringKind::graphic_string:
         return "fast_ber::GraphicString";
-    case CharacterStringType::ia5_string:
+    case CharacterStringKind::ia5_string:
         return "fast_ber::IA5String";
-    case CharacterStringType::iso646_string:
+    case CharacterStringKind::iso646_string:
         return "fast_ber::ISO646String";
-    case CharacterStringType::numeric_string:
+    case CharacterStringKind::numeric_string:
         return "fast_ber::NumericString";
-    case CharacterStringType::printable_string:
+    case CharacterStringKind::printable_string:
         return "fast_ber::PrintableString";
-    case CharacterStringType::teletex_string:
+    case CharacterStringKind::teletex_string:
         return "fast_ber::TeletexString";
-    case CharacterStringType::t61_string:
+    case CharacterStringKind::t61_string:
         return "fast_ber::T161String";
-    case CharacterStringType::universal_string:
+    case CharacterStringKind::universal_string:
         return "fast_ber::UniversalString";
-    case CharacterStringType::utf8_string:
+    case CharacterStringKind::utf8_string:
         return "fast_ber::UTF8String";
-    case CharacterStringType::videotex_string:
+    case CharacterStringKind::videotex_string:
         return "fast_ber::VideotexString";
-    case CharacterStringType::visible_string:
+    case CharacterStringKind::visible_string:
         return "fast_ber::VisibleString";
-    case CharacterStringType::character_string:
+    case CharacterStringKind::character_string:
         return "fast_ber::CharacterString";
-    case CharacterStringType::unknown:
+    case CharacterStringKind::unknown:
         return "fast_ber::UnknownStringType";
     }
     return "UnknownStringType";
 }
-inline UniversalTag universal_tag(CharacterStringType type)
+inline UniversalTag universal_tag(CharacterStringKind type)
 {
     switch (type)
     {
-    case CharacterStringType::bmp_string:
+    case CharacterStringKind::bmp_string:
         return UniversalTag::bmp_string;
-    case CharacterStringType::general_string:
+    case CharacterStringKind::general_string:
         return UniversalTag::general_string;
-    case CharacterStringType::graphic_string:
+    case CharacterStringKind::graphic_string:
         return UniversalTag::graphic_string;
-    case CharacterStringType::ia5_string:
+    case CharacterStringKind::ia5_string:
         return UniversalTag::ia5_string;
-    case CharacterStringType::iso646_string:
+    case CharacterStringKind::iso646_string:
         return UniversalTag::iso646_string;
-    case CharacterStringType::numeric_string:
+    case CharacterStringKind::numeric_string:
         return UniversalTag::numeric_string;
-    case CharacterStringType::printable_string:
+    case CharacterStringKind::printable_string:
         return UniversalTag::printable_string;
-    case CharacterStringType::teletex_string:
+    case CharacterStringKind::teletex_string:
         return UniversalTag::teletex_string;
-    case CharacterStringType::t61_string:
+    case CharacterStringKind::t61_string:
         return UniversalTag::t61_string;
-    case CharacterStringType::universal_string:
+    case CharacterStringKind::universal_string:
         return UniversalTag::universal_string;
-    case CharacterStringType::utf8_string:
+    case CharacterStringKind::utf8_string:
         return UniversalTag::utf8_string;
-    case CharacterStringType::videotex_string:
+    case CharacterStringKind::videotex_string:
         return UniversalTag::videotex_string;
-    case CharacterStringType::visible_string:
+    case CharacterStringKind::visible_string:
         return UniversalTag::visible_string;
-    case CharacterStringType::character_string:
+    case CharacterStringKind::character_string:
         return UniversalTag::character_string;
-    case CharacterStringType::unknown:
+    case CharacterStringKind::unknown:
         return UniversalTag::reserved;
     }
     return UniversalTag::reserved;
 }
 
+struct CharacterStringType
+{
+    CharacterStringKind kind;
+    Constraint          constraint;
+};
 struct ChoiceType;
 struct DateType
 {
@@ -285,6 +329,7 @@ struct EnumeratedType
 {
     std::vector<EnumerationValue> enum_values;
     bool                          accept_anything;
+    ScalarStorage                 storage;
 };
 struct ExternalType
 {
@@ -298,6 +343,8 @@ struct InstanceOfType
 struct IntegerType
 {
     std::vector<NamedNumber> named_numbers;
+    ScalarStorage            storage;
+    Constraint               constraint;
 };
 struct IRIType
 {
@@ -314,6 +361,7 @@ struct ObjectIdentifierType
 };
 struct OctetStringType
 {
+    Constraint constraint;
 };
 struct RealType
 {
@@ -396,6 +444,8 @@ struct SequenceOfType
     std::unique_ptr<NamedType> named_type;
     std::unique_ptr<Type>      type;
     StorageMode                storage = StorageMode::small_buffer_optimised;
+    Constraint                 constraint;
+    absl::optional<size_t>     inlined_size; // Elements held in place, chosen from the element size if not given
 
     SequenceOfType() = default;
     SequenceOfType(bool, std::unique_ptr<NamedType>&&, std::unique_ptr<Type>&&,
@@ -423,11 +473,6 @@ struct ChoiceType
     StorageMode            storage;
 };
 
-struct DefinedValue
-{
-    std::string reference;
-};
-
 struct ObjectClassFieldType
 {
     DefinedType              referenced_object_class;
@@ -592,6 +637,9 @@ struct Module
 struct Asn1Tree
 {
     std::vector<Module> modules;
+    StringStorage       string_storage          = StringStorage::ber;
+    size_t              compact_string_capacity = 16;
+    bool                bounded_storage         = false; // Hold constrained types in place, sized by their bounds
 };
 
 struct Identifier
@@ -748,6 +796,17 @@ bool is_oid(const Type& type);
 bool is_defined(const Type& type);
 bool is_generated(const Type& type);
 
+// Bounds of the values permitted by either or both of two constraints
+Constraint constraint_union(const Constraint& lhs, const Constraint& rhs);
+Constraint constraint_intersection(const Constraint& lhs, const Constraint& rhs);
+
+// End of a range given by a value, unset unless the value is a number or a reference to a value
+absl::optional<ConstraintBound> constraint_bound(const Value& value);
+absl::optional<ConstraintBound> exclusive_bound(const absl::optional<ConstraintBound>& bound, int64_t step);
+
+// Constraints are held by the types which use their bounds, constraints on other types are dropped
+void add_constraint(Type& type, const Constraint& constraint);
+
 struct Context;
 
 std::string gen_anon_member_name();
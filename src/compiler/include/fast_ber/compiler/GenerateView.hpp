@@ -0,0 +1,8 @@
+#pragma once
+
+#include "fast_ber/compiler/CompilerTypes.hpp"
+
+// Lazy zero copy views of generated collections and choices. Class definitions must all be output before any of
+// the function definitions, as accessors return the views of other types.
+std::string create_view_definitions(const Assignment& assignment, const Module& module, const Asn1Tree& tree);
+std::string create_view_functions(const Assignment& assignment, const Module& module, const Asn1Tree& tree);
@@ -19,6 +19,20 @@ std::vector<Assignment> reorder_assignments(std::vector<Assignment>& assignments
 // Finds any sequence or set types nested within a type
 void find_nested_structs(const Module& module, const Type& type, std::vector<NamedType>& nested_structs);
 
+// Allocate lists, recursive choices and recursive optional members from an arena rather than the heap
+void use_arena_storage(Asn1Tree& tree);
+
+// Hold optional members of sequences and sets larger than a few words out of line, so absent members take a pointer
+void use_sparse_optional_storage(Asn1Tree& tree);
+
+// Set the number of elements held in place by a list, named by its type assignment, optionally followed by the names
+// of members leading to the list, such as "Record.values". Returns false if no list is found, throws if the list is not
+// held with small buffer optimised storage, such as recursive lists and lists allocated from an arena
+bool set_inlined_size(Asn1Tree& tree, const std::string& name, size_t inlined_size);
+
+// Hold INTEGER and ENUMERATED values as native integers rather than as encoded ber
+void use_native_scalar_storage(Asn1Tree& tree);
+
 // Create assignments for imported types
 std::vector<Assignment> split_imports(const Asn1Tree& tree, std::vector<Assignment> assignments,
                                       const std::vector<Import>& imports);
@@ -40,6 +40,10 @@ bool is_value(const Assignment& assignment);
 bool is_object_class(const Assignment& assignment);
 bool is_a_parameter(const std::string& reference, const std::vector<Parameter>& parameters);
 
+// Number at the end of a constraint range, unset if unbounded or if a referenced value can't be found
+absl::optional<int64_t> resolve_bound(const Asn1Tree& tree, const Module& module,
+                                      const absl::optional<ConstraintBound>& bound);
+
 Type&                        type(Assignment& assignemnt);
 const Type&                  type(const Assignment& assignemnt);
 ValueAssignment&             value(Assignment& assignemnt);
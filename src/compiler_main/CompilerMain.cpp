@@ -6,6 +6,7 @@
 #include "fast_ber/compiler/EncodeDecode.hpp"
 #include "fast_ber/compiler/GenerateChoice.hpp"
 #include "fast_ber/compiler/GenerateHelpers.hpp"
+#include "fast_ber/compiler/GenerateView.hpp"
 #include "fast_ber/compiler/Identifier.hpp"
 #include "fast_ber/compiler/Logging.hpp"
 #include "fast_ber/compiler/ObjectClass.hpp"
@@ -16,8 +17,11 @@
 #include "fast_ber/compiler/ValueAsString.hpp"
 #include "fast_ber/compiler/ValueType.hpp"
 
+#include <cstdlib>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 std::string strip_path(const std::string& path)
 {
@@ -162,6 +166,15 @@ std::string create_detail_body(const Asn1Tree& tree)
 
     std::string body = "\n";
 
+    // Views are defined before any functions, their accessors may return the views of types defined later
+    for (const Module& module : tree.modules)
+    {
+        for (const Assignment& assignment : module.assignments)
+        {
+            body += create_view_definitions(assignment, module, tree);
+        }
+    }
+
     for (const Module& module : tree.modules)
     {
         std::string helpers;
@@ -170,6 +183,7 @@ std::string create_detail_body(const Asn1Tree& tree)
             body += create_choice_functions(tree, module, assignment);
             body += create_encode_functions(assignment, module, tree);
             body += create_decode_functions(assignment, module, tree);
+            body += create_view_functions(assignment, module, tree);
             helpers += create_helper_functions(tree, module, assignment);
         }
 
@@ -206,16 +220,92 @@ std::string create_output_file(const Asn1Tree& tree, const std::string& fwd_file
 
 int main(int argc, char** argv)
 {
-    if (argc < 3)
+    // Options precede the input files
+    bool   arena_storage           = false;
+    bool   bounded_storage         = false;
+    bool   native_scalar_storage   = false;
+    bool   sparse_optionals        = false;
+    bool   compact_string_storage  = false;
+    size_t compact_string_capacity = 16;
+    int    first_input             = 1;
+
+    std::vector<std::pair<std::string, size_t>> inlined_sizes;
+    for (; first_input < argc && std::string(argv[first_input]).compare(0, 2, "--") == 0; first_input++)
+    {
+        if (std::string(argv[first_input]) == "--arena")
+        {
+            arena_storage = true;
+        }
+        else if (std::string(argv[first_input]) == "--bounded-storage")
+        {
+            bounded_storage = true;
+        }
+        else if (std::string(argv[first_input]) == "--native-scalars")
+        {
+            native_scalar_storage = true;
+        }
+        else if (std::string(argv[first_input]) == "--sparse-optionals")
+        {
+            sparse_optionals = true;
+        }
+        else if (std::string(argv[first_input]) == "--compact-strings")
+        {
+            compact_string_storage = true;
+        }
+        else if (std::string(argv[first_input]).compare(0, 18, "--compact-strings=") == 0)
+        {
+            char* end               = nullptr;
+            compact_string_storage  = true;
+            compact_string_capacity = std::strtoul(argv[first_input] + 18, &end, 10);
+            if (*end != '\0' || compact_string_capacity == 0)
+            {
+                std::cerr << "Invalid inline capacity: " << argv[first_input] << "\n";
+                return -1;
+            }
+        }
+        else if (std::string(argv[first_input]).compare(0, 18, "--inline-elements=") == 0)
+        {
+            const std::string option = argv[first_input] + 18;
+            const size_t      equals = option.rfind('=');
+            char*             end    = nullptr;
+            const size_t      size =
+                equals == std::string::npos ? 0 : std::strtoul(option.c_str() + equals + 1, &end, 10);
+            if (equals == std::string::npos || equals == 0 || end == option.c_str() + equals + 1 || *end != '\0')
+            {
+                std::cerr << "Invalid inline elements, expected NAME=N: " << argv[first_input] << "\n";
+                return -1;
+            }
+            inlined_sizes.emplace_back(option.substr(0, equals), size);
+        }
+        else
+        {
+            std::cerr << "Unknown option: " << argv[first_input] << "\n";
+            return -1;
+        }
+    }
+
+    if (argc - first_input < 2)
     {
-        std::cout << "Usage: INPUT.asn... OUTPUT_NAME\n";
+        std::cout << "Usage: [--arena] [--bounded-storage] [--native-scalars] [--sparse-optionals] "
+                     "[--compact-strings[=N]] [--inline-elements=NAME=N]... INPUT.asn... OUTPUT_NAME\n";
+        std::cout << "    --arena                 Allocate lists and recursive types from a fast_ber::Arena\n";
+        std::cout << "    --bounded-storage       Hold strings and lists with a SIZE constraint in place, and\n";
+        std::cout << "                            INTEGER with a value range in the narrowest native integer\n";
+        std::cout << "    --native-scalars        Hold INTEGER and ENUMERATED values as native integers\n";
+        std::cout << "    --sparse-optionals      Hold large OPTIONAL members out of line, an absent member costs\n";
+        std::cout << "                            a single pointer\n";
+        std::cout << "    --compact-strings[=N]   Hold only the contents of strings, OBJECT IDENTIFIER and times,\n";
+        std::cout << "                            up to N bytes are held without allocating (default 16)\n";
+        std::cout << "    --inline-elements=NAME=N\n";
+        std::cout << "                            Hold N elements of the list NAME in place, such as Record.values.\n";
+        std::cout << "                            By default the number is chosen from the size of the elements\n";
         return -1;
     }
 
     try
     {
         Context context;
-        for (int i = 1; i < argc - 1; i++)
+        for (int i = first_input; i < argc - 1; i++)
         {
             std::string   input_filename = argv[i];
             std::ifstream input_file(input_filename);
@@ -280,6 +370,33 @@ int main(int argc, char** argv)
             module.assignments = reorder_assignments(module.assignments, context.asn1_tree, module);
         }
 
+        if (arena_storage)
+        {
+            use_arena_storage(context.asn1_tree);
+        }
+        if (native_scalar_storage)
+        {
+            use_native_scalar_storage(context.asn1_tree);
+        }
+        if (sparse_optionals)
+        {
+            use_sparse_optional_storage(context.asn1_tree);
+        }
+        context.asn1_tree.bounded_storage = bounded_storage;
+        if (compact_string_storage)
+        {
+            context.asn1_tree.string_storage          = StringStorage::compact;
+            context.asn1_tree.compact_string_capacity = compact_string_capacity;
+        }
+        for (const std::pair<std::string, size_t>& inlined_size : inlined_sizes)
+        {
+            if (!set_inlined_size(context.asn1_tree, inlined_size.first, inlined_size.second))
+            {
+                std::cerr << "No list named " << inlined_size.first << " for --inline-elements\n";
+                return -1;
+            }
+        }
+
         output_file << create_output_file(context.asn1_tree, fwd_filame, detail_filame);
         fwd_output_file << create_fwd_body(context.asn1_tree);
         detail_output_file << create_detail_body(context.asn1_tree);
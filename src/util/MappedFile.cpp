@@ -0,0 +1,106 @@
+#include "fast_ber/util/MappedFile.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FAST_BER_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fast_ber
+{
+
+MappedFile::MappedFile(MappedFile&& rhs) noexcept
+    : m_data(rhs.m_data), m_is_open(rhs.m_is_open), m_mapped(rhs.m_mapped), m_buffer(std::move(rhs.m_buffer))
+{
+    rhs.m_data    = absl::Span<const uint8_t>();
+    rhs.m_is_open = false;
+    rhs.m_mapped  = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        close();
+        m_data        = rhs.m_data;
+        m_is_open     = rhs.m_is_open;
+        m_mapped      = rhs.m_mapped;
+        m_buffer      = std::move(rhs.m_buffer);
+        rhs.m_data    = absl::Span<const uint8_t>();
+        rhs.m_is_open = false;
+        rhs.m_mapped  = false;
+    }
+    return *this;
+}
+
+bool MappedFile::open(const std::string& path)
+{
+    close();
+
+#ifdef FAST_BER_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat status = {};
+    if (::fstat(fd, &status) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    // An empty file can't be mapped, it is opened with empty contents
+    const size_t size = static_cast<size_t>(status.st_size);
+    if (size > 0)
+    {
+        void* const address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        // Files are usually read from start to end, read ahead aggressively
+        ::madvise(address, size, MADV_SEQUENTIAL);
+        m_data   = absl::MakeSpan(static_cast<const uint8_t*>(address), size);
+        m_mapped = true;
+    }
+    ::close(fd); // The mapping remains valid after the descriptor is closed
+#else
+    std::ifstream input(path, std::ios::binary);
+    if (!input.good())
+    {
+        return false;
+    }
+    m_buffer.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    m_data = m_buffer;
+#endif
+
+    m_is_open = true;
+    return true;
+}
+
+void MappedFile::close() noexcept
+{
+#ifdef FAST_BER_HAS_MMAP
+    if (m_mapped)
+    {
+        ::munmap(const_cast<uint8_t*>(m_data.data()), m_data.size());
+    }
+#endif
+
+    m_buffer.clear();
+    m_data    = absl::Span<const uint8_t>();
+    m_is_open = false;
+    m_mapped  = false;
+}
+
+} // namespace fast_ber
@@ -1,3 +1,5 @@
+#include "fast_ber/util/BerFramer.hpp"
+#include "fast_ber/util/BerIndex.hpp"
 #include "fast_ber/util/BerView.hpp"
 
 #include <fstream>
@@ -6,10 +8,25 @@
 
 void usage()
 {
-    std::cout << "Tool to inspect the contents of a BER PDU. Does not require schema.\n";
+    std::cout << "Tool to inspect the contents of BER PDUs. Does not require schema.\n";
     std::cout << "  usage: ./ber_view [pdu_to_decode.ber]\n";
 }
 
+bool print_pdu(fast_ber::BerView pdu)
+{
+    // Index the whole PDU in one pass, printing then requires no further header parsing
+    fast_ber::BerIndex index;
+    if (index.build(pdu.ber()))
+    {
+        std::cout << index << '\n';
+        return true;
+    }
+
+    // Malformed, print as much of the structure as can be parsed
+    std::cout << pdu << '\n';
+    return false;
+}
+
 int main(int argc, const char** argv)
 {
     if (argc != 2)
@@ -26,9 +43,34 @@ int main(int argc, const char** argv)
         return -1;
     }
 
-    const auto buffer = std::vector<uint8_t>{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
-    auto       view   = fast_ber::BerView(buffer);
+    // The input may hold several back to back PDUs, such as a file of records. It is read in chunks, each PDU is
+    // printed once it is complete.
+    fast_ber::BerFramer  framer;
+    fast_ber::BerView    pdu;
+    std::vector<uint8_t> chunk(64 * 1024);
+    bool                 success = true;
+    while (input)
+    {
+        input.read(reinterpret_cast<char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+        framer.push(absl::MakeSpan(chunk.data(), static_cast<size_t>(input.gcount())));
+
+        fast_ber::FrameStatus status;
+        while ((status = framer.next(pdu)) == fast_ber::FrameStatus::ready)
+        {
+            success &= print_pdu(pdu);
+        }
+        if (status == fast_ber::FrameStatus::error)
+        {
+            std::cerr << "Malformed PDU header in input: " << input_path << std::endl;
+            return -1;
+        }
+    }
 
-    std::cout << view;
-    return view.is_valid() ? 0 : -1;
+    if (framer.buffered() != 0)
+    {
+        std::cerr << "Input ends with an incomplete PDU, " << framer.bytes_needed() << " more bytes expected"
+                  << std::endl;
+        return -1;
+    }
+    return success ? 0 : -1;
 }
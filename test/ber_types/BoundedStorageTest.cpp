@@ -0,0 +1,99 @@
+#include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/ber_types/OctetString.hpp"
+#include "fast_ber/ber_types/StringImpl.hpp"
+#include "fast_ber/util/BoundedBerContainer.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/Error.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+using BoundedOctetString =
+    fast_ber::OctetString<fast_ber::ExplicitId<fast_ber::UniversalTag::octet_string>, fast_ber::BoundedStorage<8>>;
+using TaggedId = fast_ber::DoubleId<fast_ber::Id<fast_ber::Class::context_specific, 3>,
+                                    fast_ber::ExplicitId<fast_ber::UniversalTag::octet_string>>;
+
+static_assert(sizeof(BoundedOctetString) == 9, "Bounded storage holds its contents and a one byte length");
+static_assert(sizeof(fast_ber::OctetString<TaggedId, fast_ber::BoundedStorage<256>>) == 258, "Two byte length");
+
+TEST_CASE("BoundedStorage: Encoding matches BerStorage")
+{
+    for (const std::string& value : {std::string(), std::string("a"), std::string(127, 'b'), std::string(128, 'c'),
+                                     std::string(300, 'd')})
+    {
+        std::vector<uint8_t> expected(value.size() + 20, 0);
+        std::vector<uint8_t> buffer(value.size() + 20, 0);
+
+        const fast_ber::OctetString<TaggedId>                                ber(value);
+        const fast_ber::OctetString<TaggedId, fast_ber::BoundedStorage<300>> bounded(value);
+
+        const fast_ber::EncodeResult expected_result = fast_ber::encode(absl::MakeSpan(expected), ber);
+        const fast_ber::EncodeResult result          = fast_ber::encode(absl::MakeSpan(buffer), bounded);
+        REQUIRE(result.success);
+        REQUIRE(result.length == expected_result.length);
+        REQUIRE(fast_ber::encoded_length(bounded) == expected_result.length);
+        REQUIRE(buffer == expected);
+
+        std::fill(buffer.begin(), buffer.end(), 0);
+        REQUIRE(bounded.encode_reverse(absl::MakeSpan(buffer.data(), result.length)).success);
+        REQUIRE(buffer == expected);
+
+        fast_ber::OctetString<TaggedId, fast_ber::BoundedStorage<300>> decoded;
+        REQUIRE(fast_ber::decode(absl::MakeSpan(expected), decoded).success);
+        REQUIRE(decoded == value);
+    }
+}
+
+TEST_CASE("BoundedStorage: Assignment over capacity fails")
+{
+    BoundedOctetString bounded("a string longer than the capacity");
+    REQUIRE(bounded == "");
+
+    fast_ber::ErrorContext context;
+    fast_ber::ErrorScope   scope(context);
+
+    bounded = "a string";
+    bounded = "a longer string";
+    REQUIRE(bounded == "a string");
+    REQUIRE(context.code() == fast_ber::ErrorCode::capacity_exceeded);
+
+    bounded.resize(100);
+    REQUIRE(bounded.length() == 8);
+
+    bounded.resize(3);
+    REQUIRE(bounded == "a s");
+
+    fast_ber::BoundedBerContainer<fast_ber::ExplicitId<fast_ber::UniversalTag::octet_string>, 8> container;
+    const std::array<uint8_t, 9>                                                                  nine = {};
+    REQUIRE(!container.assign_content(absl::MakeSpan(nine)));
+    REQUIRE(container.assign_content(absl::MakeSpan(nine.data(), 8)));
+    REQUIRE(!container.resize_content(9));
+    REQUIRE(container.content_length() == 8);
+}
+
+TEST_CASE("BoundedStorage: Decode contents over capacity")
+{
+    const std::array<uint8_t, 11> too_long  = {0x04, 0x09, 'n', 'i', 'n', 'e', ' ', 'c', 'h', 'a', 'r'};
+    const std::array<uint8_t, 10> at_limit  = {0x04, 0x08, 'e', 'i', 'g', 'h', 't', ' ', 'c', 'h'};
+    const std::array<uint8_t, 3>  wrong_tag = {0x02, 0x01, 0x01};
+
+    BoundedOctetString bounded("kept");
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(too_long), bounded).success);
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(wrong_tag), bounded).success);
+    REQUIRE(fast_ber::decode(absl::MakeSpan(at_limit), bounded).success);
+    REQUIRE(bounded == "eight ch");
+}
+
+TEST_CASE("BoundedStorage: Conversion")
+{
+    fast_ber::OctetString<> ber("convert");
+    BoundedOctetString      bounded(ber);
+    REQUIRE(bounded == "convert");
+
+    bounded = "short";
+    ber     = bounded;
+    REQUIRE(ber == "short");
+}
@@ -0,0 +1,108 @@
+#include "fast_ber/ber_types/GeneralizedTime.hpp"
+#include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/ber_types/ObjectIdentifier.hpp"
+#include "fast_ber/ber_types/OctetString.hpp"
+#include "fast_ber/util/CompactBerContainer.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+using CompactOctetString = fast_ber::OctetString<fast_ber::ExplicitId<fast_ber::UniversalTag::octet_string>,
+                                                 fast_ber::CompactStorage<>>;
+using TaggedId           = fast_ber::DoubleId<fast_ber::Id<fast_ber::Class::context_specific, 3>,
+                                    fast_ber::ExplicitId<fast_ber::UniversalTag::octet_string>>;
+
+static_assert(sizeof(CompactOctetString) == 24, "Compact storage holds 16 bytes inline");
+static_assert(sizeof(CompactOctetString) < sizeof(fast_ber::OctetString<>), "Compact storage is smaller");
+
+TEST_CASE("CompactStorage: Encoding matches BerStorage")
+{
+    for (const std::string& value : {std::string(), std::string("a"), std::string(16, 'b'), std::string(17, 'c'),
+                                     std::string(127, 'd'), std::string(128, 'e'), std::string(70000, 'f')})
+    {
+        std::vector<uint8_t> expected(value.size() + 20, 0);
+        std::vector<uint8_t> buffer(value.size() + 20, 0);
+
+        const fast_ber::OctetString<TaggedId>                             ber(value);
+        const fast_ber::OctetString<TaggedId, fast_ber::CompactStorage<>> compact(value);
+
+        const fast_ber::EncodeResult expected_result = fast_ber::encode(absl::MakeSpan(expected), ber);
+        const fast_ber::EncodeResult result          = fast_ber::encode(absl::MakeSpan(buffer), compact);
+        REQUIRE(result.success);
+        REQUIRE(result.length == expected_result.length);
+        REQUIRE(fast_ber::encoded_length(compact) == expected_result.length);
+        REQUIRE(buffer == expected);
+
+        std::fill(buffer.begin(), buffer.end(), 0);
+        REQUIRE(compact.encode_reverse(absl::MakeSpan(buffer.data(), result.length)).success);
+        REQUIRE(buffer == expected);
+
+        fast_ber::OctetString<TaggedId, fast_ber::CompactStorage<4>> decoded;
+        REQUIRE(fast_ber::decode(absl::MakeSpan(expected), decoded).success);
+        REQUIRE(decoded == value);
+    }
+}
+
+TEST_CASE("CompactStorage: Buffer too small")
+{
+    const CompactOctetString compact("Hello world");
+    std::array<uint8_t, 12>  buffer = {};
+
+    REQUIRE(!compact.encode(absl::MakeSpan(buffer)).success);
+    REQUIRE(!compact.encode_reverse(absl::MakeSpan(buffer)).success);
+    REQUIRE(!CompactOctetString().encode(absl::MakeSpan(buffer.data(), 1)).success);
+}
+
+TEST_CASE("CompactStorage: Decode invalid")
+{
+    const std::array<uint8_t, 3> wrong_tag = {0x02, 0x01, 0x01};
+    const std::array<uint8_t, 3> truncated = {0x04, 0x05, 0x01};
+
+    CompactOctetString compact("unchanged");
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(wrong_tag), compact).success);
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(truncated), compact).success);
+}
+
+TEST_CASE("CompactStorage: Conversion")
+{
+    fast_ber::OctetString<> ber("conversion");
+    CompactOctetString      compact(ber);
+    REQUIRE(compact == "conversion");
+
+    compact = "a string longer than the inline capacity";
+    ber     = compact;
+    REQUIRE(ber == "a string longer than the inline capacity");
+
+    compact.resize(3);
+    REQUIRE(compact == "a s");
+}
+
+TEST_CASE("CompactStorage: Object identifier and time")
+{
+    using CompactObjectIdentifier =
+        fast_ber::ObjectIdentifier<fast_ber::ExplicitId<fast_ber::UniversalTag::object_identifier>,
+                                   fast_ber::CompactStorage<>>;
+    using CompactTime = fast_ber::GeneralizedTime<fast_ber::ExplicitId<fast_ber::UniversalTag::generalized_time>,
+                                                  fast_ber::CompactStorage<>>;
+
+    std::array<uint8_t, 100> expected = {};
+    std::array<uint8_t, 100> buffer   = {};
+
+    const CompactObjectIdentifier oid{1, 2, 840, 113549};
+    REQUIRE(oid == fast_ber::ObjectIdentifier<>{1, 2, 840, 113549});
+    REQUIRE(oid.value() == fast_ber::ObjectIdentifierComponents{1, 2, 840, 113549});
+    REQUIRE(fast_ber::encode(absl::MakeSpan(buffer), oid).success);
+    REQUIRE(fast_ber::encode(absl::MakeSpan(expected), fast_ber::ObjectIdentifier<>{1, 2, 840, 113549}).success);
+    REQUIRE(buffer == expected);
+
+    const CompactTime time = absl::FromTimeT(1553029782);
+    CompactTime       decoded;
+    REQUIRE(fast_ber::encode(absl::MakeSpan(buffer), time).success);
+    REQUIRE(fast_ber::decode(absl::MakeSpan(buffer), decoded).success);
+    REQUIRE(decoded.time() == absl::FromTimeT(1553029782));
+    REQUIRE(decoded.string() == fast_ber::GeneralizedTime<>(absl::FromTimeT(1553029782)).string());
+}
@@ -29,6 +29,19 @@ TEST_CASE("Default: Construct")
     CHECK(default_str.is_default());
 }
 
+TEST_CASE("Default: Default value is shared")
+{
+    using DefaultString = fast_ber::Default<fast_ber::OctetString<>, StringDefault>;
+
+    static_assert(sizeof(DefaultString) == sizeof(absl::optional<fast_ber::OctetString<>>), "Holds only the value");
+
+    const DefaultString first;
+    const DefaultString second;
+    CHECK(&first.get() == &second.get());
+    CHECK(&first.get() == &DefaultString::default_value());
+    CHECK(DefaultString::default_value() == "Hello");
+}
+
 TEST_CASE("Default: Assign")
 {
     fast_ber::Default<fast_ber::OctetString<>, StringDefault> default_str = "racoon";
@@ -0,0 +1,180 @@
+#include "fast_ber/ber_types/Enumerated.hpp"
+#include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/ber_types/NativeInteger.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace
+{
+std::vector<int64_t> native_test_values()
+{
+    std::vector<int64_t> values = {std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), 0, -1};
+    for (int shift = 0; shift < 63; shift++)
+    {
+        // Values either side of each boundary between encoded lengths
+        const int64_t power = int64_t(1) << shift;
+        values.insert(values.end(), {power, power - 1, -power, -power - 1});
+    }
+    return values;
+}
+} // namespace
+
+static_assert(sizeof(fast_ber::NativeInteger<>) == sizeof(int64_t), "NativeInteger holds only its value");
+
+TEST_CASE("NativeInteger: Encoding matches Integer")
+{
+    using ExplicitTag = fast_ber::DoubleId<fast_ber::Id<fast_ber::Class::application, 2>,
+                                           fast_ber::ExplicitId<fast_ber::UniversalTag::integer>>;
+
+    for (int64_t value : native_test_values())
+    {
+        std::array<uint8_t, 20> expected = {};
+        std::array<uint8_t, 20> buffer   = {};
+
+        const fast_ber::Integer<>       integer(value);
+        const fast_ber::NativeInteger<> native(value);
+
+        const fast_ber::EncodeResult expected_result = fast_ber::encode(absl::MakeSpan(expected), integer);
+        const fast_ber::EncodeResult result          = fast_ber::encode(absl::MakeSpan(buffer), native);
+        REQUIRE(result.success);
+        REQUIRE(result.length == expected_result.length);
+        REQUIRE(fast_ber::encoded_length(native) == expected_result.length);
+        REQUIRE(buffer == expected);
+
+        std::array<uint8_t, 20> tagged_expected = {};
+        std::array<uint8_t, 20> tagged_buffer   = {};
+        fast_ber::encode(absl::MakeSpan(tagged_expected), fast_ber::Integer<ExplicitTag>(value));
+        REQUIRE(fast_ber::encode(absl::MakeSpan(tagged_buffer), fast_ber::NativeInteger<ExplicitTag>(value)).success);
+        REQUIRE(tagged_buffer == tagged_expected);
+    }
+}
+
+TEST_CASE("NativeInteger: Encode Decode")
+{
+    using ExplicitTag = fast_ber::DoubleId<fast_ber::Id<fast_ber::Class::application, 2>,
+                                           fast_ber::ExplicitId<fast_ber::UniversalTag::integer>>;
+
+    for (int64_t value : native_test_values())
+    {
+        std::array<uint8_t, 20> buffer = {};
+
+        fast_ber::NativeInteger<ExplicitTag> native = value;
+        fast_ber::NativeInteger<ExplicitTag> native_copy;
+        fast_ber::Integer<ExplicitTag>       integer_copy;
+
+        REQUIRE(fast_ber::encode(absl::MakeSpan(buffer), native).success);
+        REQUIRE(fast_ber::decode(absl::MakeSpan(buffer), native_copy).success);
+        REQUIRE(fast_ber::decode(absl::MakeSpan(buffer), integer_copy).success);
+        REQUIRE(native_copy == value);
+        REQUIRE(native_copy == integer_copy);
+    }
+}
+
+TEST_CASE("NativeInteger: Encode reverse")
+{
+    std::array<uint8_t, 10> buffer   = {};
+    std::array<uint8_t, 4>  expected = {0x02, 0x02, 0x12, 0x34};
+
+    const fast_ber::EncodeResult result = fast_ber::NativeInteger<>(0x1234).encode_reverse(absl::MakeSpan(buffer));
+
+    REQUIRE(result.success);
+    REQUIRE(result.length == 4);
+    REQUIRE(absl::MakeSpan(buffer.data() + 6, 4) == absl::MakeSpan(expected));
+    REQUIRE(!fast_ber::NativeInteger<>(0x1234).encode_reverse(absl::MakeSpan(buffer.data(), 3)).success);
+}
+
+TEST_CASE("NativeInteger: Decode invalid")
+{
+    std::array<uint8_t, 11> too_long  = {0x02, 0x09, 0x01};
+    std::array<uint8_t, 2>  empty     = {0x02, 0x00};
+    std::array<uint8_t, 3>  wrong_tag = {0x04, 0x01, 0x01};
+
+    fast_ber::NativeInteger<> native = 5;
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(too_long), native).success);
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(empty), native).success);
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(wrong_tag), native).success);
+    REQUIRE(native == 5);
+}
+
+TEST_CASE("NativeInteger: Narrow value type")
+{
+    using Narrow = fast_ber::NativeInteger<fast_ber::ExplicitId<fast_ber::UniversalTag::integer>, uint8_t>;
+
+    static_assert(sizeof(Narrow) == 1, "Narrow NativeInteger holds a single byte");
+
+    std::array<uint8_t, 10> expected = {};
+    std::array<uint8_t, 10> buffer   = {};
+
+    Narrow narrow = 200;
+    REQUIRE(fast_ber::encode(absl::MakeSpan(expected), fast_ber::Integer<>(200)).success);
+    REQUIRE(fast_ber::encode(absl::MakeSpan(buffer), narrow).success);
+    REQUIRE(buffer == expected);
+    REQUIRE(fast_ber::decode(absl::MakeSpan(buffer), narrow).success);
+    REQUIRE(narrow == 200);
+
+    for (int64_t out_of_range : {int64_t(-1), int64_t(256)})
+    {
+        REQUIRE(fast_ber::encode(absl::MakeSpan(buffer), fast_ber::Integer<>(out_of_range)).success);
+        REQUIRE(!fast_ber::decode(absl::MakeSpan(buffer), narrow).success);
+        REQUIRE(narrow == 200);
+
+        // Assignment is range checked as decoding is, rather than narrowing the value
+        REQUIRE(!narrow.assign(out_of_range));
+        narrow = out_of_range;
+        REQUIRE(narrow == 200);
+        REQUIRE(Narrow(out_of_range) == 0);
+        REQUIRE(Narrow(fast_ber::Integer<>(out_of_range)) == 0);
+    }
+    REQUIRE(narrow.assign(255));
+    REQUIRE(narrow == 255);
+}
+
+TEST_CASE("NativeInteger: Conversion with Integer")
+{
+    fast_ber::Integer<>       integer = -27837;
+    fast_ber::NativeInteger<> native  = integer;
+
+    REQUIRE(native == integer);
+    REQUIRE(native.value() == -27837);
+
+    native  = 50;
+    integer = native.value();
+    REQUIRE(integer == 50);
+}
+
+enum class NativeTestEnumValues
+{
+    option_one,
+    option_two = 300,
+};
+
+std::ostream& operator<<(std::ostream& os, const NativeTestEnumValues& obj) noexcept
+{
+    return os << static_cast<int>(obj);
+}
+
+TEST_CASE("NativeInteger: Native enumerated")
+{
+    using NativeEnum  = fast_ber::NativeEnumerated<NativeTestEnumValues>;
+    using EncodedEnum = fast_ber::Enumerated<NativeTestEnumValues>;
+
+    static_assert(sizeof(NativeEnum) == sizeof(int64_t), "NativeEnumerated holds only its value");
+
+    std::array<uint8_t, 10> expected = {};
+    std::array<uint8_t, 10> buffer   = {};
+
+    const NativeEnum native = NativeTestEnumValues::option_two;
+    NativeEnum       copy;
+    REQUIRE(fast_ber::encode(absl::MakeSpan(expected), EncodedEnum(NativeTestEnumValues::option_two)).success);
+    REQUIRE(fast_ber::encode(absl::MakeSpan(buffer), native).success);
+    REQUIRE(buffer == expected);
+    REQUIRE(fast_ber::decode(absl::MakeSpan(buffer), copy).success);
+    REQUIRE(copy == NativeTestEnumValues::option_two);
+    REQUIRE(copy == native);
+}
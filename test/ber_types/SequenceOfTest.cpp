@@ -1,4 +1,4 @@
-#include "fast_ber/ber_types/SequenceOf.hpp"
+﻿#include "fast_ber/ber_types/SequenceOf.hpp"
 
 #include "fast_ber/ber_types/Boolean.hpp"
 #include "fast_ber/ber_types/Integer.hpp"
@@ -8,6 +8,8 @@
 #include <catch2/catch.hpp>
 
 #include <array>
+#include <type_traits>
+#include <vector>
 
 template <typename T, typename Identifier>
 void test_sequences(const std::initializer_list<fast_ber::SequenceOf<T, Identifier>>& sequences)
@@ -28,6 +30,14 @@ void test_sequences(const std::initializer_list<fast_ber::SequenceOf<T, Identifi
         CHECK(copy.size() == sequence.size());
         CHECK(sequence == copy);
         CHECK(iter == fast_ber::BerViewIterator(fast_ber::End::end));
+
+        std::array<uint8_t, 10000> reverse_buffer = {};
+        fast_ber::EncodeResult     reverse_result =
+            fast_ber::encode_reverse(absl::MakeSpan(reverse_buffer.data(), reverse_buffer.size()), sequence);
+        CHECK(reverse_result.success);
+        CHECK(reverse_result.length == encode_result.length);
+        CHECK(absl::MakeSpan(reverse_buffer.data() + reverse_buffer.size() - reverse_result.length,
+                             reverse_result.length) == absl::MakeSpan(buffer.data(), encode_result.length));
     }
 }
 
@@ -83,3 +93,83 @@ TEST_CASE("SequenceOf: Encode decode string")
 
     test_sequences(sequences);
 }
+
+TEST_CASE("SequenceOf: Encode with a plan of another value")
+{
+    using Lists = fast_ber::SequenceOf<fast_ber::SequenceOf<fast_ber::Integer<>>>;
+
+    std::array<uint8_t, 100> buffer  = {};
+    const Lists              planned = {{1, 2}};
+    const Lists              encoded = {{1, 2}, {3}};
+    fast_ber::EncodePlan     plan;
+    REQUIRE(fast_ber::encoded_length(planned, plan) > 0);
+    REQUIRE(plan.size() == 2);
+
+    // The plan runs out of entries for the second list, the encode fails rather than reading past them
+    REQUIRE(!fast_ber::encode(absl::MakeSpan(buffer), encoded, plan).success);
+    REQUIRE(fast_ber::encode(absl::MakeSpan(buffer), planned, plan).success);
+}
+
+TEST_CASE("SequenceOf: Decode reuses elements")
+{
+    const std::string long_string(200, 'x');
+    const fast_ber::SequenceOf<fast_ber::OctetString<>> three = {long_string, long_string, long_string};
+    const fast_ber::SequenceOf<fast_ber::OctetString<>> two   = {"short", long_string};
+
+    std::array<uint8_t, 1000> three_buffer = {};
+    std::array<uint8_t, 1000> two_buffer   = {};
+    const size_t three_length = fast_ber::encode(absl::MakeSpan(three_buffer), three).length;
+    const size_t two_length   = fast_ber::encode(absl::MakeSpan(two_buffer), two).length;
+
+    fast_ber::SequenceOf<fast_ber::OctetString<>> decoded;
+    REQUIRE(decoded.decode(fast_ber::BerView(absl::MakeSpan(three_buffer.data(), three_length))).success);
+    REQUIRE(decoded == three);
+    const uint8_t* const second_data = decoded[1].data();
+
+    REQUIRE(decoded.decode(fast_ber::BerView(absl::MakeSpan(two_buffer.data(), two_length))).success);
+    REQUIRE(decoded == two);
+    CHECK(decoded[1].data() == second_data);
+
+    REQUIRE(decoded.decode(fast_ber::BerView(absl::MakeSpan(three_buffer.data(), three_length))).success);
+    REQUIRE(decoded == three);
+    CHECK(decoded[1].data() == second_data);
+}
+
+struct LargeElement
+{
+    std::array<uint8_t, 300> data;
+};
+
+template <typename T, size_t n>
+using InlineSequenceOf = fast_ber::SequenceOf<T, fast_ber::ExplicitId<fast_ber::UniversalTag::sequence>,
+                                              fast_ber::StorageMode::small_buffer_optimised, n>;
+
+TEST_CASE("SequenceOf: Inline elements chosen from element size")
+{
+    static_assert(fast_ber::inlined_size_for<fast_ber::Integer<>>() == fast_ber::default_inlined_size,
+                  "Small elements");
+    static_assert(fast_ber::inlined_size_for<fast_ber::OctetString<>>() == 2, "Limited by the inline budget");
+    static_assert(fast_ber::inlined_size_for<LargeElement>() == 0, "Over the inline budget");
+
+    static_assert(std::is_same<fast_ber::SequenceOf<fast_ber::Integer<>>::Implementation,
+                               absl::InlinedVector<fast_ber::Integer<>, fast_ber::default_inlined_size>>::value,
+                  "Automatic inline size");
+    static_assert(std::is_same<fast_ber::SequenceOf<LargeElement>::Implementation, std::vector<LargeElement>>::value,
+                  "Large elements are never held in place");
+    static_assert(std::is_same<InlineSequenceOf<fast_ber::OctetString<>, 0>::Implementation,
+                               std::vector<fast_ber::OctetString<>>>::value,
+                  "Explicit inline size of 0");
+
+    const fast_ber::SequenceOf<fast_ber::OctetString<>> strings = {"one", "two", "three", "four"};
+    const InlineSequenceOf<fast_ber::OctetString<>, 3>  three_inline(strings);
+    const InlineSequenceOf<fast_ber::OctetString<>, 0>  none_inline(strings);
+    REQUIRE(three_inline.size() == 4);
+    REQUIRE(none_inline.size() == 4);
+
+    std::array<uint8_t, 100> expected = {};
+    std::array<uint8_t, 100> buffer   = {};
+    REQUIRE(fast_ber::encode(absl::MakeSpan(expected), strings).success);
+    REQUIRE(fast_ber::encode(absl::MakeSpan(buffer), none_inline).success);
+    REQUIRE(buffer == expected);
+    test_sequences({strings});
+}
@@ -0,0 +1,65 @@
+#include "autogen/real_schema_compact.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <array>
+#include <string>
+
+// Regression checks on the footprint of the SGSN types with --compact-strings. Each string holds 16 bytes inline, with
+// the default storage each holds a 100 byte buffer and a SGSNPDPRecord is over 6 KB
+static_assert(sizeof(fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::ServedIMSI) <= 24, "Compact string");
+static_assert(sizeof(fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::RecordOpeningTime) <= 24, "Compact string");
+static_assert(sizeof(fast_ber::SGSN_2009A_CDR::ManagementExtension) <= 64, "Compact object identifier");
+static_assert(sizeof(fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition) <= 128, "Compact record");
+static_assert(sizeof(fast_ber::SGSN_2009A_CDR::SGSNPDPRecord) <= 2048, "Compact record");
+static_assert(sizeof(fast_ber::SGSN_2009A_CDR::CallEventRecord) <= 2048, "Compact record");
+
+TEST_CASE("CompactSchema: Encode and decode")
+{
+    std::array<uint8_t, 5000> buffer = {};
+
+    fast_ber::SGSN_2009A_CDR::SGSNPDPRecord record;
+    record.recordType        = 18;
+    record.servedIMSI        = "12345";
+    record.chargingID        = 77;
+    record.recordOpeningTime = "24:00:00T";
+    record.nodeID            = std::string(200, 'n');
+    record.duration          = 123456789012;
+    record.recordExtensions  = fast_ber::SGSN_2009A_CDR::ManagementExtensions{
+        fast_ber::SGSN_2009A_CDR::ManagementExtension{{1, 2, 840, 113549}, true, {}}};
+    record.listOfTrafficVolumes = fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::ListOfTrafficVolumes{
+        fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition{{}, {}, 1, 2, {}, "first"},
+        fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition{{}, {}, 3, 4, {}, "second"}};
+
+    const fast_ber::SGSN_2009A_CDR::CallEventRecord event(record);
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), event);
+    REQUIRE(encode_result.success);
+    REQUIRE(encode_result.length == fast_ber::encoded_length(event));
+
+    fast_ber::SGSN_2009A_CDR::CallEventRecord decoded;
+    REQUIRE(fast_ber::decode(absl::MakeSpan(buffer.data(), encode_result.length), decoded).success);
+    REQUIRE(decoded == event);
+
+    const fast_ber::SGSN_2009A_CDR::SGSNPDPRecord& decoded_record = fast_ber::get<0>(decoded);
+    REQUIRE(decoded_record.servedIMSI == "12345");
+    REQUIRE(decoded_record.nodeID->length() == 200);
+    REQUIRE((*decoded_record.recordExtensions)[0].identifier ==
+            fast_ber::ObjectIdentifierComponents{1, 2, 840, 113549});
+}
+
+TEST_CASE("CompactSchema: View")
+{
+    std::array<uint8_t, 5000> buffer = {};
+
+    fast_ber::SGSN_2009A_CDR::SGSNPDPRecord record;
+    record.servedIMSI        = "12345";
+    record.recordOpeningTime = "24:00:00T";
+
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), record);
+    REQUIRE(encode_result.success);
+
+    const fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::View view(absl::MakeSpan(buffer.data(), encode_result.length));
+    REQUIRE(view.is_valid());
+    REQUIRE(view.servedIMSI() == "12345");
+    REQUIRE(view.recordOpeningTime() == "24:00:00T");
+}
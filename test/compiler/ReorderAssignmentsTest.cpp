@@ -1,4 +1,5 @@
 ﻿#include "fast_ber/compiler/ReorderAssignments.hpp"
+#include "fast_ber/compiler/ResolveType.hpp"
 
 #include "catch2/catch.hpp"
 
@@ -115,3 +116,109 @@ TEST_CASE("ReorderAssignments: Circular Sequence")
     // Reference is not optional, should throw
     CHECK_THROWS(reorder_assignments(assignments, Asn1Tree{}, Module{"module"}));
 }
+
+TEST_CASE("ReorderAssignments: Arena Storage")
+{
+    ComponentType list_component = {
+        NamedType{"list", SequenceOfType{false, nullptr, std::unique_ptr<Type>(new Type(IntegerType{}))}},
+        false,
+        {},
+        {},
+        StorageMode::static_};
+    ComponentType static_component  = {NamedType{"static", IntegerType{}}, true, {}, {}, StorageMode::static_};
+    ComponentType dynamic_component = {
+        NamedType{"dynamic", DefinedType{{}, {"Defined"}, {}}}, true, {}, {}, StorageMode::dynamic};
+    Collection collection;
+    collection.components = ComponentTypeList{list_component, static_component, dynamic_component};
+
+    Module module{"module", {}, {}, {}, {}};
+    module.assignments = {Assignment{"Defined", TypeAssignment{SequenceType{collection}}, {}, {}}};
+    Asn1Tree tree;
+    tree.modules = {module};
+
+    use_arena_storage(tree);
+
+    const SequenceType& sequence = absl::get<SequenceType>(
+        absl::get<BuiltinType>(absl::get<TypeAssignment>(tree.modules[0].assignments[0].specific).type));
+    const Type& list = sequence.components[0].named_type.type;
+    REQUIRE(absl::get<SequenceOfType>(absl::get<BuiltinType>(list)).storage == StorageMode::arena);
+    REQUIRE(sequence.components[1].optional_storage == StorageMode::static_);
+    REQUIRE(sequence.components[2].optional_storage == StorageMode::arena);
+}
+
+TEST_CASE("ReorderAssignments: Native Scalar Storage")
+{
+    ComponentType integer_component = {NamedType{"integer", IntegerType{}}, false, {}, {}, StorageMode::static_};
+    ComponentType list_component    = {
+        NamedType{"list", SequenceOfType{false, nullptr, std::unique_ptr<Type>(new Type(EnumeratedType{}))}},
+        false,
+        {},
+        {},
+        StorageMode::static_};
+    Collection collection;
+    collection.components = ComponentTypeList{integer_component, list_component};
+
+    Module module{"module", {}, {}, {}, {}};
+    module.assignments = {Assignment{"Defined", TypeAssignment{SequenceType{collection}}, {}, {}},
+                          Assignment{"Int", TypeAssignment{IntegerType{}}, {}, {}}};
+    Asn1Tree tree;
+    tree.modules = {module};
+
+    REQUIRE(absl::get<IntegerType>(absl::get<BuiltinType>(type(tree.modules[0].assignments[1]))).storage ==
+            ScalarStorage::ber);
+
+    use_native_scalar_storage(tree);
+
+    const SequenceType& sequence =
+        absl::get<SequenceType>(absl::get<BuiltinType>(type(tree.modules[0].assignments[0])));
+    const SequenceOfType& list =
+        absl::get<SequenceOfType>(absl::get<BuiltinType>(sequence.components[1].named_type.type));
+    REQUIRE(absl::get<IntegerType>(absl::get<BuiltinType>(sequence.components[0].named_type.type)).storage ==
+            ScalarStorage::native);
+    REQUIRE(absl::get<EnumeratedType>(absl::get<BuiltinType>(*list.type)).storage == ScalarStorage::native);
+    REQUIRE(absl::get<IntegerType>(absl::get<BuiltinType>(type(tree.modules[0].assignments[1]))).storage ==
+            ScalarStorage::native);
+}
+
+TEST_CASE("ReorderAssignments: Inlined Size")
+{
+    ComponentType list_component = {
+        NamedType{"list", SequenceOfType{false, nullptr, std::unique_ptr<Type>(new Type(IntegerType{}))}},
+        false,
+        {},
+        {},
+        StorageMode::static_};
+    Collection collection;
+    collection.components = ComponentTypeList{list_component};
+
+    Module module{"module", {}, {}, {}, {}};
+    module.assignments = {
+        Assignment{"Defined", TypeAssignment{SequenceType{collection}}, {}, {}},
+        Assignment{"Set", TypeAssignment{SetOfType{false, nullptr, std::unique_ptr<Type>(new Type(IntegerType{}))}},
+                   {},
+                   {}},
+        Assignment{"Dynamic",
+                   TypeAssignment{SequenceOfType{false, nullptr, std::unique_ptr<Type>(new Type(IntegerType{})),
+                                                 StorageMode::dynamic}},
+                   {},
+                   {}}};
+    Asn1Tree tree;
+    tree.modules = {module};
+
+    REQUIRE(set_inlined_size(tree, "Defined.list", 2));
+    REQUIRE(set_inlined_size(tree, "Set", 3));
+    REQUIRE(!set_inlined_size(tree, "Defined.missing", 2));
+    REQUIRE(!set_inlined_size(tree, "Missing", 2));
+
+    const SequenceType& sequence =
+        absl::get<SequenceType>(absl::get<BuiltinType>(type(tree.modules[0].assignments[0])));
+    REQUIRE(absl::get<SequenceOfType>(absl::get<BuiltinType>(sequence.components[0].named_type.type)).inlined_size ==
+            absl::optional<size_t>(2));
+    REQUIRE(absl::get<SetOfType>(absl::get<BuiltinType>(type(tree.modules[0].assignments[1]))).inlined_size ==
+            absl::optional<size_t>(3));
+
+    // Lists which are not held in place, such as recursive lists and lists allocated from an arena, are rejected
+    REQUIRE_THROWS(set_inlined_size(tree, "Dynamic", 2));
+    use_arena_storage(tree);
+    REQUIRE_THROWS(set_inlined_size(tree, "Set", 2));
+}
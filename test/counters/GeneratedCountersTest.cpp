@@ -0,0 +1,165 @@
+#include "autogen/sequence.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <cstring>
+#include <vector>
+
+// Built with FAST_BER_ENABLE_COUNTERS and FAST_BER_ENABLE_LATENCY, checking the hooks in the generated code and the
+// library
+
+namespace
+{
+fast_ber::CounterValues counted(fast_ber::CounterOperation operation, const char* type, const char* member = nullptr)
+{
+    for (const fast_ber::CounterEntry& entry : fast_ber::counter_snapshot())
+    {
+        if (entry.operation == operation && std::strcmp(entry.type, type) == 0 &&
+            ((entry.member == nullptr && member == nullptr) ||
+             (entry.member != nullptr && member != nullptr && std::strcmp(entry.member, member) == 0)))
+        {
+            return entry.values;
+        }
+    }
+    return fast_ber::CounterValues{};
+}
+
+uint64_t sampled(fast_ber::CounterOperation operation, const char* type)
+{
+    for (const fast_ber::LatencyEntry& entry : fast_ber::latency_snapshot())
+    {
+        if (entry.operation == operation && std::strcmp(entry.type, type) == 0)
+        {
+            return entry.histogram.count();
+        }
+    }
+    return 0;
+}
+
+std::vector<uint8_t> encoded_contents()
+{
+    fast_ber::Sequence_::Contents contents = {};
+    contents.seq.integer                   = 7;
+    contents.cho                           = fast_ber::Boolean<>(true);
+
+    std::vector<uint8_t>         buffer(100, 0);
+    const fast_ber::EncodeResult result = fast_ber::encode(absl::MakeSpan(buffer), contents);
+    REQUIRE(result.success);
+    buffer.resize(result.length);
+    return buffer;
+}
+} // namespace
+
+TEST_CASE("Counters: Generated types count decodes of the type and its members")
+{
+    const fast_ber::CounterOperation decode  = fast_ber::CounterOperation::decode;
+    const std::vector<uint8_t>       encoded = encoded_contents();
+
+    const fast_ber::CounterValues before         = counted(decode, "fast_ber::Sequence_::Contents");
+    const fast_ber::CounterValues before_seq     = counted(decode, "fast_ber::Sequence_::Contents", "seq");
+    const fast_ber::CounterValues before_boolean = counted(decode, "fast_ber::Sequence_::Contents::Cho", "boolean");
+    const fast_ber::CounterValues before_integer = counted(decode, "Integer");
+
+    fast_ber::Sequence_::Contents contents;
+    REQUIRE(fast_ber::decode(absl::MakeSpan(encoded), contents).success);
+
+    const fast_ber::CounterValues after = counted(decode, "fast_ber::Sequence_::Contents");
+    REQUIRE(after.calls - before.calls == 1);
+    REQUIRE(after.bytes - before.bytes == encoded.size());
+    REQUIRE(after.failures == before.failures);
+    REQUIRE(counted(decode, "fast_ber::Sequence_::Contents", "seq").calls - before_seq.calls == 1);
+    REQUIRE(counted(decode, "fast_ber::Sequence_::Contents::Cho", "boolean").calls - before_boolean.calls == 1);
+    // The integer and the enumerated value, which is held in an Integer
+    REQUIRE(counted(decode, "Integer").calls - before_integer.calls == 2);
+}
+
+TEST_CASE("Counters: Generated types count failed decodes")
+{
+    const fast_ber::CounterOperation decode  = fast_ber::CounterOperation::decode;
+    const std::vector<uint8_t>       encoded = encoded_contents();
+    const std::vector<uint8_t>       truncated(encoded.begin(), encoded.end() - 1);
+
+    const fast_ber::CounterValues before = counted(decode, "fast_ber::Sequence_::Contents");
+
+    fast_ber::Sequence_::Contents contents;
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(truncated), contents).success);
+
+    const fast_ber::CounterValues after = counted(decode, "fast_ber::Sequence_::Contents");
+    REQUIRE(after.calls - before.calls == 1);
+    REQUIRE(after.failures - before.failures == 1);
+}
+
+TEST_CASE("Counters: Generated types count encodes")
+{
+    const fast_ber::CounterOperation encode = fast_ber::CounterOperation::encode;
+
+    const fast_ber::CounterValues before     = counted(encode, "fast_ber::Sequence_::Contents");
+    const fast_ber::CounterValues before_cho = counted(encode, "fast_ber::Sequence_::Contents", "cho");
+    const std::vector<uint8_t>    encoded    = encoded_contents();
+
+    const fast_ber::CounterValues after = counted(encode, "fast_ber::Sequence_::Contents");
+    REQUIRE(after.calls - before.calls == 1);
+    REQUIRE(after.bytes - before.bytes == encoded.size());
+    REQUIRE(counted(encode, "fast_ber::Sequence_::Contents", "cho").calls - before_cho.calls == 1);
+}
+
+TEST_CASE("Latency: Generated types time sampled decodes and encodes")
+{
+    const fast_ber::CounterOperation decode = fast_ber::CounterOperation::decode;
+    const fast_ber::CounterOperation encode = fast_ber::CounterOperation::encode;
+
+    fast_ber::Sequence_::Contents contents = {};
+    contents.seq.integer                   = 7;
+    contents.cho                           = fast_ber::Boolean<>(true);
+    std::vector<uint8_t> buffer(100, 0);
+
+    const uint64_t before_encode = sampled(encode, "fast_ber::Sequence_::Contents");
+    const uint64_t before_decode = sampled(decode, "fast_ber::Sequence_::Contents");
+    const uint64_t before_choice = sampled(decode, "fast_ber::Sequence_::Contents::Cho");
+
+    fast_ber::set_latency_sample_period(1);
+    const fast_ber::EncodeResult encoded = fast_ber::encode(absl::MakeSpan(buffer), contents);
+    REQUIRE(encoded.success);
+    REQUIRE(fast_ber::decode(absl::MakeSpan(buffer.data(), encoded.length), contents).success);
+    fast_ber::set_latency_sample_period(1024);
+
+    REQUIRE(sampled(encode, "fast_ber::Sequence_::Contents") - before_encode == 1);
+    REQUIRE(sampled(decode, "fast_ber::Sequence_::Contents") - before_decode == 1);
+    REQUIRE(sampled(decode, "fast_ber::Sequence_::Contents::Cho") - before_choice == 1);
+}
+
+TEST_CASE("Latency: Nested types are each sampled once in every period")
+{
+    const fast_ber::CounterOperation decode  = fast_ber::CounterOperation::decode;
+    const std::vector<uint8_t>       encoded = encoded_contents();
+    const std::vector<const char*>   types   = {"fast_ber::Sequence_::Contents",
+                                                "fast_ber::Sequence_::Contents::Seq",
+                                                "fast_ber::Sequence_::Contents::Cho"};
+
+    // Each decode runs the three sites in the same order, a period of three would align with a count shared by them
+    for (uint32_t period : {2u, 3u, 4u})
+    {
+        std::vector<uint64_t> before;
+        for (const char* type : types)
+        {
+            before.push_back(sampled(decode, type));
+        }
+
+        // A period of one samples every call, restarting the count of each site
+        fast_ber::set_latency_sample_period(1);
+        fast_ber::Sequence_::Contents contents = {};
+        REQUIRE(fast_ber::decode(absl::MakeSpan(encoded), contents).success);
+        fast_ber::set_latency_sample_period(period);
+        for (int i = 0; i < 24; i++)
+        {
+            REQUIRE(fast_ber::decode(absl::MakeSpan(encoded), contents).success);
+        }
+        fast_ber::set_latency_sample_period(1024);
+
+        for (size_t i = 0; i < types.size(); i++)
+        {
+            INFO(types[i] << " with a period of " << period);
+            REQUIRE(sampled(decode, types[i]) - before[i] == 1 + 24 / period);
+        }
+    }
+}
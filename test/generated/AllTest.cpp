@@ -6,6 +6,8 @@
 
 #include "absl/time/clock.h"
 
+#include <iostream>
+
 namespace dflt
 {
 struct StringDefault
@@ -91,6 +93,24 @@ void test_type(const T& a)
         CHECK(ID::check_id_match(fast_ber::BerView(buffer).class_(), fast_ber::BerView(buffer).tag()));
     }
 
+    // Check that reverse encoding produces identical output at the end of the buffer
+    std::array<uint8_t, 1000> reverse_buffer        = {};
+    fast_ber::EncodeResult    reverse_encode_result = a.encode_reverse(absl::Span<uint8_t>(reverse_buffer));
+    CHECK(reverse_encode_result.success);
+    CHECK(reverse_encode_result.length == encoded_len);
+    CHECK(absl::MakeSpan(reverse_buffer.data() + reverse_buffer.size() - encoded_len, encoded_len) ==
+          absl::MakeSpan(buffer.data(), encoded_len));
+
+    // Check that planned encoding produces identical output
+    fast_ber::EncodePlan      plan;
+    std::array<uint8_t, 1000> planned_buffer        = {};
+    size_t                    planned_len           = fast_ber::encoded_length(a, plan);
+    fast_ber::EncodeResult    planned_encode_result = fast_ber::encode(absl::Span<uint8_t>(planned_buffer), a, plan);
+    CHECK(planned_len == encoded_len);
+    CHECK(planned_encode_result.success);
+    CHECK(planned_encode_result.length == encoded_len);
+    CHECK(absl::MakeSpan(planned_buffer.data(), encoded_len) == absl::MakeSpan(buffer.data(), encoded_len));
+
     // Destructive tests - Check for undefined behaviour when using too small buffer
     for (size_t i = 0; i < encoded_len; i++)
     {
@@ -100,6 +120,8 @@ void test_type(const T& a)
         fast_ber::DecodeResult destructive_decode_result = fast_ber::decode(absl::MakeSpan(buffer.data(), i), f);
 
         CHECK(!destructive_encode_result.success);
+        CHECK(!fast_ber::encode_reverse(absl::MakeSpan(reverse_buffer.data(), i), a).success);
+        CHECK(!fast_ber::encode(absl::MakeSpan(planned_buffer.data(), i), a, plan).success);
 
         // buffer may be valid for decoding, by chance
         (void)destructive_decode_result;
@@ -0,0 +1,70 @@
+#include "autogen/arena_storage.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <vector>
+
+namespace
+{
+fast_ber::ArenaStorage::Record make_record()
+{
+    fast_ber::ArenaStorage::Record record;
+    record.name   = "arena";
+    record.values = {1, 2, 3, 4, 5};
+    record.names  = {"one", "two"};
+
+    fast_ber::ArenaStorage::Tree tree;
+    tree.value    = 1;
+    tree.children = {fast_ber::ArenaStorage::Tree{2, {}}, fast_ber::ArenaStorage::Tree{3, {}}};
+    record.tree   = tree;
+
+    fast_ber::ArenaStorage::Sum sum;
+    sum.lhs           = fast_ber::ArenaStorage::Expression::Number(1);
+    sum.rhs           = fast_ber::ArenaStorage::Expression(fast_ber::ArenaStorage::Expression::Number(2));
+    record.expression = fast_ber::ArenaStorage::Expression(sum);
+    return record;
+}
+} // namespace
+
+TEST_CASE("ArenaStorage: Encode and decode without an arena")
+{
+    const fast_ber::ArenaStorage::Record record = make_record();
+    fast_ber::ArenaStorage::Record       copy;
+
+    std::vector<uint8_t>   buffer(500, 0);
+    fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), record);
+    fast_ber::DecodeResult decode_result = fast_ber::decode(absl::MakeSpan(buffer), copy);
+
+    REQUIRE(encode_result.success);
+    REQUIRE(decode_result.success);
+    REQUIRE(copy == record);
+}
+
+TEST_CASE("ArenaStorage: Decode into an arena")
+{
+    std::vector<uint8_t>   buffer(500, 0);
+    fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), make_record());
+    REQUIRE(encode_result.success);
+
+    fast_ber::Arena arena;
+    for (int i = 0; i < 3; i++)
+    {
+        {
+            fast_ber::ArenaScope           scope(arena);
+            fast_ber::ArenaStorage::Record copy;
+
+            fast_ber::DecodeResult decode_result = fast_ber::decode(absl::MakeSpan(buffer), copy);
+            REQUIRE(decode_result.success);
+            REQUIRE(copy == make_record());
+            REQUIRE(copy.values.get_allocator().arena() == &arena);
+            REQUIRE(copy.tree->children.size() == 2);
+            REQUIRE(arena.bytes_allocated() > 0);
+        }
+
+        // Blocks are kept for the next record
+        const size_t capacity = arena.capacity();
+        arena.reset();
+        REQUIRE(arena.bytes_allocated() == 0);
+        REQUIRE(arena.capacity() == capacity);
+    }
+}
@@ -0,0 +1,66 @@
+#include "autogen/bounded_storage.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+static_assert(sizeof(fast_ber::BoundedSchema::Measurement::Cell_id) == 3, "Bounded octet string");
+static_assert(sizeof(fast_ber::BoundedSchema::Measurement::Name) == 17, "Bounded string with a defined value bound");
+static_assert(sizeof(fast_ber::BoundedSchema::Measurement::Level) == 1, "Narrow integer");
+static_assert(sizeof(fast_ber::BoundedSchema::Measurement::Offset) == 2, "Narrow integer");
+static_assert(sizeof(fast_ber::BoundedSchema::Measurement::Count) == 4, "Narrow unsigned integer");
+static_assert(sizeof(fast_ber::BoundedSchema::Sample) == 1, "Exclusive upper bound");
+static_assert(sizeof(fast_ber::BoundedSchema::Measurement::Free_text) == sizeof(fast_ber::UTF8String<>),
+              "Strings over the capacity limit keep the default storage");
+static_assert(sizeof(fast_ber::BoundedSchema::Measurement::Comment) == sizeof(fast_ber::OctetString<>),
+              "Unconstrained strings keep the default storage");
+
+TEST_CASE("BoundedStorage: Encode and decode")
+{
+    fast_ber::BoundedSchema::Measurement measurement;
+    measurement.cell_id = "ab";
+    measurement.name    = "cell-1";
+    measurement.level   = 255;
+    measurement.offset  = -1000;
+    measurement.count   = 4000000000u;
+    measurement.samples = {-128, 0, 127};
+    measurement.comment = std::string(300, 'c');
+
+    std::vector<uint8_t>   buffer(1000, 0);
+    fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), measurement);
+    REQUIRE(encode_result.success);
+    REQUIRE(encode_result.length == fast_ber::encoded_length(measurement));
+
+    fast_ber::BoundedSchema::Measurement copy;
+    REQUIRE(fast_ber::decode(absl::MakeSpan(buffer.data(), encode_result.length), copy).success);
+    REQUIRE(copy == measurement);
+    REQUIRE(copy.count.value() == 4000000000u);
+    REQUIRE(copy.samples[0] == -128);
+}
+
+TEST_CASE("BoundedStorage: Values over the bound fail to decode")
+{
+    fast_ber::BoundedSchema::Measurement measurement;
+    measurement.name = "cell-1";
+
+    std::vector<uint8_t>         buffer(1000, 0);
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), measurement);
+    REQUIRE(encode_result.success);
+    REQUIRE(encode_result.length < 128);
+
+    // Patch the name to be longer than its 16 byte capacity
+    const std::vector<uint8_t> name = {0x81, 0x06, 'c', 'e', 'l', 'l', '-', '1'};
+    auto name_pos = std::search(buffer.begin(), buffer.end(), name.begin(), name.end());
+    REQUIRE(name_pos != buffer.end());
+
+    std::vector<uint8_t> too_long(buffer.begin(), name_pos);
+    too_long.insert(too_long.end(), {0x81, 17});
+    too_long.insert(too_long.end(), 17, 'x');
+    too_long.insert(too_long.end(), name_pos + name.size(), buffer.begin() + encode_result.length);
+    too_long[1] = static_cast<uint8_t>(too_long[1] + 11);
+
+    fast_ber::BoundedSchema::Measurement copy;
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(too_long), copy).success);
+}
@@ -68,3 +68,26 @@ TEST_CASE("Default: Serialize")
     REQUIRE(ss.str() ==
             R"({"integer" : 88, "flag" : true, "string" : "dog", "defined" : -10, "colour" : "red", "real" : -16})");
 }
+
+TEST_CASE("Default: View members read as the default when not encoded")
+{
+    std::array<uint8_t, 100> buffer = {};
+
+    fast_ber::Defaults::SequenceWithDefault sequence;
+    sequence.integer = 5;
+
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), sequence);
+    REQUIRE(encode_result.success);
+
+    const fast_ber::Defaults::SequenceWithDefault::View view(absl::MakeSpan(buffer.data(), encode_result.length));
+    REQUIRE(view.is_valid());
+    REQUIRE(view.integer() == int64_t(5));
+    REQUIRE(view.flag() == false);
+    REQUIRE(view.string() == "dog");
+    REQUIRE(view.defined() == int64_t(-172803790));
+    REQUIRE(view.colour() == fast_ber::Defaults::ColourValues::blue);
+
+    fast_ber::Defaults::SequenceWithDefault::Real real;
+    REQUIRE(fast_ber::decode(view.real(), real).success);
+    REQUIRE(real == 5523432.12323);
+}
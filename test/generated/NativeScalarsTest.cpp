@@ -0,0 +1,47 @@
+#include "autogen/native_scalars.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <vector>
+
+static_assert(std::is_base_of<fast_ber::NativeInteger<>, fast_ber::NativeScalars::Volume>::value, "Native integer");
+static_assert(sizeof(fast_ber::NativeScalars::Counters::Counter_id) == sizeof(int64_t), "Native integer");
+static_assert(sizeof(fast_ber::NativeScalars::Counters::Status) == sizeof(int64_t), "Native enumerated");
+
+TEST_CASE("NativeScalars: Encode and decode")
+{
+    fast_ber::NativeScalars::Counters counters;
+    counters.counter_id = -99999999;
+    counters.status     = fast_ber::NativeScalars::StatusValues::closed;
+    counters.uplink     = fast_ber::NativeScalars::Volume(1 << 20);
+    counters.downlink   = 500;
+    counters.samples    = {0, 1, -1, 128, -129};
+    counters.reading    = fast_ber::NativeScalars::Counters::Reading::Level(
+        fast_ber::NativeScalars::UnnamedEnum0Values::high);
+
+    std::vector<uint8_t>   buffer(200, 0);
+    fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), counters);
+    REQUIRE(encode_result.success);
+    REQUIRE(encode_result.length == fast_ber::encoded_length(counters));
+
+    fast_ber::NativeScalars::Counters copy;
+    fast_ber::DecodeResult decode_result = fast_ber::decode(absl::MakeSpan(buffer.data(), encode_result.length), copy);
+    REQUIRE(decode_result.success);
+    REQUIRE(copy == counters);
+    REQUIRE(copy.counter_id.value() == -99999999);
+    REQUIRE(copy.status == fast_ber::NativeScalars::StatusValues::closed);
+    REQUIRE(copy.samples[4] == -129);
+}
+
+TEST_CASE("NativeScalars: Default is not encoded")
+{
+    fast_ber::NativeScalars::Counters counters;
+    counters.downlink = 0;
+
+    REQUIRE(counters.downlink.is_default());
+
+    std::vector<uint8_t> buffer(200, 0);
+    const size_t         length = fast_ber::encode(absl::MakeSpan(buffer), counters).length;
+    counters.downlink           = 1;
+    REQUIRE(fast_ber::encode(absl::MakeSpan(buffer), counters).length == length + 3);
+}
@@ -1,5 +1,7 @@
 ﻿#include "autogen/real_schema.hpp"
 
+#include "fast_ber/util/ParallelDecoder.hpp"
+
 #include "catch2/catch.hpp"
 
 #include <array>
@@ -130,3 +132,223 @@ TEST_CASE("RealSchema: Expected Output")
     REQUIRE(fast_ber::encoded_length(record) == test_record_expected_encoding.size());
     REQUIRE(absl::MakeSpan(buffer.data(), test_record_expected_encoding.size()) == test_record_expected_encoding);
 }
+
+TEST_CASE("RealSchema: Reverse Encode")
+{
+    std::array<uint8_t, 5000> buffer = {};
+
+    fast_ber::SGSN_2009A_CDR::CallEventRecord record{test_record};
+
+    fast_ber::EncodeResult result = fast_ber::encode_reverse(absl::Span<uint8_t>(buffer), record);
+    REQUIRE(result.success);
+    REQUIRE(result.length == test_record_expected_encoding.size());
+    REQUIRE(absl::MakeSpan(buffer.data() + buffer.size() - result.length, result.length) ==
+            test_record_expected_encoding);
+}
+
+TEST_CASE("RealSchema: Planned Encode")
+{
+    std::array<uint8_t, 5000> buffer = {};
+
+    fast_ber::SGSN_2009A_CDR::CallEventRecord record{test_record};
+    fast_ber::EncodePlan                      plan;
+
+    REQUIRE(fast_ber::encoded_length(record, plan) == test_record_expected_encoding.size());
+
+    fast_ber::EncodeResult result = fast_ber::encode(absl::Span<uint8_t>(buffer), record, plan);
+    REQUIRE(result.success);
+    REQUIRE(result.length == test_record_expected_encoding.size());
+    REQUIRE(absl::MakeSpan(buffer.data(), result.length) == test_record_expected_encoding);
+}
+
+TEST_CASE("RealSchema: View")
+{
+    std::array<uint8_t, 5000> buffer = {};
+
+    fast_ber::SGSN_2009A_CDR::SGSNPDPRecord record;
+    record.recordType        = 18;
+    record.servedIMSI        = "12345";
+    record.sgsnAddress       = fast_ber::SGSN_2009A_CDR::GSNAddress{
+        fast_ber::SGSN_2009A_CDR::IPBinaryAddress{fast_ber::SGSN_2009A_CDR::IPBinaryAddress::IPBinV4Address{"abcd"}}};
+    record.chargingID        = 77;
+    record.recordOpeningTime = "24:00:00T";
+    record.duration          = 123456789012;
+    record.sgsnChange        = true;
+    record.apnSelectionMode =
+        fast_ber::SGSN_2009A_CDR::APNSelectionMode::Values::mSorNetworkProvidedSubscriptionVerified;
+    record.listOfTrafficVolumes = fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::ListOfTrafficVolumes{
+        fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition{{}, {}, 1, 2, {}, "first"},
+        fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition{{}, {}, 3, 4, {}, "second"}};
+
+    const fast_ber::SGSN_2009A_CDR::CallEventRecord event(record);
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), event);
+    REQUIRE(encode_result.success);
+
+    const fast_ber::SGSN_2009A_CDR::CallEventRecord::View view(absl::MakeSpan(buffer.data(), encode_result.length));
+    REQUIRE(view.is_valid());
+    REQUIRE(view.index() == 0);
+    REQUIRE(view.sgsnPDPRecord().has_value());
+    REQUIRE(!view.sgsnSMORecord().has_value());
+
+    const fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::View pdp = *view.sgsnPDPRecord();
+    REQUIRE(pdp.is_valid());
+    REQUIRE(pdp.recordType() == 18);
+    REQUIRE(pdp.servedIMSI() == "12345");
+    REQUIRE(!pdp.servedIMEI().has_value());
+    REQUIRE(pdp.chargingID() == 77);
+    REQUIRE(pdp.recordOpeningTime() == "24:00:00T");
+    REQUIRE(pdp.duration() == 123456789012);
+    REQUIRE(pdp.sgsnChange() == true);
+    REQUIRE(pdp.apnSelectionMode() ==
+            fast_ber::SGSN_2009A_CDR::APNSelectionMode::Values::mSorNetworkProvidedSubscriptionVerified);
+    REQUIRE(!pdp.nodeID().has_value());
+
+    REQUIRE(pdp.sgsnAddress().has_value());
+    REQUIRE(pdp.sgsnAddress()->index() == 0);
+    REQUIRE(pdp.sgsnAddress()->iPBinaryAddress()->iPBinV4Address() == absl::string_view("abcd"));
+
+    const auto traffic_volumes = pdp.listOfTrafficVolumes();
+    REQUIRE(traffic_volumes.has_value());
+    REQUIRE(traffic_volumes->size() == 2);
+
+    std::vector<int64_t>     volumes;
+    std::vector<std::string> times;
+    for (const fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition::View change : *traffic_volumes)
+    {
+        REQUIRE(change.is_valid());
+        volumes.push_back(change.dataVolumeGPRSUplink());
+        volumes.push_back(change.dataVolumeGPRSDownlink());
+        times.emplace_back(change.changeTime());
+    }
+    REQUIRE(volumes == std::vector<int64_t>{1, 2, 3, 4});
+    REQUIRE(times == std::vector<std::string>{"first", "second"});
+
+    fast_ber::SGSN_2009A_CDR::CallEventRecord decoded;
+    REQUIRE(fast_ber::decode(view.ber(), decoded).success);
+    REQUIRE(decoded == event);
+}
+
+TEST_CASE("RealSchema: Projected Decode")
+{
+    std::array<uint8_t, 5000> buffer = {};
+
+    fast_ber::SGSN_2009A_CDR::SGSNPDPRecord record;
+    record.recordType           = 18;
+    record.servedIMSI           = "12345";
+    record.servedIMEI           = "67890";
+    record.chargingID           = 77;
+    record.recordOpeningTime    = "24:00:00T";
+    record.duration             = 123456789012;
+    record.listOfTrafficVolumes = fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::ListOfTrafficVolumes{
+        fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition{{}, {}, 1, 2, {}, "first"}};
+
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), record);
+    REQUIRE(encode_result.success);
+
+    using Field = fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::Field;
+    const fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::FieldMask fields = {Field::servedIMSI, Field::chargingID,
+                                                                       Field::duration};
+    REQUIRE(fields.count() == 3);
+    REQUIRE(fields.test(Field::chargingID));
+    REQUIRE(!fields.test(Field::recordType));
+
+    fast_ber::SGSN_2009A_CDR::SGSNPDPRecord projected;
+    REQUIRE(projected.decode(fast_ber::BerView(absl::MakeSpan(buffer.data(), encode_result.length)), fields).success);
+    REQUIRE(projected.servedIMSI == "12345");
+    REQUIRE(projected.chargingID == 77);
+    REQUIRE(projected.duration == 123456789012);
+    REQUIRE(projected.recordType == 0);
+    REQUIRE(projected.recordOpeningTime == "");
+    REQUIRE(!projected.servedIMEI.has_value());
+    REQUIRE(!projected.listOfTrafficVolumes.has_value());
+
+    fast_ber::SGSN_2009A_CDR::SGSNPDPRecord full;
+    REQUIRE(full.decode(fast_ber::BerView(absl::MakeSpan(buffer.data(), encode_result.length)),
+                        fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::FieldMask::all())
+                .success);
+    REQUIRE(full == record);
+}
+
+TEST_CASE("RealSchema: Decode Into Existing")
+{
+    // Records of the same shape are decoded into one object, the storage of its members is kept
+    fast_ber::SGSN_2009A_CDR::SGSNPDPRecord first;
+    first.servedIMSI           = "12345";
+    first.chargingID           = 1;
+    first.recordOpeningTime    = "24:00:00T";
+    first.listOfTrafficVolumes = fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::ListOfTrafficVolumes{};
+    for (int i = 0; i < 8; i++)
+    {
+        first.listOfTrafficVolumes->push_back(
+            fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition{{}, {}, i, i, {}, "first"});
+    }
+
+    fast_ber::SGSN_2009A_CDR::SGSNPDPRecord second = first;
+    second.servedIMSI = "67890";
+    second.chargingID = 2;
+    second.listOfTrafficVolumes->resize(6);
+    (*second.listOfTrafficVolumes)[5].changeTime = "second";
+
+    std::array<uint8_t, 5000> first_buffer  = {};
+    std::array<uint8_t, 5000> second_buffer = {};
+    const fast_ber::SGSN_2009A_CDR::CallEventRecord first_event(first);
+    const fast_ber::SGSN_2009A_CDR::CallEventRecord second_event(second);
+    const size_t first_length  = fast_ber::encode(absl::MakeSpan(first_buffer), first_event).length;
+    const size_t second_length = fast_ber::encode(absl::MakeSpan(second_buffer), second_event).length;
+    REQUIRE(first_length > 0);
+    REQUIRE(second_length > 0);
+
+    fast_ber::SGSN_2009A_CDR::CallEventRecord event;
+    REQUIRE(fast_ber::decode(absl::MakeSpan(first_buffer.data(), first_length), event).success);
+    REQUIRE(event.index() == 0);
+    REQUIRE(fast_ber::get<0>(event) == first);
+    const fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition* const volumes =
+        fast_ber::get<0>(event).listOfTrafficVolumes->data();
+
+    REQUIRE(fast_ber::decode(absl::MakeSpan(second_buffer.data(), second_length), event).success);
+    REQUIRE(event.index() == 0);
+    REQUIRE(fast_ber::get<0>(event) == second);
+    CHECK(fast_ber::get<0>(event).listOfTrafficVolumes->data() == volumes);
+
+    REQUIRE(fast_ber::decode(absl::MakeSpan(first_buffer.data(), first_length), event).success);
+    REQUIRE(fast_ber::get<0>(event) == first);
+    CHECK(fast_ber::get<0>(event).listOfTrafficVolumes->data() == volumes);
+}
+
+TEST_CASE("RealSchema: Parallel Decode")
+{
+    // A file of records of varying lengths, each holding its index as the charging ID
+    std::vector<uint8_t> file(1000 * 1000);
+    size_t               length = 0;
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        fast_ber::SGSN_2009A_CDR::SGSNPDPRecord record = test_record;
+        record.chargingID                              = i;
+        record.listOfTrafficVolumes                    = fast_ber::SGSN_2009A_CDR::SGSNPDPRecord::ListOfTrafficVolumes(
+            static_cast<size_t>(i % 5), fast_ber::SGSN_2009A_CDR::ChangeOfCharCondition{{}, {}, i, i, {}, "time"});
+
+        const fast_ber::SGSN_2009A_CDR::CallEventRecord event(record);
+        const fast_ber::EncodeResult                    result =
+            fast_ber::encode(absl::MakeSpan(file.data() + length, file.size() - length), event);
+        REQUIRE(result.success);
+        length += result.length;
+    }
+    file.resize(length);
+
+    fast_ber::ParallelDecoder<fast_ber::SGSN_2009A_CDR::CallEventRecord> decoder(4, 10);
+
+    int64_t                              expected = 0;
+    size_t                               volumes  = 0;
+    const fast_ber::ParallelDecodeResult result =
+        decoder.decode(file, [&](const fast_ber::SGSN_2009A_CDR::CallEventRecord& event) {
+            const fast_ber::SGSN_2009A_CDR::SGSNPDPRecord& record = fast_ber::get<0>(event);
+            REQUIRE(record.chargingID == expected);
+            REQUIRE(record.listOfTrafficVolumes->size() == static_cast<size_t>(expected % 5));
+            volumes += record.listOfTrafficVolumes->size();
+            expected++;
+        });
+
+    REQUIRE(result.success);
+    REQUIRE(result.records == 1000);
+    REQUIRE(volumes == 2000);
+}
@@ -2,7 +2,9 @@
 
 #include "catch2/catch.hpp"
 
+#include <algorithm>
 #include <array>
+#include <string>
 
 TEST_CASE("Sequence: Empty")
 {
@@ -49,3 +51,90 @@ TEST_CASE("Sequence: Encode / Decode")
      REQUIRE(fast_ber::BerView(buffer).begin()->identifier() == fast_ber::RuntimeId{fast_ber::UniversalTag::sequence});
    */
 }
+
+TEST_CASE("Sequence: Members named as generated types")
+{
+    std::array<uint8_t, 100>    buffer = {};
+    fast_ber::Sequence_::Record record = {5, true, "value"};
+
+    fast_ber::Sequence_::Record::Field_     field      = record.field;
+    fast_ber::Sequence_::Record::FieldMask_ field_mask = record.fieldMask;
+    REQUIRE(field == 5);
+    REQUIRE(field_mask);
+
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), record);
+    REQUIRE(encode_result.success);
+
+    using Field                           = fast_ber::Sequence_::Record::Field;
+    fast_ber::Sequence_::Record projected = {};
+    REQUIRE(fast_ber::decode(absl::MakeSpan(buffer.data(), encode_result.length), projected, {Field::field}).success);
+    REQUIRE(projected.field == 5);
+    REQUIRE(!projected.fieldMask);
+    REQUIRE(projected.value.empty());
+}
+
+TEST_CASE("Sequence: Members named view")
+{
+    std::array<uint8_t, 100>    buffer = {};
+    fast_ber::Sequence_::Viewed viewed = {};
+    viewed.view                        = 5;
+    viewed.option                      = fast_ber::Sequence_::Viewed::Option::View_(true);
+
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), viewed);
+    REQUIRE(encode_result.success);
+
+    const fast_ber::Sequence_::Viewed::View view(absl::MakeSpan(buffer.data(), encode_result.length));
+    REQUIRE(view.is_valid());
+    REQUIRE(view.view() == 5);
+    REQUIRE(view.option().view().has_value());
+    REQUIRE(*view.option().view());
+    REQUIRE(!view.option().number().has_value());
+
+    // A choice which fails to match leaves the view empty
+    const fast_ber::EncodeResult option_result = fast_ber::encode(absl::MakeSpan(buffer), viewed.option);
+    REQUIRE(option_result.success);
+
+    fast_ber::Sequence_::Viewed::Option::View option(absl::MakeSpan(buffer.data(), option_result.length));
+    REQUIRE(option.is_valid());
+
+    const std::array<uint8_t, 3> unknown = {0x04, 0x01, 0x00};
+    REQUIRE(!option.assign(absl::MakeSpan(unknown)));
+    REQUIRE(!option.is_valid());
+    REQUIRE(!option.ber().is_valid());
+}
+
+#ifndef FAST_BER_DISABLE_ERRORS
+TEST_CASE("Sequence: Decode error path")
+{
+    std::array<uint8_t, 100>      buffer   = {};
+    fast_ber::Sequence_::Contents contents = {};
+    contents.seq.integer                   = 7;
+    contents.cho                           = fast_ber::Boolean<>(true);
+
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), contents);
+    REQUIRE(encode_result.success);
+
+    // Retag the nested integer as an octet string
+    const std::array<uint8_t, 3> integer = {0x02, 0x01, 0x07};
+    const auto                   end     = buffer.begin() + encode_result.length;
+    const auto                   found   = std::search(buffer.begin(), end, integer.begin(), integer.end());
+    REQUIRE(found != end);
+    *found = 0x04;
+
+    fast_ber::ErrorContext context;
+    fast_ber::ErrorScope   scope(context);
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(buffer.data(), encode_result.length), contents).success);
+    REQUIRE(context.code() == fast_ber::ErrorCode::incorrect_header);
+    REQUIRE(context.identifier() == fast_ber::RuntimeId(fast_ber::UniversalTag::octet_string));
+    REQUIRE(context.path_depth() == 2);
+    REQUIRE(std::string(context.path(0).member) == "integer");
+    REQUIRE(std::string(context.path(1).type) == "fast_ber::Sequence_::Contents");
+    REQUIRE(std::string(context.path(1).member) == "seq");
+    REQUIRE(context.error_count() == 1);
+
+    std::array<char, 200> description = {};
+    fast_ber::format_error(context, description.data(), description.size());
+    INFO(description.data());
+    REQUIRE(std::string(description.data()).find("at fast_ber::Sequence_::Contents.seq > ") != std::string::npos);
+}
+#endif
@@ -247,3 +247,32 @@ TEST_CASE("Set: Decode Fail - Duplicate Members")
     fast_ber::DecodeResult decode_result = fast_ber::decode(absl::MakeSpan(buffer.data(), buffer.size()), set);
     REQUIRE(!decode_result.success);
 }
+
+TEST_CASE("Set: View members in any order")
+{
+    std::array<uint8_t, 100> buffer = {};
+    fast_ber::Null<>         null;
+    fast_ber::Integer<>      integer    = 50;
+    fast_ber::UTF8String<>   utf_string = "Any order";
+
+    // Members encoded in the reverse order of definition
+    size_t length = 2;
+    length += fast_ber::encode(absl::MakeSpan(buffer).subspan(length), utf_string).length;
+    length += fast_ber::encode(absl::MakeSpan(buffer).subspan(length), integer).length;
+    length += fast_ber::encode(absl::MakeSpan(buffer).subspan(length), null).length;
+    buffer[0] = 0x31;
+    buffer[1] = static_cast<uint8_t>(length - 2);
+
+    fast_ber::Set_::Set_ set;
+    REQUIRE(fast_ber::decode(absl::MakeSpan(buffer.data(), length), set).success);
+
+    const fast_ber::Set_::Set_::View view(absl::MakeSpan(buffer.data(), length));
+    REQUIRE(view.is_valid());
+    REQUIRE(view.integer() == 50);
+    REQUIRE(view.string() == "Any order");
+    REQUIRE(!view.boolean().has_value());
+
+    // Mandatory null member missing
+    buffer[1] = static_cast<uint8_t>(length - 4);
+    REQUIRE(!fast_ber::Set_::Set_::View(absl::MakeSpan(buffer.data(), length - 2)).is_valid());
+}
@@ -2,6 +2,7 @@
 
 #include "catch2/catch.hpp"
 
+#include <iostream>
 #include <vector>
 
 TEST_CASE("SimpleCompilerOutput: Testing a generated ber container")
@@ -47,3 +48,163 @@ TEST_CASE("SimpleCompilerOutput: Testing a generated ber container")
 
     std::cout << "fast_ber::Simple::Collection: " << collection << std::endl;
 }
+
+TEST_CASE("SimpleCompilerOutput: View")
+{
+    std::array<uint8_t, 5000> buffer = {};
+
+    fast_ber::Simple::Collection collection;
+    collection.hello                 = "Hello world!";
+    collection.goodbye               = "Good bye world!";
+    collection.integer               = -5;
+    collection.boolean               = true;
+    collection.child.meaning_of_life = -42;
+    collection.optional_child = fast_ber::Simple::Child{999999999, {"The", "second", "child", std::string(2000, 'x')}};
+    collection.the_choice     = fast_ber::Simple::UnnamedChoice0::Goodbye("I chose a string!");
+
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), collection);
+    REQUIRE(encode_result.success);
+
+    const fast_ber::Simple::Collection::View view(absl::MakeSpan(buffer.data(), encode_result.length));
+    REQUIRE(view.is_valid());
+    REQUIRE(view.ber().ber_length() == encode_result.length);
+    REQUIRE(view.hello() == "Hello world!");
+    REQUIRE(view.goodbye() == "Good bye world!");
+    REQUIRE(view.integer() == -5);
+    REQUIRE(view.boolean() == true);
+
+    // Strings refer to the input buffer
+    REQUIRE(view.hello().data() > reinterpret_cast<const char*>(buffer.data()));
+    REQUIRE(view.hello().data() < reinterpret_cast<const char*>(buffer.data() + encode_result.length));
+
+    const fast_ber::Simple::Child::View child = view.child();
+    REQUIRE(child.is_valid());
+    REQUIRE(child.meaning_of_life() == int64_t(-42));
+    REQUIRE(child.list().empty());
+    REQUIRE(child.list().size() == 0);
+
+    REQUIRE(view.optional_child().has_value());
+    const fast_ber::Simple::Child::View optional_child = *view.optional_child();
+    REQUIRE(optional_child.is_valid());
+    REQUIRE(optional_child.meaning_of_life() == int64_t(999999999));
+    REQUIRE(optional_child.list().size() == 4);
+
+    std::vector<std::string> list;
+    for (absl::string_view element : optional_child.list())
+    {
+        list.emplace_back(element);
+    }
+    REQUIRE(list == std::vector<std::string>{"The", "second", "child", std::string(2000, 'x')});
+
+    const fast_ber::Simple::UnnamedChoice0::View choice = view.the_choice();
+    REQUIRE(choice.is_valid());
+    REQUIRE(choice.index() == 1);
+    REQUIRE(!choice.hello().has_value());
+    REQUIRE(choice.goodbye() == absl::string_view("I chose a string!"));
+    REQUIRE(!choice.integer().has_value());
+}
+
+
+TEST_CASE("SimpleCompilerOutput: View absent optional members")
+{
+    std::array<uint8_t, 500> buffer = {};
+
+    fast_ber::Simple::Collection collection;
+    collection.the_choice = fast_ber::Simple::UnnamedChoice0::Integer(7);
+
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), collection);
+    REQUIRE(encode_result.success);
+
+    const fast_ber::Simple::Collection::View view(absl::MakeSpan(buffer.data(), encode_result.length));
+    REQUIRE(view.is_valid());
+    REQUIRE(!view.optional_child().has_value());
+    REQUIRE(!view.child().meaning_of_life().has_value());
+    REQUIRE(view.the_choice().index() == 2);
+    REQUIRE(view.the_choice().integer() == int64_t(7));
+}
+
+
+TEST_CASE("SimpleCompilerOutput: View invalid input")
+{
+    std::array<uint8_t, 500> buffer = {};
+
+    fast_ber::Simple::Collection collection;
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), collection);
+    REQUIRE(encode_result.success);
+
+    REQUIRE(!fast_ber::Simple::Collection::View().is_valid());
+    REQUIRE(!fast_ber::Simple::Collection::View(absl::Span<const uint8_t>()).is_valid());
+    REQUIRE(!fast_ber::Simple::Collection::View(absl::MakeSpan(buffer.data(), encode_result.length - 1)).is_valid());
+
+    // Wrong identifier
+    std::vector<uint8_t> wrong_id(buffer.begin(), buffer.begin() + encode_result.length);
+    wrong_id[0] = 0x31;
+    REQUIRE(!fast_ber::Simple::Collection::View(wrong_id).is_valid());
+
+    // Mandatory integer with a zero length content
+    const std::array<uint8_t, 10> empty_integer = {0x30, 0x08, 0x80, 0x00, 0x81, 0x00, 0x82, 0x00, 0x83, 0x01};
+    REQUIRE(!fast_ber::Simple::Collection::View(empty_integer).is_valid());
+
+    // Elements after the last member of a type which is not extensible
+    const std::array<uint8_t, 8>  greetings          = {0x30, 0x06, 0x80, 0x01, 'a', 0x81, 0x01, 'b'};
+    const std::array<uint8_t, 10> trailing_greetings = {0x30, 0x08, 0x80, 0x01, 'a', 0x81, 0x01, 'b', 0x82, 0x00};
+    REQUIRE(fast_ber::Simple::Greetings::View(greetings).is_valid());
+    REQUIRE(!fast_ber::Simple::Greetings::View(trailing_greetings).is_valid());
+
+    // A view can be reassigned
+    fast_ber::Simple::Collection::View view;
+    REQUIRE(view.assign(absl::MakeSpan(buffer.data(), encode_result.length)));
+    REQUIRE(view.is_valid());
+    REQUIRE(!view.assign(wrong_id));
+    REQUIRE(!view.is_valid());
+}
+
+TEST_CASE("SimpleCompilerOutput: Projected decode")
+{
+    std::array<uint8_t, 5000> buffer = {};
+
+    fast_ber::Simple::Collection collection;
+    collection.hello          = "Hello world!";
+    collection.goodbye        = "Good bye world!";
+    collection.integer        = 5;
+    collection.boolean        = true;
+    collection.optional_child = fast_ber::Simple::Child{999999999, {"The", "second", "child"}};
+    collection.the_choice     = fast_ber::Simple::UnnamedChoice0::Goodbye("I chose a string!");
+
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), collection);
+    REQUIRE(encode_result.success);
+    const absl::Span<const uint8_t> encoded = absl::MakeSpan(buffer.data(), encode_result.length);
+
+    // Members which are not selected are left empty, even if they held a value before decoding
+    fast_ber::Simple::Collection projected = collection;
+    projected.integer                      = 100;
+
+    using Field = fast_ber::Simple::Collection::Field;
+    REQUIRE(fast_ber::decode(encoded, projected, {Field::hello, Field::the_choice}).success);
+    REQUIRE(projected.hello == "Hello world!");
+    REQUIRE(fast_ber::get<1>(projected.the_choice) == "I chose a string!");
+    REQUIRE(projected.goodbye == "");
+    REQUIRE(projected.integer == 0);
+    REQUIRE(projected.boolean == false);
+    REQUIRE(!projected.child.meaning_of_life.has_value());
+    REQUIRE(!projected.optional_child.has_value());
+
+    fast_ber::Simple::Collection all;
+    REQUIRE(fast_ber::decode(encoded, all, fast_ber::Simple::Collection::FieldMask::all()).success);
+    REQUIRE(all == collection);
+
+    fast_ber::Simple::Collection none;
+    REQUIRE(fast_ber::decode(encoded, none, fast_ber::Simple::Collection::FieldMask{}).success);
+    REQUIRE(none == fast_ber::Simple::Collection{});
+
+    // Skipped members must still be present
+    REQUIRE(!fast_ber::decode(encoded.subspan(0, encoded.size() - 1), none, {Field::hello}).success);
+
+    // Skipped members must have the identifier of the member
+    std::vector<uint8_t> wrong_member(encoded.begin(), encoded.end());
+    auto                 goodbye = fast_ber::BerView(absl::MakeSpan(wrong_member)).begin();
+    ++goodbye;
+    wrong_member[goodbye->ber_data() - wrong_member.data()] = 0x83;
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(wrong_member), none).success);
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(wrong_member), none, {Field::hello}).success);
+}
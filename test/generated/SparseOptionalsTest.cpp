@@ -0,0 +1,76 @@
+#include "autogen/sparse_optionals.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <vector>
+
+// Large absent members cost a pointer, small members such as BOOLEAN stay in place
+static_assert(sizeof(fast_ber::SparseOptionals::Record::name) == sizeof(void*), "Out of line string");
+static_assert(sizeof(fast_ber::SparseOptionals::Record::location) == sizeof(void*), "Out of line sequence");
+static_assert(sizeof(fast_ber::SparseOptionals::Record::notes) == sizeof(void*), "Out of line list");
+static_assert(sizeof(fast_ber::SparseOptionals::Record::flag) ==
+                  sizeof(absl::optional<fast_ber::SparseOptionals::Record::Flag>),
+              "Inline boolean");
+
+namespace
+{
+fast_ber::SparseOptionals::Record make_record()
+{
+    fast_ber::SparseOptionals::Record record;
+    record.record_id = 7;
+    record.name      = "sparse";
+    record.location  = fast_ber::SparseOptionals::Location{51, -1, fast_ber::UTF8String<>("home")};
+    record.notes     = fast_ber::SparseOptionals::Record::Notes{"first", "second"};
+    return record;
+}
+} // namespace
+
+TEST_CASE("SparseOptionals: Encode and decode")
+{
+    const fast_ber::SparseOptionals::Record record = make_record();
+    fast_ber::SparseOptionals::Record       copy;
+
+    std::vector<uint8_t>   buffer(500, 0);
+    fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), record);
+    REQUIRE(encode_result.success);
+    REQUIRE(encode_result.length == fast_ber::encoded_length(record));
+    REQUIRE(fast_ber::decode(absl::MakeSpan(buffer.data(), encode_result.length), copy).success);
+
+    REQUIRE(copy == record);
+    REQUIRE(copy.name == "sparse");
+    REQUIRE(!copy.flag);
+    REQUIRE(copy.location->label == "home");
+    REQUIRE(copy.notes->size() == 2);
+}
+
+TEST_CASE("SparseOptionals: Copy and reset")
+{
+    fast_ber::SparseOptionals::Record record = make_record();
+    fast_ber::SparseOptionals::Record copy   = record;
+    REQUIRE(copy == record);
+    REQUIRE(&*copy.name != &*record.name);
+
+    record.name = fast_ber::empty;
+    REQUIRE(!record.name);
+    REQUIRE(copy.name == "sparse");
+
+    record = copy;
+    REQUIRE(record.name == "sparse");
+}
+
+TEST_CASE("SparseOptionals: Decode into an arena")
+{
+    std::vector<uint8_t>   buffer(500, 0);
+    fast_ber::EncodeResult encode_result = fast_ber::encode(absl::MakeSpan(buffer), make_record());
+    REQUIRE(encode_result.success);
+
+    fast_ber::Arena arena;
+    {
+        fast_ber::ArenaScope              scope(arena);
+        fast_ber::SparseOptionals::Record copy;
+        REQUIRE(fast_ber::decode(absl::MakeSpan(buffer.data(), encode_result.length), copy).success);
+        REQUIRE(copy == make_record());
+        REQUIRE(arena.bytes_allocated() > 0);
+    }
+    arena.reset();
+}
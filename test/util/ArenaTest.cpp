@@ -0,0 +1,177 @@
+#include "fast_ber/util/Arena.hpp"
+#include "fast_ber/util/DynamicOptional.hpp"
+#include "fast_ber/util/DynamicVariant.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+TEST_CASE("Arena: Allocate")
+{
+    fast_ber::Arena arena(256);
+
+    void* const a = arena.allocate(10, 1);
+    void* const b = arena.allocate(sizeof(uint64_t), alignof(uint64_t));
+
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(a != b);
+    REQUIRE(reinterpret_cast<uintptr_t>(b) % alignof(uint64_t) == 0);
+    REQUIRE(arena.bytes_allocated() == 10 + sizeof(uint64_t));
+    REQUIRE(arena.capacity() == 256);
+}
+
+TEST_CASE("Arena: Growth")
+{
+    fast_ber::Arena arena(256);
+
+    arena.allocate(200, 1);
+    arena.allocate(200, 1);
+    REQUIRE(arena.capacity() == 256 + 512);
+
+    // Allocations larger than a block get a block of their own
+    arena.allocate(4096, 1);
+    REQUIRE(arena.capacity() >= 256 + 512 + 4096);
+}
+
+TEST_CASE("Arena: Reset reuses blocks")
+{
+    fast_ber::Arena arena(256);
+
+    void* const first = arena.allocate(100, 1);
+    arena.allocate(1000, 1);
+    const size_t capacity = arena.capacity();
+
+    arena.reset();
+    REQUIRE(arena.bytes_allocated() == 0);
+    REQUIRE(arena.allocate(100, 1) == first);
+    arena.allocate(1000, 1);
+    REQUIRE(arena.capacity() == capacity);
+}
+
+TEST_CASE("Arena: Scope")
+{
+    fast_ber::Arena outer;
+    fast_ber::Arena inner;
+
+    REQUIRE(fast_ber::Arena::current() == nullptr);
+    {
+        fast_ber::ArenaScope outer_scope(outer);
+        REQUIRE(fast_ber::Arena::current() == &outer);
+        {
+            fast_ber::ArenaScope inner_scope(inner);
+            REQUIRE(fast_ber::Arena::current() == &inner);
+        }
+        REQUIRE(fast_ber::Arena::current() == &outer);
+    }
+    REQUIRE(fast_ber::Arena::current() == nullptr);
+}
+
+TEST_CASE("Arena: Allocator")
+{
+    using ArenaVector = std::vector<std::string, fast_ber::ArenaAllocator<std::string>>;
+
+    fast_ber::Arena arena;
+    {
+        fast_ber::ArenaScope scope(arena);
+        ArenaVector          strings;
+        for (int i = 0; i < 100; i++)
+        {
+            strings.push_back(std::string(50, 'a'));
+        }
+
+        REQUIRE(strings.get_allocator().arena() == &arena);
+        REQUIRE(arena.bytes_allocated() >= 100 * sizeof(std::string));
+
+        // A copy takes the arena current where it is made
+        fast_ber::Arena      other;
+        fast_ber::ArenaScope other_scope(other);
+        const ArenaVector    copy = strings;
+        REQUIRE(copy.get_allocator().arena() == &other);
+        REQUIRE(copy == strings);
+    }
+
+    // Without an arena the heap is used
+    ArenaVector heap(10, "heap");
+    REQUIRE(heap.get_allocator().arena() == nullptr);
+}
+
+TEST_CASE("Arena: Allocator propagation")
+{
+    using ArenaVector = std::vector<std::string, fast_ber::ArenaAllocator<std::string>>;
+
+    fast_ber::Arena first;
+    fast_ber::Arena second;
+    ArenaVector     first_strings{fast_ber::ArenaAllocator<std::string>(&first)};
+    ArenaVector     second_strings{fast_ber::ArenaAllocator<std::string>(&second)};
+    first_strings.assign(10, std::string(50, 'a'));
+    second_strings.assign(20, std::string(50, 'b'));
+
+    // Swapped containers take the arena of their elements
+    std::swap(first_strings, second_strings);
+    REQUIRE(first_strings.get_allocator().arena() == &second);
+    REQUIRE(second_strings.get_allocator().arena() == &first);
+    REQUIRE(first_strings == ArenaVector(20, std::string(50, 'b')));
+    REQUIRE(second_strings == ArenaVector(10, std::string(50, 'a')));
+
+    // As do containers they are moved to
+    ArenaVector heap_strings{fast_ber::ArenaAllocator<std::string>(nullptr)};
+    heap_strings = std::move(first_strings);
+    REQUIRE(heap_strings.get_allocator().arena() == &second);
+    REQUIRE(heap_strings.size() == 20);
+
+    // And containers they are copied to
+    heap_strings = second_strings;
+    REQUIRE(heap_strings.get_allocator().arena() == &first);
+    REQUIRE(heap_strings == second_strings);
+}
+
+TEST_CASE("Arena: Dynamic optional")
+{
+    using ArenaOptional = fast_ber::DynamicOptional<std::string, fast_ber::ArenaAllocation>;
+
+    fast_ber::Arena arena;
+    ArenaOptional   heap_value("heap");
+    {
+        fast_ber::ArenaScope scope(arena);
+        ArenaOptional        arena_value("arena");
+
+        REQUIRE(arena.bytes_allocated() > 0);
+        REQUIRE(*arena_value == "arena");
+
+        // Values created before the arena was made current are released to the heap
+        heap_value = ArenaOptional("replaced");
+        REQUIRE(*heap_value == "replaced");
+    }
+
+    REQUIRE(heap_value.has_value());
+    heap_value = fast_ber::empty;
+    REQUIRE(!heap_value.has_value());
+}
+
+TEST_CASE("Arena: Variant")
+{
+    using Variant = fast_ber::dynamic::ArenaVariant<int, std::string>;
+
+    fast_ber::Arena arena;
+    {
+        fast_ber::ArenaScope scope(arena);
+        Variant              variant(std::string("arena"));
+
+        REQUIRE(variant.index() == 1);
+        REQUIRE(fast_ber::dynamic::get<1>(variant) == "arena");
+        REQUIRE(arena.bytes_allocated() > 0);
+
+        variant = 5;
+        REQUIRE(variant.index() == 0);
+        REQUIRE(fast_ber::dynamic::get<0>(variant) == 5);
+
+        const Variant copy = variant;
+        REQUIRE(copy == variant);
+    }
+
+    Variant heap(std::string("heap"));
+    REQUIRE(fast_ber::dynamic::get<1>(heap) == "heap");
+}
@@ -0,0 +1,170 @@
+#include "fast_ber/util/BerFramer.hpp"
+#include "fast_ber/util/BerView.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+// Three records: short form, long form length, and a multi byte tag
+const std::vector<uint8_t> framer_records = [] {
+    std::vector<uint8_t> records = {0x30, 0x03, 0x80, 0x01, 0x05};
+    records.insert(records.end(), {0x30, 0x81, 0x82, 0x04, 0x81, 0x7f});
+    records.insert(records.end(), 0x7f, 0xAB);
+    records.insert(records.end(), {0xBF, 0x81, 0x48, 0x02, 0x05, 0x00});
+    return records;
+}();
+
+const std::vector<size_t> framer_record_lengths = {5, 133, 6};
+
+// Push the records in chunks of the given size, collecting the produced PDUs
+std::vector<std::vector<uint8_t>> frame_in_chunks(fast_ber::BerFramer& framer, const std::vector<uint8_t>& input,
+                                                  size_t chunk_size)
+{
+    std::vector<std::vector<uint8_t>> pdus;
+    fast_ber::BerView                 pdu;
+    for (size_t offset = 0; offset < input.size(); offset += chunk_size)
+    {
+        framer.push(absl::MakeSpan(input.data() + offset, std::min(chunk_size, input.size() - offset)));
+
+        fast_ber::FrameStatus status;
+        while ((status = framer.next(pdu)) == fast_ber::FrameStatus::ready)
+        {
+            REQUIRE(pdu.is_valid());
+            pdus.emplace_back(pdu.ber().begin(), pdu.ber().end());
+        }
+        REQUIRE(status == fast_ber::FrameStatus::need_more);
+    }
+    return pdus;
+}
+
+TEST_CASE("BerFramer: Single chunk is not copied")
+{
+    fast_ber::BerFramer framer;
+    fast_ber::BerView   pdu;
+
+    framer.push(framer_records);
+    size_t offset = 0;
+    for (size_t length : framer_record_lengths)
+    {
+        REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::ready);
+        REQUIRE(pdu.ber_data() == framer_records.data() + offset);
+        REQUIRE(pdu.ber_length() == length);
+        offset += length;
+    }
+    REQUIRE(pdu.tag() == 200);
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::need_more);
+    REQUIRE(framer.buffered() == 0);
+    REQUIRE(framer.bytes_needed() == 2);
+}
+
+TEST_CASE("BerFramer: Any chunk size")
+{
+    for (size_t chunk_size = 1; chunk_size <= framer_records.size(); chunk_size++)
+    {
+        fast_ber::BerFramer                     framer;
+        const std::vector<std::vector<uint8_t>> pdus = frame_in_chunks(framer, framer_records, chunk_size);
+
+        REQUIRE(pdus.size() == framer_record_lengths.size());
+        size_t offset = 0;
+        for (size_t i = 0; i < pdus.size(); i++)
+        {
+            REQUIRE(pdus[i] == std::vector<uint8_t>(framer_records.begin() + offset,
+                                                    framer_records.begin() + offset + framer_record_lengths[i]));
+            offset += framer_record_lengths[i];
+        }
+        REQUIRE(framer.buffered() == 0);
+    }
+}
+
+TEST_CASE("BerFramer: Bytes needed")
+{
+    fast_ber::BerFramer framer;
+    fast_ber::BerView   pdu;
+
+    // Identifier only, the length is unknown
+    framer.push(absl::MakeSpan(framer_records.data() + 5, 1));
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::need_more);
+    REQUIRE(framer.bytes_needed() == 1);
+
+    // Long form length, one length octet missing
+    framer.push(absl::MakeSpan(framer_records.data() + 6, 1));
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::need_more);
+    REQUIRE(framer.bytes_needed() == 1);
+
+    // Header complete, the remainder of the content is needed
+    framer.push(absl::MakeSpan(framer_records.data() + 7, 11));
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::need_more);
+    REQUIRE(framer.bytes_needed() == 120);
+    REQUIRE(framer.buffered() == 13);
+
+    framer.push(absl::MakeSpan(framer_records.data() + 18, 120));
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::ready);
+    REQUIRE(pdu.ber_length() == 133);
+    REQUIRE(pdu.content_length() == 130);
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::need_more);
+    REQUIRE(framer.bytes_needed() == 2);
+
+    // Multi byte tag
+    framer.push(absl::MakeSpan(framer_records.data() + 138, 2));
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::need_more);
+    REQUIRE(framer.bytes_needed() == 2);
+}
+
+TEST_CASE("BerFramer: Push before draining")
+{
+    fast_ber::BerFramer framer;
+    fast_ber::BerView   pdu;
+
+    // Unframed data from the first chunk is kept when the second chunk is pushed
+    framer.push(absl::MakeSpan(framer_records.data(), 10));
+    framer.push(absl::MakeSpan(framer_records.data() + 10, framer_records.size() - 10));
+
+    size_t count = 0;
+    while (framer.next(pdu) == fast_ber::FrameStatus::ready)
+    {
+        REQUIRE(pdu.ber_length() == framer_record_lengths[count++]);
+    }
+    REQUIRE(count == framer_record_lengths.size());
+    REQUIRE(framer.buffered() == 0);
+}
+
+TEST_CASE("BerFramer: Truncated stream")
+{
+    fast_ber::BerFramer                     framer;
+    const std::vector<uint8_t>              truncated(framer_records.begin(), framer_records.end() - 1);
+    const std::vector<std::vector<uint8_t>> pdus = frame_in_chunks(framer, truncated, 7);
+
+    REQUIRE(pdus.size() == 2);
+    REQUIRE(framer.buffered() == 5);
+    REQUIRE(framer.bytes_needed() == 1);
+}
+
+TEST_CASE("BerFramer: Malformed stream")
+{
+    fast_ber::BerFramer framer(100);
+    fast_ber::BerView   pdu;
+
+    // Longer than the maximum PDU length
+    framer.push(framer_records);
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::ready);
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::error);
+    REQUIRE(framer.has_error());
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::error);
+
+    // Indefinite length
+    framer.reset();
+    REQUIRE(!framer.has_error());
+    const std::vector<uint8_t> indefinite = {0x30, 0x80, 0x00, 0x00};
+    framer.push(indefinite);
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::error);
+
+    // Length of more than 8 octets
+    framer.reset();
+    const std::vector<uint8_t> long_length = {0x30, 0x89, 0x01};
+    framer.push(long_length);
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::error);
+
+    framer.reset();
+    framer.push(absl::MakeSpan(framer_records.data(), 5));
+    REQUIRE(framer.next(pdu) == fast_ber::FrameStatus::ready);
+}
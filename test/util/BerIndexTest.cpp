@@ -0,0 +1,163 @@
+#include "fast_ber/ber_types/All.hpp"
+#include "fast_ber/util/BerIndex.hpp"
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <sstream>
+#include <vector>
+
+const static std::array<uint8_t, 31> index_sample_packet = {
+    0x30, 0x1d, 0x80, 0x06, 0x46, 0x61, 0x6c, 0x63, 0x6f, 0x6e, 0x82, 0x01, 0x00, 0xa3, 0x04, 0x80,
+    0x02, 0x46, 0x50, 0xa4, 0x0a, 0x0c, 0x03, 0x43, 0x61, 0x72, 0x0c, 0x03, 0x47, 0x50, 0x53};
+
+void require_same_structure(const fast_ber::BerIndex& index, size_t node_index, fast_ber::BerView view)
+{
+    const fast_ber::BerIndexNode& node       = index.node(node_index);
+    const fast_ber::BerView       index_view = index.view(node_index);
+
+    REQUIRE(index_view.is_valid());
+    REQUIRE(index_view.ber() == view.ber());
+    REQUIRE(index_view.content() == view.content());
+    REQUIRE(index_view.identifier() == view.identifier());
+    REQUIRE(index_view.construction() == view.construction());
+    REQUIRE(index.content(node_index) == view.content());
+
+    if (view.construction() == fast_ber::Construction::primitive)
+    {
+        REQUIRE(node.child_count == 0);
+        return;
+    }
+
+    size_t child_count = 0;
+    for (const fast_ber::BerView& child : view)
+    {
+        const size_t child_index = index.child(node_index, child_count);
+        REQUIRE(child_index != fast_ber::ber_index_npos);
+        require_same_structure(index, child_index, child);
+        child_count++;
+    }
+    REQUIRE(node.child_count == child_count);
+    REQUIRE(index.child(node_index, child_count) == fast_ber::ber_index_npos);
+}
+
+TEST_CASE("BerIndex: Sample data")
+{
+    fast_ber::BerIndex index;
+    REQUIRE(index.build(index_sample_packet));
+    REQUIRE(index.is_valid());
+    REQUIRE(index.size() == 8);
+
+    const fast_ber::BerIndexNode& root = index.root();
+    REQUIRE(root.offset == 0);
+    REQUIRE(root.header_length == 2);
+    REQUIRE(root.content_length == 0x1d);
+    REQUIRE(root.tag == 16);
+    REQUIRE(root.class_() == fast_ber::Class::universal);
+    REQUIRE(root.construction() == fast_ber::Construction::constructed);
+    REQUIRE(root.first_child == 1);
+    REQUIRE(root.child_count == 4);
+    REQUIRE(root.next_sibling == fast_ber::ber_index_npos);
+
+    // Siblings are linked, and contiguous
+    REQUIRE(index.node(1).next_sibling == 2);
+    REQUIRE(index.node(2).next_sibling == 3);
+    REQUIRE(index.node(3).next_sibling == 4);
+    REQUIRE(index.node(4).next_sibling == fast_ber::ber_index_npos);
+    REQUIRE(index.node(1).first_child == fast_ber::ber_index_npos);
+
+    // Grandchildren follow all of the children
+    REQUIRE(index.node(3).first_child == 5);
+    REQUIRE(index.node(4).first_child == 6);
+    REQUIRE(index.node(4).child_count == 2);
+    REQUIRE(index.child(4, 1) == 7);
+    REQUIRE(index.node(7).offset == 26);
+    REQUIRE(index.node(7).tag == 12);
+
+    require_same_structure(index, 0, fast_ber::BerView(index_sample_packet));
+}
+
+TEST_CASE("BerIndex: Output matches BerView")
+{
+    std::stringstream view_stream;
+    std::stringstream index_stream;
+
+    view_stream << fast_ber::BerView(index_sample_packet);
+    index_stream << fast_ber::BerIndex(index_sample_packet);
+
+    REQUIRE(index_stream.str() == view_stream.str());
+}
+
+TEST_CASE("BerIndex: Decode from index")
+{
+    fast_ber::BerIndex index(index_sample_packet);
+    REQUIRE(index.is_valid());
+
+    fast_ber::UTF8String<> string;
+    REQUIRE(fast_ber::decode(index, index.child(4, 1), string).success);
+    REQUIRE(string == "GPS");
+
+    fast_ber::OctetString<fast_ber::Id<fast_ber::Class::context_specific, 0>> name;
+    REQUIRE(fast_ber::decode(index, 1, name).success);
+    REQUIRE(name == "Falcon");
+}
+
+TEST_CASE("BerIndex: Long form headers")
+{
+    // Tag 200, content of 300 bytes containing a single octet string of 296 bytes
+    std::vector<uint8_t> packet = {0xBF, 0x81, 0x48, 0x82, 0x01, 0x2C, 0x04, 0x82, 0x01, 0x28};
+    packet.resize(packet.size() + 296, 0xAB);
+
+    fast_ber::BerIndex index(packet);
+    REQUIRE(index.is_valid());
+    REQUIRE(index.size() == 2);
+    REQUIRE(index.root().tag == 200);
+    REQUIRE(index.root().header_length == 6);
+    REQUIRE(index.root().content_length == 300);
+    REQUIRE(index.node(1).offset == 6);
+    REQUIRE(index.node(1).header_length == 4);
+    REQUIRE(index.node(1).content_length == 296);
+
+    require_same_structure(index, 0, fast_ber::BerView(packet));
+}
+
+TEST_CASE("BerIndex: Trailing data is ignored")
+{
+    std::vector<uint8_t> packet(index_sample_packet.begin(), index_sample_packet.end());
+    packet.push_back(0x00);
+    packet.push_back(0x00);
+
+    fast_ber::BerIndex index(packet);
+    REQUIRE(index.is_valid());
+    REQUIRE(index.size() == 8);
+    REQUIRE(index.root().ber_length() == index_sample_packet.size());
+}
+
+TEST_CASE("BerIndex: Malformed input")
+{
+    fast_ber::BerIndex index;
+
+    REQUIRE(!index.build(absl::Span<const uint8_t>()));
+    REQUIRE(!index.is_valid());
+
+    // Truncated
+    REQUIRE(!index.build(absl::MakeSpan(index_sample_packet.data(), index_sample_packet.size() - 1)));
+    REQUIRE(!index.is_valid());
+    REQUIRE(index.size() == 0);
+
+    // Child longer than its parent's content
+    std::vector<uint8_t> packet(index_sample_packet.begin(), index_sample_packet.end());
+    packet[20] = 0x0b;
+    REQUIRE(!index.build(packet));
+
+    // Children do not fill parent's content
+    packet[20] = 0x0a;
+    packet[22] = 0x02;
+    REQUIRE(!index.build(packet));
+
+    // Index can be reused after failure
+    REQUIRE(index.build(index_sample_packet));
+    REQUIRE(index.size() == 8);
+}
@@ -3,6 +3,7 @@
 #include <catch2/catch.hpp>
 
 #include <array>
+#include <iostream>
 #include <sstream>
 
 const static std::array<uint8_t, 31> sample_packet = {0x30, 0x1d, 0x80, 0x06, 0x46, 0x61, 0x6c, 0x63, 0x6f, 0x6e, 0x82,
@@ -0,0 +1,121 @@
+#include "fast_ber/util/Counters.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Entry of a type and member in the snapshot, calls is zero if not present
+fast_ber::CounterEntry find_entry(fast_ber::CounterOperation operation, const char* type, const char* member)
+{
+    for (const fast_ber::CounterEntry& entry : fast_ber::counter_snapshot())
+    {
+        if (entry.operation == operation && std::strcmp(entry.type, type) == 0 &&
+            ((entry.member == nullptr && member == nullptr) ||
+             (entry.member != nullptr && member != nullptr && std::strcmp(entry.member, member) == 0)))
+        {
+            return entry;
+        }
+    }
+    return fast_ber::CounterEntry{operation, type, member, {}};
+}
+} // namespace
+
+TEST_CASE("Counters: Sites count calls, bytes and failures")
+{
+    static const fast_ber::CounterSite site(fast_ber::CounterOperation::decode, "CountersTest.Record", nullptr);
+    static const fast_ber::CounterSite member(fast_ber::CounterOperation::decode, "CountersTest.Record", "value");
+
+    fast_ber::count(site, 10, true);
+    fast_ber::count(site, 5, false);
+    fast_ber::count(member, 3, true);
+
+    const fast_ber::CounterEntry entry = find_entry(fast_ber::CounterOperation::decode, "CountersTest.Record", nullptr);
+    REQUIRE(entry.values.calls == 2);
+    REQUIRE(entry.values.bytes == 15);
+    REQUIRE(entry.values.failures == 1);
+
+    const fast_ber::CounterEntry member_entry =
+        find_entry(fast_ber::CounterOperation::decode, "CountersTest.Record", "value");
+    REQUIRE(member_entry.values.calls == 1);
+    REQUIRE(member_entry.values.bytes == 3);
+
+    // Encodes of the same type are a separate entry
+    REQUIRE(find_entry(fast_ber::CounterOperation::encode, "CountersTest.Record", nullptr).values.calls == 0);
+}
+
+TEST_CASE("Counters: Sites with the same names are merged")
+{
+    static const fast_ber::CounterSite first(fast_ber::CounterOperation::encode, "CountersTest.Merged", nullptr);
+    static const fast_ber::CounterSite second(fast_ber::CounterOperation::encode, "CountersTest.Merged", nullptr);
+    REQUIRE(first.id() != second.id());
+
+    fast_ber::count(first, 1, true);
+    fast_ber::count(second, 2, true);
+
+    const fast_ber::CounterEntry entry = find_entry(fast_ber::CounterOperation::encode, "CountersTest.Merged", nullptr);
+    REQUIRE(entry.values.calls == 2);
+    REQUIRE(entry.values.bytes == 3);
+}
+
+TEST_CASE("Counters: Counts of exited threads are kept")
+{
+    static const fast_ber::CounterSite site(fast_ber::CounterOperation::decode, "CountersTest.Threads", nullptr);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([] {
+            for (int j = 0; j < 1000; j++)
+            {
+                fast_ber::count(site, 1, true);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    fast_ber::count(site, 1, true);
+
+    const fast_ber::CounterEntry entry =
+        find_entry(fast_ber::CounterOperation::decode, "CountersTest.Threads", nullptr);
+    REQUIRE(entry.values.calls == 4001);
+    REQUIRE(entry.values.bytes == 4001);
+}
+
+TEST_CASE("Counters: Snapshot is ordered by operation, type and member")
+{
+    static const fast_ber::CounterSite b(fast_ber::CounterOperation::decode, "CountersTest.Order", "b");
+    static const fast_ber::CounterSite a(fast_ber::CounterOperation::decode, "CountersTest.Order", "a");
+    static const fast_ber::CounterSite type(fast_ber::CounterOperation::decode, "CountersTest.Order", nullptr);
+    fast_ber::count(b, 1, true);
+    fast_ber::count(a, 1, true);
+    fast_ber::count(type, 1, true);
+
+    const std::vector<fast_ber::CounterEntry> snapshot = fast_ber::counter_snapshot();
+    for (size_t i = 1; i < snapshot.size(); i++)
+    {
+        REQUIRE(fast_ber::detail::compare_entries(snapshot[i - 1], snapshot[i]) < 0);
+    }
+}
+
+#ifndef FAST_BER_ENABLE_COUNTERS
+TEST_CASE("Counters: Disabled hooks leave the result unchanged")
+{
+    FAST_BER_COUNTER(counter, decode, "CountersTest.Disabled", nullptr);
+    FAST_BER_COUNT(counter, 1, true);
+
+    const fast_ber::EncodeResult encoded = FAST_BER_COUNT_ENCODED(counter, fast_ber::EncodeResult{true, 7});
+    const fast_ber::DecodeResult decoded = FAST_BER_COUNT_DECODED(counter, 7, fast_ber::DecodeResult{false});
+    REQUIRE(encoded.success);
+    REQUIRE(encoded.length == 7);
+    REQUIRE(!decoded.success);
+    REQUIRE(find_entry(fast_ber::CounterOperation::decode, "CountersTest.Disabled", nullptr).values.calls == 0);
+}
+#endif
@@ -0,0 +1,98 @@
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/ber_types/OctetString.hpp"
+#include "fast_ber/util/DecodeBatch.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+// Each PDU is held in a separate buffer, as if received as separate messages
+std::vector<std::vector<uint8_t>> octet_string_pdus(size_t count)
+{
+    std::vector<std::vector<uint8_t>> pdus;
+    for (size_t i = 0; i < count; i++)
+    {
+        std::vector<uint8_t>         pdu(200);
+        const fast_ber::EncodeResult res =
+            fast_ber::encode(absl::MakeSpan(pdu), fast_ber::OctetString<>(std::string(i % 150, 'a' + i % 26)));
+        REQUIRE(res.success);
+        pdu.resize(res.length);
+        pdus.push_back(pdu);
+    }
+    return pdus;
+}
+
+TEST_CASE("DecodeBatch: Decode spans")
+{
+    const std::vector<std::vector<uint8_t>> pdus = octet_string_pdus(103);
+    std::vector<absl::Span<const uint8_t>>  inputs(pdus.begin(), pdus.end());
+
+    std::vector<fast_ber::OctetString<>> outputs;
+    fast_ber::BatchDecodeResult          result = fast_ber::decode_batch(inputs, outputs);
+    REQUIRE(result.success);
+    REQUIRE(result.decoded == 103);
+    REQUIRE(outputs.size() == 103);
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        REQUIRE(outputs[i] == std::string(i % 150, 'a' + i % 26));
+    }
+
+    // Outputs are reused, and not shrunk for a smaller batch
+    inputs.erase(inputs.begin(), inputs.begin() + 50);
+    result = fast_ber::decode_batch(inputs, outputs);
+    REQUIRE(result.success);
+    REQUIRE(result.decoded == 53);
+    REQUIRE(outputs.size() == 103);
+    REQUIRE(outputs[0] == std::string(50, 'a' + 50 % 26));
+    REQUIRE(outputs[52] == std::string(102, 'a' + 102 % 26));
+
+    // Fixed size output
+    std::array<fast_ber::OctetString<>, 53> fixed_outputs;
+    REQUIRE(fast_ber::decode_batch(inputs, absl::MakeSpan(fixed_outputs)).decoded == 53);
+    REQUIRE(fixed_outputs[1] == outputs[1]);
+
+    // Too few outputs, PDUs without an output are not decoded
+    std::array<fast_ber::OctetString<>, 10> short_outputs;
+    result = fast_ber::decode_batch(inputs, absl::MakeSpan(short_outputs));
+    REQUIRE(!result.success);
+    REQUIRE(result.decoded == 10);
+    REQUIRE(short_outputs[9] == outputs[9]);
+}
+
+TEST_CASE("DecodeBatch: Decode views")
+{
+    const std::vector<std::vector<uint8_t>> pdus = octet_string_pdus(10);
+    std::vector<fast_ber::BerView>          inputs;
+    for (const std::vector<uint8_t>& pdu : pdus)
+    {
+        inputs.emplace_back(pdu);
+    }
+
+    std::vector<fast_ber::OctetString<>> outputs;
+    REQUIRE(fast_ber::decode_batch(inputs, outputs).decoded == 10);
+    REQUIRE(outputs[9] == std::string(9, 'j'));
+}
+
+TEST_CASE("DecodeBatch: Decoding stops at failure")
+{
+    const std::vector<std::vector<uint8_t>> pdus = octet_string_pdus(20);
+    std::vector<absl::Span<const uint8_t>>  inputs(pdus.begin(), pdus.end());
+
+    const std::vector<uint8_t> integer = {0x02, 0x01, 0x05};
+    inputs[13]                         = integer;
+
+    std::vector<fast_ber::OctetString<>> outputs;
+    const fast_ber::BatchDecodeResult    result = fast_ber::decode_batch(inputs, outputs);
+    REQUIRE(!result.success);
+    REQUIRE(result.decoded == 13);
+    REQUIRE(outputs[12] == std::string(12, 'm'));
+
+    std::vector<fast_ber::Integer<>> integers;
+    REQUIRE(fast_ber::decode_batch(absl::MakeSpan(inputs.data() + 13, 1), integers).success);
+    REQUIRE(integers[0] == 5);
+
+    REQUIRE(fast_ber::decode_batch(absl::Span<const absl::Span<const uint8_t>>(), integers).decoded == 0);
+}
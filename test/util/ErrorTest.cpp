@@ -0,0 +1,169 @@
+#include "fast_ber/ber_types/Boolean.hpp"
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/util/Error.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+int sink_calls = 0;
+
+void counting_sink(const fast_ber::ErrorContext&) noexcept { sink_calls++; }
+} // namespace
+
+TEST_CASE("Error: Report records code, type and identifier")
+{
+    fast_ber::ErrorContext context;
+    fast_ber::ErrorScope   scope(context);
+
+    fast_ber::report_error(fast_ber::ErrorCode::incorrect_header, "Record",
+                           fast_ber::RuntimeId(fast_ber::Class::context_specific, 5));
+
+    REQUIRE(context.code() == fast_ber::ErrorCode::incorrect_header);
+    REQUIRE(std::string(context.type()) == "Record");
+    REQUIRE(context.has_identifier());
+    REQUIRE(context.identifier() == fast_ber::RuntimeId(fast_ber::Class::context_specific, 5));
+    REQUIRE(context.path_depth() == 0);
+    REQUIRE(context.error_count() == 1);
+
+    fast_ber::report_error(fast_ber::ErrorCode::invalid_packet, "Record");
+    REQUIRE(context.code() == fast_ber::ErrorCode::invalid_packet);
+    REQUIRE(!context.has_identifier());
+    REQUIRE(context.error_count() == 2);
+}
+
+TEST_CASE("Error: Member failures extend the path")
+{
+    fast_ber::ErrorContext context;
+    fast_ber::ErrorScope   scope(context);
+
+    fast_ber::report_error(fast_ber::ErrorCode::missing_member, "Inner", "flag");
+    fast_ber::report_error(fast_ber::ErrorCode::member_failed, "Middle", "inner");
+    fast_ber::report_error(fast_ber::ErrorCode::member_failed, "Outer", "middle");
+
+    REQUIRE(context.code() == fast_ber::ErrorCode::missing_member);
+    REQUIRE(context.path_depth() == 3);
+    REQUIRE(std::string(context.path(0).member) == "flag");
+    REQUIRE(std::string(context.path(2).type) == "Outer");
+    REQUIRE(context.error_count() == 1);
+
+    std::array<char, 128> buffer = {};
+    fast_ber::format_error(context, buffer.data(), buffer.size());
+    REQUIRE(std::string(buffer.data()) == "missing member in Inner at Outer.middle > Middle.inner > Inner.flag");
+
+    // A new leaf error replaces the path
+    fast_ber::report_error(fast_ber::ErrorCode::invalid_packet, "Other");
+    REQUIRE(context.path_depth() == 0);
+
+    // Without a recorded error, a member failure starts one
+    context.clear();
+    fast_ber::report_error(fast_ber::ErrorCode::member_failed, "Outer", "middle");
+    REQUIRE(context.code() == fast_ber::ErrorCode::member_failed);
+    REQUIRE(context.path_depth() == 1);
+}
+
+TEST_CASE("Error: Path depth is bounded")
+{
+    fast_ber::ErrorContext context;
+    fast_ber::ErrorScope   scope(context);
+    const size_t           max_depth = fast_ber::ErrorContext::max_path_depth;
+
+    fast_ber::report_error(fast_ber::ErrorCode::invalid_member, "Leaf", "member");
+    for (size_t i = 0; i < 2 * max_depth; i++)
+    {
+        fast_ber::report_error(fast_ber::ErrorCode::member_failed, "Outer", "member");
+    }
+    REQUIRE(context.path_depth() == max_depth);
+    REQUIRE(std::string(context.path(0).type) == "Leaf");
+}
+
+TEST_CASE("Error: Format returns the full length")
+{
+    fast_ber::ErrorContext context;
+    fast_ber::ErrorScope   scope(context);
+
+    fast_ber::report_error(fast_ber::ErrorCode::unknown_choice, "Choice",
+                           fast_ber::RuntimeId(fast_ber::Class::private_, 1));
+
+    // As with snprintf, an empty buffer gives the length needed
+    const std::string expected = "unknown choice [Private 1] in Choice";
+    const size_t      length   = fast_ber::format_error(context, nullptr, 0);
+    REQUIRE(length == expected.length());
+
+    std::vector<char> buffer(length + 1);
+    REQUIRE(fast_ber::format_error(context, buffer.data(), buffer.size()) == length);
+    REQUIRE(std::string(buffer.data()) == expected);
+}
+
+TEST_CASE("Error: Scopes nest and restore")
+{
+    fast_ber::ErrorContext& thread_context = fast_ber::ErrorContext::current();
+    fast_ber::ErrorContext  outer;
+    fast_ber::ErrorContext  inner;
+    {
+        fast_ber::ErrorScope outer_scope(outer);
+        {
+            fast_ber::ErrorScope inner_scope(inner);
+            REQUIRE(&fast_ber::ErrorContext::current() == &inner);
+            fast_ber::report_error(fast_ber::ErrorCode::invalid_packet, "Inner");
+        }
+        REQUIRE(&fast_ber::ErrorContext::current() == &outer);
+    }
+    REQUIRE(&fast_ber::ErrorContext::current() == &thread_context);
+    REQUIRE(inner.error_count() == 1);
+    REQUIRE(outer.error_count() == 0);
+}
+
+TEST_CASE("Error: Sink is called for each report")
+{
+    fast_ber::ErrorContext context(counting_sink);
+    fast_ber::ErrorScope   scope(context);
+
+    sink_calls = 0;
+    fast_ber::report_error(fast_ber::ErrorCode::invalid_member, "Inner", "value");
+    fast_ber::report_error(fast_ber::ErrorCode::member_failed, "Outer", "inner");
+    REQUIRE(sink_calls == 2);
+
+    context.set_sink(nullptr);
+    fast_ber::report_error(fast_ber::ErrorCode::invalid_packet, "Outer");
+    REQUIRE(sink_calls == 2);
+}
+
+TEST_CASE("Error: Branch hints keep the value of the condition")
+{
+    // Conditions in the generated code contain template argument lists, so may hold unparenthesised commas
+    REQUIRE(FAST_BER_UNLIKELY(std::is_same<int, int>::value));
+    REQUIRE(!FAST_BER_UNLIKELY(std::is_same<int, bool>::value));
+    REQUIRE(FAST_BER_LIKELY(sink_calls >= 0));
+}
+
+#ifndef FAST_BER_DISABLE_ERRORS
+TEST_CASE("Error: Library types report decode failures")
+{
+    fast_ber::ErrorContext context;
+    fast_ber::ErrorScope   scope(context);
+
+    std::array<uint8_t, 3> integer_packet = {0x02, 0x01, 0x01};
+    std::array<uint8_t, 2> truncated      = {0x01, 0x05};
+    fast_ber::Boolean<>    boolean;
+
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(integer_packet), boolean).success);
+    REQUIRE(context.code() == fast_ber::ErrorCode::incorrect_header);
+    REQUIRE(std::string(context.type()) == "Boolean");
+    REQUIRE(context.identifier() == fast_ber::RuntimeId(fast_ber::UniversalTag::integer));
+
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(truncated), boolean).success);
+    REQUIRE(context.code() == fast_ber::ErrorCode::invalid_packet);
+
+    std::array<uint8_t, 12> long_integer = {0x02, 0x0A, 0x01};
+    fast_ber::Integer<>     integer;
+    REQUIRE(!fast_ber::decode(absl::MakeSpan(long_integer), integer).success);
+    REQUIRE(context.code() == fast_ber::ErrorCode::capacity_exceeded);
+    REQUIRE(context.error_count() == 3);
+}
+#endif
@@ -0,0 +1,298 @@
+#include "fast_ber/util/EncodeIdentifiers.hpp"
+#include "fast_ber/util/Extract.hpp"
+#include "fast_ber/util/HeaderCodec.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+// Byte at a time reference implementations, the word based codec must match these exactly
+namespace reference
+{
+
+size_t encode_tag(absl::Span<uint8_t> output, fast_ber::Tag tag)
+{
+    if (tag < 0 || output.length() == 0)
+    {
+        return 0;
+    }
+
+    if (tag <= 30)
+    {
+        output[0] = static_cast<uint8_t>(tag) | (output[0] & 0xE0);
+        return 1;
+    }
+
+    output[0] |= 0x1F;
+    for (size_t i = 1; i < output.size(); i++)
+    {
+        output[i] = static_cast<uint8_t>(tag % 0x80);
+        tag /= 0x80;
+
+        if (i != 1)
+        {
+            output[i] |= 0x80;
+        }
+
+        if (tag == 0)
+        {
+            std::reverse(output.data() + 1, output.data() + 1 + i);
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+size_t encode_length(absl::Span<uint8_t> output, uint64_t length)
+{
+    size_t length_length = 0;
+    while (length_length < 8 && (length >> (8 * length_length)) != 0)
+    {
+        length_length++;
+    }
+
+    if (length < 0x80)
+    {
+        if (output.length() == 0)
+        {
+            return 0;
+        }
+        output[0] = static_cast<uint8_t>(length);
+        return 1;
+    }
+
+    if (output.length() < length_length + 1)
+    {
+        return 0;
+    }
+
+    output[0] = static_cast<uint8_t>(0x80 | length_length);
+    for (size_t i = 0; i < length_length; i++)
+    {
+        output[length_length - i] = static_cast<uint8_t>(length >> (8 * i));
+    }
+    return length_length + 1;
+}
+
+size_t extract_tag(absl::Span<const uint8_t> input, fast_ber::Tag& tag)
+{
+    if (input.size() == 0)
+    {
+        return 0;
+    }
+
+    if ((input[0] & 0x1F) != 0x1F)
+    {
+        tag = static_cast<fast_ber::Tag>(input[0] & 0x1F);
+        return 1;
+    }
+
+    tag = 0;
+    for (size_t i = 1; i < input.length(); i++)
+    {
+        tag += (input[i] & 0x7F);
+        if ((input[i] & 0x80) == 0)
+        {
+            return i + 1;
+        }
+        tag *= 0x80;
+    }
+    return 0;
+}
+
+size_t extract_length(absl::Span<const uint8_t> input, size_t& length)
+{
+    if (input.size() == 0)
+    {
+        return 0;
+    }
+
+    if ((input[0] & 0x80) == 0)
+    {
+        length = input[0];
+        return 1;
+    }
+
+    const size_t length_length = input[0] & 0x7F;
+    if (length_length > 8 || length_length == 0 || length_length + 1 > input.length())
+    {
+        return 0;
+    }
+
+    length = 0;
+    for (size_t i = 1; i < length_length + 1; i++)
+    {
+        length *= 0x100;
+        length += input[i];
+    }
+    return length_length + 1;
+}
+
+} // namespace reference
+
+std::vector<uint64_t> test_values()
+{
+    std::vector<uint64_t> values;
+    for (uint64_t i = 0; i < 300; i++)
+    {
+        values.push_back(i);
+    }
+    for (size_t bit = 8; bit < 64; bit++)
+    {
+        const uint64_t power = uint64_t(1) << bit;
+        values.push_back(power - 1);
+        values.push_back(power);
+        values.push_back(power + 1);
+        values.push_back(power | (power >> 3) | 0x5A);
+    }
+    values.push_back(0xFFFFFFFFFFFFFFFFull);
+    return values;
+}
+
+TEST_CASE("HeaderCodec: Encoded lengths match encoders")
+{
+    std::array<uint8_t, 16> buffer = {};
+    for (uint64_t value : test_values())
+    {
+        REQUIRE(fast_ber::encoded_length_length(value) == reference::encode_length(absl::MakeSpan(buffer), value));
+
+        const fast_ber::Tag tag = static_cast<fast_ber::Tag>(value);
+        if (tag >= 0)
+        {
+            REQUIRE(fast_ber::encoded_tag_length(tag) == reference::encode_tag(absl::MakeSpan(buffer), tag));
+        }
+    }
+    REQUIRE(fast_ber::encoded_tag_length(fast_ber::Tag(-1)) == 0);
+}
+
+TEST_CASE("HeaderCodec: Encode matches reference")
+{
+    for (uint64_t value : test_values())
+    {
+        for (size_t buffer_length = 0; buffer_length <= 12; buffer_length++)
+        {
+            std::array<uint8_t, 12> expected = {};
+            std::array<uint8_t, 12> actual   = {};
+
+            size_t expected_length = reference::encode_length(absl::MakeSpan(expected.data(), buffer_length), value);
+            size_t actual_length   = fast_ber::encode_length(absl::MakeSpan(actual.data(), buffer_length), value);
+            REQUIRE(actual_length == expected_length);
+            REQUIRE(std::equal(actual.begin(), actual.begin() + actual_length, expected.begin()));
+
+            const fast_ber::Tag tag = static_cast<fast_ber::Tag>(value);
+            expected.fill(0xA0);
+            actual.fill(0xA0);
+            expected_length = reference::encode_tag(absl::MakeSpan(expected.data(), buffer_length), tag);
+            actual_length   = fast_ber::encode_tag(absl::MakeSpan(actual.data(), buffer_length), tag);
+            REQUIRE(actual_length == expected_length);
+            REQUIRE(std::equal(actual.begin(), actual.begin() + actual_length, expected.begin()));
+        }
+    }
+}
+
+TEST_CASE("HeaderCodec: Extract matches reference")
+{
+    for (uint64_t value : test_values())
+    {
+        std::array<uint8_t, 16> encoded = {};
+
+        const fast_ber::Tag tag        = static_cast<fast_ber::Tag>(value);
+        const size_t        tag_length = reference::encode_tag(absl::MakeSpan(encoded), tag);
+        for (size_t input_length = 0; input_length <= encoded.size(); input_length++)
+        {
+            fast_ber::Tag expected_tag = -1;
+            fast_ber::Tag actual_tag   = -1;
+            absl::Span<const uint8_t> input(encoded.data(), input_length);
+
+            const size_t expected_length = reference::extract_tag(input, expected_tag);
+            REQUIRE(fast_ber::extract_tag(input, actual_tag) == expected_length);
+            REQUIRE(actual_tag == expected_tag);
+            if (tag_length != 0 && input_length >= tag_length)
+            {
+                REQUIRE(expected_tag == tag);
+            }
+        }
+
+        encoded.fill(0xEE);
+        const size_t length_length = reference::encode_length(absl::MakeSpan(encoded), value);
+        for (size_t input_length = 0; input_length <= encoded.size(); input_length++)
+        {
+            size_t expected_value = 0;
+            size_t actual_value   = 0;
+            absl::Span<const uint8_t> input(encoded.data(), input_length);
+
+            const size_t expected_length = reference::extract_length(input, expected_value);
+            REQUIRE(fast_ber::extract_length(input, actual_value, 0) == expected_length);
+            REQUIRE(actual_value == expected_value);
+            if (input_length >= length_length)
+            {
+                REQUIRE(expected_value == value);
+            }
+        }
+    }
+}
+
+TEST_CASE("HeaderCodec: Malformed input matches reference")
+{
+    // Tags without a terminating byte, and length fields which are too long
+    std::array<uint8_t, 16> input = {};
+    for (uint8_t fill : {uint8_t(0x80), uint8_t(0xFF), uint8_t(0x89), uint8_t(0x88), uint8_t(0x00)})
+    {
+        input.fill(fill);
+        input[0] = 0x1F;
+        for (size_t input_length = 1; input_length <= input.size(); input_length++)
+        {
+            fast_ber::Tag expected_tag = -1;
+            fast_ber::Tag actual_tag   = -1;
+            size_t        expected_len = 0;
+            size_t        actual_len   = 0;
+            absl::Span<const uint8_t> span(input.data(), input_length);
+
+            // Unterminated tags longer than this overflow the tag type
+            if (input_length <= 9)
+            {
+                REQUIRE(fast_ber::extract_tag(span, actual_tag) == reference::extract_tag(span, expected_tag));
+                REQUIRE(actual_tag == expected_tag);
+            }
+            REQUIRE(fast_ber::extract_length(span, actual_len, 1) ==
+                    reference::extract_length(span.subspan(1), expected_len));
+            REQUIRE(actual_len == expected_len);
+        }
+    }
+}
+
+TEST_CASE("HeaderCodec: Short header")
+{
+    const std::array<uint8_t, 3> short_header = {0xA5, 0x7F, 0x00};
+    const std::array<uint8_t, 3> long_tag     = {0x1F, 0x1F, 0x00};
+    const std::array<uint8_t, 3> long_length  = {0x05, 0x81, 0x80};
+
+    fast_ber::Tag tag    = 0;
+    size_t        length = 0;
+    REQUIRE(fast_ber::extract_short_header(short_header, tag, length) == 2);
+    REQUIRE(tag == 5);
+    REQUIRE(length == 0x7F);
+    REQUIRE(fast_ber::extract_short_header(absl::MakeSpan(short_header.data(), 1), tag, length) == 0);
+    REQUIRE(fast_ber::extract_short_header(long_tag, tag, length) == 0);
+    REQUIRE(fast_ber::extract_short_header(long_length, tag, length) == 0);
+}
+
+TEST_CASE("HeaderCodec: Encode header")
+{
+    std::array<uint8_t, 16> buffer = {};
+    REQUIRE(fast_ber::encode_header(absl::MakeSpan(buffer), fast_ber::Construction::constructed,
+                                    fast_ber::Class::context_specific, 5, 0x10) == 2);
+    REQUIRE(buffer[0] == 0xA5);
+    REQUIRE(buffer[1] == 0x10);
+
+    REQUIRE(fast_ber::encode_header(absl::MakeSpan(buffer), fast_ber::Construction::primitive,
+                                    fast_ber::Class::private_, 200, 0x1234) == 6);
+    REQUIRE(buffer[0] == 0xDF);
+    REQUIRE(buffer[1] == 0x81);
+    REQUIRE(buffer[2] == 0x48);
+    REQUIRE(buffer[3] == 0x82);
+    REQUIRE(buffer[4] == 0x12);
+    REQUIRE(buffer[5] == 0x34);
+}
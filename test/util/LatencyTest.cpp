@@ -0,0 +1,122 @@
+#include "fast_ber/util/Latency.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Histogram of a type in the snapshot, empty if not present
+fast_ber::LatencyHistogram find_histogram(fast_ber::CounterOperation operation, const char* type)
+{
+    for (const fast_ber::LatencyEntry& entry : fast_ber::latency_snapshot())
+    {
+        if (entry.operation == operation && std::strcmp(entry.type, type) == 0)
+        {
+            return entry.histogram;
+        }
+    }
+    return fast_ber::LatencyHistogram{};
+}
+} // namespace
+
+TEST_CASE("Latency: Buckets cover every value")
+{
+    using Histogram           = fast_ber::LatencyHistogram;
+    const size_t bucket_count = Histogram::bucket_count;
+
+    for (uint64_t value : {0ull, 1ull, 15ull, 16ull, 17ull, 31ull, 32ull, 1000ull, 123456789ull, 1ull << 40, ~0ull})
+    {
+        const size_t bucket = Histogram::bucket(value);
+        REQUIRE(bucket < bucket_count);
+        REQUIRE(Histogram::lower_bound(bucket) <= value);
+        REQUIRE(Histogram::upper_bound(bucket) >= value);
+    }
+    for (size_t bucket = 1; bucket < bucket_count; bucket++)
+    {
+        REQUIRE(Histogram::lower_bound(bucket) == Histogram::upper_bound(bucket - 1) + 1);
+        REQUIRE(Histogram::bucket(Histogram::lower_bound(bucket)) == bucket);
+    }
+    REQUIRE(Histogram::bucket(~0ull) == bucket_count - 1);
+
+    // Small values are exact, larger ones within 1/16
+    REQUIRE(Histogram::upper_bound(Histogram::bucket(7)) == 7);
+    REQUIRE(Histogram::upper_bound(Histogram::bucket(1000)) - Histogram::lower_bound(Histogram::bucket(1000)) < 64);
+}
+
+TEST_CASE("Latency: Percentiles and merging")
+{
+    fast_ber::LatencyHistogram histogram;
+    REQUIRE(histogram.percentile(0.5) == 0);
+
+    for (uint64_t i = 1; i <= 99; i++)
+    {
+        histogram.record(10);
+    }
+    histogram.record(100000);
+    REQUIRE(histogram.count() == 100);
+    REQUIRE(histogram.percentile(0.5) == 10);
+    REQUIRE(histogram.percentile(0.99) == 10);
+    REQUIRE(histogram.percentile(1.0) >= 100000);
+    REQUIRE(histogram.mean() == (99 * 10 + 100000) / 100);
+
+    fast_ber::LatencyHistogram other;
+    for (uint64_t i = 1; i <= 100; i++)
+    {
+        other.record(100000);
+    }
+    histogram.merge(other);
+    REQUIRE(histogram.count() == 200);
+    REQUIRE(histogram.percentile(0.45) == 10);
+    REQUIRE(histogram.percentile(0.75) >= 100000);
+}
+
+TEST_CASE("Latency: Timers sample one in every period calls")
+{
+    static const fast_ber::LatencySite site(fast_ber::CounterOperation::decode, "LatencyTest.Sampled");
+
+    fast_ber::set_latency_sample_period(1);
+    REQUIRE(fast_ber::latency_sample_period() == 1);
+    {
+        // Sampled, restarting the count of calls on this thread
+        const fast_ber::LatencyTimer timer(site);
+    }
+    fast_ber::set_latency_sample_period(10);
+    for (int i = 0; i < 100; i++)
+    {
+        const fast_ber::LatencyTimer timer(site);
+    }
+    REQUIRE(find_histogram(fast_ber::CounterOperation::decode, "LatencyTest.Sampled").count() == 11);
+
+    fast_ber::set_latency_sample_period(0);
+    REQUIRE(fast_ber::latency_sample_period() == 1);
+    fast_ber::set_latency_sample_period(1024);
+}
+
+TEST_CASE("Latency: Histograms of exited threads are kept")
+{
+    static const fast_ber::LatencySite site(fast_ber::CounterOperation::encode, "LatencyTest.Threads");
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([] {
+            for (uint64_t j = 0; j < 100; j++)
+            {
+                fast_ber::record_latency(site, j);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    fast_ber::record_latency(site, 5);
+
+    const fast_ber::LatencyHistogram histogram =
+        find_histogram(fast_ber::CounterOperation::encode, "LatencyTest.Threads");
+    REQUIRE(histogram.count() == 401);
+    REQUIRE(histogram.total_nanoseconds() == 4 * 4950 + 5);
+}
@@ -0,0 +1,139 @@
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/MappedFile.hpp"
+#include "fast_ber/util/ParallelDecoder.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+// Back to back encoded integers, with values equal to their index
+std::vector<uint8_t> integer_records(int64_t count)
+{
+    std::vector<uint8_t> records(static_cast<size_t>(count) * 10);
+    size_t               offset = 0;
+    for (int64_t i = 0; i < count; i++)
+    {
+        const fast_ber::EncodeResult res =
+            fast_ber::encode(absl::MakeSpan(records.data() + offset, records.size() - offset), fast_ber::Integer<>(i));
+        REQUIRE(res.success);
+        offset += res.length;
+    }
+    records.resize(offset);
+    return records;
+}
+
+TEST_CASE("ParallelDecoder: Records are output in order")
+{
+    const std::vector<uint8_t> records = integer_records(100000);
+
+    for (size_t threads : {1, 2, 7})
+    {
+        fast_ber::ParallelDecoder<fast_ber::Integer<>> decoder(threads, 100);
+        REQUIRE(decoder.threads() == threads);
+
+        int64_t                              expected = 0;
+        bool                                 in_order = true;
+        const fast_ber::ParallelDecodeResult result =
+            decoder.decode(records, [&](const fast_ber::Integer<>& value) { in_order &= value == expected++; });
+
+        REQUIRE(result.success);
+        REQUIRE(result.records == 100000);
+        REQUIRE(in_order);
+
+        // The decoder can be reused
+        REQUIRE(decoder.decode(records, [](const fast_ber::Integer<>&) {}).records == 100000);
+    }
+}
+
+TEST_CASE("ParallelDecoder: Empty input")
+{
+    fast_ber::ParallelDecoder<fast_ber::Integer<>> decoder(2);
+    const fast_ber::ParallelDecodeResult           result =
+        decoder.decode(absl::Span<const uint8_t>(), [](const fast_ber::Integer<>&) { REQUIRE(false); });
+    REQUIRE(result.success);
+    REQUIRE(result.records == 0);
+}
+
+TEST_CASE("ParallelDecoder: Decoding stops at invalid record")
+{
+    std::vector<uint8_t> records = integer_records(1000);
+
+    // Record 500 is given an octet string identifier, records before it are output
+    const size_t invalid_offset = 3 * 128 + 4 * (500 - 128);
+    REQUIRE(records[invalid_offset] == 0x02);
+    records[invalid_offset] = 0x04;
+
+    fast_ber::ParallelDecoder<fast_ber::Integer<>> decoder(3, 16);
+    int64_t                                        expected = 0;
+    fast_ber::ParallelDecodeResult                 result =
+        decoder.decode(records, [&](const fast_ber::Integer<>& value) { REQUIRE(value == expected++); });
+    REQUIRE(!result.success);
+    REQUIRE(result.records == 500);
+    REQUIRE(result.error_offset == invalid_offset);
+
+    // Truncated final record
+    records = integer_records(1000);
+    records.pop_back();
+    result = decoder.decode(records, [](const fast_ber::Integer<>&) {});
+    REQUIRE(!result.success);
+    REQUIRE(result.records == 999);
+    REQUIRE(result.error_offset == records.size() - 3);
+}
+
+TEST_CASE("ParallelDecoder: Output throwing")
+{
+    const std::vector<uint8_t> records = integer_records(10000);
+
+    fast_ber::ParallelDecoder<fast_ber::Integer<>> decoder(4, 16);
+    size_t                                         output = 0;
+    REQUIRE_THROWS_AS(decoder.decode(records,
+                                     [&](const fast_ber::Integer<>&) {
+                                         if (++output == 100)
+                                         {
+                                             throw std::runtime_error("Output failed");
+                                         }
+                                     }),
+                      std::runtime_error);
+    REQUIRE(output == 100);
+
+    // Batches decoded before the exception are not output by the next decode
+    int64_t                              expected = 0;
+    bool                                 in_order = true;
+    const fast_ber::ParallelDecodeResult result =
+        decoder.decode(records, [&](const fast_ber::Integer<>& value) { in_order &= value == expected++; });
+    REQUIRE(result.success);
+    REQUIRE(result.records == 10000);
+    REQUIRE(in_order);
+}
+
+TEST_CASE("MappedFile: Read file contents")
+{
+    const std::vector<uint8_t> records = integer_records(1000);
+    const std::string          path    = "mapped_file_test.ber";
+    {
+        std::ofstream output(path, std::ios::binary);
+        output.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size()));
+    }
+
+    fast_ber::MappedFile file(path);
+    REQUIRE(file.is_open());
+    REQUIRE(file.size() == records.size());
+    REQUIRE(file.data() == absl::MakeConstSpan(records));
+
+    fast_ber::ParallelDecoder<fast_ber::Integer<>> decoder(2);
+    REQUIRE(decoder.decode(file.data(), [](const fast_ber::Integer<>&) {}).records == 1000);
+
+    fast_ber::MappedFile moved = std::move(file);
+    REQUIRE(!file.is_open());
+    REQUIRE(moved.size() == records.size());
+    moved.close();
+    REQUIRE(!moved.is_open());
+    REQUIRE(moved.data().empty());
+
+    REQUIRE(!fast_ber::MappedFile("no_such_file.ber").is_open());
+    std::remove(path.c_str());
+}